@@ -13,12 +13,16 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251 4996)
 
 #include "./api/ApiModule.hpp"
 #include "./auth/AuthToken.hpp"
+#include "./candlewebservice/FileHistoryCache.hpp"
+#include "./candlewebservice/HistoryBulkLoader.hpp"
+#include "./candlewebservice/HistoryCache.hpp"
 #include "./candlewebservice/HistoryEndpoint.hpp"
 #include "./entity/EntityModule.hpp"
 #include "./event/EventModule.hpp"
 #include "./exceptions/ExceptionsModule.hpp"
 #include "./executors/InPlaceExecutor.hpp"
 #include "./glossary/GlossaryModule.hpp"
+#include "./internal/AtomicSharedPtr.hpp"
 #include "./internal/CEntryPointErrors.hpp"
 #include "./internal/Common.hpp"
 #include "./internal/Enum.hpp"
@@ -28,6 +32,7 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251 4996)
 #include "./internal/Isolate.hpp"
 #include "./internal/JavaObjectHandle.hpp"
 #include "./internal/Metrics.hpp"
+#include "./internal/NativeTimeFormat.hpp"
 #include "./internal/NonCopyable.hpp"
 #include "./internal/Platform.hpp"
 #include "./internal/RawListWrapper.hpp"
@@ -39,14 +44,26 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251 4996)
 #include "./internal/managers/ErrorHandlingManager.hpp"
 #include "./internal/utils/CmdArgsUtils.hpp"
 #include "./internal/utils/EnumUtils.hpp"
+#include "./internal/utils/Inflater.hpp"
+#include "./internal/utils/MappedFile.hpp"
+#include "./internal/utils/ParallelUtils.hpp"
 #include "./internal/utils/StringUtils.hpp"
 #include "./internal/utils/debug/Debug.hpp"
 #include "./ipf/IpfModule.hpp"
 #include "./logging/Logging.hpp"
+#include "./model/CandleAggregator.hpp"
 #include "./model/IndexedTxModel.hpp"
+#include "./model/MarketByOrderBook.hpp"
+#include "./model/MarketByOrderModel.hpp"
+#include "./model/MarketDepthAnalytics.hpp"
 #include "./model/MarketDepthModel.hpp"
 #include "./model/MarketDepthModelListener.hpp"
+#include "./model/NativeIndexedTxModel.hpp"
+#include "./model/OptionChainAnalytics.hpp"
+#include "./model/OptionGreeksCalculator.hpp"
+#include "./model/TimeSeriesStore.hpp"
 #include "./model/TimeSeriesTxModel.hpp"
+#include "./model/TxEventProcessor.hpp"
 #include "./model/TxModelListener.hpp"
 #include "./ondemand/OnDemandService.hpp"
 #include "./promise/Promise.hpp"
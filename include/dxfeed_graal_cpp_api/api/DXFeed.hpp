@@ -14,6 +14,7 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
 #include "../internal/managers/EntityManager.hpp"
 #include "../promise/Promise.hpp"
 #include "./DXFeedSubscription.hpp"
+#include "./TimeSeriesStream.hpp"
 
 #include <memory>
 
@@ -141,6 +142,11 @@ struct DXFCPP_EXPORT DXFeed : SharedEntity {
     void *getTimeSeriesPromiseImpl(const EventTypeEnum &eventType, const SymbolWrapper &symbol, std::int64_t fromTime,
                                    std::int64_t toTime) const;
 
+    std::shared_ptr<TimeSeriesStream> getTimeSeriesStreamImpl(const EventTypeEnum &eventType,
+                                                              const SymbolWrapper &symbol, std::int64_t fromTime,
+                                                              std::int64_t toTime,
+                                                              const TimeSeriesStream::Options &options) const;
+
     std::shared_ptr<EventType> getLastEventIfSubscribedImpl(const EventTypeEnum &eventType,
                                                             const SymbolWrapper &symbol) const;
 
@@ -888,6 +894,33 @@ struct DXFCPP_EXPORT DXFeed : SharedEntity {
             getTimeSeriesPromiseImpl(E::TYPE, symbol, fromTime, toTime));
     }
 
+    /**
+     * Requests time series of events for the specified event type, symbol and a range of time by chunks.
+     *
+     * <p>The range is split into chunks of TimeSeriesStream::Options::chunkDuration, and each chunk is requested like
+     * with @ref DXFeed::getTimeSeriesPromise() "getTimeSeriesPromise". The returned stream delivers the chunks in time
+     * order while the rest of the range is being requested, so the peak memory usage is limited to
+     * TimeSeriesStream::Options::prefetch chunks instead of the whole result. The stream can be cancelled from any
+     * thread. See TimeSeriesStream for details.
+     *
+     * <p>The restrictions of @ref DXFeed::getTimeSeriesPromise() "getTimeSeriesPromise" apply to each chunk.
+     *
+     * @tparam E The type of event.
+     * @param symbol The symbol.
+     * @param fromTime The time, inclusive, to request events from (see TimeSeriesEvent::getTime()).
+     * @param toTime The time, inclusive, to request events to (see TimeSeriesEvent::getTime()).
+     *               Use `std::numeric_limits<std::int64_t>::max()` or `LLONG_MAX` macro to retrieve events without an
+     *               upper limit on time.
+     * @param options The options of the stream.
+     * @return The stream of the chunks.
+     */
+    template <Derived<TimeSeriesEvent> E>
+    std::shared_ptr<TimeSeriesStream> getTimeSeriesStream(const SymbolWrapper &symbol, std::int64_t fromTime,
+                                                          std::int64_t toTime,
+                                                          const TimeSeriesStream::Options &options = {}) const {
+        return getTimeSeriesStreamImpl(E::TYPE, symbol, fromTime, toTime, options);
+    }
+
     /**
      * Returns time series of events for the specified event type, symbol and a range of time if there is a
      * subscription for it. This method <b>does not</b> make any remote calls to the uplink data provider. It just
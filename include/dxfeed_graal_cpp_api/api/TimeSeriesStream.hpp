@@ -0,0 +1,194 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../entity/SharedEntity.hpp"
+#include "../event/EventType.hpp"
+#include "../event/TimeSeriesEvent.hpp"
+#include "../internal/Common.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_api
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The stream of the time series events that are delivered by chunks.
+ *
+ * <p>The time range is split into chunks of Options::chunkDuration, and a separate request is made for each chunk.
+ * The chunks are returned by ::next() in time order, so the events can be processed (aggregated, written to disk,
+ * etc.) while the rest of the range is being downloaded, and only the chunks in progress are kept in memory.
+ *
+ * <p>The stream is pulled by the consumer, which provides the backpressure: no more than Options::prefetch requests
+ * are made ahead of the chunk that is being consumed. The stream can be @ref ::cancel() "cancelled" from any
+ * thread; the pending requests are cancelled, and ::next() returns `std::nullopt`.
+ *
+ * <p>If the end of the range is later than the current time, the range from the current time to the end is requested
+ * as the last chunk.
+ *
+ * ```cpp
+ * auto stream = feed->getTimeSeriesStream<TimeAndSale>("AAPL", from, to, {.chunkDuration = 60'000, .prefetch = 4});
+ *
+ * while (auto chunk = stream->nextAs<TimeAndSale>()) {
+ *     writer.write(*chunk);
+ * }
+ * ```
+ *
+ * The streams are created by DXFeed::getTimeSeriesStream().
+ */
+struct DXFCPP_EXPORT TimeSeriesStream final : RequireMakeShared<TimeSeriesStream> {
+    /**
+     * The options of the stream.
+     */
+    struct Options {
+        /// The duration of a chunk in milliseconds. `0` means that the range is requested as a single chunk.
+        std::int64_t chunkDuration = 3'600'000LL;
+
+        /// The number of the chunks that are requested ahead of the consumed one (at least 1).
+        std::size_t prefetch = 2;
+    };
+
+    /**
+     * The pending request of a chunk.
+     */
+    struct DXFCPP_EXPORT Request {
+        virtual ~Request() noexcept = default;
+
+        /**
+         * Waits for the request to complete.
+         *
+         * @return The events of the chunk ordered by time.
+         */
+        virtual std::vector<std::shared_ptr<EventType>> await() = 0;
+
+        /**
+         * Cancels the request. The waiters of ::await() are released with an exception.
+         */
+        virtual void cancel() = 0;
+    };
+
+    /**
+     * The function that starts the request of the events in the time range [from, to].
+     */
+    using Requester = std::function<std::unique_ptr<Request>(std::int64_t /* from */, std::int64_t /* to */)>;
+
+    private:
+    Requester requester_;
+    std::int64_t chunkDuration_;
+    std::size_t prefetch_;
+    std::int64_t nextFrom_;
+    std::int64_t to_;
+    std::int64_t splitTo_;
+    bool requestedAll_;
+
+    mutable std::mutex mtx_{};
+    std::deque<std::shared_ptr<Request>> requests_{};
+    std::shared_ptr<Request> current_{};
+    bool cancelled_ = false;
+
+    // Must be called with the locked mutex.
+    void requestChunks();
+
+    public:
+    TimeSeriesStream(LockExternalConstructionTag, std::int64_t from, std::int64_t to, Requester requester,
+                     const Options &options);
+
+    /**
+     * Cancels the pending requests.
+     */
+    ~TimeSeriesStream() noexcept override;
+
+    /**
+     * Creates the stream of the events in the time range [from, to] and starts the first requests.
+     *
+     * @param from The start of the time range in milliseconds since epoch.
+     * @param to The end of the time range in milliseconds since epoch.
+     * @param requester The function that requests a chunk.
+     * @param options The options of the stream.
+     * @return The stream.
+     */
+    static std::shared_ptr<TimeSeriesStream> create(std::int64_t from, std::int64_t to, Requester requester,
+                                                    const Options &options);
+
+    /**
+     * Creates the stream of the events in the time range [from, to] with the default options.
+     *
+     * @param from The start of the time range in milliseconds since epoch.
+     * @param to The end of the time range in milliseconds since epoch.
+     * @param requester The function that requests a chunk.
+     * @return The stream.
+     */
+    static std::shared_ptr<TimeSeriesStream> create(std::int64_t from, std::int64_t to, Requester requester);
+
+    /**
+     * @return `true` if the stream has more chunks and is not cancelled.
+     */
+    bool hasNext() const;
+
+    /**
+     * Waits for the next chunk and returns it. The next requests are started before the wait.
+     *
+     * @return The events of the next chunk ordered by time, or `std::nullopt` if there are no more chunks or the stream
+     * is cancelled.
+     * @throws JavaException (or the exception of the request) if the request of the chunk has failed.
+     */
+    std::optional<std::vector<std::shared_ptr<EventType>>> next();
+
+    /**
+     * Waits for the next chunk and returns it converted to the event type.
+     *
+     * @tparam E The type of the events.
+     * @return The events of the next chunk ordered by time, or `std::nullopt` if there are no more chunks or the stream
+     * is cancelled.
+     */
+    template <Derived<TimeSeriesEvent> E> std::optional<std::vector<std::shared_ptr<E>>> nextAs() {
+        auto chunk = next();
+
+        if (!chunk) {
+            return std::nullopt;
+        }
+
+        return convertEvents<EventType, E>(*chunk);
+    }
+
+    /**
+     * Passes the chunks to the consumer until the stream ends. If the consumer returns `false`, the stream is
+     * cancelled.
+     *
+     * @param consumer The function that consumes a chunk and returns `true` to continue.
+     * @return The number of the consumed chunks.
+     */
+    std::size_t forEach(const std::function<bool(std::vector<std::shared_ptr<EventType>>)> &consumer);
+
+    /**
+     * Cancels the stream and the pending requests. This method can be called from any thread.
+     */
+    void cancel();
+
+    /**
+     * @return `true` if the stream is cancelled.
+     */
+    bool isCancelled() const;
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
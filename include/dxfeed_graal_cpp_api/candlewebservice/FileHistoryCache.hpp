@@ -0,0 +1,124 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../entity/SharedEntity.hpp"
+#include "../internal/utils/StringUtils.hpp"
+#include "./HistoryCache.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * \addtogroup dxfcpp_cws
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The persistent on-disk HistoryCache of the Candle time series.
+ *
+ * <p>The cache keeps a file per symbol in the directory: the time ranges that have been downloaded and the candles of
+ * these ranges. The overlapping and adjacent ranges are merged, and only the gaps of a request that are not covered
+ * by the cached ranges are downloaded. The candles that are still being built are not covered by the cached ranges, so
+ * they are downloaded again: for the time periods, the candles whose period ends after the current time; for the tick,
+ * volume and price candles, whose end is unknown, the last downloaded candle of a range.
+ *
+ * <p>The file names escape the upper-case letters, so the symbols that differ only in case have different files on the
+ * case-insensitive file systems too.
+ *
+ * <p>The candles are stored in columns. The indices are delta-encoded, the double values are XOR-ed with the previous
+ * value of the column. The results are written as variable-length integers, so a typical file is several times
+ * smaller than the raw candle records.
+ *
+ * <p>A downloaded gap replaces the candles that the cache has kept in its time range, so the candles that are removed
+ * by the service (the events with EventFlag::REMOVE_EVENT or the missing ones) are removed from the cache too.
+ *
+ * <p>Only the Candle events are cached. The events of the other types are not cached: the requests are passed to the
+ * fetcher.
+ *
+ * <p>This class is thread-safe. The requests for different symbols are served concurrently; the file of a symbol is
+ * locked while it is being read or updated. The files are replaced atomically.
+ */
+struct DXFCPP_EXPORT FileHistoryCache final : HistoryCache, RequireMakeShared<FileHistoryCache> {
+    /**
+     * The statistics of the cache.
+     */
+    struct Stats {
+        /// The number of the requests that were served without downloads.
+        std::uint64_t hits{};
+        /// The number of the requests that required downloads.
+        std::uint64_t misses{};
+        /// The number of the downloaded ranges.
+        std::uint64_t fetches{};
+        /// The number of the downloaded events.
+        std::uint64_t fetchedEvents{};
+
+        std::string toString() const;
+    };
+
+    private:
+    std::string directory_{};
+    mutable std::mutex mtx_{};
+    std::unordered_map<std::string, std::shared_ptr<std::mutex>, StringHash, std::equal_to<>> fileLocks_{};
+    Stats stats_{};
+
+    std::shared_ptr<std::mutex> getFileLock(const std::string &path);
+
+    public:
+    FileHistoryCache(LockExternalConstructionTag, std::string directory);
+
+    ~FileHistoryCache() noexcept override;
+
+    /**
+     * Creates the cache in the directory. The directory is created if it doesn't exist.
+     *
+     * @param directory The path of the directory.
+     * @return The cache.
+     * @throws InvalidArgumentException if the directory cannot be created.
+     */
+    static std::shared_ptr<FileHistoryCache> create(const StringLike &directory);
+
+    /**
+     * @return The path of the directory of the cache.
+     */
+    const std::string &getDirectory() const & noexcept;
+
+    /**
+     * Returns the path of the file of the symbol in the cache.
+     *
+     * @param eventType The type of the events.
+     * @param symbol The symbol.
+     * @return The path of the file.
+     */
+    std::string getFilePath(const EventTypeEnum &eventType, const StringLike &symbol) const;
+
+    /**
+     * @return The statistics of the cache.
+     */
+    Stats getStats() const;
+
+    /**
+     * Removes all the files of the cache.
+     */
+    void clear();
+
+    std::vector<std::shared_ptr<EventType>> getTimeSeries(const EventTypeEnum &eventType, const SymbolWrapper &symbol,
+                                                          std::int64_t from, std::int64_t to,
+                                                          const Fetcher &fetcher) override;
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
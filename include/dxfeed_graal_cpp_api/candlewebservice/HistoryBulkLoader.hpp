@@ -0,0 +1,104 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../event/EventType.hpp"
+#include "../symbols/SymbolWrapper.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_cws
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The parallel loader of the time series of many symbols.
+ *
+ * <p>The time range of each symbol is split into chunks, and the chunks are downloaded by a bounded number of threads.
+ * The chunks are passed to the consumer as soon as they are downloaded, in time order for each symbol: a chunk is
+ * delayed until all the previous chunks of its symbol are consumed. The chunks of different symbols can be consumed
+ * concurrently, so the consumer must be thread-safe, but the chunks of one symbol are never consumed concurrently.
+ *
+ * <p>The number of the chunks that are downloaded or wait for the consumer is limited by Options::window, so the memory
+ * usage doesn't depend on the number of symbols and the length of the range.
+ *
+ * <p>The loader is used by HistoryEndpoint::getTimeSeries(const std::vector<SymbolWrapper> &, std::int64_t,
+ * std::int64_t, const std::function<void(const SymbolWrapper &, std::vector<std::shared_ptr<E>>, bool)> &, const
+ * HistoryBulkLoader::Options &).
+ */
+struct DXFCPP_EXPORT HistoryBulkLoader final {
+    /**
+     * The options of the loading.
+     */
+    struct Options {
+        /// The duration of a chunk in milliseconds. `0` means that the range of a symbol is not split.
+        std::int64_t chunkDuration = 0;
+
+        /// The number of the threads (including the calling thread). `0` means the number of the logical cores.
+        std::size_t parallelism = 4;
+
+        /// The maximal number of the chunks in progress. `0` means `2 * parallelism`.
+        std::size_t window = 0;
+    };
+
+    /**
+     * The function that downloads the events of the symbol in the time range [from, to] ordered by time.
+     */
+    using Fetcher = std::function<std::vector<std::shared_ptr<EventType>>(const SymbolWrapper & /* symbol */,
+                                                                          std::int64_t /* from */,
+                                                                          std::int64_t /* to */)>;
+
+    /**
+     * The function that consumes a chunk of the events of the symbol. `isLast` is `true` for the last chunk of the
+     * symbol.
+     */
+    using Consumer = std::function<void(const SymbolWrapper & /* symbol */,
+                                        std::vector<std::shared_ptr<EventType>> /* events */, bool /* isLast */)>;
+
+    /**
+     * Loads the time series of the symbols in the time range [from, to] and passes them to the consumer by chunks.
+     * The method returns when all the chunks are consumed.
+     *
+     * <p>If the fetcher or the consumer throws an exception, no new chunks are started, and the first exception is
+     * rethrown after the chunks in progress are completed.
+     *
+     * @param symbols The symbols.
+     * @param from The start of the time range in milliseconds since epoch.
+     * @param to The end of the time range in milliseconds since epoch.
+     * @param fetcher The function that downloads a chunk.
+     * @param consumer The function that consumes a chunk.
+     * @param options The options.
+     */
+    static void load(const std::vector<SymbolWrapper> &symbols, std::int64_t from, std::int64_t to,
+                     const Fetcher &fetcher, const Consumer &consumer, const Options &options);
+
+    /**
+     * Loads the time series of the symbols in the time range [from, to] with the default options.
+     *
+     * @param symbols The symbols.
+     * @param from The start of the time range in milliseconds since epoch.
+     * @param to The end of the time range in milliseconds since epoch.
+     * @param fetcher The function that downloads a chunk.
+     * @param consumer The function that consumes a chunk.
+     */
+    static void load(const std::vector<SymbolWrapper> &symbols, std::int64_t from, std::int64_t to,
+                     const Fetcher &fetcher, const Consumer &consumer);
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
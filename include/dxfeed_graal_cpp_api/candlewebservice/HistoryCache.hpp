@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../event/EventType.hpp"
+#include "../event/EventTypeEnum.hpp"
+#include "../symbols/SymbolWrapper.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_cws
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The cache of the time series that are downloaded by HistoryEndpoint.
+ *
+ * <p>The cache is attached to the endpoint with HistoryEndpoint::Builder::withCache(). For each request, the endpoint
+ * passes the fetcher that downloads the events of a time range from the candle web service, and the cache decides
+ * which ranges it has to download. See FileHistoryCache for the persistent implementation.
+ *
+ * <p>An implementation can cache only some of the types and pass the requests of the other types to the fetcher:
+ * FileHistoryCache caches only the Candle events.
+ *
+ * <p>The implementations must be thread-safe.
+ */
+struct DXFCPP_EXPORT HistoryCache {
+    /**
+     * The function that downloads the events in the time range [from, to] (in milliseconds since epoch).
+     */
+    using Fetcher =
+        std::function<std::vector<std::shared_ptr<EventType>>(std::int64_t /* from */, std::int64_t /* to */)>;
+
+    virtual ~HistoryCache() noexcept = default;
+
+    /**
+     * Returns the time series events of the type and the symbol in the time range [from, to] ordered by time.
+     *
+     * @param eventType The type of the events.
+     * @param symbol The symbol.
+     * @param from The start of the time range in milliseconds since epoch.
+     * @param to The end of the time range in milliseconds since epoch.
+     * @param fetcher The function that downloads the events that are not in the cache.
+     * @return The events.
+     */
+    virtual std::vector<std::shared_ptr<EventType>> getTimeSeries(const EventTypeEnum &eventType,
+                                                                  const SymbolWrapper &symbol, std::int64_t from,
+                                                                  std::int64_t to, const Fetcher &fetcher) = 0;
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
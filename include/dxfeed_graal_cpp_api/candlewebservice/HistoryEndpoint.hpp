@@ -15,7 +15,10 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
 #include "../internal/Common.hpp"
 #include "../internal/JavaObjectHandle.hpp"
 #include "../symbols/SymbolWrapper.hpp"
+#include "./HistoryBulkLoader.hpp"
+#include "./HistoryCache.hpp"
 
+#include <functional>
 #include <memory>
 
 /**
@@ -92,11 +95,16 @@ struct DXFCPP_EXPORT HistoryEndpoint final : RequireMakeShared<HistoryEndpoint>
 
     private:
     JavaObjectHandle<HistoryEndpoint> handle_;
+    std::shared_ptr<HistoryCache> cache_{};
 
     std::vector<std::shared_ptr<EventType>> getTimeSeriesImpl(const EventTypeEnum &eventType,
                                                               const SymbolWrapper &symbol, std::int64_t from,
                                                               std::int64_t to) const;
 
+    void getTimeSeriesImpl(const EventTypeEnum &eventType, const std::vector<SymbolWrapper> &symbols,
+                           std::int64_t from, std::int64_t to, const HistoryBulkLoader::Consumer &consumer,
+                           const HistoryBulkLoader::Options &options) const;
+
     public:
     explicit HistoryEndpoint(RequireMakeShared<HistoryEndpoint>::LockExternalConstructionTag,
                              JavaObjectHandle<HistoryEndpoint> &&handle);
@@ -114,6 +122,7 @@ struct DXFCPP_EXPORT HistoryEndpoint final : RequireMakeShared<HistoryEndpoint>
         friend HistoryEndpoint;
 
         JavaObjectHandle<Builder> handle_;
+        std::shared_ptr<HistoryCache> cache_{};
 
         public:
         explicit Builder(RequireMakeShared<Builder>::LockExternalConstructionTag, JavaObjectHandle<Builder> &&handle);
@@ -177,6 +186,22 @@ struct DXFCPP_EXPORT HistoryEndpoint final : RequireMakeShared<HistoryEndpoint>
          */
         std::shared_ptr<Builder> withFormat(Format format);
 
+        /**
+         * Sets the cache of the time series. The requests of the endpoint are served by the cache, and only the time
+         * ranges that are not in the cache are downloaded. See FileHistoryCache.
+         *
+         * ```cpp
+         * const auto endpoint = HistoryEndpoint::newBuilder()
+         *         ->withAddress(candleDataUrl)
+         *         ->withCache(FileHistoryCache::create("history-cache"))
+         *         ->build();
+         * ```
+         *
+         * @param cache The cache or `nullptr` to disable caching (the default).
+         * @return The Builder instance with the updated cache value.
+         */
+        std::shared_ptr<Builder> withCache(std::shared_ptr<HistoryCache> cache);
+
         /**
          * Builds and returns a configured instance of HistoryEndpoint.
          * <p>
@@ -202,6 +227,53 @@ struct DXFCPP_EXPORT HistoryEndpoint final : RequireMakeShared<HistoryEndpoint>
         return convertEvents<EventType, E>(getTimeSeriesImpl(E::TYPE, symbol, from, to));
     }
 
+    /**
+     * The consumer of the chunks of the time series: the symbol, the events of the chunk and whether the chunk is the
+     * last one of the symbol.
+     *
+     * @tparam E The subclass of TimeSeriesEvent.
+     */
+    template <Derived<TimeSeriesEvent> E>
+    using TimeSeriesConsumer = std::function<void(const SymbolWrapper &, std::vector<std::shared_ptr<E>>, bool)>;
+
+    /**
+     * Retrieves the time series events of the specified type for many symbols within the given time range and passes
+     * them to the consumer by chunks.
+     *
+     * <p>The range of each symbol is split into chunks of HistoryBulkLoader::Options::chunkDuration, and the chunks
+     * are downloaded in parallel by HistoryBulkLoader::Options::parallelism threads. The chunks of each symbol are
+     * passed to the consumer in time order as soon as they are downloaded, and the last chunk of a symbol is marked
+     * with the `isLast` flag. The chunks of different symbols can be consumed concurrently, so the consumer must be
+     * thread-safe. The method returns when all the chunks are consumed.
+     *
+     * ```cpp
+     * endpoint->getTimeSeries<Candle>(
+     *     symbols, start, stop,
+     *     [](const SymbolWrapper &symbol, std::vector<std::shared_ptr<Candle>> candles, bool isLast) {
+     *         // write the candles of the symbol
+     *     },
+     *     {.chunkDuration = 7 * 24 * 3600 * 1000LL, .parallelism = 8});
+     * ```
+     *
+     * @tparam E The subclass of TimeSeriesEvent that specifies the type of event to retrieve.
+     * @param symbols The identifiers of the symbols for which the time series data is requested.
+     * @param from The start timestamp for the time series query, in milliseconds since epoch.
+     * @param to The end timestamp for the time series query, in milliseconds since epoch.
+     * @param consumer The function that consumes the chunks.
+     * @param options The options of the loading.
+     * @throws JavaException or the exception of the consumer if a chunk fails. See HistoryBulkLoader::load().
+     */
+    template <Derived<TimeSeriesEvent> E>
+    void getTimeSeries(const std::vector<SymbolWrapper> &symbols, std::int64_t from, std::int64_t to,
+                       const TimeSeriesConsumer<E> &consumer, const HistoryBulkLoader::Options &options = {}) {
+        getTimeSeriesImpl(
+            E::TYPE, symbols, from, to,
+            [&consumer](const SymbolWrapper &symbol, std::vector<std::shared_ptr<EventType>> events, bool isLast) {
+                consumer(symbol, convertEvents<EventType, E>(events), isLast);
+            },
+            options);
+    }
+
     /**
      * Creates a new instance of HistoryEndpoint::Builder with default configurations. The default settings
      * include:
@@ -0,0 +1,394 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../entity/SharedEntity.hpp"
+#include "../internal/utils/MappedFile.hpp"
+#include "../internal/utils/StringUtils.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_event
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+struct EventType;
+struct EventTypeEnum;
+
+/**
+ * The decoded block of the event archive: the columns of the events of one type and one symbol.
+ *
+ * The strings are views of the mapped archive, so the block is valid while the EventArchiveReader exists.
+ */
+struct DXFCPP_EXPORT EventArchiveBlock {
+    /// The kind of the values of a column.
+    enum class Kind : std::uint8_t {
+        /// The integers, the times, the flags, the chars and the codes of the enums (EventArchiveBlock::Column::ints).
+        INT = 1,
+        /// The doubles (EventArchiveBlock::Column::doubles).
+        DOUBLE = 2,
+        /// The strings (EventArchiveBlock::Column::strings).
+        STRING = 3,
+    };
+
+    /// The column of the block.
+    struct Column {
+        /// The name of the field (the name of the property of the event).
+        std::string_view name{};
+        /// The kind of the values.
+        Kind kind{};
+        /// `true` if the values were decoded (see EventArchiveReader::scan()).
+        bool decoded{};
+        /// The values of the EventArchiveBlock::Kind::INT column.
+        std::vector<std::int64_t> ints{};
+        /// The values of the EventArchiveBlock::Kind::DOUBLE column.
+        std::vector<double> doubles{};
+        /// The values of the EventArchiveBlock::Kind::STRING column.
+        std::vector<std::string_view> strings{};
+    };
+
+    /// The type of the events.
+    const EventTypeEnum *type{};
+    /// The symbol of the events.
+    std::string_view symbol{};
+    /// The times of the events (the time of the event: Quote::getTime(), Trade::getTime(), etc.) in milliseconds.
+    std::vector<std::int64_t> times{};
+    /// The columns of the fields in the order of the schema of the type.
+    std::vector<Column> columns{};
+
+    /**
+     * @return The number of the events.
+     */
+    std::size_t size() const noexcept {
+        return times.size();
+    }
+
+    /**
+     * @param name The name of the field.
+     * @return The column or `nullptr` if there is no such column.
+     */
+    const Column *findColumn(std::string_view name) const noexcept;
+
+    /**
+     * @param name The name of the EventArchiveBlock::Kind::INT field.
+     * @return The values or the empty span if there is no such decoded column.
+     */
+    std::span<const std::int64_t> getInts(std::string_view name) const noexcept;
+
+    /**
+     * @param name The name of the EventArchiveBlock::Kind::DOUBLE field.
+     * @return The values or the empty span if there is no such decoded column.
+     */
+    std::span<const double> getDoubles(std::string_view name) const noexcept;
+
+    /**
+     * @param name The name of the EventArchiveBlock::Kind::STRING field.
+     * @return The values or the empty span if there is no such decoded column.
+     */
+    std::span<const std::string_view> getStrings(std::string_view name) const noexcept;
+};
+
+/**
+ * The writer of the native columnar event archive.
+ *
+ * The archive is an append-only file of the blocks. Each block contains up to EventArchiveWriter::BLOCK_SIZE events of
+ * one type and one symbol stored by columns: the integers and the times as the zigzag varints of the deltas, the
+ * doubles as the zigzag varints of the deltas of the decimal mantissas (when all the values of the block have at most
+ * 9 decimal places, otherwise as the raw 8 bytes), the strings as the varint lengths and the bytes. Each column is
+ * prefixed by its length, so the reader skips the columns that are not needed. The events are buffered per type and
+ * symbol until the block is full or EventArchiveWriter::MAX_BUFFERED_EVENTS events are buffered in total, then the
+ * blocks are appended to the file.
+ *
+ * Each block is a self-describing record with the CRC-32 of its contents: it names its type (the schema of the type is
+ * written before its first block) and its symbol and contains the number of the events and the range of their times.
+ * So the blocks that were flushed before a crash stay readable: the EventArchiveReader restores the index of the
+ * archive that was not closed by the scan of the records and drops the incomplete record at the end, and
+ * create(path, true) continues such an archive (or a closed one).
+ *
+ * The footer that is written by close() contains the schemas of the types, the symbol dictionary and the index of the
+ * blocks sorted by the type, the symbol and the time, so the closed archive is opened without the scan.
+ *
+ * The supported types are Quote, Trade, TradeETH, TimeAndSale, Candle, Greeks and Order (see isSupported()). The
+ * format is specific to the byte order of the platform.
+ *
+ * ```cpp
+ * auto archive = EventArchiveWriter::create("feed.dxea");
+ *
+ * sub->addEventListener([archive](const auto &events) {
+ *     archive->write(events);
+ * });
+ * // ...
+ * archive->close();
+ * ```
+ *
+ * This class is thread-safe.
+ */
+struct DXFCPP_EXPORT EventArchiveWriter final : RequireMakeShared<EventArchiveWriter> {
+    /// The version of the format of the archive.
+    static constexpr std::uint32_t VERSION = 2;
+
+    /// The maximal number of the events in a block.
+    static constexpr std::size_t BLOCK_SIZE = 4096;
+
+    /// The maximal number of the buffered events of all the types and symbols.
+    static constexpr std::size_t MAX_BUFFERED_EVENTS = 256 * 1024;
+
+    /// The alias to a type of shared pointer to the EventArchiveWriter object
+    using Ptr = std::shared_ptr<EventArchiveWriter>;
+
+    private:
+    struct PendingBlock;
+    struct BlockEntry;
+
+    mutable std::mutex mtx_{};
+    std::string path_;
+    std::ofstream out_;
+    std::uint64_t position_{};
+    bool closed_{};
+    std::unordered_map<std::string, std::uint32_t, StringHash, std::equal_to<>> symbolIds_{};
+    std::vector<std::string> symbols_{};
+    std::vector<std::string> schemas_{};
+    std::vector<std::uint32_t> typeIds_{};
+    std::vector<std::unique_ptr<PendingBlock>> pending_;
+    std::unordered_map<std::uint64_t, PendingBlock *> pendingByKey_{};
+    std::size_t bufferedEvents_{};
+    std::vector<BlockEntry> entries_;
+    std::uint64_t eventCount_{};
+    std::string scratch_{};
+
+    void writeBytes(const void *data, std::size_t size);
+    void writeRecord(std::uint32_t kind, std::string_view payload);
+    std::uint32_t getTypeId(std::uint32_t type);
+    void append(const EventType &event);
+    void writeBlock(PendingBlock &block);
+    void writePending();
+
+    public:
+    EventArchiveWriter(LockExternalConstructionTag, const std::string &path, bool append);
+
+    ~EventArchiveWriter() noexcept override;
+
+    /**
+     * Creates the archive or continues the existing one.
+     *
+     * In the append mode the blocks of the existing archive are kept (its footer and the incomplete record at the end
+     * are overwritten), and the footer that is written by close() indexes both the old and the new blocks.
+     *
+     * @param path The path to the archive.
+     * @param append `false` to truncate the file, `true` to append to the existing archive (an empty or missing file
+     * is created).
+     * @return The new writer.
+     * @throws RuntimeException if the file can't be created or it is not an archive of the current version.
+     */
+    static Ptr create(const StringLike &path, bool append = false);
+
+    /**
+     * @param type The type of the events.
+     * @return `true` if the events of the type can be written to the archive.
+     */
+    static bool isSupported(const EventTypeEnum &type) noexcept;
+
+    /**
+     * Writes the event.
+     *
+     * @param event The event.
+     * @throws InvalidArgumentException if the type of the event is not supported.
+     * @throws RuntimeException if the writer is closed or the file can't be written.
+     */
+    void write(const std::shared_ptr<EventType> &event);
+
+    /**
+     * Writes the events.
+     *
+     * @param events The events.
+     * @throws InvalidArgumentException if the type of an event is not supported.
+     * @throws RuntimeException if the writer is closed or the file can't be written.
+     */
+    void write(const std::vector<std::shared_ptr<EventType>> &events);
+
+    /**
+     * Appends the buffered events to the file as the blocks.
+     *
+     * @throws RuntimeException if the file can't be written.
+     */
+    void flush();
+
+    /**
+     * Appends the buffered events and writes the footer. The following writes throw.
+     *
+     * @throws RuntimeException if the file can't be written.
+     */
+    void close();
+
+    /**
+     * @return The number of the written events.
+     */
+    std::uint64_t getEventCount() const noexcept;
+};
+
+/**
+ * The memory-mapped reader of the archive that is written by the EventArchiveWriter.
+ *
+ * The index of the blocks is read on open, and the blocks are decoded on demand: the scans by the type, the symbol
+ * and the time range only decode the blocks whose index entries match (and only the requested columns of them).
+ *
+ * The index is read from the footer of the closed archive or restored by the scan of the records of the archive that
+ * was not closed (the blocks that were flushed before the crash or that are flushed by the running writer).
+ *
+ * ```cpp
+ * auto archive = EventArchiveReader::open("feed.dxea");
+ *
+ * archive->scan(Quote::TYPE, "AAPL", from, to, {"bidPrice", "askPrice"}, [](const EventArchiveBlock &block) {
+ *     auto bids = block.getDoubles("bidPrice");
+ *     // ...
+ * });
+ * ```
+ *
+ * This class is immutable and thread-safe.
+ */
+struct DXFCPP_EXPORT EventArchiveReader final : RequireMakeShared<EventArchiveReader> {
+    /// The alias to a type of shared pointer to the EventArchiveReader object
+    using Ptr = std::shared_ptr<EventArchiveReader>;
+
+    /// The entry of the index of the blocks.
+    struct BlockInfo {
+        /// The type of the events.
+        const EventTypeEnum *type{};
+        /// The symbol of the events.
+        std::string_view symbol{};
+        /// The number of the events.
+        std::size_t size{};
+        /// The minimal time of the events.
+        std::int64_t minTime{};
+        /// The maximal time of the events.
+        std::int64_t maxTime{};
+    };
+
+    private:
+    struct TypeInfo;
+    struct BlockRef;
+
+    MappedFile file_;
+    std::vector<TypeInfo> types_;
+    std::vector<std::string_view> symbols_{};
+    std::unordered_map<std::string_view, std::uint32_t> symbolIds_{};
+    std::vector<BlockRef> blocks_;
+    // The running maxima of the maximal times of the blocks of each type and symbol (the blocks are sorted by the
+    // minimal time), so the blocks that end before the range are skipped by the binary search too.
+    std::vector<std::int64_t> maxTimes_{};
+    std::uint64_t eventCount_{};
+
+    const TypeInfo *findType(const EventTypeEnum &type) const noexcept;
+    std::span<const BlockRef> findBlocks(std::span<const BlockRef> blocks, std::int64_t fromTime,
+                                         std::int64_t toTime) const noexcept;
+    std::vector<std::span<const BlockRef>> findBlocks(const TypeInfo &type, std::optional<std::string_view> symbol,
+                                                      std::int64_t fromTime, std::int64_t toTime) const;
+    EventArchiveBlock decode(const BlockRef &block, const std::vector<std::string_view> &columns) const;
+
+    public:
+    EventArchiveReader(LockExternalConstructionTag, MappedFile &&file, std::string_view path);
+
+    ~EventArchiveReader() noexcept override;
+
+    /**
+     * Opens (memory-maps) the archive.
+     *
+     * @param path The path to the archive.
+     * @return The reader.
+     * @throws RuntimeException if the file can't be opened or it is not a valid archive of the current version.
+     */
+    static Ptr open(const StringLike &path);
+
+    /**
+     * @return The number of the events in the archive.
+     */
+    std::uint64_t getEventCount() const noexcept;
+
+    /**
+     * @return The types of the events in the archive.
+     */
+    std::vector<std::reference_wrapper<const EventTypeEnum>> getEventTypes() const;
+
+    /**
+     * @return The symbols of the archive. The views are valid while the reader exists.
+     */
+    const std::vector<std::string_view> &getSymbols() const noexcept;
+
+    /**
+     * Returns the names of the columns of the type in the archive.
+     *
+     * @param type The type of the events.
+     * @return The names or the empty list if there are no events of the type.
+     */
+    std::vector<std::string_view> getColumnNames(const EventTypeEnum &type) const;
+
+    /**
+     * Returns the blocks of the type and the symbol whose times intersect the range.
+     *
+     * @param type The type of the events.
+     * @param symbol The symbol or `std::nullopt` for all the symbols.
+     * @param fromTime The start of the range in milliseconds (inclusive).
+     * @param toTime The end of the range in milliseconds (exclusive).
+     * @return The entries of the index in the order of the symbol and the time.
+     */
+    std::vector<BlockInfo> getBlocks(const EventTypeEnum &type, std::optional<std::string_view> symbol = std::nullopt,
+                                     std::int64_t fromTime = std::numeric_limits<std::int64_t>::min(),
+                                     std::int64_t toTime = std::numeric_limits<std::int64_t>::max()) const;
+
+    /**
+     * Decodes the blocks of the type and the symbol whose times intersect the range. The blocks can contain the events
+     * outside of the range, so the consumer filters them by EventArchiveBlock::times.
+     *
+     * @param type The type of the events.
+     * @param symbol The symbol or `std::nullopt` for all the symbols.
+     * @param fromTime The start of the range in milliseconds (inclusive).
+     * @param toTime The end of the range in milliseconds (exclusive).
+     * @param columns The names of the columns to decode or the empty list to decode all the columns.
+     * @param consumer The consumer of the decoded blocks in the order of the symbol and the time.
+     * @throws RuntimeException if a block is corrupted.
+     */
+    void scan(const EventTypeEnum &type, std::optional<std::string_view> symbol, std::int64_t fromTime,
+              std::int64_t toTime, const std::vector<std::string_view> &columns,
+              const std::function<void(const EventArchiveBlock &)> &consumer) const;
+
+    /**
+     * Reads the events of the type and the symbol whose times are in the range.
+     *
+     * @param type The type of the events.
+     * @param symbol The symbol or `std::nullopt` for all the symbols.
+     * @param fromTime The start of the range in milliseconds (inclusive).
+     * @param toTime The end of the range in milliseconds (exclusive).
+     * @return The events in the order of the symbol and the archive.
+     * @throws RuntimeException if a block is corrupted or the archive was written with another schema of the type.
+     */
+    std::vector<std::shared_ptr<EventType>> read(const EventTypeEnum &type,
+                                                 std::optional<std::string_view> symbol = std::nullopt,
+                                                 std::int64_t fromTime = std::numeric_limits<std::int64_t>::min(),
+                                                 std::int64_t toTime = std::numeric_limits<std::int64_t>::max()) const;
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
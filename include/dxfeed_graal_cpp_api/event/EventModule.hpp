@@ -12,11 +12,13 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
  * \ingroup dxfcpp_modules
  */
 
+#include "./EventArchive.hpp"
 #include "./EventFlag.hpp"
 #include "./EventMapper.hpp"
 #include "./EventSourceWrapper.hpp"
 #include "./EventType.hpp"
 #include "./EventTypeEnum.hpp"
+#include "./EventWriter.hpp"
 #include "./IndexedEvent.hpp"
 #include "./IndexedEventSource.hpp"
 #include "./LastingEvent.hpp"
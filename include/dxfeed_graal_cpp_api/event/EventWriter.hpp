@@ -0,0 +1,205 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../entity/SharedEntity.hpp"
+#include "../internal/utils/StringUtils.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_event
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+struct EventType;
+
+/**
+ * The high-throughput writer of the events into a stream of bytes (a file, the standard output or a custom sink).
+ *
+ * The events are encoded by the calling thread into a reusable output buffer with the encoders that are specialized
+ * for each event type: the fields are written directly into the buffer (the numbers with `std::to_chars`, the times
+ * with the NativeTimeFormat), without the intermediate strings. The filled buffers are passed to the background I/O
+ * thread that writes them with large writes, and the written buffers are reused. The partially filled buffer is passed
+ * to the I/O thread every EventWriter::FLUSH_PERIOD, so the output of a slow stream is not delayed. When the I/O thread
+ * falls behind by EventWriter::MAX_QUEUED_BUFFERS buffers, the writing threads wait for it.
+ *
+ * The formats:
+ *
+ * - EventWriter::Format::TEXT: a line of the `toString()` of each event.
+ * - EventWriter::Format::CSV: a line of comma-separated values of each event, prefixed by the event type. The first
+ *   event of each type is preceded by the header line `#<Type>,eventSymbol,eventTime,...`. The times are formatted
+ *   with the NativeTimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE, the strings that contain the separators are quoted.
+ * - EventWriter::Format::JSON_LINES: a JSON object of each event (`{"type":"Quote","eventSymbol":"AAPL",...}`). The
+ *   times are formatted as in the CSV, the NaN and infinite values are written as `null`.
+ * - EventWriter::Format::BINARY: the compact binary records. The stream starts with the `DXEW` magic and the version
+ *   byte. Each record is the varint event type id (EventTypeEnum::getId()), the varint length of the record body and
+ *   the body: the symbol reference (the varint index of the symbol in the stream, or `0` followed by the varint length
+ *   and the bytes of a new symbol), and the fields in the order of the CSV header: the integers and the times as the
+ *   zigzag varints, the doubles as 8 little-endian bytes, the flags as a byte, the strings as the varint length and
+ *   the bytes, the enums by their codes. The events of the types without encoders have the single field of their
+ *   `toString()`.
+ *
+ * ```cpp
+ * auto writer = EventWriter::create(EventWriter::Format::CSV, "quotes.csv");
+ *
+ * sub->addEventListener([writer](const auto &events) {
+ *     writer->write(events);
+ * });
+ * // ...
+ * writer->close();
+ * ```
+ *
+ * This class is thread-safe.
+ */
+struct DXFCPP_EXPORT EventWriter final : RequireMakeShared<EventWriter> {
+    /**
+     * The output format.
+     */
+    enum class Format {
+        /// A line of the `toString()` of each event.
+        TEXT,
+        /// The comma-separated values.
+        CSV,
+        /// The JSON objects, one per line.
+        JSON_LINES,
+        /// The compact binary records.
+        BINARY,
+    };
+
+    /**
+     * The destination of the written bytes. It is called by the I/O thread only.
+     */
+    using Sink = std::function<void(const char *data, std::size_t size)>;
+
+    /// The default size of the output buffer.
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 1024 * 1024;
+
+    /// The maximal number of the filled buffers that wait for the I/O thread.
+    static constexpr std::size_t MAX_QUEUED_BUFFERS = 8;
+
+    /// The period after which the partially filled buffer is written.
+    static constexpr std::chrono::milliseconds FLUSH_PERIOD{100};
+
+    private:
+    struct Encoder;
+    struct State;
+
+    Format format_;
+    std::unique_ptr<Encoder> encoder_;
+
+    // The state is shared with the I/O thread, so the thread can outlive the writer.
+    std::shared_ptr<State> state_;
+    std::thread ioThread_{};
+
+    std::atomic<std::uint64_t> eventCount_{};
+
+    // Must be called under the lock of the state.
+    void encode(const EventType &event);
+
+    public:
+    EventWriter(LockExternalConstructionTag, Format format, Sink sink, std::size_t bufferSize);
+
+    ~EventWriter() noexcept override;
+
+    /**
+     * Creates the writer to the sink.
+     *
+     * @param format The output format.
+     * @param sink The destination of the written bytes.
+     * @param bufferSize The size of the output buffer.
+     * @return The new writer.
+     * @throws InvalidArgumentException if the sink is empty or the buffer size is zero.
+     */
+    static std::shared_ptr<EventWriter> create(Format format, Sink sink, std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * Creates the writer to the file. The file is truncated. The path `-` denotes the standard output.
+     *
+     * @param format The output format.
+     * @param path The path of the file.
+     * @param bufferSize The size of the output buffer.
+     * @return The new writer.
+     * @throws InvalidArgumentException if the file can't be opened or the buffer size is zero.
+     */
+    static std::shared_ptr<EventWriter> create(Format format, const StringLike &path,
+                                               std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * Parses the name of the format: `text`, `csv`, `json` (or `jsonl`) and `binary` (or `bin`), case-insensitively.
+     *
+     * @param name The name of the format.
+     * @return The format.
+     * @throws InvalidArgumentException if the name is unknown.
+     */
+    static Format parseFormat(std::string_view name);
+
+    /**
+     * @return The output format.
+     */
+    Format getFormat() const noexcept;
+
+    /**
+     * Writes the event.
+     *
+     * @param event The event.
+     * @throws RuntimeException if the writer is closed or the sink failed.
+     */
+    void write(const std::shared_ptr<EventType> &event);
+
+    /**
+     * Writes the events.
+     *
+     * @param events The events.
+     * @throws RuntimeException if the writer is closed or the sink failed.
+     */
+    void write(const std::vector<std::shared_ptr<EventType>> &events);
+
+    /**
+     * Passes the buffered events to the sink and waits until they are written.
+     *
+     * @throws RuntimeException if the sink failed.
+     */
+    void flush();
+
+    /**
+     * Writes the buffered events and stops the I/O thread. The following writes throw. If it is called by the sink (for
+     * example, when the sink releases the last reference to the writer), the I/O thread is not waited for: it writes
+     * the remaining buffers and stops by itself.
+     *
+     * @throws RuntimeException if the sink failed.
+     */
+    void close();
+
+    /**
+     * @return The number of the written events.
+     */
+    std::uint64_t getEventCount() const noexcept;
+
+    /**
+     * @return The number of the bytes that were passed to the sink.
+     */
+    std::uint64_t getByteCount() const noexcept;
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
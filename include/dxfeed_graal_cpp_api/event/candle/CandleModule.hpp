@@ -16,11 +16,14 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
 #include "./CandleAlignment.hpp"
 #include "./CandleExchange.hpp"
 #include "./CandlePeriod.hpp"
+#include "./CandlePeriodAligner.hpp"
 #include "./CandlePrice.hpp"
 #include "./CandlePriceLevel.hpp"
+#include "./CandleResampler.hpp"
 #include "./CandleSession.hpp"
 #include "./CandleSymbol.hpp"
 #include "./CandleSymbolAttribute.hpp"
+#include "./CandleSymbolCache.hpp"
 #include "./CandleType.hpp"
 
 DXFCXX_DISABLE_MSC_WARNINGS_POP()
\ No newline at end of file
@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "./CandleAlignment.hpp"
+#include "./CandlePeriod.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+/**
+ * \addtogroup dxfcpp_candle
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+struct Schedule;
+
+/**
+ * Computes the bounds of the time candles: the start and the end of the candle of the specified period that contains
+ * a time.
+ *
+ * <ul>
+ * <li>The candles of the CandleType::SECOND, CandleType::MINUTE, CandleType::HOUR and CandleType::DAY types (including
+ * the fractional periods) are aligned at midnight UTC, the CandleType::WEEK candles start on Mondays, the
+ * CandleType::MONTH and CandleType::YEAR candles start on the first day of a calendar month.
+ * <li>With the CandleAlignment::SESSION alignment, the intraday candles are aligned at the start of the trading
+ * session of the @ref Schedule "schedule" and end no later than the session.
+ * </ul>
+ *
+ * <p>The session that contains the last time is cached, so the sequential lookups in time order query the schedule
+ * only at the session boundaries.
+ *
+ * <p>This class is not thread-safe.
+ */
+struct DXFCPP_EXPORT CandlePeriodAligner final {
+    /**
+     * The bounds of a candle: [start, end).
+     */
+    using Bounds = std::pair<std::int64_t /* start */, std::int64_t /* end */>;
+
+    private:
+    enum class Kind : std::uint8_t { MILLIS, MONTHS, NOT_TIME };
+
+    Kind kind_{};
+    std::int64_t periodMillis_{};
+    std::int64_t periodMonths_{};
+    std::int64_t origin_{};
+    bool sessionAligned_{};
+    std::shared_ptr<Schedule> schedule_{};
+
+    std::int64_t sessionStart_ = std::numeric_limits<std::int64_t>::max();
+    std::int64_t sessionEnd_ = std::numeric_limits<std::int64_t>::min();
+    bool sessionRegular_{};
+
+    void updateSession(std::int64_t time);
+
+    public:
+    /**
+     * Creates the aligner.
+     *
+     * @param period The candle period.
+     * @param alignment The candle alignment.
+     * @param schedule The schedule (required for the CandleAlignment::SESSION alignment and for
+     * CandlePeriodAligner::isRegularSession()).
+     * @throws InvalidArgumentException if the period is not positive, if the period type is CandleType::OPTEXP, or if
+     * the schedule is required but it is not set.
+     */
+    explicit CandlePeriodAligner(const CandlePeriod &period,
+                                 const CandleAlignment &alignment = CandleAlignment::DEFAULT,
+                                 std::shared_ptr<Schedule> schedule = nullptr);
+
+    /**
+     * @return `true` if the candles of the period are bounded by time (`false` for the tick, volume and price
+     * candles).
+     */
+    bool isTimeBased() const noexcept;
+
+    /**
+     * Returns the bounds of the candle that contains the time.
+     *
+     * @param time The time in milliseconds since epoch.
+     * @return The start (inclusive) and the end (exclusive) of the candle.
+     * @throws InvalidArgumentException if the candles of the period are not @ref isTimeBased() "time-based".
+     */
+    Bounds getBounds(std::int64_t time);
+
+    /**
+     * Returns the start of the candle that contains the time.
+     *
+     * @param time The time in milliseconds since epoch.
+     * @return The start of the candle.
+     * @throws InvalidArgumentException if the candles of the period are not @ref isTimeBased() "time-based".
+     */
+    std::int64_t getStart(std::int64_t time) {
+        return getBounds(time).first;
+    }
+
+    /**
+     * Returns `true` if the time belongs to a session of the SessionType::REGULAR type.
+     *
+     * @param time The time in milliseconds since epoch.
+     * @return `true` if the time belongs to a regular session.
+     * @throws InvalidArgumentException if the schedule is not set.
+     */
+    bool isRegularSession(std::int64_t time);
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -0,0 +1,202 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "./Candle.hpp"
+#include "./CandleAlignment.hpp"
+#include "./CandlePeriod.hpp"
+#include "./CandleSymbol.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_candle
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+struct Schedule;
+
+/**
+ * A non-owning column (structure of arrays) view of the candles ordered by time. All the columns must have the same
+ * size.
+ */
+struct DXFCPP_EXPORT CandleColumnsView {
+    /// The start times of the candles in milliseconds since epoch.
+    std::span<const std::int64_t> times{};
+    /// The numbers of the trades.
+    std::span<const std::int64_t> counts{};
+    /// The open prices.
+    std::span<const double> opens{};
+    /// The high prices.
+    std::span<const double> highs{};
+    /// The low prices.
+    std::span<const double> lows{};
+    /// The close prices.
+    std::span<const double> closes{};
+    /// The volumes.
+    std::span<const double> volumes{};
+    /// The volume-weighted average prices.
+    std::span<const double> vwaps{};
+    /// The bid volumes.
+    std::span<const double> bidVolumes{};
+    /// The ask volumes.
+    std::span<const double> askVolumes{};
+    /// The implied volatilities.
+    std::span<const double> impVolatilities{};
+    /// The open interests.
+    std::span<const double> openInterests{};
+
+    /**
+     * @return The number of the candles.
+     */
+    std::size_t size() const noexcept {
+        return times.size();
+    }
+};
+
+/**
+ * The column (structure of arrays) storage of the candles.
+ */
+struct DXFCPP_EXPORT CandleColumns {
+    /// The start times of the candles in milliseconds since epoch.
+    std::vector<std::int64_t> times{};
+    /// The numbers of the trades.
+    std::vector<std::int64_t> counts{};
+    /// The open prices.
+    std::vector<double> opens{};
+    /// The high prices.
+    std::vector<double> highs{};
+    /// The low prices.
+    std::vector<double> lows{};
+    /// The close prices.
+    std::vector<double> closes{};
+    /// The volumes.
+    std::vector<double> volumes{};
+    /// The volume-weighted average prices.
+    std::vector<double> vwaps{};
+    /// The bid volumes.
+    std::vector<double> bidVolumes{};
+    /// The ask volumes.
+    std::vector<double> askVolumes{};
+    /// The implied volatilities.
+    std::vector<double> impVolatilities{};
+    /// The open interests.
+    std::vector<double> openInterests{};
+
+    /**
+     * @return The number of the candles.
+     */
+    std::size_t size() const noexcept {
+        return times.size();
+    }
+
+    /**
+     * Reserves the storage for the specified number of the candles.
+     *
+     * @param capacity The number of the candles.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * Resizes all the columns.
+     *
+     * @param size The number of the candles.
+     */
+    void resize(std::size_t size);
+
+    /**
+     * Appends the candle.
+     *
+     * @param candle The candle.
+     */
+    void append(const Candle &candle);
+
+    /**
+     * @return The view of the columns.
+     */
+    CandleColumnsView view() const noexcept;
+
+    /**
+     * Creates the columns from the candles. The candles in the descending order of time (as they may be returned by
+     * the feed) are reversed, so the columns are ordered by ascending time.
+     *
+     * @param candles The candles.
+     * @return The columns.
+     */
+    static CandleColumns fromCandles(const std::vector<std::shared_ptr<Candle>> &candles);
+
+    /**
+     * Creates the candles of the specified symbol from the columns.
+     *
+     * @param symbol The candle symbol of the created candles.
+     * @return The candles.
+     */
+    std::vector<std::shared_ptr<Candle>> toCandles(const CandleSymbol &symbol) const;
+};
+
+/**
+ * Resamples the candles to a longer period: e.g. the 1-minute candles that are returned by
+ * HistoryEndpoint::getTimeSeries() or DXFeed::getTimeSeriesPromise() to the 5-minute, 1-hour or daily candles.
+ *
+ * <p>The source candles are grouped into the buckets of the target period that are computed by
+ * CandlePeriodAligner according to the CandleAlignment and the (optional) Schedule. The columns of each bucket are
+ * reduced with the branch-free loops over contiguous memory: first open, max high, min low, last close, sums of
+ * the counts and the volumes, volume-weighted VWAP, last implied volatility and open interest. The bucket boundaries
+ * are found in one pass over the times, then each column is reduced in its own pass, so the resampling of millions of
+ * candles is bound by the memory bandwidth.
+ *
+ * <p>The NaN values of the prices and the volumes (e.g. of the empty candles) are ignored.
+ *
+ * ```cpp
+ * auto minutes = CandleColumns::fromCandles(endpoint->getTimeSeries<Candle>("AAPL{=m}", from, to));
+ * auto hours = CandleResampler::resample(minutes.view(), CandlePeriod::valueOf(1, CandleType::HOUR));
+ * auto candles = hours.toCandles(CandleSymbol::valueOf("AAPL{=h}"));
+ * ```
+ */
+struct DXFCPP_EXPORT CandleResampler final {
+    /**
+     * Resamples the candles.
+     *
+     * @param candles The view of the candles ordered by time.
+     * @param period The target period (of a time-based type).
+     * @param alignment The alignment of the target candles.
+     * @param schedule The schedule (required for the CandleAlignment::SESSION alignment).
+     * @return The resampled candles.
+     * @throws InvalidArgumentException if the columns have different sizes, if the candles are not ordered by time,
+     * if the period is not time-based, or if the schedule is required but it is not set.
+     */
+    static CandleColumns resample(const CandleColumnsView &candles, const CandlePeriod &period,
+                                  const CandleAlignment &alignment = CandleAlignment::DEFAULT,
+                                  const std::shared_ptr<Schedule> &schedule = nullptr);
+
+    /**
+     * Resamples the candles to the period and the alignment of the target symbol.
+     *
+     * @param candles The candles.
+     * @param symbol The target candle symbol.
+     * @param schedule The schedule (required for the CandleAlignment::SESSION alignment).
+     * @return The resampled candles of the target symbol ordered by ascending time.
+     * @throws InvalidArgumentException if the period of the symbol is not time-based, or if the schedule is required
+     * but it is not set.
+     */
+    static std::vector<std::shared_ptr<Candle>> resample(const std::vector<std::shared_ptr<Candle>> &candles,
+                                                         const CandleSymbol &symbol,
+                                                         const std::shared_ptr<Schedule> &schedule = nullptr);
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -0,0 +1,102 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "./CandleSymbol.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/**
+ * \addtogroup dxfcpp_candle
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * A process-wide concurrent cache of the parsed (normalized) candle symbols keyed by the raw symbol string.
+ *
+ * <p>Parsing a candle symbol normalizes the string and parses all its attributes. The events of a history load or of
+ * a live subscription carry the same few symbols, so Candle::fillData() takes the parsed symbols from this cache:
+ * handling the symbol of an incoming candle becomes a hash lookup.
+ *
+ * <p>The cache is split into shards guarded by shared locks, so concurrent lookups of the cached symbols do not
+ * contend. When a shard reaches its capacity, it is cleared (the cache is intended for a bounded set of working
+ * symbols).
+ *
+ * <p>This class is thread-safe.
+ */
+struct DXFCPP_EXPORT CandleSymbolCache final {
+    /**
+     * The statistics of the cache.
+     */
+    struct Stats {
+        /// The number of the lookups that found the symbol in the cache.
+        std::uint64_t hits{};
+        /// The number of the lookups that parsed the symbol.
+        std::uint64_t misses{};
+        /// The number of the cached symbols.
+        std::size_t size{};
+
+        /// @return The ratio of the hits to all the lookups or 0 if there were no lookups.
+        double getHitRatio() const noexcept {
+            return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+        }
+
+        std::string toString() const;
+    };
+
+    /// The default maximum number of the cached symbols.
+    static constexpr std::size_t DEFAULT_CAPACITY = 16384;
+
+    /**
+     * Returns the parsed candle symbol for the raw symbol string. The symbol is parsed only if it is not in the cache.
+     *
+     * @param symbol The raw symbol string.
+     * @return The shared immutable candle symbol.
+     */
+    static std::shared_ptr<const CandleSymbol> valueOf(std::string_view symbol);
+
+    /**
+     * @return The statistics of the cache.
+     */
+    static Stats getStats() noexcept;
+
+    /**
+     * Resets the hit and miss counters.
+     */
+    static void resetStats() noexcept;
+
+    /**
+     * Removes all the cached symbols.
+     */
+    static void clear() noexcept;
+
+    /**
+     * Sets the maximum number of the cached symbols. The value takes effect for the shards as they are filled.
+     * The capacity is divided between the shards rounding up, so the cache can hold a few more symbols.
+     *
+     * @param capacity The capacity (0 disables the caching: every lookup parses the symbol).
+     */
+    static void setCapacity(std::size_t capacity) noexcept;
+
+    /**
+     * @return The maximum number of the cached symbols.
+     */
+    static std::size_t getCapacity() noexcept;
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
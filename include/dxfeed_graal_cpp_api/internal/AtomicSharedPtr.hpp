@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "./Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251 4996)
+DXFCXX_DISABLE_GCC_WARNINGS_PUSH("-Wdeprecated-declarations")
+DXFCXX_DISABLE_CLANG_WARNINGS_PUSH("-Wdeprecated-declarations")
+
+#include <atomic>
+#include <memory>
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * A shared pointer that can be loaded and stored from several threads without external synchronization.
+ * It is used to publish immutable snapshots: the writer builds a new object and stores the pointer to it, the readers
+ * load the pointer and keep the object alive for as long as they use it.
+ *
+ * Uses `std::atomic<std::shared_ptr<T>>` where the standard library provides it, otherwise falls back to the atomic
+ * free functions for `std::shared_ptr`.
+ *
+ * @tparam T The type of the object.
+ */
+template <typename T> struct AtomicSharedPtr final {
+    private:
+#if defined(__cpp_lib_atomic_shared_ptr) && __cpp_lib_atomic_shared_ptr >= 201711L
+    std::atomic<std::shared_ptr<T>> ptr_{};
+#else
+    std::shared_ptr<T> ptr_{};
+#endif
+
+    public:
+    AtomicSharedPtr() noexcept = default;
+
+    explicit AtomicSharedPtr(std::shared_ptr<T> ptr) noexcept : ptr_(std::move(ptr)) {
+    }
+
+    AtomicSharedPtr(const AtomicSharedPtr &) = delete;
+    AtomicSharedPtr &operator=(const AtomicSharedPtr &) = delete;
+
+    /**
+     * @return The current pointer.
+     */
+    std::shared_ptr<T> load() const noexcept {
+#if defined(__cpp_lib_atomic_shared_ptr) && __cpp_lib_atomic_shared_ptr >= 201711L
+        return ptr_.load(std::memory_order_acquire);
+#else
+        return std::atomic_load_explicit(&ptr_, std::memory_order_acquire);
+#endif
+    }
+
+    /**
+     * Replaces the current pointer.
+     *
+     * @param ptr The new pointer.
+     */
+    void store(std::shared_ptr<T> ptr) noexcept {
+#if defined(__cpp_lib_atomic_shared_ptr) && __cpp_lib_atomic_shared_ptr >= 201711L
+        ptr_.store(std::move(ptr), std::memory_order_release);
+#else
+        std::atomic_store_explicit(&ptr_, std::move(ptr), std::memory_order_release);
+#endif
+    }
+};
+
+DXFCPP_END_NAMESPACE
+
+DXFCXX_DISABLE_CLANG_WARNINGS_POP()
+DXFCXX_DISABLE_GCC_WARNINGS_POP()
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "./Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+DXFCPP_BEGIN_NAMESPACE
+
+struct TimeFormat;
+
+/**
+ * The native implementation of the TimeFormat that formats and parses the times without calls to the Graal.
+ *
+ * The instances produce the same strings as the corresponding TimeFormat instances:
+ *
+ * - NativeTimeFormat::DEFAULT and NativeTimeFormat::GMT: `yyyyMMdd-HHmmss`
+ * - NativeTimeFormat::DEFAULT_WITH_MILLIS: `yyyyMMdd-HHmmss.SSS`
+ * - NativeTimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE: `yyyyMMdd-HHmmss.SSSZ` (the timezone as `+HHmm`)
+ *
+ * The zero time is formatted as `0`. The local times are converted by the timezone of the OS (`TZ` or the system one).
+ * It is compared once with the default timezone of the Java, and if they differ (the `user.timezone` property is set or
+ * the timezone databases disagree), the local times are formatted and parsed by TimeFormat. The offsets of the days are
+ * kept in a lock-free direct-mapped table (an entry per day with the offset at its start and the transition within it),
+ * and the date prefix of the last formatted day is cached per thread, so formatting a time is a few arithmetic
+ * operations and a memory lookup.
+ *
+ * The parser accepts the ISO 8601 times of the form `<date>[('T'|'t'|'-'|' ')<time>][<timezone>]` (see
+ * TimeFormat::parse()), the zero time and the times in milliseconds. The rest of the formats (the time periods, the
+ * times without dates, the named timezones) are parsed by the corresponding Graal-backed TimeFormat. The times outside
+ * of the years 1..9999 are formatted by the corresponding TimeFormat too.
+ *
+ * ```cpp
+ * std::array<char, NativeTimeFormat::MAX_LENGTH> buffer{};
+ * auto length = NativeTimeFormat::DEFAULT_WITH_MILLIS.format(quote->getTime(), buffer.data());
+ * ```
+ *
+ * This class is thread-safe.
+ */
+struct DXFCPP_EXPORT NativeTimeFormat final {
+    /// The maximal length of the formatted time (`yyyyMMdd-HHmmss.SSS+HHmm`).
+    static constexpr std::size_t MAX_LENGTH = 24;
+
+    /// The number of the entries in the table of the day offsets.
+    static constexpr std::size_t OFFSET_TABLE_SIZE = 1024;
+
+    /**
+     * The native counterpart of TimeFormat::DEFAULT.
+     */
+    static const NativeTimeFormat DEFAULT;
+
+    /**
+     * The native counterpart of TimeFormat::DEFAULT_WITH_MILLIS.
+     */
+    static const NativeTimeFormat DEFAULT_WITH_MILLIS;
+
+    /**
+     * The native counterpart of TimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE.
+     */
+    static const NativeTimeFormat DEFAULT_WITH_MILLIS_WITH_TIMEZONE;
+
+    /**
+     * The native counterpart of TimeFormat::GMT.
+     */
+    static const NativeTimeFormat GMT;
+
+    private:
+    // The offsets of the days. An entry is two words that both contain the day, so the torn entry is detected.
+    struct OffsetTable {
+        std::array<std::atomic<std::uint64_t>, OFFSET_TABLE_SIZE> starts{};
+        std::array<std::atomic<std::uint64_t>, OFFSET_TABLE_SIZE> transitions{};
+    };
+
+    const TimeFormat &fallback_;
+    bool local_;
+    bool withMillis_;
+    bool withTimeZone_;
+
+    NativeTimeFormat(const TimeFormat &fallback, bool local, bool withMillis, bool withTimeZone) noexcept;
+
+    static OffsetTable &getOffsetTable() noexcept;
+
+    // Returns the offset (in seconds) of the local time at the UTC time (in seconds) or std::nullopt if the OS can't
+    // convert the time or its timezone is not the default one of the Java.
+    std::optional<std::int32_t> getOffset(std::int64_t seconds) const noexcept;
+
+    // Returns the offset of the local time (in seconds) to the UTC time.
+    std::optional<std::int32_t> getOffsetOfLocal(std::int64_t localSeconds) const noexcept;
+
+    std::optional<std::int64_t> parseNative(std::string_view value) const noexcept;
+
+    public:
+    NativeTimeFormat(const NativeTimeFormat &) = delete;
+    NativeTimeFormat &operator=(const NativeTimeFormat &) = delete;
+
+    /**
+     * Formats the time into the buffer. The buffer is not null-terminated.
+     *
+     * @param timestamp The time in milliseconds since the epoch.
+     * @param buffer The buffer of at least NativeTimeFormat::MAX_LENGTH chars.
+     * @return The length of the formatted time or 0 if the time can't be formatted natively (outside of the years
+     * 1..9999, or the local time when the timezone of the OS is not the default timezone of the Java).
+     */
+    std::size_t format(std::int64_t timestamp, char *buffer) const noexcept;
+
+    /**
+     * Converts the time into string according to the format.
+     *
+     * @param timestamp The time in milliseconds since the epoch.
+     * @return The string representation of the time.
+     */
+    std::string format(std::int64_t timestamp) const;
+
+    /**
+     * Reads the time from the string.
+     *
+     * @param value The string value to parse.
+     * @return The time (in milliseconds since the epoch) parsed from the value.
+     * @see TimeFormat::parse()
+     */
+    std::int64_t parse(std::string_view value) const;
+};
+
+DXFCPP_END_NAMESPACE
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The decompressor of the DEFLATE data (RFC 1951) and its "gzip" (RFC 1952) and "zip" containers.
+ *
+ * <p>It is used to read the compressed files without the dependency on zlib.
+ */
+struct DXFCPP_EXPORT Inflater final {
+    /**
+     * Decompresses the raw DEFLATE data and appends it to the output.
+     *
+     * @param input The compressed data. It can be followed by other data.
+     * @param output The string where the decompressed data is appended.
+     * @return The number of the consumed bytes of the input.
+     * @throws RuntimeException if the data is corrupted or truncated.
+     */
+    static std::size_t inflate(std::string_view input, std::string &output);
+
+    /**
+     * @param data The data.
+     * @return `true` if the data starts with the "gzip" signature.
+     */
+    static bool isGzip(std::string_view data) noexcept;
+
+    /**
+     * @param data The data.
+     * @return `true` if the data starts with the signature of a "zip" file entry.
+     */
+    static bool isZip(std::string_view data) noexcept;
+
+    /**
+     * Decompresses the "gzip" data. All the members are decompressed and concatenated; the checksums are verified.
+     *
+     * @param data The "gzip" data.
+     * @return The decompressed data.
+     * @throws RuntimeException if the data is corrupted or truncated.
+     */
+    static std::string gunzip(std::string_view data);
+
+    /**
+     * Decompresses the first file entry of the "zip" data (the entries that are "stored" or "deflated" are
+     * supported). The directory entries before it are skipped.
+     *
+     * @param data The "zip" data.
+     * @return The decompressed data of the first file entry.
+     * @throws RuntimeException if the data is corrupted, truncated, has no file entries or uses an unsupported
+     * compression method.
+     */
+    static std::string unzip(std::string_view data);
+
+    /**
+     * Computes the CRC-32 checksum (as in "gzip" and "zip").
+     *
+     * @param data The data.
+     * @param crc The checksum of the preceding data.
+     * @return The checksum.
+     */
+    static std::uint32_t crc32(std::string_view data, std::uint32_t crc = 0) noexcept;
+};
+
+DXFCPP_END_NAMESPACE
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -0,0 +1,83 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "./StringUtils.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The read-only memory mapping of a whole file.
+ *
+ * <p>The contents are available while the object exists. An empty file is not mapped and has empty contents.
+ */
+struct DXFCPP_EXPORT MappedFile final {
+    private:
+    const char *data_ = nullptr;
+    std::size_t size_ = 0;
+    void *mapping_ = nullptr; // The mapping handle (Windows only).
+
+    void close() noexcept;
+
+    public:
+    MappedFile() noexcept = default;
+
+    /**
+     * Maps the file.
+     *
+     * @param path The path to the file.
+     * @throws RuntimeException if the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const StringLike &path);
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    ~MappedFile() noexcept;
+
+    /**
+     * @return The pointer to the contents.
+     */
+    const char *data() const noexcept {
+        return data_;
+    }
+
+    /**
+     * @return The size of the file.
+     */
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @return The contents of the file.
+     */
+    std::string_view view() const noexcept {
+        return {data_, size_};
+    }
+
+    /**
+     * Returns the last modification time of the file.
+     *
+     * @param path The path to the file.
+     * @return The last modification time in milliseconds since epoch or `0` if it is unknown.
+     */
+    static std::int64_t getLastModified(const StringLike &path) noexcept;
+};
+
+DXFCPP_END_NAMESPACE
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace parallel_utils {
+
+/**
+ * Runs the tasks with the indexes `[0, count)` on up to `parallelism` threads (including the calling one). The tasks
+ * are taken in the order of their indexes. After the first failed task, the remaining tasks are not started, and its
+ * exception is rethrown when all the threads are finished.
+ *
+ * @tparam Task The type of the task: `void(std::size_t index)`.
+ * @param count The number of the tasks.
+ * @param parallelism The maximal number of the threads.
+ * @param task The task.
+ */
+template <typename Task> void runInParallel(std::size_t count, std::size_t parallelism, Task &&task) {
+    if (count <= 1 || parallelism <= 1) {
+        for (std::size_t i = 0; i < count; i++) {
+            task(i);
+        }
+
+        return;
+    }
+
+    std::atomic<std::size_t> nextIndex{};
+    std::atomic<bool> failed{};
+    std::vector<std::exception_ptr> errors(count);
+    const auto worker = [&] {
+        for (std::size_t i{}; !failed && (i = nextIndex++) < count;) {
+            try {
+                task(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads{};
+
+    for (std::size_t i = 1; i < std::min(parallelism, count); i++) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (const auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // namespace parallel_utils
+
+DXFCPP_END_NAMESPACE
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
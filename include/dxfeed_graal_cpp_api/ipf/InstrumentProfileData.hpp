@@ -0,0 +1,264 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../internal/Common.hpp"
+#include "../internal/utils/StringUtils.hpp"
+#include "./InstrumentProfileField.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_ipf
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+struct InstrumentProfile;
+
+/**
+ * The pool of the interned strings of InstrumentProfileData.
+ *
+ * <p>Each distinct string is stored once, and the returned views stay valid while the pool exists. Most of the
+ * string fields of the instrument profiles (type, country, currency, exchanges, trading hours, etc.) have few distinct
+ * values, so the interning saves most of the memory.
+ *
+ * <p>This class is not thread-safe.
+ */
+struct DXFCPP_EXPORT InstrumentProfileStringPool final {
+    private:
+    static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+    std::unordered_set<std::string, StringHash, std::equal_to<>> strings_{};
+    std::vector<std::unique_ptr<char[]>> blocks_{};
+    char *blockNext_ = nullptr;
+    std::size_t blockLeft_ = 0;
+    std::size_t bytes_{};
+
+    public:
+    /**
+     * Returns the interned copy of the string.
+     *
+     * @param string The string.
+     * @return The view of the interned string that is valid while the pool exists.
+     */
+    std::string_view intern(std::string_view string);
+
+    /**
+     * Returns the copy of the string without the deduplication. It is cheaper than ::intern() for the strings that are
+     * unique (symbols, descriptions, etc.).
+     *
+     * @param string The string.
+     * @return The view of the copy that is valid while the pool exists.
+     */
+    std::string_view store(std::string_view string);
+
+    /**
+     * @return The number of the distinct interned strings.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * @return The total length of the interned and stored strings.
+     */
+    std::size_t getBytes() const noexcept;
+};
+
+/**
+ * The plain native copy of InstrumentProfile.
+ *
+ * <p>The fields are read directly from the memory, without the calls to the Graal side. The string fields are views of
+ * the strings in an InstrumentProfileStringPool, so the profile is valid while the pool exists. The profiles are
+ * usually kept in InstrumentProfileDataList together with their pools.
+ *
+ * <p>The date fields are day identifiers (the number of days since 1970-01-01), as returned by
+ * InstrumentProfile::getExpiration().
+ */
+struct DXFCPP_EXPORT InstrumentProfileData {
+    /// The alias to the type of the custom fields (the name and the value).
+    using CustomField = std::pair<std::string_view, std::string_view>;
+
+    std::string_view type{};
+    std::string_view symbol{};
+    std::string_view description{};
+    std::string_view localSymbol{};
+    std::string_view localDescription{};
+    std::string_view country{};
+    std::string_view opol{};
+    std::string_view exchangeData{};
+    std::string_view exchanges{};
+    std::string_view currency{};
+    std::string_view baseCurrency{};
+    std::string_view cfi{};
+    std::string_view isin{};
+    std::string_view sedol{};
+    std::string_view cusip{};
+    std::int32_t icb{};
+    std::int32_t sic{};
+    double multiplier{};
+    std::string_view product{};
+    std::string_view underlying{};
+    double spc{};
+    std::string_view additionalUnderlyings{};
+    std::string_view mmy{};
+    std::int32_t expiration{};
+    std::int32_t lastTrade{};
+    double strike{};
+    std::string_view optionType{};
+    std::string_view expirationStyle{};
+    std::string_view settlementStyle{};
+    std::string_view priceIncrements{};
+    std::string_view tradingHours{};
+
+    /// The non-empty custom fields.
+    std::vector<CustomField> customFields{};
+
+    /**
+     * Returns the value of the string field. The numeric fields are returned as empty strings.
+     *
+     * @param field The field.
+     * @return The value of the field.
+     */
+    std::string_view getStringField(const InstrumentProfileField &field) const noexcept;
+
+    /**
+     * Sets the value of the standard string field as is, without interning. The value must stay valid while the profile
+     * is used (usually it is already interned in the pool of the profile). The numeric fields are ignored.
+     *
+     * @param field The field.
+     * @param value The value of the field.
+     */
+    void setStringField(const InstrumentProfileField &field, std::string_view value) noexcept;
+
+    /**
+     * Returns the value of the numeric or date field. The string fields are returned as `0`.
+     *
+     * @param field The field.
+     * @return The value of the field.
+     */
+    double getNumericField(const InstrumentProfileField &field) const noexcept;
+
+    /**
+     * Sets the value of the numeric or date field. The string fields are ignored.
+     *
+     * @param field The field.
+     * @param value The value of the field (the day identifier for the date fields).
+     */
+    void setNumericField(const InstrumentProfileField &field, double value) noexcept;
+
+    /**
+     * Returns the value of the standard string field or the custom field with the specified name.
+     *
+     * @param name The name of the field.
+     * @return The value of the field or an empty string if there is no such field.
+     */
+    std::string_view getField(std::string_view name) const noexcept;
+
+    /**
+     * Sets the value of the standard field or the custom field with the specified name. The values of the numeric and
+     * date fields are parsed. The empty value removes the custom field.
+     *
+     * @param name The name of the field (interned in the pool).
+     * @param value The value of the field (interned in the pool).
+     * @param pool The pool of the strings.
+     * @throws InvalidArgumentException if the value of the numeric or date field can't be parsed.
+     */
+    void setField(std::string_view name, std::string_view value, InstrumentProfileStringPool &pool);
+
+    /**
+     * Sets the value of the standard field. The values of the numeric and date fields are parsed.
+     *
+     * @param field The field.
+     * @param value The value of the field (interned in the pool).
+     * @param pool The pool of the strings.
+     * @throws InvalidArgumentException if the value of the numeric or date field can't be parsed.
+     */
+    void setField(const InstrumentProfileField &field, std::string_view value, InstrumentProfileStringPool &pool);
+
+    /**
+     * Interns all the strings of the profile (including the custom fields) in the pool, so the profile doesn't depend
+     * on the previous storage of its strings.
+     *
+     * @param pool The pool of the strings.
+     */
+    void intern(InstrumentProfileStringPool &pool);
+
+    /**
+     * Creates the native copy of the instrument profile. Each field is read from the Graal side separately.
+     *
+     * @param profile The instrument profile.
+     * @param pool The pool of the strings.
+     * @return The native copy.
+     */
+    static InstrumentProfileData fromProfile(const InstrumentProfile &profile, InstrumentProfileStringPool &pool);
+
+    /**
+     * Parses the number in the IPF format. An empty string is `0`. Only the decimal notation is accepted regardless of
+     * the current locale: infinities, NaN and hexadecimal numbers are not.
+     *
+     * @param value The text.
+     * @return The number.
+     * @throws InvalidArgumentException if the text is not a number.
+     */
+    static double parseNumber(std::string_view value);
+
+    /**
+     * Parses the date in the IPF format (`yyyy-MM-dd`). An empty string is `0`.
+     *
+     * @param value The text.
+     * @return The day identifier.
+     * @throws InvalidArgumentException if the text is not a date.
+     */
+    static std::int32_t parseDate(std::string_view value);
+};
+
+/**
+ * The list of InstrumentProfileData with the pools of their strings.
+ */
+struct DXFCPP_EXPORT InstrumentProfileDataList {
+    /// The pools of the strings of the profiles.
+    std::vector<std::shared_ptr<InstrumentProfileStringPool>> pools{};
+
+    /// The profiles.
+    std::vector<InstrumentProfileData> profiles{};
+
+    /**
+     * @return The number of the profiles.
+     */
+    std::size_t size() const noexcept {
+        return profiles.size();
+    }
+
+    /**
+     * @return `true` if there are no profiles.
+     */
+    bool empty() const noexcept {
+        return profiles.empty();
+    }
+
+    /**
+     * Appends the profiles of the other list and takes its pools.
+     *
+     * @param other The other list.
+     */
+    void append(InstrumentProfileDataList &&other);
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -117,6 +117,12 @@ class DXFCPP_EXPORT InstrumentProfileField {
     InstrumentProfileFieldTypeEnum getTypeEnum() const;
 
     bool isNumericField() const;
+
+    /**
+     * Returns `true` if the values of the field are almost always distinct for each instrument (the symbols, the
+     * descriptions and the identifiers), so the native readers and snapshots store them without the deduplication.
+     */
+    bool isUniqueField() const noexcept;
 };
 
 DXFCPP_END_NAMESPACE
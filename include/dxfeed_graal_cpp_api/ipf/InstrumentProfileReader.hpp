@@ -12,6 +12,7 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
 #include "../internal/Id.hpp"
 #include "../internal/JavaObjectHandle.hpp"
 #include "./InstrumentProfile.hpp"
+#include "./InstrumentProfileData.hpp"
 
 #include <cstdint>
 #include <string>
@@ -63,8 +64,8 @@ class DXFCPP_EXPORT InstrumentProfileReader final : public SharedEntity {
     static Ptr create();
 
     /**
-     * Returns the last modification time (in milliseconds) from the last InstrumentProfileReader::readFromFile() operation
-     * or zero if it is unknown.
+     * Returns the last modification time (in milliseconds) from the last InstrumentProfileReader::readFromFile()
+     * operation or zero if it is unknown.
      */
     std::int64_t getLastModified() const;
 
@@ -139,6 +140,45 @@ class DXFCPP_EXPORT InstrumentProfileReader final : public SharedEntity {
      */
     std::vector<std::shared_ptr<InstrumentProfile>> readFromFile(const StringLike &address,
                                                                  const AuthToken &token) const;
+
+    /**
+     * Reads the instrument profiles from the specified file and returns their native copies.
+     *
+     * <p>This is a convenience over ::readFromFile(const StringLike &) const, not a faster way to read: the profiles
+     * are read as InstrumentProfile objects first, then each of them is copied field by field (a call to the Graal
+     * side per field) and released. The copying therefore adds to the reading time, and the peak memory usage includes
+     * both representations. The fields of the result are then read without the calls to the Graal side. The strings of
+     * the profiles are interned in a common pool. For the local files, NativeInstrumentProfileReader reads the native
+     * profiles without the Graal side at all. See ::readFromFile(const StringLike &) const for the supported formats.
+     *
+     * <p>This operation updates @ref ::getLastModified() "lastModified" and @ref ::wasComplete() "wasComplete".
+     *
+     * @param address URL of file to read from
+     * @return list of the native instrument profiles
+     */
+    InstrumentProfileDataList readDataFromFile(const StringLike &address) const;
+
+    /**
+     * Reads the instrument profiles from the specified address with a specified basic user and password credentials
+     * and returns their native copies. See ::readDataFromFile(const StringLike &) const.
+     *
+     * @param address URL of file to read from
+     * @param user the user name
+     * @param password the password
+     * @return list of the native instrument profiles
+     */
+    InstrumentProfileDataList readDataFromFile(const StringLike &address, const StringLike &user,
+                                               const StringLike &password) const;
+
+    /**
+     * Reads the instrument profiles from the specified address with a specified token credentials and returns their
+     * native copies. See ::readDataFromFile(const StringLike &) const.
+     *
+     * @param address URL of file to read from
+     * @param token the token
+     * @return list of the native instrument profiles
+     */
+    InstrumentProfileDataList readDataFromFile(const StringLike &address, const AuthToken &token) const;
 };
 
 DXFCPP_END_NAMESPACE
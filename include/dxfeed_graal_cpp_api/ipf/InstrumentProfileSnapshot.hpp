@@ -0,0 +1,197 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../entity/SharedEntity.hpp"
+#include "../internal/Common.hpp"
+#include "../internal/utils/MappedFile.hpp"
+#include "../internal/utils/StringUtils.hpp"
+#include "./InstrumentProfileData.hpp"
+#include "./InstrumentProfileField.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+
+/**
+ * \addtogroup dxfcpp_ipf
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The binary snapshot of the instrument profiles for the fast warm starts.
+ *
+ * <p>The snapshot is written once from the loaded profiles (see ::write()) and memory-mapped on the next start (see
+ * ::open()), so the profiles are available without parsing the text IPF again. The file contains the table of strings,
+ * a fixed-width column for each standard field, the custom fields, and the indexes by the symbol and by the underlying.
+ * The string fields are views of the mapped file, so they are valid while the snapshot exists.
+ *
+ * <p>The snapshot stores the last modification time and the completeness of the source (as returned by
+ * InstrumentProfileReader::getLastModified() and InstrumentProfileReader::wasComplete()), which are used to check
+ * whether the snapshot is still valid (see ::isValidFor()).
+ *
+ * <p>The snapshot is immutable and thread-safe. The format is specific to the byte order of the platform.
+ *
+ * ```cpp
+ * auto snapshot = InstrumentProfileSnapshot::loadOrRead("profiles.ipfs", "profiles.ipf.gz");
+ *
+ * if (auto index = snapshot->findBySymbol("AAPL")) {
+ *     std::cout << snapshot->getStringField(*index, InstrumentProfileField::DESCRIPTION) << std::endl;
+ * }
+ * ```
+ */
+struct DXFCPP_EXPORT InstrumentProfileSnapshot final : RequireMakeShared<InstrumentProfileSnapshot> {
+    /// The version of the format of the snapshot.
+    static constexpr std::uint32_t VERSION = 1;
+
+    /// The alias to a type of shared pointer to the InstrumentProfileSnapshot object
+    using Ptr = std::shared_ptr<InstrumentProfileSnapshot>;
+
+    private:
+    static constexpr std::size_t FIELD_COUNT = 31;
+
+    MappedFile file_;
+    std::int64_t lastModified_ = 0;
+    bool complete_ = false;
+    std::size_t size_ = 0;
+    std::string_view strings_{};
+    const char *columns_[FIELD_COUNT]{};
+    std::span<const std::uint32_t> customOffsets_{};
+    const char *customEntries_ = nullptr;
+    std::span<const std::uint32_t> symbolIndex_{};
+    std::span<const std::uint32_t> underlyingIndex_{};
+
+    std::string_view getString(const char *column, std::size_t index) const noexcept;
+
+    public:
+    InstrumentProfileSnapshot(LockExternalConstructionTag, MappedFile &&file, std::string_view path);
+
+    /**
+     * Writes the snapshot of the profiles. The file is written to a temporary file first, and then it is renamed, so
+     * the readers never see a partially written snapshot.
+     *
+     * @param path The path to the snapshot.
+     * @param profiles The profiles.
+     * @param lastModified The last modification time of the source of the profiles.
+     * @param complete `true` if the source of the profiles was complete.
+     * @throws RuntimeException if the file cannot be written.
+     */
+    static void write(const StringLike &path, const InstrumentProfileDataList &profiles, std::int64_t lastModified,
+                      bool complete);
+
+    /**
+     * Opens (memory-maps) the snapshot.
+     *
+     * @param path The path to the snapshot.
+     * @return The snapshot.
+     * @throws RuntimeException if the file cannot be opened or it is not a valid snapshot of the current version.
+     */
+    static Ptr open(const StringLike &path);
+
+    /**
+     * Opens the snapshot if it is valid for the source file. Otherwise, reads the source file with
+     * NativeInstrumentProfileReader, writes the new snapshot and opens it.
+     *
+     * @param snapshotPath The path to the snapshot.
+     * @param sourcePath The path to the source IPF file.
+     * @return The snapshot.
+     * @throws RuntimeException if the source file cannot be read or the snapshot cannot be written.
+     */
+    static Ptr loadOrRead(const StringLike &snapshotPath, const StringLike &sourcePath);
+
+    /**
+     * @return The last modification time of the source of the profiles.
+     */
+    std::int64_t getLastModified() const noexcept;
+
+    /**
+     * @return `true` if the source of the profiles was complete.
+     */
+    bool wasComplete() const noexcept;
+
+    /**
+     * Returns `true` if the snapshot can be used instead of the source with the specified last modification time. The
+     * snapshot is valid if the source was complete and it is not modified since. The unknown (`0`) modification time
+     * always invalidates the snapshot.
+     *
+     * @param lastModified The current last modification time of the source.
+     * @return `true` if the snapshot is valid.
+     */
+    bool isValidFor(std::int64_t lastModified) const noexcept;
+
+    /**
+     * @return The number of the profiles.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * @return `true` if there are no profiles.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * Returns the value of the string field of the profile. The numeric fields are returned as empty strings.
+     *
+     * @param index The index of the profile.
+     * @param field The field.
+     * @return The value of the field that is valid while the snapshot exists.
+     */
+    std::string_view getStringField(std::size_t index, const InstrumentProfileField &field) const noexcept;
+
+    /**
+     * Returns the value of the numeric or date field of the profile. The string fields are returned as `0`.
+     *
+     * @param index The index of the profile.
+     * @param field The field.
+     * @return The value of the field.
+     */
+    double getNumericField(std::size_t index, const InstrumentProfileField &field) const noexcept;
+
+    /**
+     * Returns the profile. The string fields are views of the snapshot, so the profile is valid while the snapshot
+     * exists.
+     *
+     * @param index The index of the profile.
+     * @return The profile.
+     */
+    InstrumentProfileData getProfile(std::size_t index) const;
+
+    /**
+     * Finds the profile by the symbol. If there are several profiles with the symbol, the first one is returned.
+     *
+     * @param symbol The symbol.
+     * @return The index of the profile or `std::nullopt` if there is no such profile.
+     */
+    std::optional<std::size_t> findBySymbol(std::string_view symbol) const noexcept;
+
+    /**
+     * Finds the profiles by the underlying.
+     *
+     * @param underlying The underlying.
+     * @return The indexes of the profiles in ascending order.
+     */
+    std::span<const std::uint32_t> findByUnderlying(std::string_view underlying) const noexcept;
+
+    /**
+     * Copies the profiles. The copies don't depend on the snapshot.
+     *
+     * @return The list of the profiles.
+     */
+    InstrumentProfileDataList toDataList() const;
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
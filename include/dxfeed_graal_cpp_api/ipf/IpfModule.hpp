@@ -13,12 +13,19 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
  */
 
 #include "./InstrumentProfile.hpp"
+#include "./InstrumentProfileData.hpp"
 #include "./InstrumentProfileField.hpp"
 #include "./InstrumentProfileReader.hpp"
+#include "./InstrumentProfileSnapshot.hpp"
 #include "./InstrumentProfileType.hpp"
+#include "./NativeInstrumentProfileReader.hpp"
 #include "./live/InstrumentProfileCollector.hpp"
 #include "./live/InstrumentProfileConnection.hpp"
+#include "./live/InstrumentProfileIndex.hpp"
 #include "./live/IterableInstrumentProfile.hpp"
 #include "./option/OptionChainsBuilder.hpp"
+#include "./option/CompactOptionSeries.hpp"
+#include "./option/CompactOptionChain.hpp"
+#include "./option/CompactOptionChainsBuilder.hpp"
 
 DXFCXX_DISABLE_MSC_WARNINGS_POP()
\ No newline at end of file
@@ -0,0 +1,131 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../entity/SharedEntity.hpp"
+#include "../internal/Common.hpp"
+#include "../internal/utils/StringUtils.hpp"
+#include "./InstrumentProfileData.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+/**
+ * \addtogroup dxfcpp_ipf
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * Reads the local files in the Instrument Profile Format (IPF) without the calls to the Graal side.
+ *
+ * <p>This is an optional replacement of InstrumentProfileReader for the local files, which are read much faster. The
+ * uncompressed file is memory-mapped, while the "gzip" and "zip" files (recognized by their contents, as
+ * InstrumentProfileReader does) are decompressed into memory first. The text is split at the record boundaries into
+ * chunks of Options::chunkSize that are parsed in parallel by Options::parallelism threads. The format lines
+ * (`#TYPE::=TYPE,SYMBOL,...`) are applied to the following records, as in the whole file. The result is the list of
+ * InstrumentProfileData in the order of the file.
+ *
+ * <p>The URLs and the authentication are not supported; use InstrumentProfileReader::readDataFromFile() for them.
+ *
+ * <p>This reader is intended for "one time only" usage: create new instances for new IPF reads. It is not thread-safe.
+ *
+ * ```cpp
+ * auto reader = NativeInstrumentProfileReader::create();
+ * auto profiles = reader->readFromFile("profiles.ipf.gz");
+ *
+ * std::cout << profiles.size() << " profiles, complete: " << reader->wasComplete() << std::endl;
+ * ```
+ */
+struct DXFCPP_EXPORT NativeInstrumentProfileReader final : RequireMakeShared<NativeInstrumentProfileReader> {
+    /**
+     * The options of the reader.
+     */
+    struct Options {
+        /// The number of the parsing threads. `0` means the number of the logical cores.
+        std::size_t parallelism = 0;
+
+        /// The approximate size of a chunk of the text that is parsed by a thread.
+        std::size_t chunkSize = 4 * 1024 * 1024;
+    };
+
+    /// The alias to a type of shared pointer to the NativeInstrumentProfileReader object
+    using Ptr = std::shared_ptr<NativeInstrumentProfileReader>;
+
+    private:
+    std::size_t parallelism_;
+    std::size_t chunkSize_;
+    std::int64_t lastModified_ = 0;
+    bool wasComplete_ = false;
+
+    public:
+    NativeInstrumentProfileReader(LockExternalConstructionTag, const Options &options);
+
+    /**
+     * Creates the new reader.
+     *
+     * @param options The options of the reader.
+     * @return The new reader.
+     */
+    static Ptr create(const Options &options);
+
+    /**
+     * Creates the new reader with the default options.
+     *
+     * @return The new reader.
+     */
+    static Ptr create();
+
+    /**
+     * Returns the last modification time (in milliseconds) of the file from the last ::readFromFile() operation or
+     * zero if it is unknown.
+     */
+    std::int64_t getLastModified() const noexcept;
+
+    /**
+     * Returns `true` if the IPF was fully read (it had the "##COMPLETE" tag) on the last read operation.
+     */
+    bool wasComplete() const noexcept;
+
+    /**
+     * Reads the instrument profiles from the local file. The "gzip" and "zip" (the first entry) files are decompressed.
+     *
+     * <p>This operation updates @ref ::getLastModified() "lastModified" and @ref ::wasComplete() "wasComplete".
+     *
+     * @param path The path to the file. The "file:" prefix is allowed.
+     * @return The list of the native instrument profiles.
+     * @throws RuntimeException if the file cannot be read or does not conform to the Instrument Profile Format.
+     */
+    InstrumentProfileDataList readFromFile(const StringLike &path);
+
+    /**
+     * Reads the instrument profiles from the data in memory. The "gzip" and "zip" data are decompressed.
+     *
+     * <p>This operation updates @ref ::wasComplete() "wasComplete" and resets
+     * @ref ::getLastModified() "lastModified".
+     *
+     * @param data The data.
+     * @return The list of the native instrument profiles.
+     * @throws RuntimeException if the data does not conform to the Instrument Profile Format.
+     */
+    InstrumentProfileDataList read(std::string_view data);
+
+    private:
+    InstrumentProfileDataList readData(std::string_view data);
+
+    InstrumentProfileDataList parse(std::string_view text);
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -0,0 +1,224 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../../entity/SharedEntity.hpp"
+#include "../../internal/Common.hpp"
+#include "../../internal/Handler.hpp"
+#include "../InstrumentProfile.hpp"
+#include "../InstrumentProfileData.hpp"
+#include "./InstrumentProfileCollector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_ipf
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The native indexes of the instrument profiles for the fast queries of the instrument universe.
+ *
+ * <p>The index keeps a unique profile per symbol (as InstrumentProfileCollector does) as InstrumentProfileData, and
+ * each profile gets an integer identifier. The index maintains:
+ * - the hash indexes by the symbol, the underlying, the product and the exchange (each of the
+ *   @ref InstrumentProfile::getExchanges() "exchanges" of the profile);
+ * - the expiration index (the profiles with the non-zero expiration sorted by it);
+ * - the CFI index for the queries by a CFI prefix;
+ * - the profiles of each underlying sorted by the expiration, for the queries like "all the options on the underlying
+ *   expiring this week".
+ *
+ * <p>The queries return the identifiers of the profiles, and the profiles themselves are copied with ::getProfile() or
+ * ::getProfiles(). An update or a removal of a profile takes amortized `O(log n)` time.
+ *
+ * <p>The index is usually connected to InstrumentProfileCollector with ::create(const InstrumentProfileCollector::Ptr
+ * &), so its update listener keeps the index current. The profiles can also be added directly (for example, the ones
+ * read by NativeInstrumentProfileReader).
+ *
+ * <p>The identifier of a removed profile can be reused by a new profile. The strings of the profiles are interned in
+ * the pool of the index. The pool is compacted (the strings of the current profiles are moved to a new pool) each time
+ * it doubles, so the strings of the updated and removed profiles don't accumulate. The copies of the profiles
+ * therefore either share the pool (::getProfiles()) or are interned in the pool of the caller (::getProfile()).
+ *
+ * <p><b>This class is thread-safe.</b>
+ *
+ * ```cpp
+ * auto index = InstrumentProfileIndex::create(collector);
+ * auto today = static_cast<std::int32_t>(dxfcpp::now() / (24 * 3600 * 1000));
+ *
+ * for (auto &&profile : index->getProfiles(index->findByUnderlying("AAPL", today, today + 7)).profiles) {
+ *     std::cout << profile.symbol << std::endl;
+ * }
+ * ```
+ */
+struct DXFCPP_EXPORT InstrumentProfileIndex final : RequireMakeShared<InstrumentProfileIndex> {
+    /// The alias to a type of the identifier of the profile
+    using ProfileId = std::uint32_t;
+
+    /// The alias to a type of shared pointer to the InstrumentProfileIndex object
+    using Ptr = std::shared_ptr<InstrumentProfileIndex>;
+
+    private:
+    struct State;
+
+    // The state is shared with the listener of the collector, so the index can be destroyed at any moment.
+    std::shared_ptr<State> state_;
+    InstrumentProfileCollector::Ptr collector_{};
+    std::size_t listenerId_{};
+
+    public:
+    explicit InstrumentProfileIndex(LockExternalConstructionTag);
+
+    ~InstrumentProfileIndex() noexcept override;
+
+    /**
+     * Creates the new empty index.
+     *
+     * @return The new index.
+     */
+    static Ptr create();
+
+    /**
+     * Creates the new index that is kept current by the update listener of the collector. The current profiles of the
+     * collector are added immediately. The listener is removed when the index is destroyed.
+     *
+     * @param collector The collector of the instrument profiles.
+     * @return The new index.
+     */
+    static Ptr create(const InstrumentProfileCollector::Ptr &collector);
+
+    /**
+     * Adds, updates or removes the profiles. The profiles with the
+     * @ref InstrumentProfileType::REMOVED "REMOVED" type are removed.
+     *
+     * @param profiles The profiles.
+     */
+    void update(const std::vector<std::shared_ptr<InstrumentProfile>> &profiles);
+
+    /**
+     * Adds or updates the profiles. The profiles with the @ref InstrumentProfileType::REMOVED "REMOVED" type are
+     * removed.
+     *
+     * @param profiles The profiles.
+     */
+    void update(const InstrumentProfileDataList &profiles);
+
+    /**
+     * Adds or updates the profile. The profile with the @ref InstrumentProfileType::REMOVED "REMOVED" type is removed.
+     *
+     * @param profile The profile.
+     * @return The identifier of the profile or `std::nullopt` if the profile was removed (or it has no symbol).
+     */
+    std::optional<ProfileId> update(const InstrumentProfileData &profile);
+
+    /**
+     * Removes the profile.
+     *
+     * @param symbol The symbol of the profile.
+     * @return `true` if the profile was removed.
+     */
+    bool remove(std::string_view symbol);
+
+    /**
+     * @return The number of the profiles.
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns the copy of the profile.
+     *
+     * @param id The identifier of the profile.
+     * @param pool The pool the strings of the copy are interned in.
+     * @return The profile or `std::nullopt` if there is no such profile.
+     */
+    std::optional<InstrumentProfileData> getProfile(ProfileId id, InstrumentProfileStringPool &pool) const;
+
+    /**
+     * Returns the copies of the profiles. The unknown identifiers are skipped. The list shares the current pool of the
+     * index, so the strings are not copied and remain valid after the compaction.
+     *
+     * @param ids The identifiers of the profiles.
+     * @return The profiles.
+     */
+    InstrumentProfileDataList getProfiles(const std::vector<ProfileId> &ids) const;
+
+    /**
+     * Finds the profile by the symbol.
+     *
+     * @param symbol The symbol.
+     * @return The identifier of the profile or `std::nullopt` if there is no such profile.
+     */
+    std::optional<ProfileId> findBySymbol(std::string_view symbol) const;
+
+    /**
+     * Finds the profiles by the underlying.
+     *
+     * @param underlying The underlying.
+     * @return The identifiers of the profiles sorted by the expiration.
+     */
+    std::vector<ProfileId> findByUnderlying(std::string_view underlying) const;
+
+    /**
+     * Finds the profiles by the underlying with the expiration in the range.
+     *
+     * @param underlying The underlying.
+     * @param fromExpiration The first day identifier of the range (inclusive).
+     * @param toExpiration The last day identifier of the range (inclusive).
+     * @return The identifiers of the profiles sorted by the expiration.
+     */
+    std::vector<ProfileId> findByUnderlying(std::string_view underlying, std::int32_t fromExpiration,
+                                            std::int32_t toExpiration) const;
+
+    /**
+     * Finds the profiles by the product.
+     *
+     * @param product The product.
+     * @return The identifiers of the profiles in ascending order.
+     */
+    std::vector<ProfileId> findByProduct(std::string_view product) const;
+
+    /**
+     * Finds the profiles that are traded on the exchange (it is one of the
+     * @ref InstrumentProfile::getExchanges() "exchanges" of the profile).
+     *
+     * @param exchange The exchange (MIC).
+     * @return The identifiers of the profiles in ascending order.
+     */
+    std::vector<ProfileId> findByExchange(std::string_view exchange) const;
+
+    /**
+     * Finds the profiles with the expiration in the range.
+     *
+     * @param fromExpiration The first day identifier of the range (inclusive).
+     * @param toExpiration The last day identifier of the range (inclusive).
+     * @return The identifiers of the profiles sorted by the expiration.
+     */
+    std::vector<ProfileId> findByExpiration(std::int32_t fromExpiration, std::int32_t toExpiration) const;
+
+    /**
+     * Finds the profiles with the CFI starting with the prefix (for example, "ES" for the common shares or "O" for
+     * the options).
+     *
+     * @param prefix The prefix of the CFI.
+     * @return The identifiers of the profiles sorted by the CFI.
+     */
+    std::vector<ProfileId> findByCfiPrefix(std::string_view prefix) const;
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
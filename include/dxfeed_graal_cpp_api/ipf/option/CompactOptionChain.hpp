@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../../internal/Common.hpp"
+#include "./CompactOptionSeries.hpp"
+#include "./OptionChain.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_ipf
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The compact representation of OptionChain: the option series for a single product or underlying symbol as a sorted
+ * array of CompactOptionSeries.
+ *
+ * <h3>Threads and locks</h3>
+ * This class is immutable after its creation and can be used from multiple threads.
+ *
+ * @tparam T The type of option instrument instances.
+ */
+template <typename T> class CompactOptionChain final {
+    friend struct CompactOptionChainsBuilder;
+
+    std::string symbol_{};
+    std::vector<CompactOptionSeries<T>> series_{};
+
+    struct ExpirationComparator {
+        bool operator()(const CompactOptionSeries<T> &series, std::int32_t expiration) const {
+            return series.getExpiration() < expiration;
+        }
+
+        bool operator()(std::int32_t expiration, const CompactOptionSeries<T> &series) const {
+            return expiration < series.getExpiration();
+        }
+    };
+
+    public:
+    /**
+     * Creates the empty chain.
+     */
+    CompactOptionChain() = default;
+
+    /**
+     * Creates the compact copy of the chain.
+     *
+     * @param chain The chain.
+     */
+    explicit CompactOptionChain(const OptionChain<T> &chain) : symbol_{chain.symbol_} {
+        series_.reserve(chain.series_.size());
+
+        for (const auto &series : chain.series_) {
+            series_.emplace_back(series);
+        }
+    }
+
+    /**
+     * Returns symbol (product or underlying) of this option chain.
+     *
+     * @return symbol (product or underlying) of this option chain.
+     */
+    const std::string &getSymbol() const & {
+        return symbol_;
+    }
+
+    /**
+     * Returns the option series of this chain in the order of OptionSeries (by expiration first).
+     *
+     * @return The option series.
+     */
+    const std::vector<CompactOptionSeries<T>> &getSeries() const & {
+        return series_;
+    }
+
+    /**
+     * Returns the option series with the expiration.
+     *
+     * @param expiration The day id of expiration.
+     * @return The option series with the expiration (the view of ::getSeries()).
+     */
+    std::span<const CompactOptionSeries<T>> getSeriesByExpiration(std::int32_t expiration) const {
+        const auto [begin, end] =
+            std::equal_range(series_.begin(), series_.end(), expiration, ExpirationComparator{});
+
+        return {begin, end};
+    }
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -0,0 +1,94 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../../internal/Common.hpp"
+#include "../InstrumentProfileData.hpp"
+#include "./CompactOptionChain.hpp"
+#include "./OptionChain.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/**
+ * \addtogroup dxfcpp_ipf
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * Builds the compact option chains (CompactOptionChain) grouped by product or underlying symbol.
+ *
+ * <p>The chains are built from the native profiles (InstrumentProfileData) with the same rules as
+ * OptionChainsBuilder::build(), but the chains of the different symbols are built in parallel, and each chain is built
+ * by sorting its options once instead of inserting them one by one. The options of the chains are the aliases of the
+ * profiles in the list, so the list is kept alive while the chains exist.
+ *
+ * ```cpp
+ * auto profiles = std::make_shared<InstrumentProfileDataList>(
+ *     NativeInstrumentProfileReader::create()->readFromFile("profiles.ipf.gz"));
+ * auto chains = CompactOptionChainsBuilder::build(profiles);
+ *
+ * for (const auto &series : chains.at("SPX").getSeries()) {
+ *     for (auto strike : series.getNStrikesAround(10, 5000.0)) {
+ *         std::cout << series.getExpiration() << " " << strike << std::endl;
+ *     }
+ * }
+ * ```
+ */
+struct DXFCPP_EXPORT CompactOptionChainsBuilder final {
+    /// The alias to a type of the chains of the native profiles by their symbols
+    using Chains = std::unordered_map<std::string, CompactOptionChain<const InstrumentProfileData>>;
+
+    /**
+     * Builds the option chains for all the options of the profiles using all the logical cores.
+     *
+     * @param profiles The profiles.
+     * @return The option chains by their symbols.
+     */
+    static Chains build(const std::shared_ptr<const InstrumentProfileDataList> &profiles);
+
+    /**
+     * Builds the option chains for all the options of the profiles.
+     *
+     * @param profiles The profiles.
+     * @param parallelism The number of the threads. `0` means the number of the logical cores.
+     * @return The option chains by their symbols.
+     */
+    static Chains build(const std::shared_ptr<const InstrumentProfileDataList> &profiles, std::size_t parallelism);
+
+    /**
+     * Converts the chains that are built by OptionChainsBuilder.
+     *
+     * @tparam T The type of option instrument instances.
+     * @param chains The chains (see OptionChainsBuilder::getChains()).
+     * @return The compact option chains by their symbols.
+     */
+    template <typename T>
+    static std::unordered_map<std::string, CompactOptionChain<T>>
+    from(const std::unordered_map<std::string, OptionChain<T>> &chains) {
+        std::unordered_map<std::string, CompactOptionChain<T>> result{};
+
+        result.reserve(chains.size());
+
+        for (const auto &[symbol, chain] : chains) {
+            result.try_emplace(symbol, chain);
+        }
+
+        return result;
+    }
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -0,0 +1,218 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../../internal/Common.hpp"
+#include "./OptionSeries.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_ipf
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The compact representation of OptionSeries for the fast lookups.
+ *
+ * <p>The strikes are stored in a sorted contiguous array, and the calls and the puts are stored in the arrays of the
+ * same size, so the options of the strike `getStrikes()[i]` are `getCalls()[i]` and `getPuts()[i]` (`nullptr` if there
+ * is no such option). The lookups by the strike are binary searches, and ::getNStrikesAround() doesn't allocate the
+ * memory.
+ *
+ * <h3>Threads and locks</h3>
+ * This class is immutable after its creation and can be used from multiple threads.
+ *
+ * @tparam T The type of option instrument instances.
+ */
+template <typename T> class CompactOptionSeries final {
+    friend struct CompactOptionChainsBuilder;
+
+    OptionSeries<T> attributes_{};
+    std::vector<double> strikes_{};
+    std::vector<std::shared_ptr<T>> calls_{};
+    std::vector<std::shared_ptr<T>> puts_{};
+
+    public:
+    /**
+     * Creates the empty series.
+     */
+    CompactOptionSeries() = default;
+
+    /**
+     * Creates the compact copy of the series.
+     *
+     * @param series The series.
+     */
+    explicit CompactOptionSeries(const OptionSeries<T> &series) : attributes_{series} {
+        attributes_.calls_.clear();
+        attributes_.puts_.clear();
+        attributes_.strikes_.clear();
+        strikes_ = series.getStrikes();
+        calls_.resize(strikes_.size());
+        puts_.resize(strikes_.size());
+
+        for (std::size_t i = 0; i < strikes_.size(); i++) {
+            if (const auto call = series.calls_.find(strikes_[i]); call != series.calls_.end()) {
+                calls_[i] = call->second;
+            }
+
+            if (const auto put = series.puts_.find(strikes_[i]); put != series.puts_.end()) {
+                puts_[i] = put->second;
+            }
+        }
+    }
+
+    /**
+     * Returns the attributes of the series (expiration, last trading day, spc, multiplier, etc.). The returned series
+     * contains no options.
+     *
+     * @return The attributes of the series.
+     */
+    const OptionSeries<T> &getAttributes() const {
+        return attributes_;
+    }
+
+    /**
+     * Returns day id of expiration.
+     *
+     * @return day id of expiration.
+     */
+    std::int32_t getExpiration() const {
+        return attributes_.getExpiration();
+    }
+
+    /**
+     * @return The number of the strikes.
+     */
+    std::size_t size() const {
+        return strikes_.size();
+    }
+
+    /**
+     * Returns all the strikes in ascending order.
+     *
+     * @return The strikes in ascending order.
+     */
+    const std::vector<double> &getStrikes() const {
+        return strikes_;
+    }
+
+    /**
+     * Returns the calls by the positions of the strikes (`nullptr` if there is no call with the strike).
+     *
+     * @return The calls.
+     */
+    const std::vector<std::shared_ptr<T>> &getCalls() const {
+        return calls_;
+    }
+
+    /**
+     * Returns the puts by the positions of the strikes (`nullptr` if there is no put with the strike).
+     *
+     * @return The puts.
+     */
+    const std::vector<std::shared_ptr<T>> &getPuts() const {
+        return puts_;
+    }
+
+    /**
+     * Returns the position of the first strike that is not less than the specified one.
+     *
+     * @param strike The strike.
+     * @return The position of the strike or ::size() if all the strikes are less than the specified one.
+     */
+    std::size_t getStrikeIndex(double strike) const {
+        return static_cast<std::size_t>(std::lower_bound(strikes_.begin(), strikes_.end(), strike) - strikes_.begin());
+    }
+
+    /**
+     * Finds the position of the strike.
+     *
+     * @param strike The strike.
+     * @return The position of the strike or `std::nullopt` if there is no such strike.
+     */
+    std::optional<std::size_t> findStrike(double strike) const {
+        if (const auto index = getStrikeIndex(strike); index < strikes_.size() && strikes_[index] == strike) {
+            return index;
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * Returns the call with the strike.
+     *
+     * @param strike The strike.
+     * @return The call or `nullptr` if there is no such call.
+     */
+    std::shared_ptr<T> getCall(double strike) const {
+        const auto index = findStrike(strike);
+
+        return index ? calls_[*index] : nullptr;
+    }
+
+    /**
+     * Returns the put with the strike.
+     *
+     * @param strike The strike.
+     * @return The put or `nullptr` if there is no such put.
+     */
+    std::shared_ptr<T> getPut(double strike) const {
+        const auto index = findStrike(strike);
+
+        return index ? puts_[*index] : nullptr;
+    }
+
+    /**
+     * Returns the range of the positions of n strikes which are centered around a specified strike value (as
+     * OptionSeries::getNStrikesAround() does).
+     *
+     * @param n The maximal number of strikes.
+     * @param strike The center strike.
+     * @return The first position and the position after the last one.
+     */
+    std::pair<std::size_t, std::size_t> getNStrikesAroundRange(std::size_t n, double strike) const {
+        const auto index = getStrikeIndex(strike);
+        const std::size_t fromIndex = (index < n / 2) ? 0 : (index - n / 2);
+        const std::size_t toIndex = std::min(strikes_.size(), fromIndex + n);
+
+        return {std::min(fromIndex, toIndex), toIndex};
+    }
+
+    /**
+     * Returns n strikes which are centered around a specified strike value.
+     *
+     * @param n The maximal number of strikes to return.
+     * @param strike The center strike.
+     * @return n strikes which are centered around a specified strike value (the view of ::getStrikes()).
+     */
+    std::span<const double> getNStrikesAround(std::size_t n, double strike) const {
+        const auto [from, to] = getNStrikesAroundRange(n, strike);
+
+        return std::span<const double>(strikes_).subspan(from, to - from);
+    }
+
+    bool operator<(const CompactOptionSeries &other) const {
+        return attributes_ < other.attributes_;
+    }
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -20,6 +20,8 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
 
 DXFCPP_BEGIN_NAMESPACE
 
+template <typename T> class CompactOptionChain;
+
 /**
  * Set of option series for a single product or underlying symbol.
  *
@@ -31,6 +33,7 @@ DXFCPP_BEGIN_NAMESPACE
  */
 template <typename T> class OptionChain final {
     friend class OptionChainsBuilder<T>;
+    friend class CompactOptionChain<T>;
 
     std::string symbol_{};
     std::set<OptionSeries<T>> series_{};
@@ -27,6 +27,8 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
 DXFCPP_BEGIN_NAMESPACE
 
 template <typename T> class OptionChainsBuilder;
+template <typename T> class CompactOptionSeries;
+struct CompactOptionChainsBuilder;
 
 /**
  * Series of call and put options with different strike sharing the same attributes of expiration, last trading day,
@@ -39,6 +41,8 @@ template <typename T> class OptionChainsBuilder;
  */
 template <typename T> class OptionSeries final {
     friend class OptionChainsBuilder<T>;
+    friend class CompactOptionSeries<T>;
+    friend struct CompactOptionChainsBuilder;
 
     std::int32_t expiration_ = 0;
     std::int32_t lastTrade_ = 0;
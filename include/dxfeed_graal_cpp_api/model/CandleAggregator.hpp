@@ -0,0 +1,233 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../entity/SharedEntity.hpp"
+#include "../event/candle/Candle.hpp"
+#include "../event/candle/CandleSymbol.hpp"
+#include "../internal/Common.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_model
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+struct DXFeed;
+struct DXFeedSubscription;
+struct Schedule;
+
+/**
+ * An aggregator that builds Candle events from the stream of trades on the client side.
+ *
+ * <p>The candles are described by CandleSymbol specifications, like the candles that are built by the server:
+ * <ul>
+ * <li>the @ref CandlePeriod "period" can be of the time types (CandleType::SECOND, CandleType::MINUTE,
+ * CandleType::HOUR, CandleType::DAY, CandleType::WEEK, CandleType::MONTH, CandleType::YEAR, including the fractional
+ * values like `0.25s`), of the CandleType::TICK, CandleType::VOLUME or CandleType::PRICE types;
+ * <li>the @ref CandleExchange "exchange" selects the regional trades;
+ * <li>the @ref CandleAlignment::SESSION "session alignment" and the @ref CandleSession::REGULAR "regular session"
+ * filter require a @ref CandleAggregator::Builder::withSchedule() "schedule".
+ * </ul>
+ * Only the CandlePrice::LAST price is supported.
+ *
+ * <p>The aggregator consumes TimeAndSale events (valid new ticks). Trade and TradeETH are not accepted: they are
+ * conflated snapshots of the last trade, so the trades between two deliveries would be lost for the volume, the count,
+ * the high and the low of the candles. Each trade is applied to the current candle of each matching specification in
+ * O(1). The candles that have been completed are passed to the listener as the <b>final</b> candles. If
+ * @ref CandleAggregator::Builder::withPartialCandles() "partial candles" are enabled, the current candles that have
+ * been updated are passed to the listener after each batch of events as well (one candle per specification). The time
+ * candles are completed by the first trade after the end of the candle or by CandleAggregator::advanceTime(). All the
+ * current candles are completed by CandleAggregator::flush().
+ *
+ * <p>The implied volatility of the candles is passed through from the last Greeks event of the symbol if
+ * @ref CandleAggregator::Builder::withImpVolatility() "enabled".
+ *
+ * <h3>Threads and locks</h3>
+ *
+ * <p>This class is thread-safe. The listener is called synchronously, while the aggregator is locked.
+ *
+ * Sample:
+ *
+ * ```cpp
+ * auto aggregator = CandleAggregator::newBuilder()
+ *                       ->withFeed(feed)
+ *                       ->withSymbols({CandleSymbol::valueOf("AAPL{=0.25s}"), CandleSymbol::valueOf("AAPL{=100t}")})
+ *                       ->withPartialCandles(true)
+ *                       ->withListener([](const auto &candles, bool isFinal) {
+ *                           for (const auto &candle : candles) {
+ *                               std::cout << (isFinal ? "Final: " : "Partial: ") << candle << std::endl;
+ *                           }
+ *                       })
+ *                       ->build();
+ * ```
+ */
+struct DXFCPP_EXPORT CandleAggregator final : RequireMakeShared<CandleAggregator> {
+    /**
+     * The listener's signature.
+     */
+    using Listener =
+        std::function<void(const std::vector<std::shared_ptr<Candle>> & /* candles */, bool /* isFinal */)>;
+
+    /**
+     * A builder class for creating an instance of CandleAggregator.
+     */
+    struct DXFCPP_EXPORT Builder final : RequireMakeShared<Builder> {
+        friend struct CandleAggregator;
+
+        private:
+        std::shared_ptr<DXFeed> feed_{};
+        std::vector<CandleSymbol> symbols_{};
+        std::shared_ptr<Schedule> schedule_{};
+        bool partialCandles_{};
+        bool impVolatility_{};
+        Listener listener_{};
+
+        public:
+        explicit Builder(LockExternalConstructionTag);
+
+        ~Builder() noexcept override;
+
+        /**
+         * Sets the DXFeed for the aggregator being created. The aggregator subscribes to the trades of the symbols.
+         * If the feed is not set, the events must be passed to CandleAggregator::process().
+         *
+         * @param feed The DXFeed.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withFeed(std::shared_ptr<DXFeed> feed);
+
+        /**
+         * Adds the candle specification to the aggregator being created.
+         *
+         * @param symbol The candle symbol.
+         * @return The builder instance.
+         * @throws InvalidArgumentException if the period, the price or the session of the symbol are not supported.
+         */
+        std::shared_ptr<Builder> withSymbol(const CandleSymbol &symbol);
+
+        /**
+         * Adds the candle specifications to the aggregator being created.
+         *
+         * @param symbols The candle symbols.
+         * @return The builder instance.
+         * @throws InvalidArgumentException if the period, the price or the session of a symbol are not supported.
+         */
+        std::shared_ptr<Builder> withSymbols(std::initializer_list<CandleSymbol> symbols);
+
+        /**
+         * Sets the schedule that is used for the session alignment and for the regular session filter.
+         *
+         * @param schedule The schedule.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withSchedule(std::shared_ptr<Schedule> schedule);
+
+        /**
+         * Enables the delivery of the current (incomplete) candles after each batch of events.
+         *
+         * @param partialCandles `true` to enable the partial candles.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withPartialCandles(bool partialCandles);
+
+        /**
+         * Enables the subscription to Greeks to pass the implied volatility through to the candles.
+         *
+         * @param impVolatility `true` to enable the implied volatility.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withImpVolatility(bool impVolatility);
+
+        /**
+         * Sets the listener for the candles.
+         *
+         * @param listener The listener.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withListener(Listener listener);
+
+        /**
+         * Builds an instance of CandleAggregator based on the provided parameters.
+         *
+         * @return The created CandleAggregator.
+         * @throws InvalidArgumentException if there are no symbols, or if a symbol requires a schedule that has not
+         * been set.
+         */
+        std::shared_ptr<CandleAggregator> build();
+    };
+
+    private:
+    struct Impl;
+
+    mutable std::recursive_mutex mtx_{};
+    std::unique_ptr<Impl> impl_;
+    std::shared_ptr<DXFeedSubscription> subscription_{};
+
+    static std::shared_ptr<CandleAggregator> create(const std::shared_ptr<Builder> &builder);
+
+    public:
+    CandleAggregator(LockExternalConstructionTag, const std::shared_ptr<Builder> &builder);
+
+    ~CandleAggregator() noexcept override;
+
+    /**
+     * Creates a new builder instance for constructing a CandleAggregator.
+     *
+     * @return A new instance of the builder.
+     */
+    static std::shared_ptr<Builder> newBuilder();
+
+    /**
+     * Applies the batch of events to the candles. The events of the unknown symbols and of the other types are
+     * ignored.
+     *
+     * @param events The events.
+     */
+    void process(const std::vector<std::shared_ptr<EventType>> &events);
+
+    /**
+     * Completes the time candles that end at or before the specified time (e.g. on a timer, when there are no
+     * trades).
+     *
+     * @param time The time in milliseconds since epoch.
+     */
+    void advanceTime(std::int64_t time);
+
+    /**
+     * Completes all the current candles.
+     */
+    void flush();
+
+    /**
+     * Returns copies of the current (incomplete) candles.
+     *
+     * @return The current candles.
+     */
+    std::vector<std::shared_ptr<Candle>> getCurrentCandles() const;
+
+    /**
+     * Closes this aggregator: the subscription is closed, the current candles are discarded.
+     */
+    void close();
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -0,0 +1,551 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../event/EventFlag.hpp"
+#include "../event/IndexedEventSource.hpp"
+#include "../event/market/OrderBase.hpp"
+#include "../event/market/Side.hpp"
+#include "../internal/Common.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_model
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The position of an order in the FIFO queue of its price level.
+ */
+struct DXFCPP_EXPORT MarketByOrderQueuePosition {
+    /// The number of orders ahead of the order at the same price level.
+    std::size_t position{};
+    /// The total size of the orders ahead of the order at the same price level.
+    double sizeAhead{};
+    /// The size of the order.
+    double size{};
+    /// The price of the order (of the price level).
+    double price{};
+    /// `true` if the order is a buy order.
+    bool isBuy{};
+
+    bool operator==(const MarketByOrderQueuePosition &) const = default;
+};
+
+/**
+ * A market-by-order book: every order is kept in the FIFO queue of its price level, so the position of each order in
+ * its queue and the size ahead of it are known (e.g. for fill simulation).
+ *
+ * <p>The orders are keyed by @ref IndexedEvent::getIndex() "index" and live in a pooled slab; each price level is an
+ * intrusive doubly linked list of the slab nodes. Adding an order to an existing level, modifying and cancelling an
+ * order are O(1). Only the creation or the removal of a price level costs O(log L), where L is the number of the levels
+ * of the side.
+ *
+ * <p>The queue position of an order is cached when the order joins the queue. The fills at the head of the queue (the
+ * removal or the size decrease of the first order) are counted by the level, and the cached positions are shifted by
+ * these counters, so with a typical flow of additions, fills and cancellations at the back the queries are O(1). Only
+ * a cancellation or a size decrease in the middle of the queue makes the orders behind it recompute their positions
+ * (by walking the orders ahead) on the next query.
+ *
+ * <p>Queue priority rules: an order that changes its price or side moves to the back of the queue of the new level;
+ * an order that increases its size also moves to the back of its queue; an order that decreases its size keeps its
+ * position.
+ *
+ * <p>The book is updated with the transactions of the IndexedTxModel, see MarketByOrderBook::update().
+ * This class is not thread-safe, see MarketByOrderModel for the thread-safe model on top of the book.
+ *
+ * @tparam O The type of order derived from OrderBase.
+ */
+template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketByOrderBook final {
+    /// The index of the slab node.
+    using Slot = std::uint32_t;
+
+    static constexpr Slot NONE = std::numeric_limits<Slot>::max();
+
+    private:
+    struct Node {
+        std::shared_ptr<O> order{};
+        std::int64_t index{};
+        double size{};
+        Slot prev{NONE};
+        Slot next{NONE};
+        Slot level{NONE};
+        std::int32_t sourceId{};
+        bool isBuy{};
+        // The cached queue position that is valid while it is equal to the version of the level. The orders and the
+        // size that have been dequeued from the head of the level since then are ahead of the order no longer.
+        mutable std::uint64_t cacheVersion{};
+        mutable std::size_t cachedPosition{};
+        mutable double cachedSizeAhead{};
+        mutable std::size_t cachedDequeuedCount{};
+        mutable double cachedDequeuedSize{};
+    };
+
+    struct Level {
+        double price{};
+        double size{};
+        std::size_t count{};
+        Slot head{NONE};
+        Slot tail{NONE};
+        // Changes when the positions of the queued orders change other than by the fills at the head.
+        std::uint64_t version{1};
+        // The number and the total size of the orders that have left the head of the queue (the fills).
+        std::size_t dequeuedCount{};
+        double dequeuedSize{};
+        bool isBuy{};
+    };
+
+    template <typename T> struct Slab {
+        std::vector<T> items{};
+        std::vector<Slot> free{};
+
+        Slot allocate() {
+            if (!free.empty()) {
+                auto slot = free.back();
+
+                free.pop_back();
+
+                return slot;
+            }
+
+            items.emplace_back();
+
+            return static_cast<Slot>(items.size() - 1);
+        }
+
+        void release(Slot slot) {
+            items[slot] = T{};
+            free.push_back(slot);
+        }
+
+        T &operator[](Slot slot) noexcept {
+            return items[slot];
+        }
+
+        const T &operator[](Slot slot) const noexcept {
+            return items[slot];
+        }
+
+        void clear() noexcept {
+            items.clear();
+            free.clear();
+        }
+    };
+
+    Slab<Node> nodes_{};
+    Slab<Level> levels_{};
+    std::unordered_map<std::int64_t, Slot> orders_{};
+    std::unordered_map<double, Slot> buyLevelsByPrice_{};
+    std::unordered_map<double, Slot> sellLevelsByPrice_{};
+    std::set<double, std::greater<>> buyPrices_{};
+    std::set<double, std::less<>> sellPrices_{};
+
+    Slot findOrCreateLevel(bool isBuy, double price) {
+        auto &byPrice = isBuy ? buyLevelsByPrice_ : sellLevelsByPrice_;
+
+        if (auto found = byPrice.find(price); found != byPrice.end()) {
+            return found->second;
+        }
+
+        auto slot = levels_.allocate();
+        auto &level = levels_[slot];
+
+        level.price = price;
+        level.isBuy = isBuy;
+        byPrice.emplace(price, slot);
+
+        if (isBuy) {
+            buyPrices_.insert(price);
+        } else {
+            sellPrices_.insert(price);
+        }
+
+        return slot;
+    }
+
+    void releaseLevel(Slot slot) {
+        const auto &level = levels_[slot];
+
+        if (level.isBuy) {
+            buyLevelsByPrice_.erase(level.price);
+            buyPrices_.erase(level.price);
+        } else {
+            sellLevelsByPrice_.erase(level.price);
+            sellPrices_.erase(level.price);
+        }
+
+        levels_.release(slot);
+    }
+
+    void pushBack(Slot levelSlot, Slot nodeSlot) noexcept {
+        auto &level = levels_[levelSlot];
+        auto &node = nodes_[nodeSlot];
+
+        node.level = levelSlot;
+        node.cacheVersion = level.version;
+        node.cachedPosition = level.count;
+        node.cachedSizeAhead = level.size;
+        node.cachedDequeuedCount = level.dequeuedCount;
+        node.cachedDequeuedSize = level.dequeuedSize;
+        node.prev = level.tail;
+        node.next = NONE;
+
+        if (level.tail != NONE) {
+            nodes_[level.tail].next = nodeSlot;
+        } else {
+            level.head = nodeSlot;
+        }
+
+        level.tail = nodeSlot;
+        level.size += node.size;
+        level.count++;
+    }
+
+    // Unlinks the node from its level, releases the level if it becomes empty.
+    void unlink(Slot nodeSlot) {
+        auto &node = nodes_[nodeSlot];
+        auto levelSlot = node.level;
+        auto &level = levels_[levelSlot];
+        const bool isHead = node.prev == NONE;
+        const bool isTail = node.next == NONE;
+
+        if (node.prev != NONE) {
+            nodes_[node.prev].next = node.next;
+        } else {
+            level.head = node.next;
+        }
+
+        if (node.next != NONE) {
+            nodes_[node.next].prev = node.prev;
+        } else {
+            level.tail = node.prev;
+        }
+
+        node.prev = NONE;
+        node.next = NONE;
+        node.level = NONE;
+
+        if (--level.count == 0) {
+            releaseLevel(levelSlot);
+        } else {
+            level.size -= node.size;
+
+            // The orders behind the removed one have moved: by the dequeued order if it was the head.
+            if (isHead) {
+                level.dequeuedCount++;
+                level.dequeuedSize += node.size;
+            } else if (!isTail) {
+                level.version++;
+            }
+        }
+    }
+
+    static bool shallAdd(const std::shared_ptr<O> &order) {
+        return order->hasSize() && !std::isnan(order->getPrice()) &&
+               !order->getEventFlagsMask().contains(EventFlag::REMOVE_EVENT);
+    }
+
+    public:
+    /**
+     * Adds the order to the back of the queue of its price level, or updates the order with the same index
+     * (following the queue priority rules of the book).
+     * Orders without a size or a price and orders marked with EventFlag::REMOVE_EVENT are removed from the book.
+     *
+     * @param order The order.
+     */
+    void upsert(const std::shared_ptr<O> &order) {
+        if (!shallAdd(order)) {
+            cancel(order->getIndex());
+
+            return;
+        }
+
+        const bool isBuy = order->getOrderSide() == Side::BUY;
+        const auto price = order->getPrice();
+        const auto size = order->getSize();
+
+        if (auto found = orders_.find(order->getIndex()); found != orders_.end()) {
+            auto slot = found->second;
+            auto &node = nodes_[slot];
+            auto &level = levels_[node.level];
+
+            node.order = order;
+            node.sourceId = order->getSource().id();
+
+            if (node.isBuy == isBuy && level.price == price && size <= node.size) {
+                // Decreased (or unchanged) size keeps the position in the queue.
+                if (size != node.size) {
+                    if (level.head == slot) {
+                        level.dequeuedSize += node.size - size;
+                    } else if (level.tail != slot) {
+                        level.version++;
+                    }
+
+                    level.size += size - node.size;
+                    node.size = size;
+                }
+
+                return;
+            }
+
+            unlink(slot);
+            node.size = size;
+            node.isBuy = isBuy;
+            pushBack(findOrCreateLevel(isBuy, price), slot);
+
+            return;
+        }
+
+        auto slot = nodes_.allocate();
+        auto &node = nodes_[slot];
+
+        node.order = order;
+        node.index = order->getIndex();
+        node.size = size;
+        node.sourceId = order->getSource().id();
+        node.isBuy = isBuy;
+        orders_.emplace(node.index, slot);
+        pushBack(findOrCreateLevel(isBuy, price), slot);
+    }
+
+    /**
+     * Removes the order from the book.
+     *
+     * @param index The index of the order.
+     * @return `true` if the order was removed.
+     */
+    bool cancel(std::int64_t index) {
+        auto found = orders_.find(index);
+
+        if (found == orders_.end()) {
+            return false;
+        }
+
+        auto slot = found->second;
+
+        orders_.erase(found);
+        unlink(slot);
+        nodes_.release(slot);
+
+        return true;
+    }
+
+    /**
+     * Removes the orders of the source from the book.
+     *
+     * @param source The source.
+     */
+    void clearBySource(const IndexedEventSource &source) {
+        std::vector<std::int64_t> indices{};
+
+        for (const auto &[index, slot] : orders_) {
+            if (nodes_[slot].sourceId == source.id()) {
+                indices.push_back(index);
+            }
+        }
+
+        for (auto index : indices) {
+            cancel(index);
+        }
+    }
+
+    /**
+     * Removes all the orders.
+     */
+    void clear() noexcept {
+        nodes_.clear();
+        levels_.clear();
+        orders_.clear();
+        buyLevelsByPrice_.clear();
+        sellLevelsByPrice_.clear();
+        buyPrices_.clear();
+        sellPrices_.clear();
+    }
+
+    /**
+     * Applies the transaction (or the snapshot) of the IndexedTxModel to the book.
+     *
+     * @param source The source of the events.
+     * @param events The events of the transaction.
+     * @param isSnapshot `true` if the events represent a snapshot of the source: the orders of the source are replaced.
+     */
+    void update(const IndexedEventSource &source, const std::vector<std::shared_ptr<O>> &events, bool isSnapshot) {
+        if (isSnapshot) {
+            clearBySource(source);
+        }
+
+        for (const auto &order : events) {
+            upsert(order);
+        }
+    }
+
+    /**
+     * Returns the position of the order in the queue of its price level.
+     *
+     * @param index The index of the order.
+     * @return The position or `std::nullopt` if there is no such order.
+     */
+    std::optional<MarketByOrderQueuePosition> getQueuePosition(std::int64_t index) const {
+        auto found = orders_.find(index);
+
+        if (found == orders_.end()) {
+            return std::nullopt;
+        }
+
+        const auto &node = nodes_[found->second];
+        const auto &level = levels_[node.level];
+
+        if (node.cacheVersion != level.version) {
+            std::size_t position = 0;
+            double sizeAhead = 0.0;
+
+            for (auto slot = level.head; slot != found->second; slot = nodes_[slot].next) {
+                position++;
+                sizeAhead += nodes_[slot].size;
+            }
+
+            node.cacheVersion = level.version;
+            node.cachedPosition = position;
+            node.cachedSizeAhead = sizeAhead;
+            node.cachedDequeuedCount = level.dequeuedCount;
+            node.cachedDequeuedSize = level.dequeuedSize;
+        }
+
+        const auto position = node.cachedPosition - (level.dequeuedCount - node.cachedDequeuedCount);
+        // The head of the queue has nothing ahead of it, whatever the rounding of the dequeued sizes.
+        const auto sizeAhead =
+            position == 0 ? 0.0 : node.cachedSizeAhead - (level.dequeuedSize - node.cachedDequeuedSize);
+
+        return MarketByOrderQueuePosition{position, sizeAhead, node.size, level.price, node.isBuy};
+    }
+
+    /**
+     * @param index The index of the order.
+     * @return The order or `nullptr` if there is no such order.
+     */
+    std::shared_ptr<O> getOrder(std::int64_t index) const {
+        auto found = orders_.find(index);
+
+        return found == orders_.end() ? nullptr : nodes_[found->second].order;
+    }
+
+    /// @return The number of the orders in the book.
+    std::size_t size() const noexcept {
+        return orders_.size();
+    }
+
+    /// @return `true` if the book is empty.
+    bool empty() const noexcept {
+        return orders_.empty();
+    }
+
+    /**
+     * @param side The side (all the sides that are not Side::BUY are considered as Side::SELL).
+     * @return The number of price levels of the side.
+     */
+    std::size_t getLevelCount(const Side &side) const noexcept {
+        return side == Side::BUY ? buyPrices_.size() : sellPrices_.size();
+    }
+
+    /**
+     * @param side The side.
+     * @return The best price of the side or `NaN` if the side is empty.
+     */
+    double getBestPrice(const Side &side) const noexcept {
+        if (side == Side::BUY) {
+            return buyPrices_.empty() ? math::NaN : *buyPrices_.begin();
+        }
+
+        return sellPrices_.empty() ? math::NaN : *sellPrices_.begin();
+    }
+
+    /**
+     * @param side The side.
+     * @param price The price of the level.
+     * @return The total size of the orders at the price level (0 if there is no such level).
+     */
+    double getLevelSize(const Side &side, double price) const noexcept {
+        const auto &byPrice = side == Side::BUY ? buyLevelsByPrice_ : sellLevelsByPrice_;
+        auto found = byPrice.find(price);
+
+        return found == byPrice.end() ? 0.0 : levels_[found->second].size;
+    }
+
+    /**
+     * @param side The side.
+     * @param price The price of the level.
+     * @return The number of the orders at the price level (0 if there is no such level).
+     */
+    std::size_t getLevelOrderCount(const Side &side, double price) const noexcept {
+        const auto &byPrice = side == Side::BUY ? buyLevelsByPrice_ : sellLevelsByPrice_;
+        auto found = byPrice.find(price);
+
+        return found == byPrice.end() ? 0 : levels_[found->second].count;
+    }
+
+    /**
+     * Calls the function for each order of the price level in the queue order (from the front to the back).
+     *
+     * @tparam F The type of the function: `void(const std::shared_ptr<O> &)`
+     * @param side The side.
+     * @param price The price of the level.
+     * @param f The function.
+     */
+    template <typename F> void forEachOrderAtLevel(const Side &side, double price, F &&f) const {
+        const auto &byPrice = side == Side::BUY ? buyLevelsByPrice_ : sellLevelsByPrice_;
+        auto found = byPrice.find(price);
+
+        if (found == byPrice.end()) {
+            return;
+        }
+
+        for (auto slot = levels_[found->second].head; slot != NONE; slot = nodes_[slot].next) {
+            f(nodes_[slot].order);
+        }
+    }
+
+    /**
+     * Calls the function for each price level of the side from the best to the worst.
+     *
+     * @tparam F The type of the function: `void(double price, double size, std::size_t count)`
+     * @param side The side.
+     * @param f The function.
+     */
+    template <typename F> void forEachLevel(const Side &side, F &&f) const {
+        auto visit = [this, &f](const auto &prices, const auto &byPrice) {
+            for (auto price : prices) {
+                const auto &level = levels_[byPrice.at(price)];
+
+                f(level.price, level.size, level.count);
+            }
+        };
+
+        if (side == Side::BUY) {
+            visit(buyPrices_, buyLevelsByPrice_);
+        } else {
+            visit(sellPrices_, sellLevelsByPrice_);
+        }
+    }
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
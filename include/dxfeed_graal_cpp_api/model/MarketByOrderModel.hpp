@@ -0,0 +1,277 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../entity/SharedEntity.hpp"
+#include "../event/EventSourceWrapper.hpp"
+#include "../event/market/OrderBase.hpp"
+#include "./IndexedTxModel.hpp"
+#include "./MarketByOrderBook.hpp"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_model
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+struct DXFeed;
+struct SymbolWrapper;
+
+/**
+ * A model of the market-by-order book that tracks the position of each order in the FIFO queue of its price level.
+ *
+ * <p>The model consumes the transactions of the IndexedTxModel and applies them to a MarketByOrderBook.
+ * It is intended for the orders of the sources with the full order book (Scope::ORDER), e.g. for fill simulation:
+ * MarketByOrderModel::getQueuePosition() returns the number of orders and the size ahead of the order.
+ *
+ * <h3>Configuration</h3>
+ *
+ * <p>This model must be configured using the @ref MarketByOrderModel::Builder "builder". This model requires
+ * a @ref MarketByOrderModel::Builder::withSymbol() "symbol" and it must be
+ * @ref MarketByOrderModel::Builder::withFeed() "attached" to a DXFeed instance to begin operation.
+ *
+ * <h3>Threads and locks</h3>
+ *
+ * <p>This class is thread-safe and can be used concurrently from multiple threads without external synchronization.
+ * The listener is called synchronously in the thread that delivers the transactions, while the model is locked:
+ * it can query the book that is passed to it, but it must not block.
+ *
+ * Sample:
+ *
+ * ```cpp
+ * auto model = MarketByOrderModel<Order>::newBuilder()
+ *                  ->withFeed(feed)
+ *                  ->withSymbol("AAPL")
+ *                  ->withSources({OrderSource::NTV})
+ *                  ->withListener([myOrderIndex](const auto &book, const auto &events, bool isSnapshot) {
+ *                      if (auto position = book.getQueuePosition(myOrderIndex)) {
+ *                          std::cout << position->position << " orders ahead, " << position->sizeAhead << std::endl;
+ *                      }
+ *                  })
+ *                  ->build();
+ * ```
+ *
+ * @tparam O The type of order derived from OrderBase.
+ */
+template <Derived<OrderBase> O>
+struct /* DXFCPP_EXPORT */ MarketByOrderModel final : RequireMakeShared<MarketByOrderModel<O>> {
+    /**
+     * The listener's signature.
+     */
+    using Listener = std::function<void(const MarketByOrderBook<O> & /* book */,
+                                        const std::vector<std::shared_ptr<O>> & /* events */, bool /* isSnapshot */)>;
+
+    /**
+     * A builder class for creating an instance of MarketByOrderModel.
+     */
+    struct /* DXFCPP_EXPORT */ Builder final : RequireMakeShared<Builder> {
+        friend struct MarketByOrderModel;
+
+        private:
+        std::shared_ptr<typename IndexedTxModel<O>::Builder> builder_{};
+        Listener listener_{};
+
+        public:
+        explicit Builder(typename RequireMakeShared<Builder>::LockExternalConstructionTag) {
+            builder_ = IndexedTxModel<O>::newBuilder();
+        }
+
+        ~Builder() noexcept override {
+        }
+
+        /**
+         * Sets the DXFeed for the model being created.
+         * The feed cannot be attached after the model has been built.
+         *
+         * @param feed The DXFeed.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withFeed(std::shared_ptr<DXFeed> feed) {
+            builder_ = builder_->withFeed(std::move(feed));
+
+            return this->template sharedAs<Builder>();
+        }
+
+        /**
+         * Sets the subscription symbol for the model being created.
+         * The symbol cannot be added or changed after the model has been built.
+         *
+         * @param symbol The subscription symbol.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withSymbol(const SymbolWrapper &symbol) {
+            builder_ = builder_->withSymbol(symbol);
+
+            return this->template sharedAs<Builder>();
+        }
+
+        /**
+         * Sets the listener that is called after each transaction has been applied to the book.
+         * The listener cannot be changed or added once the model has been built.
+         *
+         * @param listener The listener.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withListener(Listener listener) {
+            listener_ = std::move(listener);
+
+            return this->template sharedAs<Builder>();
+        }
+
+        /**
+         * Sets the sources from which to subscribe for indexed events.
+         * If no sources have been set, subscriptions will default to all possible sources.
+         *
+         * @tparam EventSourceIt The source collection iterator type.
+         * @param begin The beginning of the collection of sources.
+         * @param end The end of the collection of sources.
+         * @return The builder instance.
+         */
+        template <typename EventSourceIt> std::shared_ptr<Builder> withSources(EventSourceIt begin, EventSourceIt end) {
+            builder_ = builder_->withSources(begin, end);
+
+            return this->template sharedAs<Builder>();
+        }
+
+        /**
+         * Sets the sources from which to subscribe for indexed events.
+         * If no sources have been set, subscriptions will default to all possible sources.
+         *
+         * @tparam EventSourceCollection A type of the collection of sources (std::vector<EventSourceWrapper>,
+         * std::set<OrderSource>, etc.)
+         * @param sources The specified sources.
+         * @return The builder instance.
+         */
+        template <ConvertibleToEventSourceWrapperCollection EventSourceCollection>
+        std::shared_ptr<Builder> withSources(EventSourceCollection &&sources) {
+            return withSources(std::begin(sources), std::end(sources));
+        }
+
+        /**
+         * Sets the sources from which to subscribe for indexed events.
+         * If no sources have been set, subscriptions will default to all possible sources.
+         *
+         * @param sources The specified sources.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withSources(std::initializer_list<EventSourceWrapper> sources) {
+            return withSources(sources.begin(), sources.end());
+        }
+
+        /**
+         * Builds an instance of MarketByOrderModel based on the provided parameters.
+         *
+         * @return The created MarketByOrderModel.
+         */
+        std::shared_ptr<MarketByOrderModel> build() {
+            return MarketByOrderModel::create(this->template sharedAs<Builder>());
+        }
+    };
+
+    private:
+    mutable std::recursive_mutex mtx_{};
+    MarketByOrderBook<O> book_{};
+    std::shared_ptr<IndexedTxModel<O>> indexedTxModel_{};
+    Listener listener_{};
+
+    static std::shared_ptr<MarketByOrderModel> create(std::shared_ptr<Builder> builder) {
+        auto model = MarketByOrderModel::createShared(builder);
+
+        model->indexedTxModel_ =
+            builder->builder_
+                ->withListener([m = model->weak_from_this()](const IndexedEventSource &source,
+                                                             const std::vector<std::shared_ptr<O>> &events,
+                                                             bool isSnapshot) {
+                    if (const auto model = m.lock()) {
+                        model->template sharedAs<MarketByOrderModel>()->eventsReceived(source, events, isSnapshot);
+                    }
+                })
+                ->build();
+
+        return model;
+    }
+
+    void eventsReceived(const IndexedEventSource &source, const std::vector<std::shared_ptr<O>> &events,
+                        bool isSnapshot) {
+        std::lock_guard guard(mtx_);
+
+        book_.update(source, events, isSnapshot);
+
+        if (listener_) {
+            listener_(book_, events, isSnapshot);
+        }
+    }
+
+    public:
+    MarketByOrderModel(typename RequireMakeShared<MarketByOrderModel<O>>::LockExternalConstructionTag,
+                       const std::shared_ptr<Builder> &builder)
+        : listener_(builder->listener_) {
+    }
+
+    ~MarketByOrderModel() override {
+        close();
+    }
+
+    /**
+     * Creates a new builder instance for constructing a MarketByOrderModel.
+     *
+     * @return A new instance of the builder.
+     */
+    static std::shared_ptr<Builder> newBuilder() {
+        return Builder::createShared();
+    }
+
+    /**
+     * Returns the position of the order in the queue of its price level.
+     *
+     * @param index The @ref IndexedEvent::getIndex() "index" of the order.
+     * @return The position or `std::nullopt` if there is no such order in the book.
+     */
+    std::optional<MarketByOrderQueuePosition> getQueuePosition(std::int64_t index) const {
+        std::lock_guard guard(mtx_);
+
+        return book_.getQueuePosition(index);
+    }
+
+    /**
+     * Calls the function with the book while the model is locked.
+     *
+     * @tparam F The type of the function: `R(const MarketByOrderBook<O> &)`
+     * @param f The function.
+     * @return The result of the function.
+     */
+    template <typename F> decltype(auto) withBook(F &&f) const {
+        std::lock_guard guard(mtx_);
+
+        return std::forward<F>(f)(book_);
+    }
+
+    /**
+     * Closes this model and makes it <i>permanently detached</i>.
+     */
+    void close() const {
+        std::lock_guard guard(mtx_);
+
+        if (indexedTxModel_) {
+            indexedTxModel_->close();
+        }
+    }
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
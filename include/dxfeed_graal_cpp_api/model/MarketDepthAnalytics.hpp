@@ -0,0 +1,237 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../event/market/Side.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_model
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The aggregated price level of the order book: the total size and the number of orders at the price.
+ */
+struct DXFCPP_EXPORT MarketDepthLevel {
+    /// The price of the level.
+    double price{};
+    /// The total size of the orders at the price.
+    double size{};
+    /// The number of orders at the price.
+    std::size_t count{};
+
+    bool operator==(const MarketDepthLevel &) const = default;
+};
+
+struct MarketDepthAnalytics;
+
+/**
+ * Incrementally maintained price levels of both sides of the order book.
+ *
+ * <p>Each order update costs O(log L), where L is the number of price levels of the side. The totals of the sides are
+ * maintained in O(1). Orders without a price are ignored.
+ *
+ * <p>This class is not thread-safe: it is owned by the writer of the MarketDepthModel.
+ * Readers use immutable MarketDepthAnalytics snapshots created with MarketDepthLevels::getAnalytics().
+ */
+struct DXFCPP_EXPORT MarketDepthLevels final {
+    private:
+    struct Level {
+        double size{};
+        std::size_t count{};
+    };
+
+    std::map<double, Level, std::greater<>> buyLevels_{};
+    std::map<double, Level, std::less<>> sellLevels_{};
+    double totalBuySize_{};
+    double totalSellSize_{};
+
+    public:
+    /**
+     * Adds the order to the levels.
+     *
+     * @param side The side of the order. All the orders that are not Side::BUY are considered sell orders (as in
+     * MarketDepthModel).
+     * @param price The price of the order.
+     * @param size The size of the order.
+     */
+    void add(const Side &side, double price, double size);
+
+    /**
+     * Removes the order (that was previously added with the same parameters) from the levels.
+     *
+     * @param side The side of the order.
+     * @param price The price of the order.
+     * @param size The size of the order.
+     */
+    void remove(const Side &side, double price, double size);
+
+    /**
+     * Removes all the levels.
+     */
+    void clear() noexcept;
+
+    /**
+     * @param side The side.
+     * @return The number of price levels of the side.
+     */
+    std::size_t getLevelCount(const Side &side) const noexcept;
+
+    /**
+     * @param side The side.
+     * @return The total size of the orders of the side.
+     */
+    double getTotalSize(const Side &side) const noexcept;
+
+    /**
+     * Returns the best price levels of the side (from the best to the worst).
+     *
+     * @param side The side.
+     * @param maxLevels The maximum number of levels.
+     * @return The price levels.
+     */
+    std::vector<MarketDepthLevel> getLevels(const Side &side, std::size_t maxLevels) const;
+
+    /**
+     * Creates the immutable analytics snapshot with the specified number of the best price levels of each side.
+     * The complexity is O(maxLevels).
+     *
+     * @param maxLevels The maximum number of the price levels of each side.
+     * @return The analytics.
+     */
+    std::shared_ptr<const MarketDepthAnalytics> getAnalytics(std::size_t maxLevels) const;
+};
+
+/**
+ * An immutable snapshot of the order book analytics.
+ *
+ * <p>The analytics keep the best price levels of both sides (up to the analytics depth that is configured with
+ * MarketDepthModel::Builder::withAnalyticsDepth()) and the totals of the whole book. All the metrics are computed from
+ * these levels, so a query never walks the orders. A metric is `NaN` if the book does not have enough data for it.
+ */
+struct DXFCPP_EXPORT MarketDepthAnalytics final {
+    private:
+    std::vector<MarketDepthLevel> buyLevels_{};
+    std::vector<MarketDepthLevel> sellLevels_{};
+    double totalBuySize_{};
+    double totalSellSize_{};
+
+    const std::vector<MarketDepthLevel> &levels(const Side &side) const noexcept;
+
+    public:
+    /**
+     * Creates the analytics.
+     *
+     * @param buyLevels The best buy levels (from the best to the worst).
+     * @param sellLevels The best sell levels (from the best to the worst).
+     * @param totalBuySize The total size of the buy orders of the book.
+     * @param totalSellSize The total size of the sell orders of the book.
+     */
+    MarketDepthAnalytics(std::vector<MarketDepthLevel> buyLevels, std::vector<MarketDepthLevel> sellLevels,
+                         double totalBuySize, double totalSellSize) noexcept;
+
+    /// @return The empty analytics.
+    static const std::shared_ptr<const MarketDepthAnalytics> &empty();
+
+    /**
+     * @param side The side.
+     * @return The best price levels of the side (from the best to the worst).
+     */
+    const std::vector<MarketDepthLevel> &getLevels(const Side &side) const noexcept;
+
+    /**
+     * @param side The side.
+     * @return The total size of the orders of the side (of the whole book, not limited by the analytics depth).
+     */
+    double getTotalSize(const Side &side) const noexcept;
+
+    /**
+     * @param side The side.
+     * @return The best price of the side or `NaN`.
+     */
+    double getBestPrice(const Side &side) const noexcept;
+
+    /// @return The best sell price minus the best buy price or `NaN`.
+    double getSpread() const noexcept;
+
+    /// @return The average of the best buy and sell prices or `NaN`.
+    double getMidPrice() const noexcept;
+
+    /**
+     * Returns the book imbalance `(B - S) / (B + S)`, where `B` and `S` are the total sizes of the specified number of
+     * the best buy and sell levels. The value is in the range [-1, 1]; positive values mean more buy interest.
+     *
+     * @param levels The number of the best levels of each side (1 means the top of the book).
+     * @return The imbalance or `NaN`.
+     */
+    double getImbalance(std::size_t levels = 1) const noexcept;
+
+    /**
+     * Returns the microprice: the mid-price weighted by the opposite sizes of the top of the book
+     * `(bidPrice * askSize + askPrice * bidSize) / (bidSize + askSize)`.
+     *
+     * @return The microprice or `NaN`.
+     */
+    double getMicroprice() const noexcept;
+
+    /**
+     * Returns the size-weighted average price of the specified number of the best levels of the side
+     * (queue-level VWAP).
+     *
+     * @param side The side.
+     * @param levels The number of the best levels.
+     * @return The VWAP or `NaN`.
+     */
+    double getVwap(const Side &side, std::size_t levels) const noexcept;
+
+    /**
+     * Returns the depth-weighted mid-price: the average of the @ref MarketDepthAnalytics::getVwap() "VWAPs" of the
+     * specified number of the best levels of each side.
+     *
+     * @param levels The number of the best levels of each side.
+     * @return The depth-weighted mid-price or `NaN`.
+     */
+    double getDepthWeightedMid(std::size_t levels) const noexcept;
+
+    /**
+     * Returns the cumulative size of the levels of the side that are within the specified number of ticks from the
+     * best price of the side (inclusive). Only the levels within the analytics depth are taken into account.
+     *
+     * @param side The side.
+     * @param ticks The number of ticks (0 means the best level only).
+     * @param tickSize The tick size.
+     * @return The cumulative size.
+     */
+    double getCumulativeSize(const Side &side, std::size_t ticks, double tickSize) const noexcept;
+
+    /**
+     * Returns the average price of the immediate execution of the specified quantity against the levels of the side.
+     *
+     * @param side The side of the book to execute against (Side::SELL to buy, Side::BUY to sell).
+     * @param quantity The quantity.
+     * @return The average price or `NaN` if the levels within the analytics depth do not have enough size.
+     */
+    double getSweepPrice(const Side &side, double quantity) const noexcept;
+
+    std::string toString() const;
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -11,14 +11,22 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
 #include "../event/EventSourceWrapper.hpp"
 #include "../event/market/Order.hpp"
 #include "../event/market/OrderBase.hpp"
+#include "../internal/AtomicSharedPtr.hpp"
 #include "../internal/Timer.hpp"
 #include "./IndexedTxModel.hpp"
+#include "./MarketDepthAnalytics.hpp"
 #include "./MarketDepthModelListener.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <set>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 /**
  * \addtogroup dxfcpp_model
@@ -59,6 +67,21 @@ struct SymbolWrapper;
  *
  * This class is thread-safe and can be used concurrently from multiple threads without external synchronization.
  *
+ * <h3>Snapshots</h3>
+ *
+ * The model has a single writer: the thread that delivers the events updates the order sets and, after each change,
+ * publishes an immutable MarketDepthModel::Snapshot with the top orders (limited by the depth limit) of both sides.
+ * The snapshot is published by an atomic pointer swap, so any number of threads can read a consistent book with
+ * MarketDepthModel::getSnapshot() at any time without locking the writer:
+ *
+ * ```cpp
+ * auto snapshot = model->getSnapshot();
+ *
+ * if (auto bid = snapshot->getBestBuyOrder(), ask = snapshot->getBestSellOrder(); bid && ask) {
+ *     auto spread = ask->getPrice() - bid->getPrice();
+ * }
+ * ```
+ *
  * Sample:
  *
  * ```cpp
@@ -117,7 +140,8 @@ struct SymbolWrapper;
  *
  * @tparam O The type of order derived from OrderBase.
  */
-template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel final : RequireMakeShared<MarketDepthModel<O>> {
+template <Derived<OrderBase> O>
+struct /* DXFCPP_EXPORT */ MarketDepthModel final : RequireMakeShared<MarketDepthModel<O>> {
 
     struct /* DXFCPP_EXPORT */ Builder final : RequireMakeShared<Builder> {
         friend struct MarketDepthModel;
@@ -127,6 +151,7 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
         std::shared_ptr<MarketDepthModelListener<O>> listener_{};
         std::size_t depthLimit_{};
         std::int64_t aggregationPeriodMillis_{};
+        std::size_t analyticsDepth_{};
 
         public:
         explicit Builder(RequireMakeShared<Builder>::LockExternalConstructionTag) {
@@ -271,6 +296,27 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
             return withAggregationPeriod(aggregationPeriod.count());
         }
 
+        /**
+         * Sets the number of the best price levels of each side that are kept in the
+         * @ref MarketDepthModel::Snapshot::getAnalytics() "analytics" of the published snapshots.
+         *
+         * <p>The price levels of the whole book are maintained incrementally (O(log L) per order update), and each
+         * published snapshot copies only the specified number of the best levels, so the metrics are available
+         * without walking the orders. The default value is 0: the analytics are disabled.
+         *
+         * <p>The changes of the book beyond the depth limit publish a new snapshot only if they change the levels
+         * within the analytics depth. So the @ref MarketDepthAnalytics::getTotalSize() "totals" of the sides are not
+         * refreshed by the changes beyond the analytics depth until the next published snapshot.
+         *
+         * @param analyticsDepth The number of the price levels (0 to disable the analytics).
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withAnalyticsDepth(std::size_t analyticsDepth) {
+            analyticsDepth_ = analyticsDepth;
+
+            return this->template sharedAs<Builder>();
+        }
+
         /**
          * Builds an instance of MarketDepthModel based on the provided parameters.
          *
@@ -395,56 +441,48 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
 
     /**
      * Represents a set of orders, sorted by a comparator.
+     * The set is not thread-safe: it is owned and guarded by the model's writer.
+     *
      * @tparam Less The comparator type.
      */
     template <typename Less> struct SortedOrderSet {
+        /// The immutable top orders of the set.
+        using Orders = std::vector<std::shared_ptr<O>>;
+
         private:
-        mutable std::recursive_mutex mutex_{};
-        std::vector<std::shared_ptr<O>> snapshot_{};
+        std::shared_ptr<const Orders> snapshot_ = std::make_shared<const Orders>();
         std::set<std::shared_ptr<O>, Less> orders_{};
-        std::atomic<std::size_t> depthLimit_{};
-        std::atomic<bool> isChanged_{};
+        std::size_t depthLimit_{};
+        bool isChanged_{};
 
         bool isDepthLimitUnbounded() const {
-            auto temp = depthLimit_.load();
-
-            return temp == 0 || temp == std::numeric_limits<decltype(temp)>::max();
+            return depthLimit_ == 0 || depthLimit_ == std::numeric_limits<std::size_t>::max();
         }
 
         bool isOrderCountWithinDepthLimit() const {
-            std::lock_guard lock(mutex_);
-
             return orders_.size() <= depthLimit_;
         }
 
         bool isOrderWithinDepthLimit(const std::shared_ptr<O> &order) const {
-            std::lock_guard lock(mutex_);
-
-            if (snapshot_.empty()) {
+            if (snapshot_->empty()) {
                 return true;
             }
 
-            return !Less{}(snapshot_.back(), order);
+            return !Less{}(snapshot_->back(), order);
         }
 
         void updateSnapshot() {
-            std::lock_guard lock(mutex_);
-
             isChanged_ = false;
-            snapshot_.clear();
 
-            const auto limit = isDepthLimitUnbounded() ? std::numeric_limits<std::size_t>::max() : depthLimit_.load();
-            std::size_t i = 0;
+            const auto limit = isDepthLimitUnbounded() ? orders_.size() : std::min(depthLimit_, orders_.size());
+            auto snapshot = std::make_shared<Orders>();
 
-            for (auto it = orders_.begin(); i < limit && it != orders_.end(); ++it) {
-                snapshot_.push_back(*it);
-                ++i;
-            }
+            snapshot->reserve(limit);
+            std::copy_n(orders_.begin(), limit, std::back_inserter(*snapshot));
+            snapshot_ = std::move(snapshot);
         }
 
         void markAsChangedIfNeeded(const std::shared_ptr<O> &order) {
-            std::lock_guard lock(mutex_);
-
             if (isChanged_) {
                 return;
             }
@@ -466,8 +504,6 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
          * @param depthLimit The new depth limit.
          */
         void setDepthLimit(std::size_t depthLimit) {
-            std::lock_guard lock(mutex_);
-
             if (depthLimit_ == depthLimit) {
                 return;
             }
@@ -483,8 +519,6 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
          * @return `true` if order was added.
          */
         bool insert(const std::shared_ptr<O> &order) {
-            std::lock_guard lock(mutex_);
-
             if (orders_.insert(order).second) {
                 markAsChangedIfNeeded(order);
 
@@ -501,8 +535,6 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
          * @return `true` if order was removed.
          */
         bool erase(const std::shared_ptr<O> &order) {
-            std::lock_guard lock(mutex_);
-
             if (orders_.erase(order) > 0) {
                 markAsChangedIfNeeded(order);
 
@@ -518,27 +550,104 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
          * @param source The source to clear orders by.
          */
         void clearBySource(const IndexedEventSource &source) {
-            std::lock_guard lock(mutex_);
-
-            std::size_t size = orders_.size();
+            if (std::erase_if(orders_, [&source](const auto &order) {
+                    return order->getSource() == source;
+                }) > 0) {
+                isChanged_ = true;
+            }
+        }
 
-            for (auto it = orders_.begin(); it != orders_.end(); ++it) {
-                if ((*it)->getSource() == source) {
-                    it = orders_.erase(it);
-                }
+        /**
+         * Returns the top orders of the set (limited by the depth limit).
+         * The returned orders are rebuilt only if the set has changed since the last call, otherwise the previous
+         * (immutable) orders are returned.
+         *
+         * @return The top orders of the set.
+         */
+        std::shared_ptr<const Orders> getSnapshot() {
+            if (isChanged_) {
+                updateSnapshot();
             }
 
-            isChanged_ = orders_.size() != size;
+            return snapshot_;
         }
 
         std::vector<std::shared_ptr<O>> toVector() {
-            std::lock_guard lock(mutex_);
+            auto snapshot = getSnapshot();
 
-            if (isChanged_) {
-                updateSnapshot();
-            }
+            return {snapshot->begin(), snapshot->end()};
+        }
+    };
+
+    /**
+     * An immutable snapshot of the order book that is published by the model after each change.
+     * The sides that have not changed are shared between consecutive snapshots.
+     */
+    struct Snapshot final {
+        friend struct MarketDepthModel;
 
-            return {snapshot_.begin(), snapshot_.end()};
+        private:
+        std::shared_ptr<const std::vector<std::shared_ptr<O>>> buyOrders_{};
+        std::shared_ptr<const std::vector<std::shared_ptr<O>>> sellOrders_{};
+        std::shared_ptr<const MarketDepthAnalytics> analytics_{};
+        std::uint64_t version_{};
+
+        public:
+        Snapshot(std::shared_ptr<const std::vector<std::shared_ptr<O>>> buyOrders,
+                 std::shared_ptr<const std::vector<std::shared_ptr<O>>> sellOrders,
+                 std::shared_ptr<const MarketDepthAnalytics> analytics, std::uint64_t version) noexcept
+            : buyOrders_(std::move(buyOrders)), sellOrders_(std::move(sellOrders)), analytics_(std::move(analytics)),
+              version_(version) {
+        }
+
+        /**
+         * @return The top buy orders (the best is the first), limited by the depth limit of the model.
+         */
+        const std::vector<std::shared_ptr<O>> &getBuyOrders() const noexcept {
+            return *buyOrders_;
+        }
+
+        /**
+         * @return The top sell orders (the best is the first), limited by the depth limit of the model.
+         */
+        const std::vector<std::shared_ptr<O>> &getSellOrders() const noexcept {
+            return *sellOrders_;
+        }
+
+        /**
+         * @return The best buy order or `nullptr` if there are no buy orders.
+         */
+        std::shared_ptr<O> getBestBuyOrder() const noexcept {
+            return buyOrders_->empty() ? nullptr : buyOrders_->front();
+        }
+
+        /**
+         * @return The best sell order or `nullptr` if there are no sell orders.
+         */
+        std::shared_ptr<O> getBestSellOrder() const noexcept {
+            return sellOrders_->empty() ? nullptr : sellOrders_->front();
+        }
+
+        /**
+         * Returns the analytics of the book (imbalance, microprice, VWAPs, etc.) at the moment of the snapshot.
+         * The analytics take into account all the orders of the book (not limited by the depth limit) and keep the
+         * number of the best price levels that is set by MarketDepthModel::Builder::withAnalyticsDepth().
+         * If the analytics are disabled, the empty analytics are returned.
+         *
+         * @return The analytics.
+         */
+        const MarketDepthAnalytics &getAnalytics() const noexcept {
+            return *analytics_;
+        }
+
+        /**
+         * Returns the version of the snapshot. The version is incremented by one with each published snapshot, so
+         * readers can cheaply check whether the book has changed since they last looked at it.
+         *
+         * @return The version of the snapshot.
+         */
+        std::uint64_t getVersion() const noexcept {
+            return version_;
         }
     };
 
@@ -553,6 +662,13 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
     std::int64_t aggregationPeriodMillis_{};
     std::atomic<bool> taskScheduled_{};
     std::shared_ptr<Timer> taskTimer_{};
+    AtomicSharedPtr<const Snapshot> snapshot_{};
+    std::uint64_t snapshotVersion_{};
+    MarketDepthLevels levels_{};
+    std::size_t analyticsDepth_{};
+    // The analytics of the last published snapshot and whether the levels within the analytics depth changed since.
+    std::shared_ptr<const MarketDepthAnalytics> analytics_{MarketDepthAnalytics::empty()};
+    bool isAnalyticsChanged_{};
 
     static std::shared_ptr<MarketDepthModel> create(std::shared_ptr<Builder> builder) {
         auto marketDepthModel = MarketDepthModel::createShared(builder);
@@ -580,9 +696,16 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
         std::lock_guard guard(mtx_);
 
         if (!update(source, events, isSnapshot)) {
+            // The changes beyond the depth limit are not notified, but they are reflected in the analytics.
+            if (isAnalyticsChanged_) {
+                publishSnapshot();
+            }
+
             return;
         }
 
+        publishSnapshot();
+
         if (isSnapshot || aggregationPeriodMillis_ == 0) {
             tryCancelTask();
             notifyListeners();
@@ -594,7 +717,12 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
     void notifyListeners() {
         std::lock_guard guard(mtx_);
 
-        listener_->getHandler()(getBuyOrders(), getSellOrders());
+        if (listener_) {
+            auto snapshot = snapshot_.load();
+
+            listener_->getHandler()(snapshot->getBuyOrders(), snapshot->getSellOrders());
+        }
+
         taskScheduled_ = false;
     }
 
@@ -646,20 +774,18 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
 
                 ordersByIndex_.erase(order->getIndex());
 
-                if (removed->getOrderSide() == Side::BUY) {
-                    buyOrders_.erase(removed);
-                } else {
-                    sellOrders_.erase(removed);
+                if (removed->getOrderSide() == Side::BUY ? buyOrders_.erase(removed) : sellOrders_.erase(removed)) {
+                    levels_.remove(removed->getOrderSide(), removed->getPrice(), removed->getSize());
+                    markAnalytics(removed->getOrderSide(), removed->getPrice());
                 }
             }
 
             if (shallAdd(order)) {
                 ordersByIndex_[order->getIndex()] = order;
 
-                if (order->getOrderSide() == Side::BUY) {
-                    buyOrders_.insert(order);
-                } else {
-                    sellOrders_.insert(order);
+                if (order->getOrderSide() == Side::BUY ? buyOrders_.insert(order) : sellOrders_.insert(order)) {
+                    levels_.add(order->getOrderSide(), order->getPrice(), order->getSize());
+                    markAnalytics(order->getOrderSide(), order->getPrice());
                 }
             }
         }
@@ -667,16 +793,29 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
         return buyOrders_.isChanged() || sellOrders_.isChanged();
     }
 
-    std::vector<std::shared_ptr<O>> getBuyOrders() {
-        std::lock_guard guard(mtx_);
+    // Marks the analytics as changed if the price is within the best levels of the last published analytics. Until
+    // such a change the best levels stay the same, so the last published ones are the boundary of the analytics depth.
+    void markAnalytics(const Side &side, double price) {
+        if (analyticsDepth_ == 0 || isAnalyticsChanged_ || std::isnan(price)) {
+            return;
+        }
 
-        return buyOrders_.toVector();
+        const auto &levels = analytics_->getLevels(side);
+
+        isAnalyticsChanged_ = levels.size() < analyticsDepth_ ||
+                              (side == Side::BUY ? price >= levels.back().price : price <= levels.back().price);
     }
 
-    std::vector<std::shared_ptr<O>> getSellOrders() {
+    void publishSnapshot() {
         std::lock_guard guard(mtx_);
 
-        return sellOrders_.toVector();
+        if (analyticsDepth_ != 0) {
+            analytics_ = levels_.getAnalytics(analyticsDepth_);
+            isAnalyticsChanged_ = false;
+        }
+
+        snapshot_.store(std::make_shared<const Snapshot>(buyOrders_.getSnapshot(), sellOrders_.getSnapshot(),
+                                                         analytics_, ++snapshotVersion_));
     }
 
     void clearBySource(const IndexedEventSource &source) {
@@ -688,6 +827,8 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
         for (const auto &[index, order] : ordersByIndex_) {
             if (order->getSource() == source) {
                 indices.push_back(index);
+                levels_.remove(order->getOrderSide(), order->getPrice(), order->getSize());
+                markAnalytics(order->getOrderSide(), order->getPrice());
             }
         }
 
@@ -707,6 +848,8 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
         sellOrders_.setDepthLimit(depthLimit_);
         aggregationPeriodMillis_ = builder->aggregationPeriodMillis_;
         listener_ = builder->listener_;
+        analyticsDepth_ = builder->analyticsDepth_;
+        publishSnapshot();
     }
 
     ~MarketDepthModel() override {
@@ -746,6 +889,7 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
         depthLimit_ = depthLimit;
         buyOrders_.setDepthLimit(depthLimit);
         sellOrders_.setDepthLimit(depthLimit);
+        publishSnapshot();
         tryCancelTask();
         notifyListeners();
     }
@@ -784,6 +928,16 @@ template <Derived<OrderBase> O> struct /* DXFCPP_EXPORT */ MarketDepthModel fina
         setAggregationPeriod(aggregationPeriod.count());
     }
 
+    /**
+     * Returns the latest published snapshot of the order book.
+     * This method does not lock the model and can be called from any number of threads concurrently with the updates.
+     *
+     * @return The latest snapshot (never `nullptr`).
+     */
+    std::shared_ptr<const Snapshot> getSnapshot() const noexcept {
+        return snapshot_.load();
+    }
+
     /**
      * Closes this model and makes it <i>permanently detached</i>.
      */
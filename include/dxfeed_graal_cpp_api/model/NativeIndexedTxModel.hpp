@@ -0,0 +1,499 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../api/DXFeed.hpp"
+#include "../api/DXFeedSubscription.hpp"
+#include "../api/osub/IndexedEventSubscriptionSymbol.hpp"
+#include "../entity/SharedEntity.hpp"
+#include "../event/EventSourceWrapper.hpp"
+#include "../event/IndexedEvent.hpp"
+#include "../event/market/OrderSource.hpp"
+#include "../exceptions/InvalidArgumentException.hpp"
+#include "../symbols/SymbolWrapper.hpp"
+#include "./TxEventProcessor.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_model
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * An incremental model for indexed events that processes the event flags in native memory.
+ *
+ * <p>This model is the pure C++ equivalent of the IndexedTxModel: it delivers the same sequence of snapshots and
+ * transactions to its listener, but it is built on top of a plain DXFeedSubscription, and the snapshot and transaction
+ * assembly (TX_PENDING, SNAPSHOT_BEGIN, SNAPSHOT_END, SNAPSHOT_SNIP, REMOVE_EVENT) is performed by
+ * a per-source TxEventProcessor. The pending buffers of the processors are reused, so events are delivered to the
+ * listener without an additional round-trip to the Graal side and without additional allocations.
+ *
+ * <h3>Configuration</h3>
+ *
+ * <p>This model must be configured using the @ref NativeIndexedTxModel::Builder "builder". This model requires
+ * a @ref NativeIndexedTxModel::Builder::withSymbol() "symbol" and it must be
+ * @ref NativeIndexedTxModel::Builder::withFeed() "attached" to a DXFeed instance to begin operation.
+ * Sources and feed can be changed after the model is built, see @ref NativeIndexedTxModel::setSources() "setSources"
+ * and @ref NativeIndexedTxModel::attach() "attach".
+ *
+ * <h3>Threads and locks</h3>
+ *
+ * <p>This class is thread-safe and can be used concurrently from multiple threads without external synchronization.
+ * The listener is called synchronously in the thread that delivers the events of the subscription.
+ * The listener can call @ref NativeIndexedTxModel::close() "close" or
+ * @ref NativeIndexedTxModel::setSources() "setSources": the rest of the events of the batch are dropped then.
+ *
+ * Sample:
+ *
+ * ```cpp
+ * auto feed = DXEndpoint::getInstance(DXEndpoint::Role::FEED)->connect("demo.dxfeed.com:7300")->getFeed();
+ * auto model = NativeIndexedTxModel<Order>::newBuilder()
+ *                  ->withFeed(feed)
+ *                  ->withBatchProcessing(true)
+ *                  ->withSnapshotProcessing(true)
+ *                  ->withSources({OrderSource::NTV, OrderSource::DEX})
+ *                  ->withListener([](const auto &source, const auto &events, bool isSnapshot) {
+ *                      std::cout << source.toString() << (isSnapshot ? " snapshot: " : " update: ") << events.size()
+ *                                << std::endl;
+ *                  })
+ *                  ->withSymbol("IBM")
+ *                  ->build();
+ * ```
+ *
+ * @tparam E The type of event (derived from IndexedEvent)
+ */
+template <Derived<IndexedEvent> E>
+struct /* DXFCPP_EXPORT */ NativeIndexedTxModel final : RequireMakeShared<NativeIndexedTxModel<E>> {
+    /**
+     * The listener's signature.
+     */
+    using Listener = typename TxEventProcessor<E>::Listener;
+
+    /**
+     * A builder class for creating an instance of NativeIndexedTxModel.
+     */
+    struct /* DXFCPP_EXPORT */ Builder final : RequireMakeShared<Builder> {
+        friend struct NativeIndexedTxModel;
+
+        private:
+        bool isBatchProcessing_{true};
+        bool isSnapshotProcessing_{false};
+        std::shared_ptr<DXFeed> feed_{};
+        std::optional<SymbolWrapper> symbol_{};
+        std::unordered_set<EventSourceWrapper> sources_{};
+        Listener listener_{};
+
+        public:
+        explicit Builder(typename RequireMakeShared<Builder>::LockExternalConstructionTag) {
+        }
+
+        ~Builder() noexcept override {
+        }
+
+        /**
+         * Enables or disables batch processing.
+         * <b>This is enabled by default</b>.
+         *
+         * @param isBatchProcessing `true` to enable batch processing; `false` otherwise.
+         * @return The builder instance.
+         * @see IndexedTxModel::Builder::withBatchProcessing()
+         */
+        std::shared_ptr<Builder> withBatchProcessing(bool isBatchProcessing) {
+            isBatchProcessing_ = isBatchProcessing;
+
+            return this->template sharedAs<Builder>();
+        }
+
+        /**
+         * Enables or disables snapshot processing.
+         * <b>This is disabled by default</b>.
+         *
+         * @param isSnapshotProcessing `true` to enable snapshot processing; `false` otherwise.
+         * @return The builder instance.
+         * @see IndexedTxModel::Builder::withSnapshotProcessing()
+         */
+        std::shared_ptr<Builder> withSnapshotProcessing(bool isSnapshotProcessing) {
+            isSnapshotProcessing_ = isSnapshotProcessing;
+
+            return this->template sharedAs<Builder>();
+        }
+
+        /**
+         * Sets the @ref DXFeed "feed" for the model being created.
+         *
+         * @param feed The @ref DXFeed "feed".
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withFeed(std::shared_ptr<DXFeed> feed) {
+            feed_ = std::move(feed);
+
+            return this->template sharedAs<Builder>();
+        }
+
+        /**
+         * Sets the subscription symbol for the model being created.
+         * The symbol cannot be added or changed after the model has been built.
+         *
+         * @param symbol The subscription symbol.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withSymbol(const SymbolWrapper &symbol) {
+            symbol_ = symbol;
+
+            return this->template sharedAs<Builder>();
+        }
+
+        /**
+         * Sets the listener for transaction notifications.
+         * The listener cannot be changed or added once the model has been built.
+         *
+         * @param onEventsReceived A functional object, lambda, or function to which indexed event data will be passed.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withListener(Listener onEventsReceived) {
+            listener_ = std::move(onEventsReceived);
+
+            return this->template sharedAs<Builder>();
+        }
+
+        /**
+         * Sets the sources from which to subscribe for indexed events.
+         * If no sources have been set, subscriptions will default to all possible sources.
+         *
+         * @tparam EventSourceIt The source collection iterator type.
+         * @param begin The beginning of the collection of sources.
+         * @param end The end of the collection of sources.
+         * @return The builder instance.
+         */
+        template <typename EventSourceIt> std::shared_ptr<Builder> withSources(EventSourceIt begin, EventSourceIt end) {
+            sources_ = std::unordered_set<EventSourceWrapper>(begin, end);
+
+            return this->template sharedAs<Builder>();
+        }
+
+        /**
+         * Sets the sources from which to subscribe for indexed events.
+         * If no sources have been set, subscriptions will default to all possible sources.
+         *
+         * @tparam EventSourceCollection A type of the collection of sources (std::vector<EventSourceWrapper>,
+         * std::set<OrderSource>, etc.)
+         * @param sources The specified sources.
+         * @return The builder instance.
+         */
+        template <ConvertibleToEventSourceWrapperCollection EventSourceCollection>
+        std::shared_ptr<Builder> withSources(EventSourceCollection &&sources) {
+            return withSources(std::begin(sources), std::end(sources));
+        }
+
+        /**
+         * Sets the sources from which to subscribe for indexed events.
+         * If no sources have been set, subscriptions will default to all possible sources.
+         *
+         * @param sources The specified sources.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withSources(std::initializer_list<EventSourceWrapper> sources) {
+            return withSources(sources.begin(), sources.end());
+        }
+
+        /**
+         * Builds an instance of NativeIndexedTxModel based on the provided parameters.
+         *
+         * @return The created NativeIndexedTxModel.
+         */
+        std::shared_ptr<NativeIndexedTxModel> build() {
+            return NativeIndexedTxModel::create(this->template sharedAs<Builder>());
+        }
+    };
+
+    private:
+    mutable std::recursive_mutex mtx_{};
+    bool isBatchProcessing_{};
+    bool isSnapshotProcessing_{};
+    SymbolWrapper symbol_{};
+    std::unordered_set<EventSourceWrapper> sources_{};
+    Listener listener_{};
+    std::shared_ptr<DXFeedSubscription> subscription_{};
+    std::unordered_map<IndexedEventSource, TxEventProcessor<E>> processorsBySource_{};
+    std::vector<TxEventProcessor<E> *> processorsInBatch_{};
+    // The processors that were dropped by the listener (close() or setSources()) while a batch was being processed.
+    std::vector<std::unordered_map<IndexedEventSource, TxEventProcessor<E>>> retiredProcessors_{};
+    bool isProcessingBatch_{};
+    std::size_t generation_{};
+    bool closed_{};
+
+    static std::shared_ptr<NativeIndexedTxModel> create(const std::shared_ptr<Builder> &builder) {
+        auto model = NativeIndexedTxModel::createShared(builder);
+
+        model->subscription_->template addEventListener<E>(
+            [m = model->weak_from_this()](const std::vector<std::shared_ptr<E>> &events) {
+                if (const auto locked = m.lock()) {
+                    locked->template sharedAs<NativeIndexedTxModel>()->eventsReceived(events);
+                }
+            });
+
+        model->subscription_->setSymbols(model->createSubscriptionSymbols());
+
+        if (builder->feed_) {
+            model->subscription_->attach(builder->feed_);
+        }
+
+        return model;
+    }
+
+    std::vector<SymbolWrapper> createSubscriptionSymbols() const {
+        if (sources_.empty()) {
+            return {symbol_};
+        }
+
+        std::vector<SymbolWrapper> symbols{};
+
+        symbols.reserve(sources_.size());
+
+        for (const auto &source : sources_) {
+            if (auto orderSource = source.asOrderSource()) {
+                symbols.emplace_back(IndexedEventSubscriptionSymbol(symbol_, orderSource.value()));
+            } else if (auto indexedEventSource = source.asIndexedEventSource()) {
+                symbols.emplace_back(IndexedEventSubscriptionSymbol(symbol_, indexedEventSource.value()));
+            }
+        }
+
+        return symbols;
+    }
+
+    TxEventProcessor<E> &getOrCreateProcessor(const IndexedEventSource &source) {
+        auto found = processorsBySource_.find(source);
+
+        if (found != processorsBySource_.end()) {
+            return found->second;
+        }
+
+        return processorsBySource_.try_emplace(source, source, isBatchProcessing_, isSnapshotProcessing_)
+            .first->second;
+    }
+
+    // Drops the processors. They are kept alive until the end of the batch if the listener is being called.
+    void dropProcessors() {
+        if (isProcessingBatch_) {
+            retiredProcessors_.push_back(std::move(processorsBySource_));
+        }
+
+        processorsBySource_.clear();
+        processorsInBatch_.clear();
+        generation_++;
+    }
+
+    void eventsReceived(const std::vector<std::shared_ptr<E>> &events) {
+        std::lock_guard guard(mtx_);
+
+        if (closed_) {
+            return;
+        }
+
+        // The listener can close the model or change its sources: the rest of the batch is dropped then.
+        const auto listener = listener_;
+        const auto generation = generation_;
+        const auto wasProcessingBatch = isProcessingBatch_;
+        TxEventProcessor<E> *processor = nullptr;
+
+        isProcessingBatch_ = true;
+
+        DXFCPP_FINALLY([&] {
+            isProcessingBatch_ = wasProcessingBatch;
+
+            if (!isProcessingBatch_) {
+                retiredProcessors_.clear();
+            }
+        });
+
+        for (const auto &event : events) {
+            // Events of the same source usually come in a row.
+            if (processor == nullptr || !(processor->getSource() == event->getSource())) {
+                processor = &getOrCreateProcessor(event->getSource());
+            }
+
+            processor->processEvent(event, listener);
+
+            if (generation != generation_) {
+                return;
+            }
+
+            if (isBatchProcessing_ && std::find(processorsInBatch_.begin(), processorsInBatch_.end(), processor) ==
+                                          processorsInBatch_.end()) {
+                processorsInBatch_.push_back(processor);
+            }
+        }
+
+        for (std::size_t i = 0; i < processorsInBatch_.size(); i++) {
+            processorsInBatch_[i]->receiveAllEventsInBatch(listener);
+
+            if (generation != generation_) {
+                return;
+            }
+        }
+
+        processorsInBatch_.clear();
+    }
+
+    public:
+    NativeIndexedTxModel(typename RequireMakeShared<NativeIndexedTxModel<E>>::LockExternalConstructionTag,
+                         const std::shared_ptr<Builder> &builder)
+        : isBatchProcessing_(builder->isBatchProcessing_), isSnapshotProcessing_(builder->isSnapshotProcessing_),
+          sources_(builder->sources_), listener_(builder->listener_) {
+        if (!builder->symbol_) {
+            throw InvalidArgumentException("The symbol must be specified");
+        }
+
+        symbol_ = builder->symbol_.value();
+        subscription_ = DXFeedSubscription::create(E::TYPE);
+    }
+
+    /// Calls @ref NativeIndexedTxModel::close "close" method and destructs this model.
+    ~NativeIndexedTxModel() noexcept override {
+        close();
+    }
+
+    /**
+     * Factory method to create a new builder for this model.
+     *
+     * @return A new @ref NativeIndexedTxModel::Builder "builder" instance.
+     */
+    static std::shared_ptr<Builder> newBuilder() {
+        return Builder::createShared();
+    }
+
+    /**
+     * @return `true` if batch processing is enabled; `false` otherwise.
+     */
+    bool isBatchProcessing() const {
+        return isBatchProcessing_;
+    }
+
+    /**
+     * @return `true` if snapshot processing is enabled; `false` otherwise.
+     */
+    bool isSnapshotProcessing() const {
+        return isSnapshotProcessing_;
+    }
+
+    /**
+     * Attaches this model to the specified feed.
+     *
+     * @param feed The feed to attach to.
+     */
+    void attach(const std::shared_ptr<DXFeed> &feed) const {
+        subscription_->attach(feed);
+    }
+
+    /**
+     * Detaches this model from the specified feed.
+     *
+     * @param feed The feed to detach from.
+     */
+    void detach(const std::shared_ptr<DXFeed> &feed) const {
+        subscription_->detach(feed);
+    }
+
+    /**
+     * Closes this model and makes it <i>permanently detached</i>.
+     *
+     * <p>This method clears installed listener.
+     */
+    void close() {
+        std::lock_guard guard(mtx_);
+
+        if (closed_) {
+            return;
+        }
+
+        closed_ = true;
+        subscription_->close();
+        dropProcessors();
+        listener_ = nullptr;
+    }
+
+    /**
+     * Returns the current set of sources.
+     * If no sources have been set, an empty set is returned, indicating that all possible sources have been subscribed
+     * to.
+     *
+     * @return The set of the current sources.
+     */
+    std::unordered_set<EventSourceWrapper> getSources() const {
+        std::lock_guard guard(mtx_);
+
+        return sources_;
+    }
+
+    /**
+     * Sets the sources from which to subscribe for indexed events.
+     * If an empty list is provided, subscriptions will default to all available sources.
+     * If these sources have already been set, nothing happens.
+     *
+     * @tparam EventSourceIt The source collection iterator type.
+     * @param begin The beginning of the collection of sources.
+     * @param end The end of the collection of sources.
+     */
+    template <typename EventSourceIt> void setSources(EventSourceIt begin, EventSourceIt end) {
+        std::lock_guard guard(mtx_);
+
+        std::unordered_set<EventSourceWrapper> sources(begin, end);
+
+        if (closed_ || sources == sources_) {
+            return;
+        }
+
+        sources_ = std::move(sources);
+        dropProcessors();
+        subscription_->setSymbols(createSubscriptionSymbols());
+    }
+
+    /**
+     * Sets the sources from which to subscribe for indexed events.
+     * If an empty list is provided, subscriptions will default to all available sources.
+     * If these sources have already been set, nothing happens.
+     *
+     * @tparam EventSourceCollection A type of the collection of sources (std::vector<EventSourceWrapper>,
+     * std::set<OrderSource>, etc.)
+     * @param sources The specified sources.
+     */
+    template <ConvertibleToEventSourceWrapperCollection EventSourceCollection>
+    void setSources(EventSourceCollection &&sources) {
+        setSources(std::begin(sources), std::end(sources));
+    }
+
+    /**
+     * Sets the sources from which to subscribe for indexed events.
+     * If an empty list is provided, subscriptions will default to all available sources.
+     * If these sources have already been set, nothing happens.
+     *
+     * @param sources The specified sources.
+     */
+    void setSources(std::initializer_list<EventSourceWrapper> sources) {
+        setSources(sources.begin(), sources.end());
+    }
+
+    std::string toString() const override {
+        return "NativeIndexedTxModel{" + symbol_.toString() + "}";
+    }
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
@@ -0,0 +1,387 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../entity/SharedEntity.hpp"
+#include "../event/EventType.hpp"
+#include "../internal/Common.hpp"
+#include "../ipf/InstrumentProfile.hpp"
+#include "../ipf/InstrumentProfileData.hpp"
+#include "../ipf/option/CompactOptionChain.hpp"
+#include "../ipf/option/CompactOptionSeries.hpp"
+#include "../ipf/option/OptionChain.hpp"
+#include "../ipf/option/OptionSeries.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_model
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+struct DXFeed;
+struct DXFeedSubscription;
+
+/**
+ * The chain-level statistics of an option series (see OptionChainAnalytics).
+ *
+ * <p>The values that can't be calculated yet (for example, before the first Series event) are `NaN`.
+ */
+struct DXFCPP_EXPORT OptionSeriesAnalytics {
+    /// The series (as OptionSeries::toString()).
+    std::string series{};
+    /// The day id of expiration.
+    std::int32_t expiration{};
+    /// The underlying symbol of the series.
+    std::string underlying{};
+    /// The forward price of the Series event.
+    double forwardPrice{};
+    /// The at-the-money volatility: the volatility interpolated by the strike at the forward price.
+    double atmVolatility{};
+    /// The 25-delta skew: the volatility of the put with the delta nearest to -0.25 minus the volatility of the call
+    /// with the delta nearest to 0.25.
+    double skew25Delta{};
+    /// The call volume of the Series event.
+    double callVolume{};
+    /// The put volume of the Series event.
+    double putVolume{};
+    /// The put/call volume ratio.
+    double putCallVolumeRatio{};
+    /// The total open interest of the calls.
+    double callOpenInterest{};
+    /// The total open interest of the puts.
+    double putOpenInterest{};
+    /// The put/call open interest ratio.
+    double putCallOpenInterestRatio{};
+    /// The open-interest-weighted volatility of the options.
+    double weightedVolatility{};
+    /// The gamma exposure of the series: the sum of `gamma * openInterest * spc` of the calls minus the one of the
+    /// puts.
+    double gammaExposure{};
+    /// The strikes of the series in ascending order.
+    std::vector<double> strikes{};
+    /// The gamma exposures by the ::strikes.
+    std::vector<double> gammaExposureByStrike{};
+};
+
+/**
+ * The incremental chain-level analytics of the option series: the ATM volatility, the 25-delta skew, the put/call
+ * volume and open interest ratios, the open-interest-weighted volatility and the gamma exposure by strike.
+ *
+ * <p>The model keeps the last Greeks (the volatility, the delta and the gamma) and Summary (the open interest) of each
+ * option of the series and the last Series event (the forward price and the volumes) of each expiration of the
+ * underlying. Each event updates the sums of the series in O(1). The ATM volatility and the 25-delta skew are
+ * calculated when the analytics are requested or notified.
+ *
+ * <p>The listener is notified with the analytics of the changed series after each batch of events, or once per
+ * @ref Builder::withAggregationPeriod() "aggregation period" (as MarketDepthModel does), if it is set.
+ *
+ * <h3>Threads and locks</h3>
+ *
+ * <p>This class is thread-safe. The listener is called while the model is locked.
+ *
+ * Sample:
+ *
+ * ```cpp
+ * auto analytics = OptionChainAnalytics::newBuilder()
+ *                      ->withFeed(feed)
+ *                      ->withChain(chains.at("SPX"))
+ *                      ->withAggregationPeriod(std::chrono::milliseconds(500))
+ *                      ->withListener([](const auto &series) {
+ *                          for (const auto &s : series) {
+ *                              std::cout << s.expiration << ": ATM " << s.atmVolatility << ", skew " << s.skew25Delta
+ *                                        << std::endl;
+ *                          }
+ *                      })
+ *                      ->build();
+ * ```
+ */
+struct DXFCPP_EXPORT OptionChainAnalytics final : RequireMakeShared<OptionChainAnalytics> {
+    /**
+     * The listener's signature.
+     */
+    using Listener = std::function<void(const std::vector<OptionSeriesAnalytics> & /* changedSeries */)>;
+
+    /**
+     * A builder class for creating an instance of OptionChainAnalytics.
+     */
+    struct DXFCPP_EXPORT Builder final : RequireMakeShared<Builder> {
+        friend struct OptionChainAnalytics;
+
+        private:
+        struct SeriesDefinition {
+            std::string series{};
+            std::int32_t expiration{};
+            double spc{};
+            std::string underlying{};
+            std::vector<double> strikes{};
+            // The symbols of the options by the strikes (empty if there is no option).
+            std::vector<std::string> calls{};
+            std::vector<std::string> puts{};
+        };
+
+        std::shared_ptr<DXFeed> feed_{};
+        std::vector<SeriesDefinition> series_{};
+        std::int64_t aggregationPeriodMillis_{};
+        Listener listener_{};
+
+        static std::string getSymbol(const InstrumentProfile &profile);
+
+        static std::string getSymbol(const InstrumentProfileData &profile) {
+            return std::string(profile.symbol);
+        }
+
+        static std::string getSymbol(const std::string &symbol) {
+            return symbol;
+        }
+
+        static std::string getUnderlying(const InstrumentProfile &profile);
+
+        static std::string getUnderlying(const InstrumentProfileData &profile) {
+            return std::string(profile.underlying);
+        }
+
+        static std::string getUnderlying(const std::string &) {
+            return {};
+        }
+
+        template <typename T>
+        void addSeries(const OptionSeries<T> &attributes, const std::vector<double> &strikes,
+                       const std::vector<std::shared_ptr<T>> &calls, const std::vector<std::shared_ptr<T>> &puts,
+                       std::optional<std::string> underlying) {
+            SeriesDefinition definition{attributes.toString(), attributes.getExpiration(), attributes.getSPC(), {},
+                                        strikes, {}, {}};
+
+            for (auto [options, symbols] : {std::pair{&calls, &definition.calls}, std::pair{&puts, &definition.puts}}) {
+                symbols->reserve(options->size());
+
+                for (const auto &option : *options) {
+                    symbols->push_back(option ? getSymbol(*option) : std::string{});
+
+                    if (!underlying && option) {
+                        underlying = getUnderlying(*option);
+                    }
+                }
+            }
+
+            definition.underlying = underlying.value_or(std::string{});
+            series_.push_back(std::move(definition));
+        }
+
+        template <typename T>
+        void addSeries(const OptionSeries<T> &series, std::optional<std::string> underlying) {
+            const auto &strikes = series.getStrikes();
+            std::vector<std::shared_ptr<T>> calls(strikes.size());
+            std::vector<std::shared_ptr<T>> puts(strikes.size());
+
+            for (std::size_t i = 0; i < strikes.size(); i++) {
+                if (const auto call = series.getCalls().find(strikes[i]); call != series.getCalls().end()) {
+                    calls[i] = call->second;
+                }
+
+                if (const auto put = series.getPuts().find(strikes[i]); put != series.getPuts().end()) {
+                    puts[i] = put->second;
+                }
+            }
+
+            addSeries(series, strikes, calls, puts, std::move(underlying));
+        }
+
+        public:
+        explicit Builder(LockExternalConstructionTag);
+
+        ~Builder() noexcept override;
+
+        /**
+         * Sets the DXFeed for the model being created. The model subscribes to Greeks and Summary of the options and to
+         * Series of the underlyings. If the feed is not set, the events must be passed to
+         * OptionChainAnalytics::process().
+         *
+         * @param feed The DXFeed.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withFeed(std::shared_ptr<DXFeed> feed);
+
+        /**
+         * Adds the option series to the model being created. The underlying symbol (for the Series events) is the
+         * underlying of the options.
+         *
+         * @tparam T The type of option instrument instances: InstrumentProfile, InstrumentProfileData or the symbol
+         * (`std::string`).
+         * @param series The series.
+         * @return The builder instance.
+         */
+        template <typename T> std::shared_ptr<Builder> withSeries(const OptionSeries<T> &series) {
+            addSeries(series, std::nullopt);
+
+            return sharedAs<Builder>();
+        }
+
+        /**
+         * Adds the option series with the underlying symbol to the model being created.
+         *
+         * @tparam T The type of option instrument instances: InstrumentProfile, InstrumentProfileData or the symbol
+         * (`std::string`).
+         * @param series The series.
+         * @param underlying The underlying symbol (for the Series events).
+         * @return The builder instance.
+         */
+        template <typename T>
+        std::shared_ptr<Builder> withSeries(const OptionSeries<T> &series, const StringLike &underlying) {
+            addSeries(series, std::string(underlying));
+
+            return sharedAs<Builder>();
+        }
+
+        /**
+         * Adds all the series of the option chain to the model being created.
+         *
+         * @tparam T The type of option instrument instances: InstrumentProfile, InstrumentProfileData or the symbol
+         * (`std::string`).
+         * @param chain The chain.
+         * @return The builder instance.
+         */
+        template <typename T> std::shared_ptr<Builder> withChain(OptionChain<T> chain) {
+            for (const auto &series : chain.getSeries()) {
+                addSeries(series, std::nullopt);
+            }
+
+            return sharedAs<Builder>();
+        }
+
+        /**
+         * Adds all the series of the compact option chain to the model being created.
+         *
+         * @tparam T The type of option instrument instances: InstrumentProfile, InstrumentProfileData or the symbol
+         * (`std::string`).
+         * @param chain The chain.
+         * @return The builder instance.
+         */
+        template <typename T> std::shared_ptr<Builder> withChain(const CompactOptionChain<T> &chain) {
+            for (const auto &series : chain.getSeries()) {
+                addSeries(series.getAttributes(), series.getStrikes(), series.getCalls(), series.getPuts(),
+                          std::nullopt);
+            }
+
+            return sharedAs<Builder>();
+        }
+
+        /**
+         * Sets the aggregation period. The changed series are notified once per period instead of after each batch of
+         * events. `0` (the default) means no aggregation.
+         *
+         * @param aggregationPeriodMillis The aggregation period in milliseconds.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withAggregationPeriod(std::int64_t aggregationPeriodMillis);
+
+        /**
+         * Sets the aggregation period.
+         *
+         * @param aggregationPeriod The aggregation period.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withAggregationPeriod(std::chrono::milliseconds aggregationPeriod) {
+            return withAggregationPeriod(aggregationPeriod.count());
+        }
+
+        /**
+         * Sets the listener for the analytics of the changed series.
+         *
+         * @param listener The listener.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder> withListener(Listener listener);
+
+        /**
+         * Builds an instance of OptionChainAnalytics based on the provided parameters.
+         *
+         * @return The created OptionChainAnalytics.
+         * @throws InvalidArgumentException if there are no series or the aggregation period is negative.
+         */
+        std::shared_ptr<OptionChainAnalytics> build();
+    };
+
+    private:
+    struct Impl;
+
+    mutable std::recursive_mutex mtx_{};
+    std::unique_ptr<Impl> impl_;
+    std::shared_ptr<DXFeedSubscription> subscription_{};
+    std::shared_ptr<DXFeedSubscription> seriesSubscription_{};
+
+    static std::shared_ptr<OptionChainAnalytics> create(const std::shared_ptr<Builder> &builder);
+
+    void notifyListener();
+
+    public:
+    OptionChainAnalytics(LockExternalConstructionTag, const std::shared_ptr<Builder> &builder);
+
+    ~OptionChainAnalytics() noexcept override;
+
+    /**
+     * Creates a new builder instance for constructing an OptionChainAnalytics.
+     *
+     * @return A new instance of the builder.
+     */
+    static std::shared_ptr<Builder> newBuilder();
+
+    /**
+     * Applies the batch of Greeks, Summary and Series events. The events of the unknown symbols and of the other types
+     * are ignored.
+     *
+     * @param events The events.
+     */
+    void process(const std::vector<std::shared_ptr<EventType>> &events);
+
+    /**
+     * Returns the analytics of all the series in the order of their addition.
+     *
+     * @return The analytics of the series.
+     */
+    std::vector<OptionSeriesAnalytics> getAnalytics() const;
+
+    /**
+     * Returns the analytics of the series.
+     *
+     * @param series The series (as OptionSeries::toString()).
+     * @return The analytics or `std::nullopt` if there is no such series.
+     */
+    std::optional<OptionSeriesAnalytics> getAnalytics(const std::string &series) const;
+
+    /**
+     * Returns the analytics of the series.
+     *
+     * @tparam T The type of option instrument instances.
+     * @param series The series.
+     * @return The analytics or `std::nullopt` if there is no such series.
+     */
+    template <typename T> std::optional<OptionSeriesAnalytics> getAnalytics(const OptionSeries<T> &series) const {
+        return getAnalytics(series.toString());
+    }
+
+    /**
+     * Closes this model: the subscription is closed, the pending notification is cancelled.
+     */
+    void close();
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
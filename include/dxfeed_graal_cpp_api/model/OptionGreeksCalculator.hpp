@@ -0,0 +1,300 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../event/option/Greeks.hpp"
+#include "../ipf/option/CompactOptionChain.hpp"
+#include "../ipf/option/CompactOptionSeries.hpp"
+#include "../ipf/option/OptionSeries.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_model
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * The columns of the options for OptionGreeksCalculator: the inputs (the strike, the time to expiration, the market
+ * price, the rate, the dividend yield and the call/put flag of each option) and the outputs (the implied volatility,
+ * the theoretical price and the greeks).
+ *
+ * <p>The inputs of a chain usually change only by the market prices, so the batch is filled once and only the
+ * ::prices column is updated before each calculation.
+ */
+struct DXFCPP_EXPORT OptionGreeksBatch {
+    /// The strikes of the options.
+    std::vector<double> strikes{};
+    /// The times to expiration in years (see OptionGreeksCalculator::getTimeToExpiration()).
+    std::vector<double> expirations{};
+    /// The market prices of the options (the input of the implied volatility). `NaN` if there is no price.
+    std::vector<double> prices{};
+    /// The continuously compounded risk-free rates (`0.05` is 5%).
+    std::vector<double> rates{};
+    /// The continuously compounded dividend yields (`0.01` is 1%). They are ignored by the Black-76 model.
+    std::vector<double> dividends{};
+    /// `1` for calls, `0` for puts.
+    std::vector<std::uint8_t> calls{};
+
+    /// The volatilities (the output of the implied volatility and the input of the greeks).
+    std::vector<double> volatilities{};
+    /// The theoretical prices by the ::volatilities.
+    std::vector<double> theoPrices{};
+    /// The deltas (the first derivative of the price by the underlying price).
+    std::vector<double> deltas{};
+    /// The gammas (the second derivative of the price by the underlying price).
+    std::vector<double> gammas{};
+    /// The thetas (the change of the price in one calendar day).
+    std::vector<double> thetas{};
+    /// The rhos (the change of the price by one percent of the rate).
+    std::vector<double> rhos{};
+    /// The vegas (the change of the price by one percent of the volatility).
+    std::vector<double> vegas{};
+
+    /**
+     * @return The number of the options.
+     */
+    std::size_t size() const noexcept {
+        return strikes.size();
+    }
+
+    /**
+     * Adds the option. Its volatility and its outputs are `NaN`.
+     *
+     * @param strike The strike.
+     * @param expiration The time to expiration in years.
+     * @param price The market price (`NaN` if there is no price).
+     * @param rate The risk-free rate.
+     * @param dividend The dividend yield.
+     * @param isCall `true` for a call, `false` for a put.
+     */
+    void add(double strike, double expiration, double price, double rate, double dividend, bool isCall);
+
+    /**
+     * Removes all the options.
+     */
+    void clear() noexcept;
+};
+
+/**
+ * The batch calculator of the implied volatilities and the greeks by the Black-Scholes (with a continuous dividend
+ * yield) or the Black-76 (of the options on the futures) models.
+ *
+ * <p>The calculations are done column by column over OptionGreeksBatch. The implied volatilities of all the options are
+ * solved together: each iteration is a single pass over the options that haven't converged yet that does a safeguarded
+ * Newton step (or a bisection step if the Newton step leaves the bracket). The converged options are removed from the
+ * working columns after each iteration, so a slow option doesn't cost an iteration of the whole batch.
+ *
+ * <p>The loops are vectorized (SSE2, AVX2, NEON, depending on the target of the build): the normal CDF, `exp` and `log`
+ * are computed by the branch-free polynomial approximations (accurate to a few ulps, the normal CDF to 1e-15 absolute)
+ * instead of the calls of the standard library, and the library compiles this calculator with `-fno-trapping-math` and
+ * `-fno-math-errno` (GCC and Clang).
+ *
+ * <p>The options of the chains are added with ::addSeries() and ::addChain(), so the whole chain is recalculated on
+ * each change of the underlying price, and the results are converted to Greeks events with ::toGreeks().
+ *
+ * ```cpp
+ * OptionGreeksBatch batch{};
+ * auto options = OptionGreeksCalculator::addChain(batch, chains.at("SPX"), now, 0.05, 0.0, [&](const auto &option) {
+ *     return midPrices[option->symbol];
+ * });
+ *
+ * // On each tick of the underlying.
+ * OptionGreeksCalculator::compute(OptionGreeksCalculator::Model::BLACK_SCHOLES, underlyingPrice, batch);
+ *
+ * auto greeks = OptionGreeksCalculator::toGreeks(batch, 0, options[0]->symbol, now);
+ * ```
+ *
+ * <p>This class is thread-safe: it has no state.
+ */
+struct DXFCPP_EXPORT OptionGreeksCalculator final {
+    /// The pricing model.
+    enum class Model {
+        /// The Black-Scholes model: the underlying price is the spot price, the dividend yield is used.
+        BLACK_SCHOLES,
+        /// The Black-76 model: the underlying price is the futures price, the dividend yield is ignored.
+        BLACK_76,
+    };
+
+    /// The maximal number of the iterations of the implied volatility.
+    static constexpr std::size_t MAX_ITERATIONS = 100;
+
+    /// The precision of the implied volatility.
+    static constexpr double VOLATILITY_PRECISION = 1e-10;
+
+    /// The minimal implied volatility.
+    static constexpr double MIN_VOLATILITY = 1e-6;
+
+    /// The maximal implied volatility (1000%).
+    static constexpr double MAX_VOLATILITY = 10.0;
+
+    /**
+     * Calculates the implied volatilities (OptionGreeksBatch::volatilities) of the options by their market prices. The
+     * volatility is `NaN` if the price is unknown or it is out of the bounds of the model (for example, it is less than
+     * the intrinsic value), or if the option is expired.
+     *
+     * @param model The model.
+     * @param underlyingPrice The underlying price.
+     * @param batch The options.
+     */
+    static void computeImpliedVolatilities(Model model, double underlyingPrice, OptionGreeksBatch &batch);
+
+    /**
+     * Calculates the theoretical prices and the greeks of the options by their OptionGreeksBatch::volatilities.
+     * The outputs are `NaN` if the volatility is `NaN`.
+     *
+     * @param model The model.
+     * @param underlyingPrice The underlying price.
+     * @param batch The options.
+     */
+    static void computeGreeks(Model model, double underlyingPrice, OptionGreeksBatch &batch);
+
+    /**
+     * Calculates the implied volatilities and then the greeks of the options.
+     *
+     * @param model The model.
+     * @param underlyingPrice The underlying price.
+     * @param batch The options.
+     */
+    static void compute(Model model, double underlyingPrice, OptionGreeksBatch &batch);
+
+    /**
+     * Returns the time to expiration in years (of 365 days). The options expire at the end of the expiration day (in
+     * UTC).
+     *
+     * @param expiration The day id of expiration (see OptionSeries::getExpiration()).
+     * @param time The current time in milliseconds since Unix epoch.
+     * @return The time to expiration in years (`0` if the option is expired).
+     */
+    static double getTimeToExpiration(std::int32_t expiration, std::int64_t time) noexcept;
+
+    /**
+     * Creates the Greeks event by the results of the option.
+     *
+     * @param batch The options.
+     * @param index The index of the option in the batch.
+     * @param eventSymbol The symbol of the option.
+     * @param time The time of the event in milliseconds since Unix epoch.
+     * @return The new Greeks event.
+     */
+    static std::shared_ptr<Greeks> toGreeks(const OptionGreeksBatch &batch, std::size_t index,
+                                            const StringLike &eventSymbol, std::int64_t time);
+
+    /**
+     * Adds the options of the series to the batch: the calls and then the puts in the order of the strikes.
+     *
+     * @tparam T The type of option instrument instances.
+     * @tparam PriceFunction The type of the function that returns the market price of the option: `double(const
+     * std::shared_ptr<T> &)`.
+     * @param batch The batch.
+     * @param series The series.
+     * @param time The current time in milliseconds since Unix epoch.
+     * @param rate The risk-free rate.
+     * @param dividend The dividend yield.
+     * @param price The function that returns the market price of the option.
+     * @return The added options in the order of the batch.
+     */
+    template <typename T, typename PriceFunction>
+    static std::vector<std::shared_ptr<T>> addSeries(OptionGreeksBatch &batch, const OptionSeries<T> &series,
+                                                     std::int64_t time, double rate, double dividend,
+                                                     PriceFunction &&price) {
+        std::vector<std::shared_ptr<T>> options{};
+        const auto expiration = getTimeToExpiration(series.getExpiration(), time);
+
+        for (const auto *map : {&series.getCalls(), &series.getPuts()}) {
+            for (const auto &[strike, option] : *map) {
+                batch.add(strike, expiration, price(option), rate, dividend, map == &series.getCalls());
+                options.push_back(option);
+            }
+        }
+
+        return options;
+    }
+
+    /**
+     * Adds the options of the compact series to the batch: the calls and then the puts in the order of the strikes.
+     *
+     * @tparam T The type of option instrument instances.
+     * @tparam PriceFunction The type of the function that returns the market price of the option: `double(const
+     * std::shared_ptr<T> &)`.
+     * @param batch The batch.
+     * @param series The series.
+     * @param time The current time in milliseconds since Unix epoch.
+     * @param rate The risk-free rate.
+     * @param dividend The dividend yield.
+     * @param price The function that returns the market price of the option.
+     * @return The added options in the order of the batch.
+     */
+    template <typename T, typename PriceFunction>
+    static std::vector<std::shared_ptr<T>> addSeries(OptionGreeksBatch &batch, const CompactOptionSeries<T> &series,
+                                                     std::int64_t time, double rate, double dividend,
+                                                     PriceFunction &&price) {
+        std::vector<std::shared_ptr<T>> options{};
+
+        addSeries(batch, series, time, rate, dividend, price, options);
+
+        return options;
+    }
+
+    /**
+     * Adds the options of all the series of the chain to the batch.
+     *
+     * @tparam T The type of option instrument instances.
+     * @tparam PriceFunction The type of the function that returns the market price of the option: `double(const
+     * std::shared_ptr<T> &)`.
+     * @param batch The batch.
+     * @param chain The chain.
+     * @param time The current time in milliseconds since Unix epoch.
+     * @param rate The risk-free rate.
+     * @param dividend The dividend yield.
+     * @param price The function that returns the market price of the option.
+     * @return The added options in the order of the batch.
+     */
+    template <typename T, typename PriceFunction>
+    static std::vector<std::shared_ptr<T>> addChain(OptionGreeksBatch &batch, const CompactOptionChain<T> &chain,
+                                                    std::int64_t time, double rate, double dividend,
+                                                    PriceFunction &&price) {
+        std::vector<std::shared_ptr<T>> options{};
+
+        for (const auto &series : chain.getSeries()) {
+            addSeries(batch, series, time, rate, dividend, price, options);
+        }
+
+        return options;
+    }
+
+    private:
+    template <typename T, typename PriceFunction>
+    static void addSeries(OptionGreeksBatch &batch, const CompactOptionSeries<T> &series, std::int64_t time,
+                          double rate, double dividend, PriceFunction &price,
+                          std::vector<std::shared_ptr<T>> &options) {
+        const auto expiration = getTimeToExpiration(series.getExpiration(), time);
+
+        for (const auto *slots : {&series.getCalls(), &series.getPuts()}) {
+            for (std::size_t i = 0; i < slots->size(); i++) {
+                if (const auto &option = (*slots)[i]) {
+                    batch.add(series.getStrikes()[i], expiration, price(option), rate, dividend,
+                              slots == &series.getCalls());
+                    options.push_back(option);
+                }
+            }
+        }
+    }
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
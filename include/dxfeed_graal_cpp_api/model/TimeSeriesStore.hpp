@@ -0,0 +1,661 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../entity/SharedEntity.hpp"
+#include "../event/EventFlag.hpp"
+#include "../event/TimeSeriesEvent.hpp"
+#include "../event/candle/Candle.hpp"
+#include "../event/market/TimeAndSale.hpp"
+#include "../exceptions/InvalidArgumentException.hpp"
+#include "./TxModelListener.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_model
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * A compact POD representation of the TimeAndSale event that is stored in the TimeSeriesStore.
+ * The event symbol and the string fields (exchange sale conditions, buyer, seller) are not stored.
+ */
+struct TimeAndSaleRecord {
+    std::int64_t index;
+    std::int64_t time;
+    double price;
+    double size;
+    double bidPrice;
+    double askPrice;
+    std::int32_t timeNanoPart;
+    std::int16_t exchangeCode;
+    std::uint8_t aggressorSide;
+    std::uint8_t type;
+    char tradeThroughExempt;
+    bool spreadLeg;
+    bool extendedTradingHours;
+    bool validTick;
+};
+
+static_assert(std::is_trivially_copyable_v<TimeAndSaleRecord> && sizeof(TimeAndSaleRecord) <= 64);
+
+/**
+ * A compact POD representation of the Candle event that is stored in the TimeSeriesStore.
+ * The candle symbol is not stored (it is the same for all the candles of the store).
+ */
+struct CandleRecord {
+    std::int64_t index;
+    std::int64_t time;
+    std::int64_t count;
+    double open;
+    double high;
+    double low;
+    double close;
+    double volume;
+    double vwap;
+    double bidVolume;
+    double askVolume;
+    double impVolatility;
+    double openInterest;
+};
+
+static_assert(std::is_trivially_copyable_v<CandleRecord> && sizeof(CandleRecord) <= 104);
+
+/**
+ * Maps the time series event type to the compact record type of the TimeSeriesStore.
+ * The specialization must define the `Record` type (a trivially copyable struct with `index` and `time` fields)
+ * and the `static Record toRecord(const E &event)` function.
+ *
+ * @tparam E The type of event (derived from TimeSeriesEvent)
+ */
+template <typename E> struct TimeSeriesRecordTraits;
+
+template <> struct TimeSeriesRecordTraits<TimeAndSale> {
+    using Record = TimeAndSaleRecord;
+
+    static Record toRecord(const TimeAndSale &event) noexcept {
+        return {event.getIndex(),
+                event.getTime(),
+                event.getPrice(),
+                event.getSize(),
+                event.getBidPrice(),
+                event.getAskPrice(),
+                event.getTimeNanoPart(),
+                event.getExchangeCode(),
+                static_cast<std::uint8_t>(event.getAggressorSide().getCode()),
+                static_cast<std::uint8_t>(event.getType().getCode()),
+                event.getTradeThroughExempt(),
+                event.isSpreadLeg(),
+                event.isExtendedTradingHours(),
+                event.isValidTick()};
+    }
+};
+
+template <> struct TimeSeriesRecordTraits<Candle> {
+    using Record = CandleRecord;
+
+    static Record toRecord(const Candle &event) noexcept {
+        return {event.getIndex(),     event.getTime(),      event.getCount(),  event.getOpen(),
+                event.getHigh(),      event.getLow(),       event.getClose(),  event.getVolume(),
+                event.getVWAP(),      event.getBidVolume(), event.getAskVolume(), event.getImpVolatility(),
+                event.getOpenInterest()};
+    }
+};
+
+/**
+ * A bounded in-memory store of the time series events of a single symbol.
+ *
+ * <p>The events are kept as compact POD @ref TimeSeriesRecordTraits "records" in a circular buffer sorted by
+ * @ref IndexedEvent::getIndex() "index" (and therefore by time). When the store is full, the oldest records are
+ * evicted. Appending the newest event or prepending the oldest one (time series snapshots are delivered from the newest
+ * event to the oldest) is O(1), lookups by index and time-range queries are O(log n).
+ *
+ * <p>The store is updated with the transactions of the TimeSeriesTxModel: a snapshot replaces the content of the store,
+ * events marked with @ref EventFlag::REMOVE_EVENT "REMOVE_EVENT" remove the records with the same index, and other
+ * events insert or replace the records with the same index. The store is attached to a model with
+ * @ref TimeSeriesTxModel::Builder::withStore() "withStore" or by the @ref TimeSeriesStore::createListener()
+ * "listener".
+ *
+ * <h3>Threads and locks</h3>
+ *
+ * <p>This class is thread-safe. Any number of threads can query the store while the model updates it.
+ *
+ * Sample:
+ *
+ * ```cpp
+ * auto store = TimeSeriesStore<TimeAndSale>::create(100'000);
+ * auto model = TimeSeriesTxModel<TimeAndSale>::newBuilder()
+ *                  ->withFeed(feed)
+ *                  ->withFromTime(std::chrono::milliseconds(dxfcpp::now()) - std::chrono::minutes(30))
+ *                  ->withStore(store)
+ *                  ->withSymbol("AAPL")
+ *                  ->build();
+ *
+ * // ...
+ *
+ * for (const auto &r : store->getLastWindow(std::chrono::minutes(5))) {
+ *     std::cout << r.time << ": " << r.price << " x " << r.size << std::endl;
+ * }
+ * ```
+ *
+ * @tparam E The type of event (derived from TimeSeriesEvent)
+ */
+template <Derived<TimeSeriesEvent> E>
+struct /* DXFCPP_EXPORT */ TimeSeriesStore final : RequireMakeShared<TimeSeriesStore<E>> {
+    /// The type of the stored records.
+    using Record = typename TimeSeriesRecordTraits<E>::Record;
+
+    static_assert(std::is_trivially_copyable_v<Record>, "The record must be a trivially copyable type");
+
+    private:
+    mutable std::shared_mutex mtx_{};
+    std::vector<Record> buffer_{};
+    std::size_t mask_{};
+    std::size_t capacity_{};
+    std::size_t head_{};
+    std::size_t size_{};
+
+    const Record &at(std::size_t position) const noexcept {
+        return buffer_[(head_ + position) & mask_];
+    }
+
+    Record &at(std::size_t position) noexcept {
+        return buffer_[(head_ + position) & mask_];
+    }
+
+    std::size_t lowerBoundByIndex(std::int64_t index) const noexcept {
+        std::size_t first = 0;
+        std::size_t count = size_;
+
+        while (count > 0) {
+            auto step = count / 2;
+
+            if (at(first + step).index < index) {
+                first += step + 1;
+                count -= step + 1;
+            } else {
+                count = step;
+            }
+        }
+
+        return first;
+    }
+
+    // The first position with time >= time (upper == false) or with time > time (upper == true).
+    std::size_t boundByTime(std::int64_t time, bool upper) const noexcept {
+        std::size_t first = 0;
+        std::size_t count = size_;
+
+        while (count > 0) {
+            auto step = count / 2;
+            const auto &r = at(first + step);
+
+            if (upper ? r.time <= time : r.time < time) {
+                first += step + 1;
+                count -= step + 1;
+            } else {
+                count = step;
+            }
+        }
+
+        return first;
+    }
+
+    void insertAt(std::size_t position, const Record &record) noexcept {
+        if (size_ == capacity_) {
+            if (position == 0) {
+                return; // older than all the stored records
+            }
+
+            head_ = (head_ + 1) & mask_; // evict the oldest record
+            size_--;
+            position--;
+        }
+
+        // Shift the smaller part of the buffer.
+        if (position < size_ - position) {
+            head_ = (head_ - 1) & mask_;
+
+            for (std::size_t i = 0; i < position; i++) {
+                at(i) = at(i + 1);
+            }
+        } else {
+            for (std::size_t i = size_; i > position; i--) {
+                at(i) = at(i - 1);
+            }
+        }
+
+        at(position) = record;
+        size_++;
+    }
+
+    void eraseAt(std::size_t position) noexcept {
+        if (position < size_ - position - 1) {
+            for (std::size_t i = position; i > 0; i--) {
+                at(i) = at(i - 1);
+            }
+
+            head_ = (head_ + 1) & mask_;
+        } else {
+            for (std::size_t i = position; i + 1 < size_; i++) {
+                at(i) = at(i + 1);
+            }
+        }
+
+        size_--;
+    }
+
+    void updateImpl(const E &event) noexcept {
+        const auto index = event.getIndex();
+        const auto position = lowerBoundByIndex(index);
+        const bool found = position < size_ && at(position).index == index;
+
+        if ((event.getEventFlags() & EventFlag::REMOVE_EVENT) != 0) {
+            if (found) {
+                eraseAt(position);
+            }
+
+            return;
+        }
+
+        if (found) {
+            at(position) = TimeSeriesRecordTraits<E>::toRecord(event);
+        } else {
+            insertAt(position, TimeSeriesRecordTraits<E>::toRecord(event));
+        }
+    }
+
+    public:
+    /**
+     * A read-only view of the consecutive records of the store.
+     * The view holds the shared lock of the store: the store cannot be updated while the view exists,
+     * so the view must be short-lived.
+     */
+    struct Window final {
+        friend struct TimeSeriesStore;
+
+        /// The random access iterator over the records of the window.
+        struct Iterator {
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = Record;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Record *;
+            using reference = const Record &;
+
+            private:
+            const TimeSeriesStore *store_{};
+            std::size_t position_{};
+
+            public:
+            Iterator() noexcept = default;
+
+            Iterator(const TimeSeriesStore *store, std::size_t position) noexcept
+                : store_(store), position_(position) {
+            }
+
+            reference operator*() const noexcept {
+                return store_->at(position_);
+            }
+
+            pointer operator->() const noexcept {
+                return &store_->at(position_);
+            }
+
+            reference operator[](difference_type n) const noexcept {
+                return store_->at(position_ + n);
+            }
+
+            Iterator &operator++() noexcept {
+                position_++;
+
+                return *this;
+            }
+
+            Iterator operator++(int) noexcept {
+                auto copy = *this;
+
+                position_++;
+
+                return copy;
+            }
+
+            Iterator &operator--() noexcept {
+                position_--;
+
+                return *this;
+            }
+
+            Iterator operator--(int) noexcept {
+                auto copy = *this;
+
+                position_--;
+
+                return copy;
+            }
+
+            Iterator &operator+=(difference_type n) noexcept {
+                position_ += n;
+
+                return *this;
+            }
+
+            Iterator &operator-=(difference_type n) noexcept {
+                position_ -= n;
+
+                return *this;
+            }
+
+            friend Iterator operator+(Iterator it, difference_type n) noexcept {
+                return it += n;
+            }
+
+            friend Iterator operator+(difference_type n, Iterator it) noexcept {
+                return it += n;
+            }
+
+            friend Iterator operator-(Iterator it, difference_type n) noexcept {
+                return it -= n;
+            }
+
+            friend difference_type operator-(const Iterator &it1, const Iterator &it2) noexcept {
+                return static_cast<difference_type>(it1.position_) - static_cast<difference_type>(it2.position_);
+            }
+
+            friend bool operator==(const Iterator &it1, const Iterator &it2) noexcept {
+                return it1.position_ == it2.position_;
+            }
+
+            friend auto operator<=>(const Iterator &it1, const Iterator &it2) noexcept {
+                return it1.position_ <=> it2.position_;
+            }
+        };
+
+        private:
+        std::shared_lock<std::shared_mutex> lock_;
+        const TimeSeriesStore *store_;
+        std::size_t first_;
+        std::size_t last_;
+
+        Window(std::shared_lock<std::shared_mutex> &&lock, const TimeSeriesStore *store, std::size_t first,
+               std::size_t last) noexcept
+            : lock_(std::move(lock)), store_(store), first_(first), last_(last) {
+        }
+
+        public:
+        /// @return The iterator to the oldest record of the window.
+        Iterator begin() const noexcept {
+            return {store_, first_};
+        }
+
+        /// @return The iterator past the newest record of the window.
+        Iterator end() const noexcept {
+            return {store_, last_};
+        }
+
+        /// @return The number of records in the window.
+        std::size_t size() const noexcept {
+            return last_ - first_;
+        }
+
+        /// @return `true` if the window is empty.
+        bool empty() const noexcept {
+            return first_ == last_;
+        }
+
+        /**
+         * @param i The position of the record in the window.
+         * @return The record.
+         */
+        const Record &operator[](std::size_t i) const noexcept {
+            return store_->at(first_ + i);
+        }
+    };
+
+    /**
+     * Creates the new store.
+     *
+     * @param capacity The maximum number of records in the store.
+     * @throws InvalidArgumentException if the capacity is zero.
+     */
+    TimeSeriesStore(typename RequireMakeShared<TimeSeriesStore<E>>::LockExternalConstructionTag, std::size_t capacity)
+        : capacity_(capacity) {
+        if (capacity == 0) {
+            throw InvalidArgumentException("The capacity of the store must be positive");
+        }
+
+        buffer_.resize(std::bit_ceil(capacity));
+        mask_ = buffer_.size() - 1;
+    }
+
+    ~TimeSeriesStore() noexcept override {
+    }
+
+    /**
+     * Creates the new store.
+     *
+     * @param capacity The maximum number of records in the store. When the store is full, the oldest records are
+     * evicted.
+     * @return The new store.
+     * @throws InvalidArgumentException if the capacity is zero.
+     */
+    static std::shared_ptr<TimeSeriesStore> create(std::size_t capacity) {
+        return TimeSeriesStore::createShared(capacity);
+    }
+
+    /**
+     * Applies the transaction (or the snapshot) of the TimeSeriesTxModel to the store.
+     *
+     * @param events The events of the transaction.
+     * @param isSnapshot `true` if the events represent a snapshot. The snapshot replaces the content of the store.
+     */
+    void update(const std::vector<std::shared_ptr<E>> &events, bool isSnapshot) {
+        std::unique_lock lock(mtx_);
+
+        if (isSnapshot) {
+            head_ = 0;
+            size_ = 0;
+        }
+
+        for (const auto &e : events) {
+            if (e) {
+                updateImpl(*e);
+            }
+        }
+    }
+
+    /**
+     * Removes all the records.
+     */
+    void clear() {
+        std::unique_lock lock(mtx_);
+
+        head_ = 0;
+        size_ = 0;
+    }
+
+    /// @return The number of records in the store.
+    std::size_t size() const {
+        std::shared_lock lock(mtx_);
+
+        return size_;
+    }
+
+    /// @return `true` if the store is empty.
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /// @return The maximum number of records in the store.
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /// @return The newest record or `std::nullopt` if the store is empty.
+    std::optional<Record> getLast() const {
+        std::shared_lock lock(mtx_);
+
+        if (size_ == 0) {
+            return std::nullopt;
+        }
+
+        return at(size_ - 1);
+    }
+
+    /// @return The oldest record or `std::nullopt` if the store is empty.
+    std::optional<Record> getFirst() const {
+        std::shared_lock lock(mtx_);
+
+        if (size_ == 0) {
+            return std::nullopt;
+        }
+
+        return at(0);
+    }
+
+    /**
+     * Finds the record by the event index.
+     *
+     * @param index The @ref IndexedEvent::getIndex() "index" of the event.
+     * @return The record or `std::nullopt` if there is no such record.
+     */
+    std::optional<Record> findByIndex(std::int64_t index) const {
+        std::shared_lock lock(mtx_);
+
+        auto position = lowerBoundByIndex(index);
+
+        if (position < size_ && at(position).index == index) {
+            return at(position);
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * Returns the view of the records with time in the range [fromTime, toTime].
+     * The view holds the shared lock of the store while it exists.
+     *
+     * @param fromTime The time, inclusive, in milliseconds since Unix epoch.
+     * @param toTime The time, inclusive, in milliseconds since Unix epoch.
+     * @return The view of the records (sorted by time).
+     */
+    Window getWindow(std::int64_t fromTime, std::int64_t toTime) const {
+        std::shared_lock lock(mtx_);
+
+        if (fromTime > toTime) {
+            return Window(std::move(lock), this, 0, 0);
+        }
+
+        auto first = boundByTime(fromTime, false);
+        auto last = boundByTime(toTime, true);
+
+        return Window(std::move(lock), this, first, last);
+    }
+
+    /**
+     * Returns the view of the records with time in the range [fromTime, toTime].
+     * The view holds the shared lock of the store while it exists.
+     *
+     * @param fromTime The time, inclusive.
+     * @param toTime The time, inclusive.
+     * @return The view of the records (sorted by time).
+     */
+    Window getWindow(std::chrono::milliseconds fromTime, std::chrono::milliseconds toTime) const {
+        return getWindow(fromTime.count(), toTime.count());
+    }
+
+    /**
+     * Returns the view of the records that are not older than the specified period relative to the newest record.
+     * The view holds the shared lock of the store while it exists.
+     *
+     * @param period The period.
+     * @return The view of the records (sorted by time).
+     */
+    Window getLastWindow(std::chrono::milliseconds period) const {
+        std::shared_lock lock(mtx_);
+
+        if (size_ == 0) {
+            return Window(std::move(lock), this, 0, 0);
+        }
+
+        auto first = boundByTime(at(size_ - 1).time - period.count(), false);
+
+        return Window(std::move(lock), this, first, size_);
+    }
+
+    /**
+     * Returns a copy of the records with time in the range [fromTime, toTime].
+     *
+     * @param fromTime The time, inclusive, in milliseconds since Unix epoch.
+     * @param toTime The time, inclusive, in milliseconds since Unix epoch.
+     * @return The records (sorted by time).
+     */
+    std::vector<Record> getRange(std::int64_t fromTime, std::int64_t toTime) const {
+        auto window = getWindow(fromTime, toTime);
+
+        return {window.begin(), window.end()};
+    }
+
+    /**
+     * Calls the function for each record with time in the range [fromTime, toTime] (from the oldest to the newest).
+     * The store cannot be updated while the function is being called.
+     *
+     * @tparam F The type of the function: `void(const Record &)`
+     * @param fromTime The time, inclusive, in milliseconds since Unix epoch.
+     * @param toTime The time, inclusive, in milliseconds since Unix epoch.
+     * @param f The function.
+     */
+    template <typename F> void forEach(std::int64_t fromTime, std::int64_t toTime, F &&f) const {
+        for (const auto &record : getWindow(fromTime, toTime)) {
+            f(record);
+        }
+    }
+
+    /**
+     * Creates the listener that applies the transactions of the TimeSeriesTxModel to this store.
+     *
+     * @param onEventsReceived The optional callback that is called after the store is updated.
+     * @return The new listener.
+     */
+    std::shared_ptr<TimeSeriesTxModelListener<E>>
+    createListener(std::function<void(const std::vector<std::shared_ptr<E>> & /* events */, bool /* isSnapshot */)>
+                       onEventsReceived = {}) {
+        return TimeSeriesTxModelListener<E>::create(
+            [s = this->template sharedAs<TimeSeriesStore>(), l = std::move(onEventsReceived)](
+                const std::vector<std::shared_ptr<E>> &events, bool isSnapshot) {
+                s->update(events, isSnapshot);
+
+                if (l) {
+                    l(events, isSnapshot);
+                }
+            });
+    }
+
+    std::string toString() const override {
+        return "TimeSeriesStore{size = " + std::to_string(size()) + ", capacity = " + std::to_string(capacity_) + "}";
+    }
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
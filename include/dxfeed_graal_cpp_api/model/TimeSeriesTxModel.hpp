@@ -12,6 +12,7 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
 #include "../event/TimeSeriesEvent.hpp"
 #include "../internal/JavaObjectHandle.hpp"
 #include "../symbols/SymbolWrapper.hpp"
+#include "./TimeSeriesStore.hpp"
 #include "./TxModelListener.hpp"
 
 #include <chrono>
@@ -286,6 +287,27 @@ struct /* DXFCPP_EXPORT */ TimeSeriesTxModel final : TimeSeriesTxModelImpl, Requ
             return withListener(TimeSeriesTxModelListener<E>::create(onEventsReceived));
         }
 
+        /**
+         * Sets the store that will keep the events of the model.
+         * The store is updated by the model's listener, so this method replaces the listener that was set earlier.
+         *
+         * ```cpp
+         * auto store = TimeSeriesStore<TimeAndSale>::create(100'000);
+         * auto builder = TimeSeriesTxModel<TimeAndSale>::newBuilder()->withStore(store);
+         * ```
+         *
+         * @param store The store.
+         * @param onEventsReceived An optional functional object, lambda, or function to which time series event data
+         * will be passed after the store is updated.
+         * @return The builder instance.
+         */
+        std::shared_ptr<Builder>
+        withStore(std::shared_ptr<TimeSeriesStore<E>> store,
+                  std::function<void(const std::vector<std::shared_ptr<E>> & /* events */, bool /* isSnapshot */)>
+                      onEventsReceived = {}) const {
+            return withListener(store->createListener(std::move(onEventsReceived)));
+        }
+
         /**
          * Sets the time from which to subscribe for time-series.
          *
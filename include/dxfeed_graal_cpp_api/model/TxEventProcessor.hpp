@@ -0,0 +1,217 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../event/EventFlag.hpp"
+#include "../event/IndexedEvent.hpp"
+#include "../event/IndexedEventSource.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_model
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+/**
+ * Processes the event flags of the indexed events of a single source and assembles them into snapshots and
+ * transactions.
+ *
+ * <p>This is the native counterpart of the processing logic that IndexedTxModel delegates to the Java side.
+ * Events that are part of an incomplete snapshot or a pending transaction are kept in a pending buffer until the
+ * snapshot is complete or the transaction has ended. All buffers are reused between transactions, so after warm-up the
+ * assembly does not allocate.
+ *
+ * <p>This class is not thread-safe. The owner is responsible for the synchronization.
+ *
+ * @tparam E The type of event (derived from IndexedEvent)
+ */
+template <Derived<IndexedEvent> E> struct /* DXFCPP_EXPORT */ TxEventProcessor final {
+    /**
+     * The listener's signature.
+     */
+    using Listener = std::function<void(const IndexedEventSource & /* source */,
+                                        const std::vector<std::shared_ptr<E>> & /* events */, bool /* isSnapshot */)>;
+
+    private:
+    IndexedEventSource source_{};
+    bool isBatchProcessing_{true};
+    bool isSnapshotProcessing_{false};
+    bool isPartialSnapshot_{};
+    bool isCompleteSnapshot_{};
+    std::vector<std::shared_ptr<E>> pendingEvents_{};
+    std::vector<std::shared_ptr<E>> transactions_{};
+    std::vector<std::shared_ptr<E>> snapshot_{};
+    std::unordered_map<std::int64_t, std::size_t> snapshotPositions_{};
+
+    static bool isRemove(const std::shared_ptr<E> &event) {
+        return (event->getEventFlags() & EventFlag::REMOVE_EVENT) != 0;
+    }
+
+    // Removes events that are marked for removal, merges repeated indexes (the last one wins, the position of the first
+    // one is kept) and resets the event flags.
+    const std::vector<std::shared_ptr<E>> &processSnapshot() {
+        snapshot_.clear();
+        snapshotPositions_.clear();
+
+        std::size_t removed = 0;
+
+        for (const auto &event : pendingEvents_) {
+            auto found = snapshotPositions_.find(event->getIndex());
+
+            if (isRemove(event)) {
+                if (found != snapshotPositions_.end()) {
+                    snapshot_[found->second].reset();
+                    snapshotPositions_.erase(found);
+                    removed++;
+                }
+
+                continue;
+            }
+
+            event->setEventFlags(0);
+
+            if (found != snapshotPositions_.end()) {
+                snapshot_[found->second] = event;
+            } else {
+                snapshotPositions_.emplace(event->getIndex(), snapshot_.size());
+                snapshot_.push_back(event);
+            }
+        }
+
+        if (removed > 0) {
+            std::erase(snapshot_, nullptr);
+        }
+
+        return snapshot_;
+    }
+
+    void notifySnapshot(const Listener &listener) {
+        // A snapshot is never combined with other transactions.
+        receiveAllEventsInBatch(listener);
+
+        if (listener) {
+            listener(source_, isSnapshotProcessing_ ? processSnapshot() : pendingEvents_, true);
+        }
+
+        snapshot_.clear();
+    }
+
+    void notifyTransaction(const Listener &listener) {
+        if (isBatchProcessing_) {
+            transactions_.insert(transactions_.end(), pendingEvents_.begin(), pendingEvents_.end());
+
+            return;
+        }
+
+        if (listener) {
+            listener(source_, pendingEvents_, false);
+        }
+    }
+
+    public:
+    TxEventProcessor() = default;
+
+    /**
+     * Creates the new processor.
+     *
+     * @param source The source of the processed events.
+     * @param isBatchProcessing `true` to combine the transactions until the
+     * @ref TxEventProcessor::receiveAllEventsInBatch() "end of the batch".
+     * @param isSnapshotProcessing `true` to remove, merge and reset flags of the events of a snapshot.
+     */
+    TxEventProcessor(IndexedEventSource source, bool isBatchProcessing, bool isSnapshotProcessing)
+        : source_(std::move(source)), isBatchProcessing_(isBatchProcessing),
+          isSnapshotProcessing_(isSnapshotProcessing) {
+    }
+
+    /**
+     * Processes the next event of the source.
+     *
+     * @param event The event.
+     * @param listener The listener to be notified if the event completes a snapshot or a transaction.
+     * @return `true` if the event completed a snapshot or a transaction.
+     */
+    bool processEvent(const std::shared_ptr<E> &event, const Listener &listener) {
+        if (EventFlag::isSnapshotBegin(event)) {
+            isPartialSnapshot_ = true;
+            isCompleteSnapshot_ = false;
+            pendingEvents_.clear(); // remove any unprocessed leftovers on new snapshot
+        }
+
+        if (isPartialSnapshot_ && EventFlag::isSnapshotEndOrSnip(event)) {
+            isPartialSnapshot_ = false;
+            isCompleteSnapshot_ = true;
+        }
+
+        pendingEvents_.push_back(event);
+
+        if (isPartialSnapshot_ || EventFlag::isPending(event)) {
+            return false; // waiting for the end of the snapshot or the transaction
+        }
+
+        if (isCompleteSnapshot_) {
+            isCompleteSnapshot_ = false;
+            notifySnapshot(listener);
+        } else {
+            notifyTransaction(listener);
+        }
+
+        pendingEvents_.clear();
+
+        return true;
+    }
+
+    /**
+     * Notifies the listener about all transactions combined since the last call (if batch processing is enabled).
+     *
+     * @param listener The listener.
+     */
+    void receiveAllEventsInBatch(const Listener &listener) {
+        if (transactions_.empty()) {
+            return;
+        }
+
+        if (listener) {
+            listener(source_, transactions_, false);
+        }
+
+        transactions_.clear();
+    }
+
+    /**
+     * Drops the pending events and the state of an incomplete snapshot. The buffers keep their capacity.
+     */
+    void reset() {
+        isPartialSnapshot_ = false;
+        isCompleteSnapshot_ = false;
+        pendingEvents_.clear();
+        transactions_.clear();
+        snapshot_.clear();
+        snapshotPositions_.clear();
+    }
+
+    /**
+     * @return The source of the processed events.
+     */
+    const IndexedEventSource &getSource() const noexcept {
+        return source_;
+    }
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
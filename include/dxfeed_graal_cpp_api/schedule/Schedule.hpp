@@ -22,6 +22,7 @@ struct SessionFilter;
 struct InstrumentProfile;
 struct Day;
 struct Session;
+struct SessionTimeline;
 struct StringLike;
 
 /**
@@ -42,8 +43,9 @@ struct DXFCPP_EXPORT Schedule {
 
     private:
     JavaObjectHandle<Schedule> handle_;
+    std::unique_ptr<SessionTimeline> sessionTimeline_;
 
-    explicit Schedule(JavaObjectHandle<Schedule> &&handle) noexcept;
+    explicit Schedule(JavaObjectHandle<Schedule> &&handle);
 
     /**
      * Checks the handle, attempts to allocate memory for the pointer and return Schedule::Ptr
@@ -54,6 +56,8 @@ struct DXFCPP_EXPORT Schedule {
     static Schedule::Ptr create(JavaObjectHandle<Schedule> &&handle);
 
     public:
+    ~Schedule() noexcept;
+
     /**
      * Returns default schedule instance for specified instrument profile.
      *
@@ -139,7 +143,8 @@ struct DXFCPP_EXPORT Schedule {
      *
      * @param dayId The day identifier to search for
      * @return The day for a specified day identifier
-     * @throw JavaException "IllegalArgumentException" if the specified day identifier falls outside of the valid date range
+     * @throw JavaException "IllegalArgumentException" if the specified day identifier falls outside of the valid date
+     * range
      * @see Day::getDayId()
      */
     std::shared_ptr<Day> getDayById(std::int32_t dayId) const;
@@ -208,6 +213,15 @@ struct DXFCPP_EXPORT Schedule {
      */
     std::shared_ptr<Session> findNearestSessionByTime(std::int64_t time, const SessionFilter &filter) const;
 
+    /**
+     * Returns the native timeline of the sessions and days of this schedule. The timeline answers the time&rarr;session
+     * and time&rarr;day queries without calls to the Graal and is loaded from this schedule lazily.
+     *
+     * @return The session timeline of this schedule.
+     * @see SessionTimeline
+     */
+    const SessionTimeline &getSessionTimeline() const &;
+
     /**
      * Returns name of this schedule.
      *
@@ -0,0 +1,149 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/**
+ * \addtogroup dxfcpp_schedule
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+struct Schedule;
+struct InstrumentProfile;
+struct InstrumentProfileData;
+
+/**
+ * A process-wide concurrent cache of the Schedule instances keyed by the normalized (trimmed) schedule definition and
+ * the trading venue.
+ *
+ * <p>Each Schedule::getInstance() call goes through the Graal, while the instruments of a universe share a handful of
+ * distinct @ref InstrumentProfile::getTradingHours() "trading hours". The schedules are resolved by this cache only
+ * once per distinct definition (and venue), so the instances (and their @ref Schedule::getSessionTimeline()
+ * "session timelines") are shared. The lookups of the native InstrumentProfileData don't call the Graal at all; the
+ * lookups of the InstrumentProfile read its trading hours from the Graal.
+ *
+ * <p>A new definition is resolved outside the lock of the cache, so the lookups of the cached definitions are not
+ * blocked by it. The concurrent lookups of the same new definition can resolve it more than once, but only the first
+ * resolved instance is cached and returned.
+ *
+ * ```cpp
+ * for (const auto &profile : *profiles) {
+ *     auto schedule = ScheduleCache::getInstance(profile);
+ *     // ...
+ * }
+ *
+ * std::cout << ScheduleCache::getStats().toString() << std::endl;
+ * ```
+ *
+ * <p>This class is thread-safe.
+ */
+struct DXFCPP_EXPORT ScheduleCache final {
+    /**
+     * The statistics of the cache.
+     */
+    struct Stats {
+        /// The number of the lookups that found the schedule in the cache.
+        std::uint64_t hits{};
+        /// The number of the lookups that resolved the schedule through the Graal.
+        std::uint64_t misses{};
+        /// The number of the cached schedules.
+        std::size_t size{};
+
+        /// @return The ratio of the hits to all the lookups or 0 if there were no lookups.
+        double getHitRatio() const noexcept {
+            return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+        }
+
+        std::string toString() const;
+    };
+
+    /**
+     * Returns the default schedule instance for specified schedule definition.
+     *
+     * @param scheduleDefinition The schedule definition of the requested schedule.
+     * @return The shared schedule instance.
+     * @see Schedule::getInstance(const StringLike &)
+     */
+    static std::shared_ptr<Schedule> getInstance(std::string_view scheduleDefinition);
+
+    /**
+     * Returns the schedule instance for specified schedule definition (the trading hours of an instrument) and trading
+     * venue.
+     *
+     * @param scheduleDefinition The schedule definition of the requested schedule.
+     * @param venue The trading venue those schedule is requested.
+     * @return The shared schedule instance.
+     * @see Schedule::getInstance(const std::shared_ptr<InstrumentProfile> &, const StringLike &)
+     */
+    static std::shared_ptr<Schedule> getInstance(std::string_view scheduleDefinition, std::string_view venue);
+
+    /**
+     * Returns the default schedule instance for specified instrument profile.
+     *
+     * @param profile The instrument profile those schedule is requested.
+     * @return The shared schedule instance.
+     * @throw InvalidArgumentException if the profile is nullptr.
+     */
+    static std::shared_ptr<Schedule> getInstance(const std::shared_ptr<InstrumentProfile> &profile);
+
+    /**
+     * Returns the schedule instance for specified instrument profile and trading venue.
+     *
+     * @param profile The instrument profile those schedule is requested.
+     * @param venue The trading venue those schedule is requested.
+     * @return The shared schedule instance.
+     * @throw InvalidArgumentException if the profile is nullptr.
+     */
+    static std::shared_ptr<Schedule> getInstance(const std::shared_ptr<InstrumentProfile> &profile,
+                                                 std::string_view venue);
+
+    /**
+     * Returns the default schedule instance for specified native instrument profile.
+     *
+     * @param profile The native instrument profile those schedule is requested.
+     * @return The shared schedule instance.
+     */
+    static std::shared_ptr<Schedule> getInstance(const InstrumentProfileData &profile);
+
+    /**
+     * Returns the schedule instance for specified native instrument profile and trading venue.
+     *
+     * @param profile The native instrument profile those schedule is requested.
+     * @param venue The trading venue those schedule is requested.
+     * @return The shared schedule instance.
+     */
+    static std::shared_ptr<Schedule> getInstance(const InstrumentProfileData &profile, std::string_view venue);
+
+    /**
+     * @return The statistics of the cache.
+     */
+    static Stats getStats() noexcept;
+
+    /**
+     * Resets the hit and miss counters.
+     */
+    static void resetStats() noexcept;
+
+    /**
+     * Removes all the cached schedules (e.g. after Schedule::setDefaults() or Schedule::downloadDefaults()).
+     */
+    static void clear() noexcept;
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
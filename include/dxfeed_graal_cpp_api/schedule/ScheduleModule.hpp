@@ -15,8 +15,10 @@ DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
 #include "./Day.hpp"
 #include "./DayFilter.hpp"
 #include "./Schedule.hpp"
+#include "./ScheduleCache.hpp"
 #include "./Session.hpp"
 #include "./SessionFilter.hpp"
+#include "./SessionTimeline.hpp"
 #include "./SessionType.hpp"
 
 DXFCXX_DISABLE_MSC_WARNINGS_POP()
\ No newline at end of file
@@ -0,0 +1,302 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../internal/Conf.hpp"
+
+DXFCXX_DISABLE_MSC_WARNINGS_PUSH(4251)
+
+#include "../internal/Common.hpp"
+#include "./SessionType.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <vector>
+
+/**
+ * \addtogroup dxfcpp_schedule
+ * @{
+ */
+
+DXFCPP_BEGIN_NAMESPACE
+
+struct Schedule;
+struct Day;
+struct SessionFilter;
+
+/**
+ * The native timeline of the sessions and days of the Schedule.
+ *
+ * The timeline keeps the sorted arrays of the sessions and days over a rolling horizon and answers the
+ * time&rarr;session and time&rarr;day queries with a binary search, without calls to the Graal and without allocations.
+ * The horizon is loaded from the schedule lazily: when the time falls outside of it, the adjacent days are appended
+ * (with the prefetch of the next SessionTimeline::PREFETCH_DAYS days when moving forward), and the distant times
+ * restart the horizon at the day of the time. The horizon is limited to SessionTimeline::MAX_DAYS days, the days on
+ * the opposite side are dropped.
+ *
+ * The timeline of the schedule is returned by Schedule::getSessionTimeline(). The methods are thread-safe.
+ *
+ * The large batches of the times are classified by SessionTimeline::classify() in parallel.
+ *
+ * ```cpp
+ * const auto &timeline = schedule->getSessionTimeline();
+ *
+ * if (timeline.getSessionByTime(timeAndSale->getTime()).getType() == SessionType::REGULAR) {
+ *     // ...
+ * }
+ * ```
+ */
+struct DXFCPP_EXPORT SessionTimeline final {
+    friend struct Schedule;
+
+    /// The session is the trading one.
+    static constexpr std::uint32_t TRADING = 0x01u;
+
+    /// The day of the session is the trading one.
+    static constexpr std::uint32_t TRADING_DAY = 0x02u;
+
+    /// The day of the session is a holiday.
+    static constexpr std::uint32_t HOLIDAY = 0x04u;
+
+    /// The day of the session is a short day.
+    static constexpr std::uint32_t SHORT_DAY = 0x08u;
+
+    /// The number of the days loaded ahead of the time when the timeline moves forward.
+    static constexpr std::size_t PREFETCH_DAYS = 7;
+
+    /// The maximal number of the days in the timeline.
+    static constexpr std::size_t MAX_DAYS = 400;
+
+    /// The distance from the horizon (in days) after which the timeline is restarted at the day of the time.
+    static constexpr std::int64_t MAX_GAP_DAYS = 31;
+
+    /// The day identifier that is written by classify() for the times whose sessions are rejected by the filter.
+    static constexpr std::int32_t REJECTED_DAY_ID = std::numeric_limits<std::int32_t>::min();
+
+    /// The number of the times that are classified by one parallel task.
+    static constexpr std::size_t CLASSIFY_CHUNK_SIZE = 64 * 1024;
+
+    /// The maximal span of the times (in days) for which classify() loads all the days of the span.
+    static constexpr std::int64_t MAX_CLASSIFY_SPAN_DAYS = 100 * 366;
+
+    /**
+     * The native copy of the Session.
+     */
+    struct SessionInfo {
+        /// The start time of the session (inclusive).
+        std::int64_t startTime{};
+
+        /// The end time of the session (exclusive).
+        std::int64_t endTime{};
+
+        /// The type of the session.
+        SessionTypeEnum type{};
+
+        /// The identifier of the day of the session.
+        std::int32_t dayId{};
+
+        /// The flags of the session and its day: TRADING, TRADING_DAY, HOLIDAY and SHORT_DAY.
+        std::uint32_t flags{};
+
+        /**
+         * @return The type of the session.
+         */
+        const SessionType &getType() const noexcept;
+
+        /**
+         * @return `true` if trading activity is allowed within this session.
+         */
+        bool isTrading() const noexcept {
+            return (flags & TRADING) != 0;
+        }
+
+        /**
+         * @return `true` if the session has zero duration.
+         */
+        bool isEmpty() const noexcept {
+            return startTime >= endTime;
+        }
+
+        /**
+         * @return `true` if specified time belongs to this session.
+         */
+        bool containsTime(std::int64_t time) const noexcept {
+            return time >= startTime && time < endTime;
+        }
+    };
+
+    /**
+     * The native copy of the Day.
+     */
+    struct DayInfo {
+        /// The start time of the day (inclusive).
+        std::int64_t startTime{};
+
+        /// The end time of the day (exclusive).
+        std::int64_t endTime{};
+
+        /// The reset time of the day.
+        std::int64_t resetTime{};
+
+        /// The identifier of the day.
+        std::int32_t dayId{};
+
+        /// The year, month and day numbers packed as `year * 10000 + month * 100 + day`.
+        std::int32_t yearMonthDay{};
+
+        /// The flags of the day: TRADING_DAY, HOLIDAY and SHORT_DAY.
+        std::uint32_t flags{};
+
+        /**
+         * @return `true` if trading activity is allowed within this day.
+         */
+        bool isTrading() const noexcept {
+            return (flags & TRADING_DAY) != 0;
+        }
+
+        /**
+         * @return `true` if this day is a holiday.
+         */
+        bool isHoliday() const noexcept {
+            return (flags & HOLIDAY) != 0;
+        }
+
+        /**
+         * @return `true` if this day is a short day.
+         */
+        bool isShortDay() const noexcept {
+            return (flags & SHORT_DAY) != 0;
+        }
+
+        /**
+         * @return `true` if specified time belongs to this day.
+         */
+        bool containsTime(std::int64_t time) const noexcept {
+            return time >= startTime && time < endTime;
+        }
+    };
+
+    private:
+    const Schedule *schedule_;
+    mutable std::shared_mutex mtx_{};
+    mutable std::vector<SessionInfo> sessions_{};
+    mutable std::vector<DayInfo> days_{};
+    mutable std::shared_ptr<Day> firstDay_{};
+    mutable std::shared_ptr<Day> lastDay_{};
+
+    explicit SessionTimeline(const Schedule &schedule) noexcept;
+
+    bool covers(std::int64_t time) const noexcept;
+    void load(std::int64_t time) const;
+    void append(const std::shared_ptr<Day> &day) const;
+    void prepend(const std::shared_ptr<Day> &day) const;
+    void trim(std::int64_t time) const;
+
+    template <typename F> auto read(std::int64_t time, F &&f) const {
+        {
+            std::shared_lock lock(mtx_);
+
+            if (covers(time)) {
+                return f();
+            }
+        }
+
+        std::unique_lock lock(mtx_);
+
+        load(time);
+
+        return f();
+    }
+
+    public:
+    SessionTimeline(const SessionTimeline &) = delete;
+    SessionTimeline &operator=(const SessionTimeline &) = delete;
+
+    /**
+     * Returns the session that contains specified time. Loads the days from the schedule if the time is outside of the
+     * horizon.
+     *
+     * @param time The time to search for.
+     * @return The session that contains specified time.
+     * @throw JavaException "IllegalArgumentException" if specified time falls outside of the valid date range.
+     */
+    SessionInfo getSessionByTime(std::int64_t time) const;
+
+    /**
+     * Returns the day that contains specified time. Loads the days from the schedule if the time is outside of the
+     * horizon.
+     *
+     * @param time The time to search for.
+     * @return The day that contains specified time.
+     * @throw JavaException "IllegalArgumentException" if specified time falls outside of the valid date range.
+     */
+    DayInfo getDayByTime(std::int64_t time) const;
+
+    /**
+     * Returns `true` if trading activity is allowed at specified time.
+     *
+     * @param time The time to search for.
+     * @return `true` if the session that contains specified time is the trading one.
+     */
+    bool isTrading(std::int64_t time) const;
+
+    /**
+     * Classifies the times by the sessions that contain them. One call replaces `times.size()` calls of
+     * Schedule::getSessionByTime().
+     *
+     * The days of the span of the times are loaded from the schedule once (on the calling thread), and then the
+     * chunks of SessionTimeline::CLASSIFY_CHUNK_SIZE times are classified in parallel without calls to the Graal. The
+     * sorted times are merged with the sessions, the unsorted ones are looked up with a binary search. The times that
+     * span more than SessionTimeline::MAX_CLASSIFY_SPAN_DAYS days are classified one by one with getSessionByTime().
+     *
+     * ```cpp
+     * std::vector<SessionTypeEnum> types(times.size());
+     * std::vector<std::int32_t> dayIds(times.size());
+     * auto trading = schedule->getSessionTimeline().classify(times, SessionFilter::TRADING, types, dayIds);
+     * ```
+     *
+     * @param times The times (preferably sorted).
+     * @param filter The filter of the sessions.
+     * @param types The types of the sessions that contain the times (the output of the same size as `times`).
+     * @param dayIds The identifiers of the days of the sessions, or SessionTimeline::REJECTED_DAY_ID if the session is
+     * rejected by the filter (the output of the same size as `times`).
+     * @param parallelism The number of the threads. `0` means the number of the logical cores.
+     * @return The number of the times whose sessions are accepted by the filter.
+     * @throw InvalidArgumentException if the sizes of the outputs differ from the size of the times.
+     * @throw JavaException "IllegalArgumentException" if some time falls outside of the valid date range.
+     */
+    std::size_t classify(std::span<const std::int64_t> times, const SessionFilter &filter,
+                         std::span<SessionTypeEnum> types, std::span<std::int32_t> dayIds,
+                         std::size_t parallelism = 0) const;
+
+    /**
+     * @return The start time of the loaded horizon (inclusive) or 0 if the timeline is empty.
+     */
+    std::int64_t getStartTime() const;
+
+    /**
+     * @return The end time of the loaded horizon (exclusive) or 0 if the timeline is empty.
+     */
+    std::int64_t getEndTime() const;
+
+    /**
+     * @return The number of the loaded days.
+     */
+    std::size_t getDayCount() const;
+
+    /**
+     * Drops the loaded horizon.
+     */
+    void clear() const;
+};
+
+DXFCPP_END_NAMESPACE
+
+/// @}
+
+DXFCXX_DISABLE_MSC_WARNINGS_POP()
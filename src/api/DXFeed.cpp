@@ -16,6 +16,25 @@
 
 DXFCPP_BEGIN_NAMESPACE
 
+namespace {
+
+struct TimeSeriesPromiseRequest final : TimeSeriesStream::Request {
+    Promise<std::vector<std::shared_ptr<EventType>>> promise;
+
+    explicit TimeSeriesPromiseRequest(void *handle) : promise(handle) {
+    }
+
+    std::vector<std::shared_ptr<EventType>> await() override {
+        return promise.await();
+    }
+
+    void cancel() override {
+        promise.cancel();
+    }
+};
+
+} // namespace
+
 std::shared_ptr<DXFeed> DXFeed::getInstance() {
     if constexpr (Debugger::isDebug) {
         // ReSharper disable once CppDFAUnreachableCode
@@ -178,6 +197,18 @@ void *DXFeed::getTimeSeriesPromiseImpl(const EventTypeEnum &eventType, const Sym
     return isolated::api::IsolatedDXFeed::getTimeSeriesPromise(handle_, eventType, symbol, fromTime, toTime);
 }
 
+std::shared_ptr<TimeSeriesStream>
+DXFeed::getTimeSeriesStreamImpl(const EventTypeEnum &eventType, const SymbolWrapper &symbol, std::int64_t fromTime,
+                                std::int64_t toTime, const TimeSeriesStream::Options &options) const {
+    return TimeSeriesStream::create(
+        fromTime, toTime,
+        [feed = sharedAs<const DXFeed>(), &eventType, symbol](std::int64_t from, std::int64_t to) {
+            return std::make_unique<TimeSeriesPromiseRequest>(
+                feed->getTimeSeriesPromiseImpl(eventType, symbol, from, to));
+        },
+        options);
+}
+
 std::shared_ptr<EventType> DXFeed::getLastEventIfSubscribedImpl(const EventTypeEnum &eventType,
                                                                 const SymbolWrapper &symbol) const {
     return isolated::api::IsolatedDXFeed::getLastEventIfSubscribed(handle_, eventType, symbol);
@@ -0,0 +1,154 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/api/TimeSeriesStream.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+DXFCPP_BEGIN_NAMESPACE
+
+TimeSeriesStream::TimeSeriesStream(LockExternalConstructionTag, std::int64_t from, std::int64_t to,
+                                   Requester requester, const Options &options)
+    : requester_{std::move(requester)}, chunkDuration_{options.chunkDuration},
+      prefetch_{std::max<std::size_t>(options.prefetch, 1)}, nextFrom_{from}, to_{to},
+      splitTo_{std::min(to, std::chrono::duration_cast<std::chrono::milliseconds>(
+                                std::chrono::system_clock::now().time_since_epoch())
+                                .count())},
+      requestedAll_{from > to} {
+}
+
+TimeSeriesStream::~TimeSeriesStream() noexcept {
+    try {
+        cancel();
+    } catch (...) {
+    }
+}
+
+std::shared_ptr<TimeSeriesStream> TimeSeriesStream::create(std::int64_t from, std::int64_t to, Requester requester,
+                                                           const Options &options) {
+    auto stream = createShared(from, to, std::move(requester), options);
+    std::lock_guard guard(stream->mtx_);
+
+    stream->requestChunks();
+
+    return stream;
+}
+
+std::shared_ptr<TimeSeriesStream> TimeSeriesStream::create(std::int64_t from, std::int64_t to, Requester requester) {
+    return create(from, to, std::move(requester), Options{});
+}
+
+void TimeSeriesStream::requestChunks() {
+    while (!cancelled_ && !requestedAll_ && requests_.size() < prefetch_) {
+        // The range after the current time is requested as the last chunk.
+        const auto chunkTo =
+            chunkDuration_ <= 0 || splitTo_ - nextFrom_ < chunkDuration_ ? to_ : nextFrom_ + chunkDuration_ - 1;
+
+        requests_.push_back(requester_(nextFrom_, chunkTo));
+
+        if (chunkTo == to_) {
+            requestedAll_ = true;
+        } else {
+            nextFrom_ = chunkTo + 1;
+        }
+    }
+}
+
+bool TimeSeriesStream::hasNext() const {
+    std::lock_guard guard(mtx_);
+
+    return !cancelled_ && (!requests_.empty() || !requestedAll_);
+}
+
+std::optional<std::vector<std::shared_ptr<EventType>>> TimeSeriesStream::next() {
+    std::shared_ptr<Request> request{};
+
+    {
+        std::lock_guard guard(mtx_);
+
+        if (cancelled_ || requests_.empty()) {
+            return std::nullopt;
+        }
+
+        request = std::move(requests_.front());
+        requests_.pop_front();
+        current_ = request;
+        requestChunks();
+    }
+
+    std::vector<std::shared_ptr<EventType>> events{};
+
+    try {
+        events = request->await();
+    } catch (...) {
+        std::lock_guard guard(mtx_);
+
+        current_.reset();
+
+        if (cancelled_) {
+            return std::nullopt;
+        }
+
+        throw;
+    }
+
+    std::lock_guard guard(mtx_);
+
+    current_.reset();
+
+    if (cancelled_) {
+        return std::nullopt;
+    }
+
+    return events;
+}
+
+std::size_t TimeSeriesStream::forEach(const std::function<bool(std::vector<std::shared_ptr<EventType>>)> &consumer) {
+    std::size_t count = 0;
+
+    while (auto chunk = next()) {
+        count++;
+
+        if (!consumer(std::move(*chunk))) {
+            cancel();
+
+            break;
+        }
+    }
+
+    return count;
+}
+
+void TimeSeriesStream::cancel() {
+    std::deque<std::shared_ptr<Request>> requests{};
+    std::shared_ptr<Request> current{};
+
+    {
+        std::lock_guard guard(mtx_);
+
+        if (cancelled_) {
+            return;
+        }
+
+        cancelled_ = true;
+        requests.swap(requests_);
+        current = current_;
+    }
+
+    if (current) {
+        current->cancel();
+    }
+
+    for (const auto &request : requests) {
+        request->cancel();
+    }
+}
+
+bool TimeSeriesStream::isCancelled() const {
+    std::lock_guard guard(mtx_);
+
+    return cancelled_;
+}
+
+DXFCPP_END_NAMESPACE
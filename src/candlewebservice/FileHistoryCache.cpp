@@ -0,0 +1,533 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/candlewebservice/FileHistoryCache.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/event/EventFlag.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/candle/Candle.hpp"
+#include "../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/Common.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fmt/format.h>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <system_error>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+constexpr std::array<char, 4> MAGIC{'D', 'X', 'H', 'C'};
+constexpr std::uint64_t VERSION = 1;
+constexpr std::size_t VALUES = 10;
+constexpr auto FILE_EXTENSION = ".dxhc";
+
+struct Range {
+    std::int64_t from;
+    std::int64_t to;
+};
+
+struct Record {
+    std::int64_t index;
+    std::int64_t count;
+    // open, high, low, close, volume, vwap, bidVolume, askVolume, impVolatility, openInterest
+    std::array<double, VALUES> values;
+};
+
+struct Entry {
+    std::vector<Range> ranges{};
+    std::map<std::int64_t, Record> records{};
+};
+
+// The same as Candle::getTime().
+std::int64_t getTimeOfIndex(std::int64_t index) noexcept {
+    return (index >> 32) * 1000 + ((index >> 22) & 0x3ff);
+}
+
+Record toRecord(const Candle &candle) noexcept {
+    return {candle.getIndex(),
+            candle.getCount(),
+            {candle.getOpen(), candle.getHigh(), candle.getLow(), candle.getClose(), candle.getVolume(),
+             candle.getVWAP(), candle.getBidVolume(), candle.getAskVolume(), candle.getImpVolatility(),
+             candle.getOpenInterest()}};
+}
+
+std::shared_ptr<Candle> toCandle(const CandleSymbol &symbol, const Record &record) {
+    auto candle = std::make_shared<Candle>(symbol);
+
+    candle->setIndex(record.index);
+    candle->setCount(record.count);
+    candle->setOpen(record.values[0]);
+    candle->setHigh(record.values[1]);
+    candle->setLow(record.values[2]);
+    candle->setClose(record.values[3]);
+    candle->setVolume(record.values[4]);
+    candle->setVWAP(record.values[5]);
+    candle->setBidVolume(record.values[6]);
+    candle->setAskVolume(record.values[7]);
+    candle->setImpVolatility(record.values[8]);
+    candle->setOpenInterest(record.values[9]);
+
+    return candle;
+}
+
+std::uint64_t byteSwap(std::uint64_t value) noexcept {
+    std::uint64_t result = 0;
+
+    for (int i = 0; i < 8; i++) {
+        result = (result << 8) | (value & 0xff);
+        value >>= 8;
+    }
+
+    return result;
+}
+
+struct Writer {
+    std::string buffer{};
+
+    void putVarint(std::uint64_t value) {
+        while (value >= 0x80) {
+            buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+
+        buffer.push_back(static_cast<char>(value));
+    }
+
+    void putSigned(std::int64_t value) {
+        putVarint((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+    }
+
+    // The XOR of the close values usually has the zero low bytes (the short decimal mantissas), so the byte order is
+    // reversed: the zero low bytes become the zero high bytes that are not written by the varint.
+    void putDouble(double value, std::uint64_t &previous) {
+        const auto bits = dxfcpp::bit_cast<std::uint64_t>(value);
+
+        putVarint(byteSwap(bits ^ previous));
+        previous = bits;
+    }
+};
+
+struct Reader {
+    const char *current;
+    const char *end;
+    bool ok = true;
+
+    std::uint64_t getVarint() noexcept {
+        std::uint64_t result = 0;
+
+        for (int shift = 0; shift < 64 && current < end; shift += 7) {
+            const auto byte = static_cast<std::uint8_t>(*current++);
+
+            result |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+
+            if ((byte & 0x80) == 0) {
+                return result;
+            }
+        }
+
+        ok = false;
+
+        return 0;
+    }
+
+    std::int64_t getSigned() noexcept {
+        const auto value = getVarint();
+
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    double getDouble(std::uint64_t &previous) noexcept {
+        previous ^= byteSwap(getVarint());
+
+        return dxfcpp::bit_cast<double>(previous);
+    }
+};
+
+std::string encode(const Entry &entry) {
+    Writer writer{};
+
+    writer.buffer.append(MAGIC.data(), MAGIC.size());
+    writer.putVarint(VERSION);
+    writer.putVarint(entry.ranges.size());
+
+    for (const auto &range : entry.ranges) {
+        writer.putSigned(range.from);
+        writer.putSigned(range.to - range.from);
+    }
+
+    writer.putVarint(entry.records.size());
+
+    std::int64_t previousIndex = 0;
+
+    for (const auto &[index, record] : entry.records) {
+        writer.putSigned(index - previousIndex);
+        previousIndex = index;
+    }
+
+    for (const auto &[_, record] : entry.records) {
+        writer.putSigned(record.count);
+    }
+
+    for (std::size_t column = 0; column < VALUES; column++) {
+        std::uint64_t previous = 0;
+
+        for (const auto &[_, record] : entry.records) {
+            writer.putDouble(record.values[column], previous);
+        }
+    }
+
+    return std::move(writer.buffer);
+}
+
+// Returns an empty entry if the data is not a valid cache file.
+Entry decode(const std::string &data) {
+    if (data.size() < MAGIC.size() || std::memcmp(data.data(), MAGIC.data(), MAGIC.size()) != 0) {
+        return {};
+    }
+
+    Reader reader{data.data() + MAGIC.size(), data.data() + data.size()};
+
+    if (reader.getVarint() != VERSION) {
+        return {};
+    }
+
+    Entry entry{};
+    const auto rangeCount = reader.getVarint();
+
+    for (std::uint64_t i = 0; i < rangeCount && reader.ok; i++) {
+        const auto from = reader.getSigned();
+
+        entry.ranges.push_back({from, from + reader.getSigned()});
+    }
+
+    const auto recordCount = reader.getVarint();
+
+    if (!reader.ok || recordCount > data.size()) {
+        return {};
+    }
+
+    std::vector<Record> records(recordCount);
+    std::int64_t index = 0;
+
+    for (auto &record : records) {
+        index += reader.getSigned();
+        record.index = index;
+    }
+
+    for (auto &record : records) {
+        record.count = reader.getSigned();
+    }
+
+    for (std::size_t column = 0; column < VALUES; column++) {
+        std::uint64_t previous = 0;
+
+        for (auto &record : records) {
+            record.values[column] = reader.getDouble(previous);
+        }
+    }
+
+    if (!reader.ok) {
+        return {};
+    }
+
+    for (const auto &record : records) {
+        entry.records.emplace_hint(entry.records.end(), record.index, record);
+    }
+
+    return entry;
+}
+
+Entry load(const std::filesystem::path &path) {
+    std::ifstream in(path, std::ios::binary);
+
+    if (!in) {
+        return {};
+    }
+
+    return decode(std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()));
+}
+
+void save(const std::filesystem::path &path, const Entry &entry) {
+    const auto data = encode(entry);
+    auto temp = path;
+
+    temp += ".tmp";
+
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+        if (!out) {
+            return;
+        }
+    }
+
+    std::error_code ec{};
+
+    std::filesystem::rename(temp, path, ec);
+}
+
+std::vector<Range> merge(std::vector<Range> ranges) {
+    std::sort(ranges.begin(), ranges.end(), [](const Range &a, const Range &b) {
+        return a.from < b.from;
+    });
+
+    std::vector<Range> result{};
+
+    for (const auto &range : ranges) {
+        if (!result.empty() &&
+            (result.back().to == std::numeric_limits<std::int64_t>::max() || range.from <= result.back().to + 1)) {
+            result.back().to = std::max(result.back().to, range.to);
+        } else {
+            result.push_back(range);
+        }
+    }
+
+    return result;
+}
+
+// The parts of [from, to] that are not covered by the merged ranges.
+std::vector<Range> subtract(std::int64_t from, std::int64_t to, const std::vector<Range> &ranges) {
+    std::vector<Range> gaps{};
+
+    for (const auto &range : ranges) {
+        if (from > to) {
+            break;
+        }
+
+        if (range.to < from) {
+            continue;
+        }
+
+        if (range.from > to) {
+            break;
+        }
+
+        if (range.from > from) {
+            gaps.push_back({from, range.from - 1});
+        }
+
+        if (range.to == std::numeric_limits<std::int64_t>::max()) {
+            return gaps;
+        }
+
+        from = range.to + 1;
+    }
+
+    if (from <= to) {
+        gaps.push_back({from, to});
+    }
+
+    return gaps;
+}
+
+// The name must be unique on the case-insensitive file systems too: the lower-case letters, the digits, '.' and '-'
+// are kept, an upper-case letter is written as '~' and the lower-case letter, the other bytes (and a leading '.') as
+// '_' and the upper-case hex code.
+std::string escape(std::string_view symbol) {
+    std::string result{};
+
+    for (const auto c : symbol) {
+        if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || (c == '.' && !result.empty())) {
+            result.push_back(c);
+        } else if (c >= 'A' && c <= 'Z') {
+            result.push_back('~');
+            result.push_back(static_cast<char>(c - 'A' + 'a'));
+        } else {
+            result += fmt::format("_{:02X}", static_cast<std::uint8_t>(c));
+        }
+    }
+
+    return result;
+}
+
+// The upper bound of the length of the candles of the period, or 0 if the candles are not limited by time
+// (the tick, volume and price candles).
+std::int64_t getMaxPeriodMillis(const CandlePeriod &period) {
+    constexpr std::int64_t DAY = 24LL * 60LL * 60LL * 1000LL;
+    const auto &type = period.getType();
+    auto millis = static_cast<double>(type.getPeriodIntervalMillis());
+
+    if (type == CandleType::MONTH || type == CandleType::OPTEXP) {
+        millis = static_cast<double>(31 * DAY);
+    } else if (type == CandleType::YEAR) {
+        millis = static_cast<double>(366 * DAY);
+    }
+
+    return static_cast<std::int64_t>(std::ceil(millis * period.getValue()));
+}
+
+std::int64_t currentTimeMillis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace
+
+std::string FileHistoryCache::Stats::toString() const {
+    return fmt::format("FileHistoryCache.Stats{{hits={}, misses={}, fetches={}, fetchedEvents={}}}", hits, misses,
+                       fetches, fetchedEvents);
+}
+
+FileHistoryCache::FileHistoryCache(LockExternalConstructionTag, std::string directory)
+    : directory_(std::move(directory)) {
+}
+
+FileHistoryCache::~FileHistoryCache() noexcept = default;
+
+std::shared_ptr<FileHistoryCache> FileHistoryCache::create(const StringLike &directory) {
+    std::error_code ec{};
+
+    std::filesystem::create_directories(std::filesystem::path(std::string(directory)), ec);
+
+    if (ec) {
+        throw InvalidArgumentException(
+            fmt::format("Unable to create the history cache directory '{}': {}", std::string(directory), ec.message()));
+    }
+
+    return createShared(std::string(directory));
+}
+
+const std::string &FileHistoryCache::getDirectory() const & noexcept {
+    return directory_;
+}
+
+std::string FileHistoryCache::getFilePath(const EventTypeEnum &eventType, const StringLike &symbol) const {
+    return (std::filesystem::path(directory_) / eventType.getName() / (escape(symbol) + FILE_EXTENSION)).string();
+}
+
+std::shared_ptr<std::mutex> FileHistoryCache::getFileLock(const std::string &path) {
+    std::lock_guard guard(mtx_);
+
+    auto &lock = fileLocks_[path];
+
+    if (!lock) {
+        lock = std::make_shared<std::mutex>();
+    }
+
+    return lock;
+}
+
+FileHistoryCache::Stats FileHistoryCache::getStats() const {
+    std::lock_guard guard(mtx_);
+
+    return stats_;
+}
+
+void FileHistoryCache::clear() {
+    std::lock_guard guard(mtx_);
+    std::error_code ec{};
+
+    for (const auto &item : std::filesystem::recursive_directory_iterator(directory_, ec)) {
+        if (item.is_regular_file() && item.path().extension() == FILE_EXTENSION) {
+            std::filesystem::remove(item.path(), ec);
+        }
+    }
+}
+
+std::vector<std::shared_ptr<EventType>> FileHistoryCache::getTimeSeries(const EventTypeEnum &eventType,
+                                                                        const SymbolWrapper &symbol, std::int64_t from,
+                                                                        std::int64_t to, const Fetcher &fetcher) {
+    if (eventType != Candle::TYPE || !(symbol.isCandleSymbol() || symbol.isStringSymbol()) || from > to) {
+        return fetcher(from, to);
+    }
+
+    const auto candleSymbol =
+        symbol.isCandleSymbol() ? *symbol.asCandleSymbol() : CandleSymbol::valueOf(symbol.asStringSymbol());
+    const auto path = getFilePath(eventType, candleSymbol.toString());
+    const auto fileLock = getFileLock(path);
+    std::lock_guard fileGuard(*fileLock);
+
+    auto entry = load(path);
+    const auto gaps = subtract(from, to, entry.ranges);
+    const auto periodMillis = getMaxPeriodMillis(candleSymbol.getPeriod().value_or(CandlePeriod::DEFAULT));
+
+    for (const auto &gap : gaps) {
+        const auto events = fetcher(gap.from, gap.to);
+        auto lastTime = std::numeric_limits<std::int64_t>::min();
+
+        // The downloaded gap replaces the kept candles of its range (the candles that were still being built), so the
+        // removed candles are not kept.
+        std::erase_if(entry.records, [&gap](const auto &item) {
+            const auto time = getTimeOfIndex(item.first);
+
+            return time >= gap.from && time <= gap.to;
+        });
+
+        for (const auto &event : events) {
+            const auto *candle = dynamic_cast<const Candle *>(event.get());
+
+            if (candle == nullptr) {
+                continue;
+            }
+
+            if (EventFlag::REMOVE_EVENT.in(static_cast<std::uint32_t>(candle->getEventFlags()))) {
+                entry.records.erase(candle->getIndex());
+
+                continue;
+            }
+
+            entry.records[candle->getIndex()] = toRecord(*candle);
+            lastTime = std::max(lastTime, candle->getTime());
+        }
+
+        // The candles that are still being built are not covered: for the time periods, the candles that end after
+        // the current time, otherwise the last downloaded candle (its end is unknown).
+        auto coveredTo = gap.to;
+
+        if (periodMillis > 0) {
+            coveredTo = std::min(coveredTo, currentTimeMillis() - periodMillis);
+        } else if (lastTime != std::numeric_limits<std::int64_t>::min()) {
+            coveredTo = std::min(coveredTo, lastTime - 1);
+        } else if (gap.to >= currentTimeMillis()) {
+            coveredTo = gap.from - 1;
+        }
+
+        if (coveredTo >= gap.from) {
+            entry.ranges.push_back({gap.from, coveredTo});
+        }
+
+        std::lock_guard guard(mtx_);
+
+        stats_.fetches++;
+        stats_.fetchedEvents += events.size();
+    }
+
+    if (!gaps.empty()) {
+        entry.ranges = merge(std::move(entry.ranges));
+
+        std::error_code ec{};
+
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+        save(path, entry);
+    }
+
+    {
+        std::lock_guard guard(mtx_);
+
+        (gaps.empty() ? stats_.hits : stats_.misses)++;
+    }
+
+    std::vector<std::shared_ptr<EventType>> result{};
+
+    for (const auto &[index, record] : entry.records) {
+        if (const auto time = getTimeOfIndex(index); time >= from && time <= to) {
+            result.push_back(toCandle(candleSymbol, record));
+        }
+    }
+
+    return result;
+}
+
+DXFCPP_END_NAMESPACE
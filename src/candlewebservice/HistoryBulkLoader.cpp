@@ -0,0 +1,229 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/candlewebservice/HistoryBulkLoader.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/internal/Common.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/Platform.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+struct Task {
+    std::size_t symbol;
+    std::int64_t from;
+    std::int64_t to;
+};
+
+struct SymbolState {
+    std::size_t nextTask{};
+    std::size_t endTask{};
+    bool consuming = false;
+    std::map<std::size_t, std::vector<std::shared_ptr<EventType>>> ready{};
+};
+
+struct Loading {
+    const std::vector<SymbolWrapper> &symbols;
+    const HistoryBulkLoader::Fetcher &fetcher;
+    const HistoryBulkLoader::Consumer &consumer;
+    std::size_t window;
+
+    std::vector<Task> tasks{};
+    std::vector<SymbolState> states{};
+
+    std::mutex mtx{};
+    std::condition_variable cv{};
+    std::size_t next{};
+    // The tasks that are started but not consumed.
+    std::set<std::size_t> inProgress{};
+    std::exception_ptr error{};
+
+    Loading(const std::vector<SymbolWrapper> &symbols, const HistoryBulkLoader::Fetcher &fetcher,
+            const HistoryBulkLoader::Consumer &consumer, std::size_t window)
+        : symbols{symbols}, fetcher{fetcher}, consumer{consumer}, window{window} {
+    }
+
+    void split(std::int64_t from, std::int64_t to, std::int64_t chunkDuration) {
+        states.resize(symbols.size());
+
+        for (std::size_t s = 0; s < symbols.size(); s++) {
+            states[s].nextTask = tasks.size();
+
+            if (chunkDuration <= 0 || from > to) {
+                tasks.push_back({s, from, to});
+            } else {
+                for (auto chunkFrom = from;;) {
+                    const auto chunkTo = to - chunkFrom < chunkDuration ? to : chunkFrom + chunkDuration - 1;
+
+                    tasks.push_back({s, chunkFrom, chunkTo});
+
+                    if (chunkTo == to) {
+                        break;
+                    }
+
+                    chunkFrom = chunkTo + 1;
+                }
+            }
+
+            states[s].endTask = tasks.size();
+        }
+    }
+
+    // Must be called with the locked mutex.
+    bool canStart() const {
+        if (error || next >= tasks.size()) {
+            return true;
+        }
+
+        const auto lowest = inProgress.empty() ? next : *inProgress.begin();
+
+        return next < lowest + window;
+    }
+
+    // Must be called with the locked mutex.
+    void fail(std::exception_ptr exception) {
+        if (!error) {
+            error = std::move(exception);
+        }
+
+        cv.notify_all();
+    }
+
+    // Consumes the ready chunks of the symbol in order. Must be called with the locked mutex.
+    void consume(std::unique_lock<std::mutex> &lock, std::size_t symbol) {
+        auto &state = states[symbol];
+
+        if (state.consuming) {
+            return;
+        }
+
+        state.consuming = true;
+
+        while (!error) {
+            auto found = state.ready.find(state.nextTask);
+
+            if (found == state.ready.end()) {
+                break;
+            }
+
+            const auto task = state.nextTask;
+            auto events = std::move(found->second);
+
+            state.ready.erase(found);
+            lock.unlock();
+
+            try {
+                consumer(symbols[symbol], std::move(events), task + 1 == state.endTask);
+            } catch (...) {
+                lock.lock();
+                fail(std::current_exception());
+
+                break;
+            }
+
+            lock.lock();
+            state.nextTask++;
+            inProgress.erase(task);
+            cv.notify_all();
+        }
+
+        state.consuming = false;
+    }
+
+    void run() {
+        std::unique_lock lock(mtx);
+
+        while (true) {
+            cv.wait(lock, [this] {
+                return canStart();
+            });
+
+            if (error || next >= tasks.size()) {
+                return;
+            }
+
+            const auto task = next++;
+            const auto &[symbol, from, to] = tasks[task];
+
+            inProgress.insert(task);
+            lock.unlock();
+
+            std::vector<std::shared_ptr<EventType>> events{};
+
+            try {
+                events = fetcher(symbols[symbol], from, to);
+            } catch (...) {
+                lock.lock();
+                fail(std::current_exception());
+
+                return;
+            }
+
+            lock.lock();
+            states[symbol].ready.emplace(task, std::move(events));
+            consume(lock, symbol);
+        }
+    }
+};
+
+} // namespace
+
+void HistoryBulkLoader::load(const std::vector<SymbolWrapper> &symbols, std::int64_t from, std::int64_t to,
+                             const Fetcher &fetcher, const Consumer &consumer, const Options &options) {
+    if (symbols.empty()) {
+        return;
+    }
+
+    const auto parallelism =
+        options.parallelism == 0 ? std::max<std::size_t>(Platform::getLogicalCoresCount(), 1) : options.parallelism;
+    Loading loading(symbols, fetcher, consumer, options.window == 0 ? 2 * parallelism : options.window);
+
+    loading.split(from, to, options.chunkDuration);
+
+    const auto threadCount = std::min(parallelism, loading.tasks.size());
+    std::vector<std::thread> threads{};
+
+    threads.reserve(threadCount - 1);
+
+    // The started threads are joined if the start of the next one or the run on this thread throws: the threads refer
+    // to the loading, and a joinable thread terminates the program when it is destroyed.
+    DXFCPP_FINALLY([&threads] {
+        for (auto &thread : threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    });
+
+    for (std::size_t i = 1; i < threadCount; i++) {
+        threads.emplace_back([&loading] {
+            loading.run();
+        });
+    }
+
+    loading.run();
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    if (loading.error) {
+        std::rethrow_exception(loading.error);
+    }
+}
+
+void HistoryBulkLoader::load(const std::vector<SymbolWrapper> &symbols, std::int64_t from, std::int64_t to,
+                             const Fetcher &fetcher, const Consumer &consumer) {
+    load(symbols, from, to, fetcher, consumer, Options{});
+}
+
+DXFCPP_END_NAMESPACE
@@ -16,7 +16,27 @@ DXFCPP_BEGIN_NAMESPACE
 std::vector<std::shared_ptr<EventType>> HistoryEndpoint::getTimeSeriesImpl(const EventTypeEnum &eventType,
                                                                            const SymbolWrapper &symbol,
                                                                            std::int64_t from, std::int64_t to) const {
-    return isolated::candlewebservice::IsolatedHistoryEndpoint::getTimeSeries(handle_, eventType, symbol, from, to);
+    if (!cache_) {
+        return isolated::candlewebservice::IsolatedHistoryEndpoint::getTimeSeries(handle_, eventType, symbol, from, to);
+    }
+
+    return cache_->getTimeSeries(eventType, symbol, from, to,
+                                 [this, &eventType, &symbol](std::int64_t fetchFrom, std::int64_t fetchTo) {
+                                     return isolated::candlewebservice::IsolatedHistoryEndpoint::getTimeSeries(
+                                         handle_, eventType, symbol, fetchFrom, fetchTo);
+                                 });
+}
+
+void HistoryEndpoint::getTimeSeriesImpl(const EventTypeEnum &eventType, const std::vector<SymbolWrapper> &symbols,
+                                        std::int64_t from, std::int64_t to,
+                                        const HistoryBulkLoader::Consumer &consumer,
+                                        const HistoryBulkLoader::Options &options) const {
+    HistoryBulkLoader::load(
+        symbols, from, to,
+        [this, &eventType](const SymbolWrapper &symbol, std::int64_t chunkFrom, std::int64_t chunkTo) {
+            return getTimeSeriesImpl(eventType, symbol, chunkFrom, chunkTo);
+        },
+        consumer, options);
 }
 
 HistoryEndpoint::HistoryEndpoint(LockExternalConstructionTag,
@@ -71,9 +91,16 @@ std::shared_ptr<HistoryEndpoint::Builder> HistoryEndpoint::Builder::withFormat(F
     return this->sharedAs<Builder>();
 }
 
+std::shared_ptr<HistoryEndpoint::Builder> HistoryEndpoint::Builder::withCache(std::shared_ptr<HistoryCache> cache) {
+    cache_ = std::move(cache);
+
+    return this->sharedAs<Builder>();
+}
+
 std::shared_ptr<HistoryEndpoint> HistoryEndpoint::Builder::build() const {
     auto endpoint = HistoryEndpoint::createShared(
         isolated::candlewebservice::IsolatedHistoryEndpoint::Builder::build(handle_));
+    endpoint->cache_ = cache_;
     const auto id = ApiContext::getInstance()->getManager<EntityManager<HistoryEndpoint>>()->registerEntity(endpoint);
     ignoreUnused(id);
 
@@ -0,0 +1,1547 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/event/EventArchive.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/event/EventType.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/EventTypeEnum.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/candle/Candle.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/Direction.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/Order.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/Quote.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/TimeAndSale.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/Trade.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/TradeETH.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/option/Greeks.hpp"
+#include "../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/exceptions/RuntimeException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/utils/Inflater.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+using Kind = EventArchiveBlock::Kind;
+
+constexpr char MAGIC[8] = {'D', 'X', 'F', 'E', 'V', 'A', 'R', '\0'};
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr std::uint32_t RECORD_MAGIC = 0x52435844; // "DXCR"
+constexpr std::uint32_t NO_TYPE = std::numeric_limits<std::uint32_t>::max();
+constexpr std::uint8_t RAW_DOUBLES = 0xFF;
+constexpr int MAX_SCALE = 9;
+constexpr double MAX_MANTISSA = 9e15; // The mantissas below 2^53 are exact.
+constexpr double POWERS_OF_TEN[MAX_SCALE + 1] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+// The layout of the file:
+//   Header
+//   The records. A record is RecordHeader (with the CRC-32 of the payload) and the payload, so the records that were
+//   written before a crash are found by the scan from the header, and the incomplete record at the end is detected.
+//   The SCHEMA record is the schema of a type (the name, the number of the columns, the kind and the name of each
+//   column). It precedes the first block of the type, and the types are numbered in the order of their schemas.
+//   The BLOCK record is the number of the type, the symbol (the varint length and the bytes), the number of the events,
+//   the zigzag varints of the minimal and the maximal time, the column of the times and the columns of the fields in
+//   the order of the schema. A column is the varint length and the values: the zigzag varints of the deltas (INT), the
+//   mode byte (the decimal scale or RAW_DOUBLES) and the zigzag varints of the deltas of the mantissas plus one (0 is
+//   NaN) or the raw doubles (DOUBLE), the varint lengths and the bytes (STRING).
+//   The FOOTER record (written by close()): the number of the schemas and the schemas, the symbols (the varint lengths
+//   and the bytes), the padding to 8 bytes and the BlockEntry of each block sorted by the type, the symbol, the minimal
+//   time and the offset.
+//   Trailer
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+};
+
+struct Trailer {
+    std::uint64_t footerOffset;
+    std::uint64_t entriesOffset;
+    std::uint64_t entryCount;
+    std::uint64_t eventCount;
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+    char magic[8];
+};
+
+enum class RecordKind : std::uint32_t {
+    SCHEMA = 1,
+    BLOCK = 2,
+    FOOTER = 3,
+};
+
+struct RecordHeader {
+    std::uint32_t magic;
+    RecordKind kind;
+    std::uint64_t size;
+    std::uint32_t checksum;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(Header) == 16 && sizeof(Trailer) == 48 && sizeof(RecordHeader) == 24);
+
+// The description of a field of an event type: its kind and the accessors for the kind.
+struct ColumnSpec {
+    std::string_view name{};
+    Kind kind{};
+    std::int64_t (*getInt)(const EventType &){};
+    double (*getDouble)(const EventType &){};
+    std::string_view (*getString)(const EventType &){};
+    void (*setInt)(EventType &, std::int64_t){};
+    void (*setDouble)(EventType &, double){};
+    void (*setString)(EventType &, std::string_view){};
+};
+
+struct TypeSpec {
+    const EventTypeEnum *type{};
+    std::type_index typeIndex = typeid(void);
+    std::string_view (*getSymbol)(const EventType &){};
+    std::int64_t (*getTime)(const EventType &){};
+    void (*setTime)(EventType &, std::int64_t){}; // nullptr if the time is derived from the fields.
+    std::shared_ptr<EventType> (*create)(std::string_view symbol){};
+    std::vector<ColumnSpec> columns{};
+};
+
+template <typename> struct SetterTraits;
+
+template <typename C, typename A> struct SetterTraits<void (C::*)(A)> {
+    using Arg = std::remove_cvref_t<A>;
+};
+
+template <typename C, typename A> struct SetterTraits<void (C::*)(A) noexcept> {
+    using Arg = std::remove_cvref_t<A>;
+};
+
+// Selects the overload of the setter by the type of its argument.
+template <typename A, typename C> constexpr auto overload(void (C::*setter)(A)) {
+    return setter;
+}
+
+template <typename E, auto GET, auto SET> ColumnSpec column(std::string_view name) {
+    using Value = std::remove_cvref_t<std::invoke_result_t<decltype(GET), const E &>>;
+    using Arg = typename SetterTraits<decltype(SET)>::Arg;
+
+    ColumnSpec spec{name};
+
+    if constexpr (std::is_floating_point_v<Value>) {
+        spec.kind = Kind::DOUBLE;
+        spec.getDouble = [](const EventType &e) -> double {
+            return std::invoke(GET, static_cast<const E &>(e));
+        };
+        spec.setDouble = [](EventType &e, double value) {
+            std::invoke(SET, static_cast<E &>(e), value);
+        };
+    } else if constexpr (std::is_same_v<Value, std::string>) {
+        spec.kind = Kind::STRING;
+        spec.getString = [](const EventType &e) -> std::string_view {
+            return std::invoke(GET, static_cast<const E &>(e));
+        };
+        spec.setString = [](EventType &e, std::string_view value) {
+            std::invoke(SET, static_cast<E &>(e), StringLike(value));
+        };
+    } else if constexpr (std::is_integral_v<Value>) {
+        spec.kind = Kind::INT;
+        spec.getInt = [](const EventType &e) -> std::int64_t {
+            return static_cast<std::int64_t>(std::invoke(GET, static_cast<const E &>(e)));
+        };
+        spec.setInt = [](EventType &e, std::int64_t value) {
+            std::invoke(SET, static_cast<E &>(e), static_cast<Arg>(value));
+        };
+    } else if constexpr (requires(const Value &value) { value.getCode(); }) {
+        // The enums are stored by their codes.
+        spec.kind = Kind::INT;
+        spec.getInt = [](const EventType &e) -> std::int64_t {
+            return static_cast<std::int64_t>(std::invoke(GET, static_cast<const E &>(e)).getCode());
+        };
+        spec.setInt = [](EventType &e, std::int64_t value) {
+            std::invoke(SET, static_cast<E &>(e), Arg::valueOf(value));
+        };
+    } else {
+        // The sources are stored by their ids.
+        spec.kind = Kind::INT;
+        spec.getInt = [](const EventType &e) -> std::int64_t {
+            return std::invoke(GET, static_cast<const E &>(e)).id();
+        };
+        spec.setInt = [](EventType &e, std::int64_t value) {
+            std::invoke(SET, static_cast<E &>(e), Arg::valueOf(static_cast<std::int32_t>(value)));
+        };
+    }
+
+    return spec;
+}
+
+template <typename E, auto GET_TIME, auto SET_TIME> TypeSpec type(std::vector<ColumnSpec> columns) {
+    TypeSpec spec{&E::TYPE, typeid(E)};
+
+    spec.getSymbol = [](const EventType &e) -> std::string_view {
+        if constexpr (std::is_same_v<E, Candle>) {
+            return static_cast<const E &>(e).getEventSymbol().toString();
+        } else {
+            return static_cast<const E &>(e).getEventSymbol();
+        }
+    };
+    spec.getTime = [](const EventType &e) -> std::int64_t {
+        return std::invoke(GET_TIME, static_cast<const E &>(e));
+    };
+
+    if constexpr (!std::is_same_v<decltype(SET_TIME), std::nullptr_t>) {
+        spec.setTime = [](EventType &e, std::int64_t time) {
+            std::invoke(SET_TIME, static_cast<E &>(e), time);
+        };
+    }
+
+    spec.create = [](std::string_view symbol) -> std::shared_ptr<EventType> {
+        if constexpr (std::is_same_v<E, Candle>) {
+            return std::make_shared<Candle>(CandleSymbol::valueOf(symbol));
+        } else {
+            return std::make_shared<E>(std::string(symbol));
+        }
+    };
+    spec.columns = std::move(columns);
+
+    return spec;
+}
+
+template <typename E> std::vector<ColumnSpec> tradeColumns() {
+    return {
+        column<E, &EventType::getEventTime, &EventType::setEventTime>("eventTime"),
+        column<E, &TradeBase::getTimeNanoPart, &TradeBase::setTimeNanoPart>("timeNanoPart"),
+        column<E, &TradeBase::getSequence, &TradeBase::setSequence>("sequence"),
+        column<E, &TradeBase::getExchangeCode, overload<std::int16_t, TradeBase>(&TradeBase::setExchangeCode)>(
+            "exchange"),
+        column<E, &TradeBase::getPrice, &TradeBase::setPrice>("price"),
+        column<E, &TradeBase::getSize, &TradeBase::setSize>("size"),
+        column<E, &TradeBase::getDayId, &TradeBase::setDayId>("dayId"),
+        column<E, &TradeBase::getDayVolume, &TradeBase::setDayVolume>("dayVolume"),
+        column<E, &TradeBase::getDayTurnover, &TradeBase::setDayTurnover>("dayTurnover"),
+        column<E, &TradeBase::getTickDirection, &TradeBase::setTickDirection>("tickDirection"),
+        column<E, &TradeBase::isExtendedTradingHours, &TradeBase::setExtendedTradingHours>("extendedTradingHours"),
+        column<E, &TradeBase::getChange, &TradeBase::setChange>("change"),
+    };
+}
+
+// The schemas of the supported types. The order of the columns is the part of the format.
+const std::vector<TypeSpec> &getTypeSpecs() {
+    static const std::vector<TypeSpec> SPECS{
+        type<Quote, &Quote::getTime, nullptr>({
+            column<Quote, &EventType::getEventTime, &EventType::setEventTime>("eventTime"),
+            column<Quote, &Quote::getTimeNanoPart, &Quote::setTimeNanoPart>("timeNanoPart"),
+            column<Quote, &Quote::getSequence, &Quote::setSequence>("sequence"),
+            column<Quote, &Quote::getBidTime, &Quote::setBidTime>("bidTime"),
+            column<Quote, &Quote::getBidExchangeCode, overload<std::int16_t, Quote>(&Quote::setBidExchangeCode)>(
+                "bidExchange"),
+            column<Quote, &Quote::getBidPrice, &Quote::setBidPrice>("bidPrice"),
+            column<Quote, &Quote::getBidSize, &Quote::setBidSize>("bidSize"),
+            column<Quote, &Quote::getAskTime, &Quote::setAskTime>("askTime"),
+            column<Quote, &Quote::getAskExchangeCode, overload<std::int16_t, Quote>(&Quote::setAskExchangeCode)>(
+                "askExchange"),
+            column<Quote, &Quote::getAskPrice, &Quote::setAskPrice>("askPrice"),
+            column<Quote, &Quote::getAskSize, &Quote::setAskSize>("askSize"),
+        }),
+        type<Trade, &TradeBase::getTime, &TradeBase::setTime>(tradeColumns<Trade>()),
+        type<TradeETH, &TradeBase::getTime, &TradeBase::setTime>(tradeColumns<TradeETH>()),
+        type<TimeAndSale, &TimeAndSale::getTime, &TimeAndSale::setTime>({
+            column<TimeAndSale, &EventType::getEventTime, &EventType::setEventTime>("eventTime"),
+            column<TimeAndSale, &TimeAndSale::getEventFlags,
+                   overload<std::int32_t, TimeAndSale>(&TimeAndSale::setEventFlags)>("eventFlags"),
+            column<TimeAndSale, &TimeAndSale::getTimeNanoPart, &TimeAndSale::setTimeNanoPart>("timeNanoPart"),
+            column<TimeAndSale, &TimeAndSale::getSequence, &TimeAndSale::setSequence>("sequence"),
+            column<TimeAndSale, &TimeAndSale::getExchangeCode,
+                   overload<std::int16_t, TimeAndSale>(&TimeAndSale::setExchangeCode)>("exchange"),
+            column<TimeAndSale, &TimeAndSale::getPrice, &TimeAndSale::setPrice>("price"),
+            column<TimeAndSale, &TimeAndSale::getSize, &TimeAndSale::setSize>("size"),
+            column<TimeAndSale, &TimeAndSale::getBidPrice, &TimeAndSale::setBidPrice>("bidPrice"),
+            column<TimeAndSale, &TimeAndSale::getAskPrice, &TimeAndSale::setAskPrice>("askPrice"),
+            column<TimeAndSale, &TimeAndSale::getExchangeSaleConditions, &TimeAndSale::setExchangeSaleConditions>(
+                "exchangeSaleConditions"),
+            column<TimeAndSale, &TimeAndSale::getTradeThroughExempt, &TimeAndSale::setTradeThroughExempt>(
+                "tradeThroughExempt"),
+            column<TimeAndSale, &TimeAndSale::getAggressorSide, &TimeAndSale::setAggressorSide>("aggressorSide"),
+            column<TimeAndSale, &TimeAndSale::isSpreadLeg, &TimeAndSale::setSpreadLeg>("spreadLeg"),
+            column<TimeAndSale, &TimeAndSale::isExtendedTradingHours, &TimeAndSale::setExtendedTradingHours>(
+                "extendedTradingHours"),
+            column<TimeAndSale, &TimeAndSale::isValidTick, &TimeAndSale::setValidTick>("validTick"),
+            column<TimeAndSale, &TimeAndSale::getType, &TimeAndSale::setType>("type"),
+            column<TimeAndSale, &TimeAndSale::getBuyer, &TimeAndSale::setBuyer>("buyer"),
+            column<TimeAndSale, &TimeAndSale::getSeller, &TimeAndSale::setSeller>("seller"),
+        }),
+        type<Candle, &Candle::getTime, &Candle::setTime>({
+            column<Candle, &EventType::getEventTime, &EventType::setEventTime>("eventTime"),
+            column<Candle, &Candle::getEventFlags, overload<std::int32_t, Candle>(&Candle::setEventFlags)>(
+                "eventFlags"),
+            column<Candle, &Candle::getSequence, &Candle::setSequence>("sequence"),
+            column<Candle, &Candle::getCount, &Candle::setCount>("count"),
+            column<Candle, &Candle::getOpen, &Candle::setOpen>("open"),
+            column<Candle, &Candle::getHigh, &Candle::setHigh>("high"),
+            column<Candle, &Candle::getLow, &Candle::setLow>("low"),
+            column<Candle, &Candle::getClose, &Candle::setClose>("close"),
+            column<Candle, &Candle::getVolume, &Candle::setVolume>("volume"),
+            column<Candle, &Candle::getVWAP, &Candle::setVWAP>("vwap"),
+            column<Candle, &Candle::getBidVolume, &Candle::setBidVolume>("bidVolume"),
+            column<Candle, &Candle::getAskVolume, &Candle::setAskVolume>("askVolume"),
+            column<Candle, &Candle::getImpVolatility, &Candle::setImpVolatility>("impVolatility"),
+            column<Candle, &Candle::getOpenInterest, &Candle::setOpenInterest>("openInterest"),
+        }),
+        type<Greeks, &Greeks::getTime, &Greeks::setTime>({
+            column<Greeks, &EventType::getEventTime, &EventType::setEventTime>("eventTime"),
+            column<Greeks, &Greeks::getEventFlags, overload<std::int32_t, Greeks>(&Greeks::setEventFlags)>(
+                "eventFlags"),
+            column<Greeks, &Greeks::getSequence, &Greeks::setSequence>("sequence"),
+            column<Greeks, &Greeks::getPrice, &Greeks::setPrice>("price"),
+            column<Greeks, &Greeks::getVolatility, &Greeks::setVolatility>("volatility"),
+            column<Greeks, &Greeks::getDelta, &Greeks::setDelta>("delta"),
+            column<Greeks, &Greeks::getGamma, &Greeks::setGamma>("gamma"),
+            column<Greeks, &Greeks::getTheta, &Greeks::setTheta>("theta"),
+            column<Greeks, &Greeks::getRho, &Greeks::setRho>("rho"),
+            column<Greeks, &Greeks::getVega, &Greeks::setVega>("vega"),
+        }),
+        type<Order, &OrderBase::getTime, &OrderBase::setTime>({
+            column<Order, &EventType::getEventTime, &EventType::setEventTime>("eventTime"),
+            column<Order, &OrderBase::getSource, &OrderBase::setSource>("source"),
+            column<Order, &OrderBase::getEventFlags, overload<std::int32_t, OrderBase>(&OrderBase::setEventFlags)>(
+                "eventFlags"),
+            // The index contains the source, so it is set after it.
+            column<Order, &OrderBase::getIndex, &OrderBase::setIndex>("index"),
+            column<Order, &OrderBase::getTimeNanoPart, &OrderBase::setTimeNanoPart>("timeNanoPart"),
+            column<Order, &OrderBase::getSequence, &OrderBase::setSequence>("sequence"),
+            column<Order, &OrderBase::getAction, &OrderBase::setAction>("action"),
+            column<Order, &OrderBase::getActionTime, &OrderBase::setActionTime>("actionTime"),
+            column<Order, &OrderBase::getOrderId, &OrderBase::setOrderId>("orderId"),
+            column<Order, &OrderBase::getAuxOrderId, &OrderBase::setAuxOrderId>("auxOrderId"),
+            column<Order, &OrderBase::getPrice, &OrderBase::setPrice>("price"),
+            column<Order, &OrderBase::getSize, &OrderBase::setSize>("size"),
+            column<Order, &OrderBase::getExecutedSize, &OrderBase::setExecutedSize>("executedSize"),
+            column<Order, &OrderBase::getCount, &OrderBase::setCount>("count"),
+            column<Order, &OrderBase::getExchangeCode,
+                   overload<std::int16_t, OrderBase>(&OrderBase::setExchangeCode)>("exchange"),
+            column<Order, &OrderBase::getOrderSide, &OrderBase::setOrderSide>("side"),
+            column<Order, &OrderBase::getScope, &OrderBase::setScope>("scope"),
+            column<Order, &OrderBase::getTradeId, &OrderBase::setTradeId>("tradeId"),
+            column<Order, &OrderBase::getTradePrice, &OrderBase::setTradePrice>("tradePrice"),
+            column<Order, &OrderBase::getTradeSize, &OrderBase::setTradeSize>("tradeSize"),
+            column<Order, &Order::getMarketMaker, &Order::setMarketMaker>("marketMaker"),
+        }),
+    };
+
+    return SPECS;
+}
+
+const TypeSpec *findTypeSpec(const EventTypeEnum &type) noexcept {
+    for (const auto &spec : getTypeSpecs()) {
+        if (spec.type == &type) {
+            return &spec;
+        }
+    }
+
+    return nullptr;
+}
+
+std::uint64_t zigzag(std::uint64_t value) noexcept {
+    return (value << 1) ^ (0 - (value >> 63));
+}
+
+std::uint64_t unzigzag(std::uint64_t value) noexcept {
+    return (value >> 1) ^ (0 - (value & 1));
+}
+
+void appendVarint(std::string &out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    out.push_back(static_cast<char>(value));
+}
+
+void appendString(std::string &out, std::string_view value) {
+    appendVarint(out, value.size());
+    out.append(value);
+}
+
+// The values of a column of the block that is being written. The integers and the strings are encoded immediately, the
+// doubles are encoded when the block is written, because the scale depends on all the values.
+struct PendingColumn {
+    std::string data{};
+    std::uint64_t last{};
+    std::vector<double> doubles{};
+
+    void addInt(std::int64_t value) {
+        appendVarint(data, zigzag(static_cast<std::uint64_t>(value) - last));
+        last = static_cast<std::uint64_t>(value);
+    }
+
+    void clear() noexcept {
+        data.clear();
+        last = 0;
+        doubles.clear();
+    }
+};
+
+// Returns the minimal decimal scale of the value or MAX_SCALE + 1 if there is no such scale.
+int getScale(double value) noexcept {
+    for (int scale = 0; scale <= MAX_SCALE; scale++) {
+        const auto scaled = value * POWERS_OF_TEN[scale];
+
+        if (std::abs(scaled) >= MAX_MANTISSA) {
+            break;
+        }
+
+        if (static_cast<double>(std::llround(scaled)) / POWERS_OF_TEN[scale] == value) {
+            return scale;
+        }
+    }
+
+    return MAX_SCALE + 1;
+}
+
+void encodeDoubles(std::string &out, const std::vector<double> &values) {
+    int scale = 0;
+
+    for (const auto value : values) {
+        if (std::isnan(value)) {
+            continue;
+        }
+
+        // The infinities and the negative zero (its mantissa is +0) are stored as the raw doubles.
+        if (!std::isfinite(value) || (value == 0.0 && std::signbit(value))) {
+            scale = MAX_SCALE + 1;
+
+            break;
+        }
+
+        if (scale = std::max(scale, getScale(value)); scale > MAX_SCALE) {
+            break;
+        }
+    }
+
+    const auto start = out.size();
+
+    if (scale <= MAX_SCALE) {
+        const auto power = POWERS_OF_TEN[scale];
+
+        out.push_back(static_cast<char>(scale));
+
+        std::uint64_t last = 0;
+
+        for (const auto value : values) {
+            if (std::isnan(value)) {
+                out.push_back(0);
+
+                continue;
+            }
+
+            const auto scaled = value * power;
+            const auto mantissa = std::llround(scaled);
+
+            // The value can have the minimal scale below the chosen one, but not be exact with the chosen one.
+            if (std::abs(scaled) >= MAX_MANTISSA || static_cast<double>(mantissa) / power != value) {
+                out.resize(start);
+                scale = MAX_SCALE + 1;
+
+                break;
+            }
+
+            appendVarint(out, zigzag(static_cast<std::uint64_t>(mantissa) - last) + 1);
+            last = static_cast<std::uint64_t>(mantissa);
+        }
+    }
+
+    if (scale > MAX_SCALE) {
+        out.push_back(static_cast<char>(RAW_DOUBLES));
+
+        const auto offset = out.size();
+
+        out.resize(offset + values.size() * sizeof(double));
+        std::memcpy(out.data() + offset, values.data(), values.size() * sizeof(double));
+    }
+}
+
+// The reader of the encoded values that checks the bounds.
+struct Cursor {
+    const char *position;
+    const char *end;
+
+    [[noreturn]] static void fail() {
+        throw RuntimeException("The event archive is corrupted");
+    }
+
+    bool atEnd() const noexcept {
+        return position == end;
+    }
+
+    std::uint64_t readVarint() {
+        std::uint64_t result = 0;
+
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (position == end) {
+                fail();
+            }
+
+            const auto byte = static_cast<std::uint8_t>(*position++);
+
+            result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+            if ((byte & 0x80) == 0) {
+                return result;
+            }
+        }
+
+        fail();
+    }
+
+    std::uint8_t readByte() {
+        if (position == end) {
+            fail();
+        }
+
+        return static_cast<std::uint8_t>(*position++);
+    }
+
+    std::string_view readBytes(std::uint64_t size) {
+        if (size > static_cast<std::uint64_t>(end - position)) {
+            fail();
+        }
+
+        const std::string_view result(position, static_cast<std::size_t>(size));
+
+        position += size;
+
+        return result;
+    }
+
+    std::string_view readString() {
+        return readBytes(readVarint());
+    }
+
+    Cursor readColumn() {
+        const auto bytes = readBytes(readVarint());
+
+        return {bytes.data(), bytes.data() + bytes.size()};
+    }
+};
+
+void decodeInts(Cursor cursor, std::size_t count, std::vector<std::int64_t> &values) {
+    std::uint64_t last = 0;
+
+    values.resize(count);
+
+    for (auto &value : values) {
+        last += unzigzag(cursor.readVarint());
+        value = static_cast<std::int64_t>(last);
+    }
+
+    if (!cursor.atEnd()) {
+        Cursor::fail();
+    }
+}
+
+void decodeDoubles(Cursor cursor, std::size_t count, std::vector<double> &values) {
+    const auto mode = cursor.readByte();
+
+    values.resize(count);
+
+    if (mode == RAW_DOUBLES) {
+        const auto bytes = cursor.readBytes(count * sizeof(double));
+
+        std::memcpy(values.data(), bytes.data(), bytes.size());
+    } else if (mode <= MAX_SCALE) {
+        const auto power = POWERS_OF_TEN[mode];
+        std::uint64_t last = 0;
+
+        for (auto &value : values) {
+            if (const auto code = cursor.readVarint(); code == 0) {
+                value = std::numeric_limits<double>::quiet_NaN();
+            } else {
+                last += unzigzag(code - 1);
+                value = static_cast<double>(static_cast<std::int64_t>(last)) / power;
+            }
+        }
+    } else {
+        Cursor::fail();
+    }
+
+    if (!cursor.atEnd()) {
+        Cursor::fail();
+    }
+}
+
+void decodeStrings(Cursor cursor, std::size_t count, std::vector<std::string_view> &values) {
+    values.resize(count);
+
+    for (auto &value : values) {
+        value = cursor.readString();
+    }
+
+    if (!cursor.atEnd()) {
+        Cursor::fail();
+    }
+}
+
+// The schema of a type in the archive.
+struct Schema {
+    std::string_view name{};
+    std::vector<std::pair<std::string_view, Kind>> columns{};
+
+    static Schema read(Cursor &cursor) {
+        Schema result{cursor.readString()};
+        const auto columnCount = cursor.readVarint();
+
+        for (std::uint64_t c = 0; c < columnCount; c++) {
+            const auto kind = static_cast<Kind>(cursor.readByte());
+
+            if (kind != Kind::INT && kind != Kind::DOUBLE && kind != Kind::STRING) {
+                Cursor::fail();
+            }
+
+            result.columns.emplace_back(cursor.readString(), kind);
+        }
+
+        return result;
+    }
+
+    static void append(std::string &out, const TypeSpec &spec) {
+        appendString(out, spec.type->getClassName());
+        appendVarint(out, spec.columns.size());
+
+        for (const auto &column : spec.columns) {
+            out.push_back(static_cast<char>(column.kind));
+            appendString(out, column.name);
+        }
+    }
+
+    bool matches(const TypeSpec &spec) const {
+        return spec.type->getClassName() == name && spec.columns.size() == columns.size() &&
+               std::equal(spec.columns.begin(), spec.columns.end(), columns.begin(),
+                          [](const ColumnSpec &s, const auto &column) {
+                              return s.name == column.first && s.kind == column.second;
+                          });
+    }
+};
+
+template <typename T> T load(const char *data) noexcept {
+    T result;
+
+    std::memcpy(&result, data, sizeof(T));
+
+    return result;
+}
+
+// The block that is found by the scan of the records.
+struct ScannedBlock {
+    std::uint64_t offset; // The offset of the column of the times.
+    std::uint64_t size;
+    std::uint32_t type;
+    std::string_view symbol;
+    std::uint32_t count;
+    std::int64_t minTime;
+    std::int64_t maxTime;
+};
+
+struct ScannedRecords {
+    std::vector<std::string_view> schemas{};
+    std::vector<ScannedBlock> blocks{};
+    // The end of the last valid record (before the footer, if any).
+    std::uint64_t end{};
+};
+
+// Reads the records from the header to the footer, or to the first incomplete or corrupted record (the tail of the
+// archive that was being written when the process was terminated).
+ScannedRecords scanRecords(const char *data, std::uint64_t size) {
+    ScannedRecords result{};
+    std::uint64_t position = sizeof(Header);
+
+    result.end = position;
+
+    while (size - position >= sizeof(RecordHeader)) {
+        const auto header = load<RecordHeader>(data + position);
+        const auto payloadOffset = position + sizeof(RecordHeader);
+
+        if (header.magic != RECORD_MAGIC || header.kind == RecordKind::FOOTER || header.size > size - payloadOffset) {
+            break;
+        }
+
+        const std::string_view payload(data + payloadOffset, static_cast<std::size_t>(header.size));
+
+        if (Inflater::crc32(payload) != header.checksum) {
+            break;
+        }
+
+        if (header.kind == RecordKind::SCHEMA) {
+            result.schemas.push_back(payload);
+        } else if (header.kind == RecordKind::BLOCK) {
+            Cursor cursor{payload.data(), payload.data() + payload.size()};
+            ScannedBlock block{};
+
+            try {
+                const auto type = cursor.readVarint();
+
+                block.symbol = cursor.readString();
+
+                const auto count = cursor.readVarint();
+
+                block.minTime = static_cast<std::int64_t>(unzigzag(cursor.readVarint()));
+                block.maxTime = static_cast<std::int64_t>(unzigzag(cursor.readVarint()));
+
+                if (type >= result.schemas.size() || count > EventArchiveWriter::BLOCK_SIZE) {
+                    break;
+                }
+
+                block.type = static_cast<std::uint32_t>(type);
+                block.count = static_cast<std::uint32_t>(count);
+            } catch (const RuntimeException &) {
+                break;
+            }
+
+            block.offset = payloadOffset + static_cast<std::uint64_t>(cursor.position - payload.data());
+            block.size = static_cast<std::uint64_t>(cursor.end - cursor.position);
+            result.blocks.push_back(block);
+        } else {
+            break;
+        }
+
+        position = payloadOffset + header.size;
+        result.end = position;
+    }
+
+    return result;
+}
+
+} // namespace
+
+struct EventArchiveWriter::PendingBlock {
+    const TypeSpec *spec{};
+    std::uint32_t type{};
+    std::uint32_t symbol{};
+    std::size_t size{};
+    std::int64_t minTime{};
+    std::int64_t maxTime{};
+    PendingColumn times{};
+    std::vector<PendingColumn> columns{};
+};
+
+struct EventArchiveWriter::BlockEntry {
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::uint32_t type;
+    std::uint32_t symbol;
+    std::uint32_t count;
+    std::uint32_t reserved;
+    std::int64_t minTime;
+    std::int64_t maxTime;
+};
+
+struct EventArchiveReader::TypeInfo {
+    const EventTypeEnum *type{};
+    const TypeSpec *spec{}; // nullptr if the schema of the archive differs from the current one.
+    std::vector<std::pair<std::string_view, Kind>> columns{};
+    std::size_t blocksBegin{};
+    std::size_t blocksEnd{};
+};
+
+struct EventArchiveReader::BlockRef {
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::uint32_t type;
+    std::uint32_t symbol;
+    std::uint32_t count;
+    std::uint32_t reserved;
+    std::int64_t minTime;
+    std::int64_t maxTime;
+};
+
+const EventArchiveBlock::Column *EventArchiveBlock::findColumn(std::string_view name) const noexcept {
+    const auto found = std::find_if(columns.begin(), columns.end(), [name](const Column &column) {
+        return column.name == name;
+    });
+
+    return found == columns.end() ? nullptr : &*found;
+}
+
+std::span<const std::int64_t> EventArchiveBlock::getInts(std::string_view name) const noexcept {
+    if (const auto column = findColumn(name); column != nullptr) {
+        return column->ints;
+    }
+
+    return {};
+}
+
+std::span<const double> EventArchiveBlock::getDoubles(std::string_view name) const noexcept {
+    if (const auto column = findColumn(name); column != nullptr) {
+        return column->doubles;
+    }
+
+    return {};
+}
+
+std::span<const std::string_view> EventArchiveBlock::getStrings(std::string_view name) const noexcept {
+    if (const auto column = findColumn(name); column != nullptr) {
+        return column->strings;
+    }
+
+    return {};
+}
+
+EventArchiveWriter::EventArchiveWriter(LockExternalConstructionTag, const std::string &path, bool append)
+    : path_(path), typeIds_(getTypeSpecs().size(), NO_TYPE) {
+    std::error_code error{};
+
+    if (append && std::filesystem::file_size(path_, error) > 0 && !error) {
+        std::uint64_t end{};
+
+        {
+            const MappedFile file(path_);
+            const auto data = file.data();
+            const auto header = file.size() >= sizeof(Header) ? load<Header>(data) : Header{};
+
+            if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+                header.byteOrderMark != BYTE_ORDER_MARK) {
+                throw RuntimeException(
+                    fmt::format("Unable to append to the file \"{}\": not an event archive of the current version",
+                                path_));
+            }
+
+            // The footer and the incomplete record at the end are overwritten.
+            const auto records = scanRecords(data, file.size());
+            const auto &specs = getTypeSpecs();
+
+            for (const auto payload : records.schemas) {
+                Cursor cursor{payload.data(), payload.data() + payload.size()};
+                const auto schema = Schema::read(cursor);
+
+                for (std::size_t t = 0; t < specs.size(); t++) {
+                    if (typeIds_[t] == NO_TYPE && schema.matches(specs[t])) {
+                        typeIds_[t] = static_cast<std::uint32_t>(schemas_.size());
+                    }
+                }
+
+                schemas_.emplace_back(payload);
+            }
+
+            for (const auto &block : records.blocks) {
+                auto symbolId = symbolIds_.find(block.symbol);
+
+                if (symbolId == symbolIds_.end()) {
+                    const auto id = static_cast<std::uint32_t>(symbols_.size());
+
+                    symbolId = symbolIds_.emplace(std::string(block.symbol), id).first;
+                    symbols_.emplace_back(block.symbol);
+                }
+
+                entries_.push_back({block.offset, block.size, block.type, symbolId->second, block.count, 0,
+                                    block.minTime, block.maxTime});
+                eventCount_ += block.count;
+            }
+
+            end = records.end;
+        }
+
+        std::filesystem::resize_file(path_, end, error);
+        out_.open(path_, std::ios::binary | std::ios::app);
+
+        if (error || !out_) {
+            throw RuntimeException(fmt::format("Unable to open the file \"{}\"", path_));
+        }
+
+        position_ = end;
+
+        return;
+    }
+
+    out_.open(path_, std::ios::binary | std::ios::trunc);
+
+    if (!out_) {
+        throw RuntimeException(fmt::format("Unable to create the file \"{}\"", path_));
+    }
+
+    Header header{};
+
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    writeBytes(&header, sizeof(Header));
+}
+
+EventArchiveWriter::~EventArchiveWriter() noexcept {
+    try {
+        close();
+    } catch (...) {
+        // The errors are reported by close().
+    }
+}
+
+EventArchiveWriter::Ptr EventArchiveWriter::create(const StringLike &path, bool append) {
+    return createShared(std::string(path), append);
+}
+
+bool EventArchiveWriter::isSupported(const EventTypeEnum &type) noexcept {
+    return findTypeSpec(type) != nullptr;
+}
+
+void EventArchiveWriter::writeBytes(const void *data, std::size_t size) {
+    out_.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+    position_ += size;
+
+    if (!out_) {
+        throw RuntimeException(fmt::format("Unable to write the file \"{}\"", path_));
+    }
+}
+
+void EventArchiveWriter::writeRecord(std::uint32_t kind, std::string_view payload) {
+    const RecordHeader header{RECORD_MAGIC, static_cast<RecordKind>(kind), payload.size(), Inflater::crc32(payload), 0};
+
+    writeBytes(&header, sizeof(RecordHeader));
+    writeBytes(payload.data(), payload.size());
+}
+
+std::uint32_t EventArchiveWriter::getTypeId(std::uint32_t type) {
+    if (typeIds_[type] == NO_TYPE) {
+        std::string schema{};
+
+        Schema::append(schema, getTypeSpecs()[type]);
+        writeRecord(static_cast<std::uint32_t>(RecordKind::SCHEMA), schema);
+        typeIds_[type] = static_cast<std::uint32_t>(schemas_.size());
+        schemas_.push_back(std::move(schema));
+    }
+
+    return typeIds_[type];
+}
+
+void EventArchiveWriter::append(const EventType &event) {
+    const auto &specs = getTypeSpecs();
+    const std::type_index typeIndex = typeid(event);
+    const auto spec = std::find_if(specs.begin(), specs.end(), [&typeIndex](const TypeSpec &s) {
+        return s.typeIndex == typeIndex;
+    });
+
+    if (spec == specs.end()) {
+        throw InvalidArgumentException(
+            fmt::format("The event archive doesn't support the events of type {}", typeIndex.name()));
+    }
+
+    const auto symbol = spec->getSymbol(event);
+    auto symbolId = symbolIds_.find(symbol);
+
+    if (symbolId == symbolIds_.end()) {
+        symbolId = symbolIds_.emplace(std::string(symbol), static_cast<std::uint32_t>(symbols_.size())).first;
+        symbols_.emplace_back(symbol);
+    }
+
+    const auto type = static_cast<std::uint32_t>(spec - specs.begin());
+    const auto key = (static_cast<std::uint64_t>(type) << 32) | symbolId->second;
+    auto &block = pendingByKey_[key];
+
+    if (block == nullptr) {
+        pending_.push_back(std::make_unique<PendingBlock>());
+        block = pending_.back().get();
+        block->spec = &*spec;
+        block->type = type;
+        block->symbol = symbolId->second;
+        block->columns.resize(spec->columns.size());
+    }
+
+    const auto time = spec->getTime(event);
+
+    block->minTime = block->size == 0 ? time : std::min(block->minTime, time);
+    block->maxTime = block->size == 0 ? time : std::max(block->maxTime, time);
+    block->times.addInt(time);
+
+    for (std::size_t c = 0; c < spec->columns.size(); c++) {
+        const auto &column = spec->columns[c];
+        auto &pending = block->columns[c];
+
+        switch (column.kind) {
+        case Kind::INT:
+            pending.addInt(column.getInt(event));
+            break;
+        case Kind::DOUBLE:
+            pending.doubles.push_back(column.getDouble(event));
+            break;
+        case Kind::STRING:
+            appendString(pending.data, column.getString(event));
+            break;
+        }
+    }
+
+    block->size++;
+    bufferedEvents_++;
+    eventCount_++;
+
+    if (block->size >= BLOCK_SIZE) {
+        writeBlock(*block);
+    }
+
+    if (bufferedEvents_ >= MAX_BUFFERED_EVENTS) {
+        writePending();
+    }
+}
+
+void EventArchiveWriter::writeBlock(PendingBlock &block) {
+    if (block.size == 0) {
+        return;
+    }
+
+    const auto type = getTypeId(block.type);
+
+    scratch_.clear();
+    appendVarint(scratch_, type);
+    appendString(scratch_, symbols_[block.symbol]);
+    appendVarint(scratch_, block.size);
+    appendVarint(scratch_, zigzag(static_cast<std::uint64_t>(block.minTime)));
+    appendVarint(scratch_, zigzag(static_cast<std::uint64_t>(block.maxTime)));
+
+    const auto columnsOffset = scratch_.size();
+
+    appendString(scratch_, block.times.data);
+
+    std::string doubles{};
+
+    for (std::size_t c = 0; c < block.columns.size(); c++) {
+        auto &column = block.columns[c];
+
+        if (block.spec->columns[c].kind == Kind::DOUBLE) {
+            doubles.clear();
+            encodeDoubles(doubles, column.doubles);
+            appendString(scratch_, doubles);
+        } else {
+            appendString(scratch_, column.data);
+        }
+
+        column.clear();
+    }
+
+    entries_.push_back({position_ + sizeof(RecordHeader) + columnsOffset, scratch_.size() - columnsOffset, type,
+                        block.symbol, static_cast<std::uint32_t>(block.size), 0, block.minTime, block.maxTime});
+    writeRecord(static_cast<std::uint32_t>(RecordKind::BLOCK), scratch_);
+    bufferedEvents_ -= block.size;
+    block.size = 0;
+    block.times.clear();
+}
+
+void EventArchiveWriter::writePending() {
+    for (const auto &block : pending_) {
+        writeBlock(*block);
+    }
+}
+
+void EventArchiveWriter::write(const std::shared_ptr<EventType> &event) {
+    if (!event) {
+        return;
+    }
+
+    std::lock_guard lock(mtx_);
+
+    if (closed_) {
+        throw RuntimeException("The EventArchiveWriter is closed");
+    }
+
+    append(*event);
+}
+
+void EventArchiveWriter::write(const std::vector<std::shared_ptr<EventType>> &events) {
+    std::lock_guard lock(mtx_);
+
+    if (closed_) {
+        throw RuntimeException("The EventArchiveWriter is closed");
+    }
+
+    for (const auto &event : events) {
+        if (event) {
+            append(*event);
+        }
+    }
+}
+
+void EventArchiveWriter::flush() {
+    std::lock_guard lock(mtx_);
+
+    if (closed_) {
+        return;
+    }
+
+    writePending();
+    out_.flush();
+}
+
+void EventArchiveWriter::close() {
+    std::lock_guard lock(mtx_);
+
+    if (closed_) {
+        return;
+    }
+
+    static_assert(sizeof(BlockEntry) == 48);
+
+    closed_ = true;
+    writePending();
+
+    // The footer is the index of the blocks, so the reader doesn't scan the records of the closed archive.
+    const auto footerOffset = position_ + sizeof(RecordHeader);
+    std::string footer{};
+
+    appendVarint(footer, schemas_.size());
+
+    for (const auto &schema : schemas_) {
+        footer.append(schema);
+    }
+
+    appendVarint(footer, symbols_.size());
+
+    for (const auto &symbol : symbols_) {
+        appendString(footer, symbol);
+    }
+
+    footer.resize(footer.size() + (8 - (footerOffset + footer.size()) % 8) % 8);
+
+    const auto entriesOffset = footerOffset + footer.size();
+
+    std::sort(entries_.begin(), entries_.end(), [](const BlockEntry &a, const BlockEntry &b) {
+        return std::tie(a.type, a.symbol, a.minTime, a.offset) < std::tie(b.type, b.symbol, b.minTime, b.offset);
+    });
+    footer.append(reinterpret_cast<const char *>(entries_.data()), entries_.size() * sizeof(BlockEntry));
+    writeRecord(static_cast<std::uint32_t>(RecordKind::FOOTER), footer);
+
+    Trailer trailer{footerOffset, entriesOffset, entries_.size(), eventCount_, VERSION, BYTE_ORDER_MARK, {}};
+
+    std::memcpy(trailer.magic, MAGIC, sizeof(MAGIC));
+    writeBytes(&trailer, sizeof(Trailer));
+    out_.close();
+
+    if (!out_) {
+        throw RuntimeException(fmt::format("Unable to write the file \"{}\"", path_));
+    }
+
+    pending_.clear();
+    pendingByKey_.clear();
+}
+
+std::uint64_t EventArchiveWriter::getEventCount() const noexcept {
+    std::lock_guard lock(mtx_);
+
+    return eventCount_;
+}
+
+EventArchiveReader::EventArchiveReader(LockExternalConstructionTag, MappedFile &&file, std::string_view path)
+    : file_{std::move(file)} {
+    static_assert(sizeof(BlockRef) == 48);
+
+    const auto fail = [path](std::string_view reason) {
+        return RuntimeException(fmt::format("Invalid event archive \"{}\": {}", path, reason));
+    };
+
+    const auto data = file_.data();
+    const std::uint64_t fileSize = file_.size();
+
+    if (fileSize < sizeof(Header)) {
+        throw fail("the file is too small");
+    }
+
+    const auto header = load<Header>(data);
+
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw fail("not an event archive");
+    }
+
+    if (header.version != EventArchiveWriter::VERSION) {
+        throw fail(fmt::format("unsupported version {}", header.version));
+    }
+
+    if (header.byteOrderMark != BYTE_ORDER_MARK) {
+        throw fail("the byte order of the platform is different");
+    }
+
+    const auto addType = [this](const Schema &schema) {
+        TypeInfo info{nullptr, nullptr, schema.columns};
+
+        for (const auto &type : EventTypeEnum::ALL) {
+            if (type.get().getClassName() == schema.name) {
+                info.type = &type.get();
+            }
+        }
+
+        if (info.type != nullptr) {
+            if (const auto spec = findTypeSpec(*info.type); spec != nullptr && schema.matches(*spec)) {
+                info.spec = spec;
+            }
+        }
+
+        types_.push_back(std::move(info));
+    };
+
+    const auto trailer = fileSize >= sizeof(Header) + sizeof(Trailer)
+                             ? load<Trailer>(data + fileSize - sizeof(Trailer))
+                             : Trailer{};
+
+    if (std::memcmp(trailer.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        // The archive was not closed: the index is restored by the scan of the records.
+        const auto records = scanRecords(data, fileSize);
+
+        try {
+            for (const auto payload : records.schemas) {
+                Cursor cursor{payload.data(), payload.data() + payload.size()};
+
+                addType(Schema::read(cursor));
+            }
+        } catch (const RuntimeException &) {
+            throw fail("the schema is corrupted");
+        }
+
+        for (const auto &block : records.blocks) {
+            const auto [symbolId, inserted] =
+                symbolIds_.emplace(block.symbol, static_cast<std::uint32_t>(symbols_.size()));
+
+            if (inserted) {
+                symbols_.push_back(block.symbol);
+            }
+
+            blocks_.push_back({block.offset, block.size, block.type, symbolId->second, block.count, 0, block.minTime,
+                               block.maxTime});
+            eventCount_ += block.count;
+        }
+
+        std::sort(blocks_.begin(), blocks_.end(), [](const BlockRef &a, const BlockRef &b) {
+            return std::tie(a.type, a.symbol, a.minTime, a.offset) < std::tie(b.type, b.symbol, b.minTime, b.offset);
+        });
+    } else {
+        if (trailer.version != EventArchiveWriter::VERSION) {
+            throw fail(fmt::format("unsupported version {}", trailer.version));
+        }
+
+        if (trailer.byteOrderMark != BYTE_ORDER_MARK) {
+            throw fail("the byte order of the platform is different");
+        }
+
+        const auto entriesEnd = fileSize - sizeof(Trailer);
+
+        if (trailer.footerOffset < sizeof(Header) + sizeof(RecordHeader) ||
+            trailer.footerOffset > trailer.entriesOffset || trailer.entriesOffset > entriesEnd ||
+            (entriesEnd - trailer.entriesOffset) % sizeof(BlockRef) != 0 ||
+            trailer.entryCount != (entriesEnd - trailer.entriesOffset) / sizeof(BlockRef)) {
+            throw fail("the footer is corrupted");
+        }
+
+        try {
+            Cursor footer{data + trailer.footerOffset, data + trailer.entriesOffset};
+            const auto typeCount = footer.readVarint();
+
+            for (std::uint64_t t = 0; t < typeCount; t++) {
+                addType(Schema::read(footer));
+            }
+
+            const auto symbolCount = footer.readVarint();
+
+            for (std::uint64_t s = 0; s < symbolCount; s++) {
+                const auto symbol = footer.readString();
+
+                symbolIds_.emplace(symbol, static_cast<std::uint32_t>(symbols_.size()));
+                symbols_.push_back(symbol);
+            }
+        } catch (const RuntimeException &) {
+            throw fail("the footer is corrupted");
+        }
+
+        blocks_.resize(trailer.entryCount);
+
+        if (!blocks_.empty()) {
+            std::memcpy(blocks_.data(), data + trailer.entriesOffset, blocks_.size() * sizeof(BlockRef));
+        }
+
+        for (const auto &block : blocks_) {
+            if (block.offset < sizeof(Header) || block.offset > trailer.footerOffset ||
+                block.size > trailer.footerOffset - block.offset || block.type >= types_.size() ||
+                block.symbol >= symbols_.size()) {
+                throw fail("the index is corrupted");
+            }
+        }
+
+        if (!std::is_sorted(blocks_.begin(), blocks_.end(), [](const BlockRef &a, const BlockRef &b) {
+                return std::tie(a.type, a.symbol, a.minTime) < std::tie(b.type, b.symbol, b.minTime);
+            })) {
+            throw fail("the index is not sorted");
+        }
+
+        eventCount_ = trailer.eventCount;
+    }
+
+    for (std::size_t i = 0; i < blocks_.size();) {
+        const auto type = blocks_[i].type;
+        auto &info = types_[type];
+
+        info.blocksBegin = i;
+
+        while (i < blocks_.size() && blocks_[i].type == type) {
+            i++;
+        }
+
+        info.blocksEnd = i;
+    }
+
+    maxTimes_.resize(blocks_.size());
+
+    for (std::size_t i = 0; i < blocks_.size(); i++) {
+        const auto &block = blocks_[i];
+        const auto isFirst = i == 0 || blocks_[i - 1].type != block.type || blocks_[i - 1].symbol != block.symbol;
+
+        maxTimes_[i] = isFirst ? block.maxTime : std::max(maxTimes_[i - 1], block.maxTime);
+    }
+}
+
+EventArchiveReader::~EventArchiveReader() noexcept = default;
+
+EventArchiveReader::Ptr EventArchiveReader::open(const StringLike &path) {
+    const std::string pathString = path;
+
+    return createShared(MappedFile(pathString), pathString);
+}
+
+std::uint64_t EventArchiveReader::getEventCount() const noexcept {
+    return eventCount_;
+}
+
+std::vector<std::reference_wrapper<const EventTypeEnum>> EventArchiveReader::getEventTypes() const {
+    std::vector<std::reference_wrapper<const EventTypeEnum>> result{};
+
+    for (const auto &type : types_) {
+        if (type.type != nullptr && type.blocksBegin != type.blocksEnd) {
+            result.emplace_back(*type.type);
+        }
+    }
+
+    return result;
+}
+
+const std::vector<std::string_view> &EventArchiveReader::getSymbols() const noexcept {
+    return symbols_;
+}
+
+std::vector<std::string_view> EventArchiveReader::getColumnNames(const EventTypeEnum &type) const {
+    std::vector<std::string_view> result{};
+
+    if (const auto info = findType(type); info != nullptr) {
+        for (const auto &[name, kind] : info->columns) {
+            result.push_back(name);
+        }
+    }
+
+    return result;
+}
+
+const EventArchiveReader::TypeInfo *EventArchiveReader::findType(const EventTypeEnum &type) const noexcept {
+    // The types without blocks are skipped, so the type with blocks is found if there are duplicates.
+    for (const auto &info : types_) {
+        if (info.type == &type && info.blocksBegin != info.blocksEnd) {
+            return &info;
+        }
+    }
+
+    return nullptr;
+}
+
+std::span<const EventArchiveReader::BlockRef>
+EventArchiveReader::findBlocks(std::span<const BlockRef> blocks, std::int64_t fromTime,
+                               std::int64_t toTime) const noexcept {
+    // The blocks of one type and symbol: the tail starts with the first block that starts after the range, and the
+    // head ends with the first block whose running maximal time reaches the range.
+    const auto end = std::lower_bound(blocks.begin(), blocks.end(), toTime, [](const BlockRef &block, auto time) {
+        return block.minTime < time;
+    });
+    const auto begin = std::lower_bound(blocks.begin(), end, fromTime, [this](const BlockRef &block, auto time) {
+        return maxTimes_[static_cast<std::size_t>(&block - blocks_.data())] < time;
+    });
+
+    return {begin, end};
+}
+
+std::vector<std::span<const EventArchiveReader::BlockRef>>
+EventArchiveReader::findBlocks(const TypeInfo &type, std::optional<std::string_view> symbol, std::int64_t fromTime,
+                               std::int64_t toTime) const {
+    const std::span<const BlockRef> blocks(blocks_.data() + type.blocksBegin, type.blocksEnd - type.blocksBegin);
+    std::vector<std::span<const BlockRef>> result{};
+
+    if (symbol) {
+        const auto found = symbolIds_.find(*symbol);
+
+        if (found == symbolIds_.end()) {
+            return result;
+        }
+
+        const auto symbolId = found->second;
+        const auto begin = std::lower_bound(blocks.begin(), blocks.end(), symbolId, [](const BlockRef &block, auto id) {
+            return block.symbol < id;
+        });
+        const auto end = std::upper_bound(begin, blocks.end(), symbolId, [](auto id, const BlockRef &block) {
+            return id < block.symbol;
+        });
+
+        result.push_back(findBlocks({begin, end}, fromTime, toTime));
+
+        return result;
+    }
+
+    for (auto begin = blocks.begin(); begin != blocks.end();) {
+        const auto end = std::upper_bound(begin, blocks.end(), begin->symbol, [](auto id, const BlockRef &block) {
+            return id < block.symbol;
+        });
+
+        if (const auto found = findBlocks({begin, end}, fromTime, toTime); !found.empty()) {
+            result.push_back(found);
+        }
+
+        begin = end;
+    }
+
+    return result;
+}
+
+std::vector<EventArchiveReader::BlockInfo> EventArchiveReader::getBlocks(const EventTypeEnum &type,
+                                                                         std::optional<std::string_view> symbol,
+                                                                         std::int64_t fromTime,
+                                                                         std::int64_t toTime) const {
+    std::vector<BlockInfo> result{};
+    const auto info = findType(type);
+
+    if (info == nullptr) {
+        return result;
+    }
+
+    for (const auto &blocks : findBlocks(*info, symbol, fromTime, toTime)) {
+        for (const auto &block : blocks) {
+            if (block.maxTime >= fromTime) {
+                result.push_back({info->type, symbols_[block.symbol], block.count, block.minTime, block.maxTime});
+            }
+        }
+    }
+
+    return result;
+}
+
+EventArchiveBlock EventArchiveReader::decode(const BlockRef &block,
+                                             const std::vector<std::string_view> &columns) const {
+    const auto &info = types_[block.type];
+    EventArchiveBlock result{info.type, symbols_[block.symbol]};
+    Cursor cursor{file_.data() + block.offset, file_.data() + block.offset + block.size};
+
+    decodeInts(cursor.readColumn(), block.count, result.times);
+    result.columns.resize(info.columns.size());
+
+    for (std::size_t c = 0; c < info.columns.size(); c++) {
+        const auto [name, kind] = info.columns[c];
+        auto &column = result.columns[c];
+        const auto data = cursor.readColumn();
+
+        column.name = name;
+        column.kind = kind;
+
+        // The columns that are not requested are skipped without decoding.
+        if (!columns.empty() && std::find(columns.begin(), columns.end(), name) == columns.end()) {
+            continue;
+        }
+
+        switch (kind) {
+        case Kind::INT:
+            decodeInts(data, block.count, column.ints);
+            break;
+        case Kind::DOUBLE:
+            decodeDoubles(data, block.count, column.doubles);
+            break;
+        case Kind::STRING:
+            decodeStrings(data, block.count, column.strings);
+            break;
+        }
+
+        column.decoded = true;
+    }
+
+    return result;
+}
+
+void EventArchiveReader::scan(const EventTypeEnum &type, std::optional<std::string_view> symbol,
+                              std::int64_t fromTime, std::int64_t toTime, const std::vector<std::string_view> &columns,
+                              const std::function<void(const EventArchiveBlock &)> &consumer) const {
+    const auto info = findType(type);
+
+    if (info == nullptr || !consumer) {
+        return;
+    }
+
+    for (const auto &blocks : findBlocks(*info, symbol, fromTime, toTime)) {
+        for (const auto &block : blocks) {
+            if (block.maxTime >= fromTime) {
+                consumer(decode(block, columns));
+            }
+        }
+    }
+}
+
+std::vector<std::shared_ptr<EventType>> EventArchiveReader::read(const EventTypeEnum &type,
+                                                                 std::optional<std::string_view> symbol,
+                                                                 std::int64_t fromTime, std::int64_t toTime) const {
+    std::vector<std::shared_ptr<EventType>> result{};
+    const auto info = findType(type);
+
+    if (info == nullptr) {
+        return result;
+    }
+
+    if (info->spec == nullptr) {
+        throw RuntimeException(
+            fmt::format("The events of type {} were archived with another schema", type.getClassName()));
+    }
+
+    const auto &spec = *info->spec;
+
+    for (const auto &blocks : findBlocks(*info, symbol, fromTime, toTime)) {
+        for (const auto &ref : blocks) {
+            if (ref.maxTime < fromTime) {
+                continue;
+            }
+
+            const auto block = decode(ref, {});
+
+            for (std::size_t i = 0; i < block.size(); i++) {
+                if (block.times[i] < fromTime || block.times[i] >= toTime) {
+                    continue;
+                }
+
+                auto event = spec.create(block.symbol);
+
+                if (spec.setTime) {
+                    spec.setTime(*event, block.times[i]);
+                }
+
+                for (std::size_t c = 0; c < spec.columns.size(); c++) {
+                    const auto &column = spec.columns[c];
+
+                    switch (column.kind) {
+                    case Kind::INT:
+                        column.setInt(*event, block.columns[c].ints[i]);
+                        break;
+                    case Kind::DOUBLE:
+                        column.setDouble(*event, block.columns[c].doubles[i]);
+                        break;
+                    case Kind::STRING:
+                        column.setString(*event, block.columns[c].strings[i]);
+                        break;
+                    }
+                }
+
+                result.push_back(std::move(event));
+            }
+        }
+    }
+
+    return result;
+}
+
+DXFCPP_END_NAMESPACE
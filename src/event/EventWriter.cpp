@@ -0,0 +1,1019 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/event/EventWriter.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/event/EventType.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/EventTypeEnum.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/candle/Candle.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/AnalyticOrder.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/Direction.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/OptionSale.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/Order.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/OtcMarketsOrder.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/Profile.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/Quote.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/SpreadOrder.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/Summary.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/TimeAndSale.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/Trade.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/TradeETH.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/misc/Message.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/misc/TextMessage.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/option/Greeks.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/option/Series.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/option/TheoPrice.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/option/Underlying.hpp"
+#include "../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/exceptions/RuntimeException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/NativeTimeFormat.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <fmt/format.h>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+constexpr std::string_view BINARY_MAGIC = "DXEW";
+constexpr char BINARY_VERSION = 1;
+constexpr std::string_view UNKNOWN_TYPE_NAME = "Event";
+constexpr std::uint32_t UNKNOWN_TYPE_ID = 0xFFFFFFFFu;
+
+// The field values that are encoded differently from the plain numbers.
+struct Time {
+    std::int64_t value;
+};
+
+struct Char {
+    std::int16_t value;
+};
+
+// The element of an enum: the name is written by the text encoders, the code by the binary one.
+struct Code {
+    std::string_view name;
+    std::int64_t code;
+};
+
+Char charOf(char c) {
+    return {static_cast<std::int16_t>(static_cast<unsigned char>(c))};
+}
+
+template <typename E> Code codeOf(const E &e) {
+    return {e.getName(), static_cast<std::int64_t>(e.getCode())};
+}
+
+void appendInt(std::string &out, std::int64_t value) {
+    std::array<char, 24> chars{};
+    const auto result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+
+    out.append(chars.data(), result.ptr);
+}
+
+// Appends the shortest representation of the finite value.
+void appendFiniteDouble(std::string &out, double value) {
+    std::array<char, 32> chars{};
+    const auto result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+
+    out.append(chars.data(), result.ptr);
+}
+
+void appendTime(std::string &out, std::int64_t time) {
+    std::array<char, NativeTimeFormat::MAX_LENGTH> chars{};
+
+    const auto &format = NativeTimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE;
+
+    if (const auto length = format.format(time, chars.data()); length > 0) {
+        out.append(chars.data(), length);
+    } else {
+        out.append(format.format(time));
+    }
+}
+
+void appendChar(std::string &out, std::int16_t c) {
+    if (c == 0) {
+        return;
+    }
+
+    if (c > 0 && c < 0x80) {
+        out.push_back(static_cast<char>(c));
+    } else {
+        out.append(utf16toUtf8String(c));
+    }
+}
+
+void appendCsvString(std::string &out, std::string_view s) {
+    if (s.find_first_of(",\"\r\n") == std::string_view::npos) {
+        out.append(s);
+
+        return;
+    }
+
+    out.push_back('"');
+
+    for (auto c : s) {
+        if (c == '"') {
+            out.push_back('"');
+        }
+
+        out.push_back(c);
+    }
+
+    out.push_back('"');
+}
+
+void appendJsonString(std::string &out, std::string_view s) {
+    static constexpr std::string_view HEX = "0123456789abcdef";
+
+    out.push_back('"');
+
+    for (auto c : s) {
+        switch (c) {
+        case '"':
+            out.append("\\\"");
+            break;
+        case '\\':
+            out.append("\\\\");
+            break;
+        case '\n':
+            out.append("\\n");
+            break;
+        case '\r':
+            out.append("\\r");
+            break;
+        case '\t':
+            out.append("\\t");
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out.append("\\u00");
+                out.push_back(HEX[(c >> 4) & 0xF]);
+                out.push_back(HEX[c & 0xF]);
+            } else {
+                out.push_back(c);
+            }
+        }
+    }
+
+    out.push_back('"');
+}
+
+void appendVarint(std::string &out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    out.push_back(static_cast<char>(value));
+}
+
+void appendZigzag(std::string &out, std::int64_t value) {
+    appendVarint(out, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+}
+
+// The encoders. Each one receives the begin() of the event, the field() calls in the order of the fields and the end().
+
+struct HeaderEncoder {
+    std::string *out;
+
+    void begin(std::string_view typeName, std::uint32_t, std::string_view, std::int64_t) {
+        out->push_back('#');
+        out->append(typeName);
+        out->append(",eventSymbol,eventTime");
+    }
+
+    template <typename T> void field(std::string_view name, const T &) {
+        out->push_back(',');
+        out->append(name);
+    }
+
+    void end() {
+        out->push_back('\n');
+    }
+};
+
+struct CsvEncoder {
+    std::string *out;
+
+    void begin(std::string_view typeName, std::uint32_t, std::string_view symbol, std::int64_t eventTime) {
+        out->append(typeName);
+        out->push_back(',');
+        appendCsvString(*out, symbol);
+        out->push_back(',');
+        appendTime(*out, eventTime);
+    }
+
+    template <typename T> void field(std::string_view, const T &value) {
+        out->push_back(',');
+
+        if constexpr (std::is_same_v<T, bool>) {
+            out->append(value ? "true" : "false");
+        } else if constexpr (std::is_integral_v<T>) {
+            appendInt(*out, value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(value)) {
+                out->append("NaN");
+            } else if (std::isinf(value)) {
+                out->append(value > 0 ? "Infinity" : "-Infinity");
+            } else {
+                appendFiniteDouble(*out, value);
+            }
+        } else if constexpr (std::is_same_v<T, Time>) {
+            appendTime(*out, value.value);
+        } else if constexpr (std::is_same_v<T, Char>) {
+            appendChar(*out, value.value);
+        } else if constexpr (std::is_same_v<T, Code>) {
+            out->append(value.name);
+        } else {
+            appendCsvString(*out, value);
+        }
+    }
+
+    void end() {
+        out->push_back('\n');
+    }
+};
+
+struct JsonEncoder {
+    std::string *out;
+
+    void begin(std::string_view typeName, std::uint32_t, std::string_view symbol, std::int64_t eventTime) {
+        out->append(R"({"type":")");
+        out->append(typeName);
+        out->append(R"(","eventSymbol":)");
+        appendJsonString(*out, symbol);
+        out->append(R"(,"eventTime":")");
+        appendTime(*out, eventTime);
+        out->push_back('"');
+    }
+
+    template <typename T> void field(std::string_view name, const T &value) {
+        out->append(",\"");
+        out->append(name);
+        out->append("\":");
+
+        if constexpr (std::is_same_v<T, bool>) {
+            out->append(value ? "true" : "false");
+        } else if constexpr (std::is_integral_v<T>) {
+            appendInt(*out, value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if (std::isfinite(value)) {
+                appendFiniteDouble(*out, value);
+            } else {
+                out->append("null");
+            }
+        } else if constexpr (std::is_same_v<T, Time>) {
+            out->push_back('"');
+            appendTime(*out, value.value);
+            out->push_back('"');
+        } else if constexpr (std::is_same_v<T, Char>) {
+            std::string chars{};
+
+            appendChar(chars, value.value);
+            appendJsonString(*out, chars);
+        } else if constexpr (std::is_same_v<T, Code>) {
+            appendJsonString(*out, value.name);
+        } else {
+            appendJsonString(*out, value);
+        }
+    }
+
+    void end() {
+        out->append("}\n");
+    }
+};
+
+struct BinaryEncoder {
+    std::string *out;
+    std::string *body;
+    std::unordered_map<std::string, std::uint64_t, StringHash, std::equal_to<>> *symbols;
+    std::uint32_t typeId{};
+
+    void begin(std::string_view, std::uint32_t id, std::string_view symbol, std::int64_t eventTime) {
+        typeId = id;
+        body->clear();
+
+        if (auto found = symbols->find(symbol); found != symbols->end()) {
+            appendVarint(*body, found->second);
+        } else {
+            symbols->emplace(std::string(symbol), symbols->size() + 1);
+            appendVarint(*body, 0);
+            appendVarint(*body, symbol.size());
+            body->append(symbol);
+        }
+
+        appendZigzag(*body, eventTime);
+    }
+
+    template <typename T> void field(std::string_view, const T &value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            body->push_back(value ? 1 : 0);
+        } else if constexpr (std::is_integral_v<T>) {
+            appendZigzag(*body, static_cast<std::int64_t>(value));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            auto bits = std::bit_cast<std::uint64_t>(static_cast<double>(value));
+
+            for (int i = 0; i < 8; i++, bits >>= 8) {
+                body->push_back(static_cast<char>(bits & 0xFF));
+            }
+        } else if constexpr (std::is_same_v<T, Time>) {
+            appendZigzag(*body, value.value);
+        } else if constexpr (std::is_same_v<T, Char>) {
+            appendVarint(*body, static_cast<std::uint16_t>(value.value));
+        } else if constexpr (std::is_same_v<T, Code>) {
+            appendZigzag(*body, value.code);
+        } else {
+            const std::string_view s = value;
+
+            appendVarint(*body, s.size());
+            body->append(s);
+        }
+    }
+
+    void end() {
+        appendVarint(*out, typeId);
+        appendVarint(*out, body->size());
+        out->append(*body);
+    }
+};
+
+// The fields of the event types.
+
+template <typename V> void visitFields(const Quote &e, V &v) {
+    v.field("time", Time{e.getTime()});
+    v.field("timeNanoPart", e.getTimeNanoPart());
+    v.field("sequence", e.getSequence());
+    v.field("bidTime", Time{e.getBidTime()});
+    v.field("bidExchange", Char{e.getBidExchangeCode()});
+    v.field("bidPrice", e.getBidPrice());
+    v.field("bidSize", e.getBidSize());
+    v.field("askTime", Time{e.getAskTime()});
+    v.field("askExchange", Char{e.getAskExchangeCode()});
+    v.field("askPrice", e.getAskPrice());
+    v.field("askSize", e.getAskSize());
+}
+
+template <typename V> void visitFields(const TradeBase &e, V &v) {
+    v.field("time", Time{e.getTime()});
+    v.field("timeNanoPart", e.getTimeNanoPart());
+    v.field("sequence", e.getSequence());
+    v.field("exchange", Char{e.getExchangeCode()});
+    v.field("price", e.getPrice());
+    v.field("size", e.getSize());
+    v.field("dayId", e.getDayId());
+    v.field("dayVolume", e.getDayVolume());
+    v.field("dayTurnover", e.getDayTurnover());
+    v.field("tickDirection", codeOf(e.getTickDirection()));
+    v.field("extendedTradingHours", e.isExtendedTradingHours());
+    v.field("change", e.getChange());
+}
+
+template <typename V> void visitFields(const TimeAndSale &e, V &v) {
+    v.field("eventFlags", e.getEventFlags());
+    v.field("index", e.getIndex());
+    v.field("time", Time{e.getTime()});
+    v.field("timeNanoPart", e.getTimeNanoPart());
+    v.field("sequence", e.getSequence());
+    v.field("exchange", Char{e.getExchangeCode()});
+    v.field("price", e.getPrice());
+    v.field("size", e.getSize());
+    v.field("bidPrice", e.getBidPrice());
+    v.field("askPrice", e.getAskPrice());
+    v.field("exchangeSaleConditions", std::string_view(e.getExchangeSaleConditions()));
+    v.field("tradeThroughExempt", charOf(e.getTradeThroughExempt()));
+    v.field("aggressorSide", codeOf(e.getAggressorSide()));
+    v.field("spreadLeg", e.isSpreadLeg());
+    v.field("extendedTradingHours", e.isExtendedTradingHours());
+    v.field("validTick", e.isValidTick());
+    v.field("type", codeOf(e.getType()));
+    v.field("buyer", std::string_view(e.getBuyer()));
+    v.field("seller", std::string_view(e.getSeller()));
+}
+
+template <typename V> void visitFields(const Summary &e, V &v) {
+    v.field("dayId", e.getDayId());
+    v.field("dayOpenPrice", e.getDayOpenPrice());
+    v.field("dayHighPrice", e.getDayHighPrice());
+    v.field("dayLowPrice", e.getDayLowPrice());
+    v.field("dayClosePrice", e.getDayClosePrice());
+    v.field("dayClosePriceType", codeOf(e.getDayClosePriceType()));
+    v.field("prevDayId", e.getPrevDayId());
+    v.field("prevDayClosePrice", e.getPrevDayClosePrice());
+    v.field("prevDayClosePriceType", codeOf(e.getPrevDayClosePriceType()));
+    v.field("prevDayVolume", e.getPrevDayVolume());
+    v.field("openInterest", e.getOpenInterest());
+}
+
+template <typename V> void visitFields(const Profile &e, V &v) {
+    v.field("description", std::string_view(e.getDescription()));
+    v.field("shortSaleRestriction", codeOf(e.getShortSaleRestriction()));
+    v.field("tradingStatus", codeOf(e.getTradingStatus()));
+    v.field("statusReason", std::string_view(e.getStatusReason()));
+    v.field("haltStartTime", Time{e.getHaltStartTime()});
+    v.field("haltEndTime", Time{e.getHaltEndTime()});
+    v.field("highLimitPrice", e.getHighLimitPrice());
+    v.field("lowLimitPrice", e.getLowLimitPrice());
+    v.field("beta", e.getBeta());
+    v.field("earningsPerShare", e.getEarningsPerShare());
+    v.field("dividendFrequency", e.getDividendFrequency());
+    v.field("exDividendAmount", e.getExDividendAmount());
+    v.field("exDividendDayId", e.getExDividendDayId());
+    v.field("shares", e.getShares());
+    v.field("freeFloat", e.getFreeFloat());
+}
+
+template <typename V> void visitFields(const Greeks &e, V &v) {
+    v.field("eventFlags", e.getEventFlags());
+    v.field("index", e.getIndex());
+    v.field("time", Time{e.getTime()});
+    v.field("sequence", e.getSequence());
+    v.field("price", e.getPrice());
+    v.field("volatility", e.getVolatility());
+    v.field("delta", e.getDelta());
+    v.field("gamma", e.getGamma());
+    v.field("theta", e.getTheta());
+    v.field("rho", e.getRho());
+    v.field("vega", e.getVega());
+}
+
+template <typename V> void visitFields(const TheoPrice &e, V &v) {
+    v.field("eventFlags", e.getEventFlags());
+    v.field("index", e.getIndex());
+    v.field("time", Time{e.getTime()});
+    v.field("sequence", e.getSequence());
+    v.field("price", e.getPrice());
+    v.field("underlyingPrice", e.getUnderlyingPrice());
+    v.field("delta", e.getDelta());
+    v.field("gamma", e.getGamma());
+    v.field("dividend", e.getDividend());
+    v.field("interest", e.getInterest());
+}
+
+template <typename V> void visitFields(const Underlying &e, V &v) {
+    v.field("eventFlags", e.getEventFlags());
+    v.field("index", e.getIndex());
+    v.field("time", Time{e.getTime()});
+    v.field("sequence", e.getSequence());
+    v.field("volatility", e.getVolatility());
+    v.field("frontVolatility", e.getFrontVolatility());
+    v.field("backVolatility", e.getBackVolatility());
+    v.field("callVolume", e.getCallVolume());
+    v.field("putVolume", e.getPutVolume());
+    v.field("optionVolume", e.getOptionVolume());
+    v.field("putCallRatio", e.getPutCallRatio());
+}
+
+template <typename V> void visitFields(const Series &e, V &v) {
+    v.field("eventFlags", e.getEventFlags());
+    v.field("index", e.getIndex());
+    v.field("time", Time{e.getTime()});
+    v.field("sequence", e.getSequence());
+    v.field("expiration", e.getExpiration());
+    v.field("volatility", e.getVolatility());
+    v.field("callVolume", e.getCallVolume());
+    v.field("putVolume", e.getPutVolume());
+    v.field("optionVolume", e.getOptionVolume());
+    v.field("putCallRatio", e.getPutCallRatio());
+    v.field("forwardPrice", e.getForwardPrice());
+    v.field("dividend", e.getDividend());
+    v.field("interest", e.getInterest());
+}
+
+template <typename V> void visitFields(const Candle &e, V &v) {
+    v.field("eventFlags", e.getEventFlags());
+    v.field("index", e.getIndex());
+    v.field("time", Time{e.getTime()});
+    v.field("sequence", e.getSequence());
+    v.field("count", e.getCount());
+    v.field("open", e.getOpen());
+    v.field("high", e.getHigh());
+    v.field("low", e.getLow());
+    v.field("close", e.getClose());
+    v.field("volume", e.getVolume());
+    v.field("vwap", e.getVWAP());
+    v.field("bidVolume", e.getBidVolume());
+    v.field("askVolume", e.getAskVolume());
+    v.field("impVolatility", e.getImpVolatility());
+    v.field("openInterest", e.getOpenInterest());
+}
+
+template <typename V> void visitFields(const OrderBase &e, V &v) {
+    v.field("source", Code{e.getSource().name(), e.getSource().id()});
+    v.field("eventFlags", e.getEventFlags());
+    v.field("index", e.getIndex());
+    v.field("time", Time{e.getTime()});
+    v.field("timeNanoPart", e.getTimeNanoPart());
+    v.field("sequence", e.getSequence());
+    v.field("action", codeOf(e.getAction()));
+    v.field("actionTime", Time{e.getActionTime()});
+    v.field("orderId", e.getOrderId());
+    v.field("auxOrderId", e.getAuxOrderId());
+    v.field("price", e.getPrice());
+    v.field("size", e.getSize());
+    v.field("executedSize", e.getExecutedSize());
+    v.field("count", e.getCount());
+    v.field("exchange", Char{e.getExchangeCode()});
+    v.field("side", codeOf(e.getOrderSide()));
+    v.field("scope", codeOf(e.getScope()));
+    v.field("tradeId", e.getTradeId());
+    v.field("tradePrice", e.getTradePrice());
+    v.field("tradeSize", e.getTradeSize());
+}
+
+template <typename V> void visitFields(const Order &e, V &v) {
+    visitFields(static_cast<const OrderBase &>(e), v);
+    v.field("marketMaker", std::string_view(e.getMarketMaker()));
+}
+
+template <typename V> void visitFields(const AnalyticOrder &e, V &v) {
+    visitFields(static_cast<const Order &>(e), v);
+    v.field("icebergPeakSize", e.getIcebergPeakSize());
+    v.field("icebergHiddenSize", e.getIcebergHiddenSize());
+    v.field("icebergExecutedSize", e.getIcebergExecutedSize());
+    v.field("icebergType", codeOf(e.getIcebergType()));
+}
+
+template <typename V> void visitFields(const OtcMarketsOrder &e, V &v) {
+    visitFields(static_cast<const Order &>(e), v);
+    v.field("quoteAccessPayment", e.getQuoteAccessPayment());
+    v.field("open", e.isOpen());
+    v.field("unsolicited", e.isUnsolicited());
+    v.field("otcMarketsPriceType", codeOf(e.getOtcMarketsPriceType()));
+    v.field("saturated", e.isSaturated());
+    v.field("autoExecution", e.isAutoExecution());
+    v.field("nmsConditional", e.isNmsConditional());
+}
+
+template <typename V> void visitFields(const SpreadOrder &e, V &v) {
+    visitFields(static_cast<const OrderBase &>(e), v);
+    v.field("spreadSymbol", std::string_view(e.getSpreadSymbol()));
+}
+
+template <typename V> void visitFields(const OptionSale &e, V &v) {
+    v.field("eventFlags", e.getEventFlags());
+    v.field("index", e.getIndex());
+    v.field("time", Time{e.getTime()});
+    v.field("timeNanoPart", e.getTimeNanoPart());
+    v.field("sequence", e.getSequence());
+    v.field("exchange", Char{e.getExchangeCode()});
+    v.field("price", e.getPrice());
+    v.field("size", e.getSize());
+    v.field("bidPrice", e.getBidPrice());
+    v.field("askPrice", e.getAskPrice());
+    v.field("exchangeSaleConditions", std::string_view(e.getExchangeSaleConditions()));
+    v.field("tradeThroughExempt", charOf(e.getTradeThroughExempt()));
+    v.field("aggressorSide", codeOf(e.getAggressorSide()));
+    v.field("spreadLeg", e.isSpreadLeg());
+    v.field("extendedTradingHours", e.isExtendedTradingHours());
+    v.field("validTick", e.isValidTick());
+    v.field("type", codeOf(e.getType()));
+    v.field("underlyingPrice", e.getUnderlyingPrice());
+    v.field("volatility", e.getVolatility());
+    v.field("delta", e.getDelta());
+    v.field("optionSymbol", std::string_view(e.getOptionSymbol()));
+}
+
+template <typename V> void visitFields(const Message &e, V &v) {
+    v.field("attachment", std::string_view(e.getAttachment()));
+}
+
+template <typename V> void visitFields(const TextMessage &e, V &v) {
+    v.field("time", Time{e.getTime()});
+    v.field("sequence", e.getSequence());
+    v.field("text", std::string_view(e.getText()));
+}
+
+template <typename E> std::string_view getSymbol(const E &e) {
+    if constexpr (std::is_same_v<E, Candle>) {
+        return e.getEventSymbol().toString();
+    } else {
+        return e.getEventSymbol();
+    }
+}
+
+template <typename E, typename V> void encodeAs(const EventType &event, V &v) {
+    const auto &e = static_cast<const E &>(event);
+
+    v.begin(E::TYPE.getClassName(), E::TYPE.getId(), getSymbol(e), e.getEventTime());
+    visitFields(e, v);
+    v.end();
+}
+
+template <typename V> void encodeUnknown(const EventType &event, V &v) {
+    v.begin(UNKNOWN_TYPE_NAME, UNKNOWN_TYPE_ID, "", event.getEventTime());
+    v.field("text", event.toString());
+    v.end();
+}
+
+// The encoders of an event type.
+struct TypeEncoding {
+    void (*header)(const EventType &, HeaderEncoder &);
+    void (*csv)(const EventType &, CsvEncoder &);
+    void (*json)(const EventType &, JsonEncoder &);
+    void (*binary)(const EventType &, BinaryEncoder &);
+
+    template <typename E> static std::pair<std::type_index, TypeEncoding> of() {
+        return {typeid(E), {&encodeAs<E, HeaderEncoder>, &encodeAs<E, CsvEncoder>, &encodeAs<E, JsonEncoder>,
+                            &encodeAs<E, BinaryEncoder>}};
+    }
+};
+
+const TypeEncoding UNKNOWN_ENCODING{&encodeUnknown<HeaderEncoder>, &encodeUnknown<CsvEncoder>,
+                                    &encodeUnknown<JsonEncoder>, &encodeUnknown<BinaryEncoder>};
+
+const TypeEncoding &getEncoding(const std::type_index &type) {
+    static const std::unordered_map<std::type_index, TypeEncoding> ENCODINGS{
+        TypeEncoding::of<Quote>(),         TypeEncoding::of<Trade>(),         TypeEncoding::of<TradeETH>(),
+        TypeEncoding::of<TimeAndSale>(),   TypeEncoding::of<Summary>(),       TypeEncoding::of<Profile>(),
+        TypeEncoding::of<Greeks>(),        TypeEncoding::of<TheoPrice>(),     TypeEncoding::of<Underlying>(),
+        TypeEncoding::of<Series>(),        TypeEncoding::of<Candle>(),        TypeEncoding::of<Order>(),
+        TypeEncoding::of<AnalyticOrder>(), TypeEncoding::of<OtcMarketsOrder>(), TypeEncoding::of<SpreadOrder>(),
+        TypeEncoding::of<OptionSale>(),    TypeEncoding::of<Message>(),       TypeEncoding::of<TextMessage>(),
+    };
+
+    const auto found = ENCODINGS.find(type);
+
+    return found == ENCODINGS.end() ? UNKNOWN_ENCODING : found->second;
+}
+
+} // namespace
+
+// The state of the encoding: the encoding of the last event type, the types that have CSV headers and the binary
+// symbols.
+struct EventWriter::Encoder {
+    std::type_index lastType = typeid(void);
+    const TypeEncoding *lastEncoding{};
+    std::unordered_set<const TypeEncoding *> headers{};
+    std::unordered_map<std::string, std::uint64_t, StringHash, std::equal_to<>> symbols{};
+    std::string body{};
+};
+
+// The buffers, the queue and the sink. They are owned by the writer and the I/O thread together, so the thread can
+// finish writing after the writer is destroyed (when the last reference to the writer is released by the sink).
+struct EventWriter::State {
+    Sink sink;
+    std::size_t bufferSize;
+
+    std::mutex mtx{};
+    std::condition_variable ioCondition{};
+    std::condition_variable writtenCondition{};
+    std::string buffer{};
+    std::deque<std::string> queue{};
+    std::vector<std::string> pool{};
+    std::uint64_t submittedBuffers{};
+    std::uint64_t writtenBuffers{};
+    std::exception_ptr error{};
+    bool closed{};
+
+    std::atomic<std::uint64_t> byteCount{};
+
+    State(Sink sink, std::size_t bufferSize) : sink(std::move(sink)), bufferSize(bufferSize) {
+    }
+
+    std::string takeBuffer() {
+        if (pool.empty()) {
+            std::string result{};
+
+            result.reserve(bufferSize + bufferSize / 8);
+
+            return result;
+        }
+
+        auto result = std::move(pool.back());
+
+        pool.pop_back();
+
+        return result;
+    }
+
+    // Passes the current buffer to the I/O thread. The bound of the queue is not waited for by the I/O thread itself.
+    void submit(std::unique_lock<std::mutex> &lock, bool wait = true) {
+        if (wait) {
+            writtenCondition.wait(lock, [this] {
+                return queue.size() < MAX_QUEUED_BUFFERS;
+            });
+        }
+
+        if (buffer.empty()) {
+            return;
+        }
+
+        queue.push_back(std::move(buffer));
+        submittedBuffers++;
+        buffer = takeBuffer();
+        ioCondition.notify_one();
+    }
+
+    void runIo() {
+        std::unique_lock lock(mtx);
+
+        while (true) {
+            if (queue.empty()) {
+                if (closed) {
+                    break;
+                }
+
+                // The partially filled buffer is written when nothing was submitted during the period.
+                if (!ioCondition.wait_for(lock, FLUSH_PERIOD, [this] {
+                        return !queue.empty() || closed;
+                    }) &&
+                    !buffer.empty()) {
+                    queue.push_back(std::move(buffer));
+                    submittedBuffers++;
+                    buffer = takeBuffer();
+                }
+
+                continue;
+            }
+
+            auto data = std::move(queue.front());
+            const bool failed = static_cast<bool>(error);
+            std::exception_ptr sinkError{};
+
+            queue.pop_front();
+            lock.unlock();
+
+            // After a failure the buffers are dropped.
+            if (!failed) {
+                try {
+                    sink(data.data(), data.size());
+                    byteCount += data.size();
+                } catch (...) {
+                    sinkError = std::current_exception();
+                }
+            }
+
+            lock.lock();
+
+            if (sinkError) {
+                error = sinkError;
+            }
+
+            writtenBuffers++;
+            data.clear();
+            pool.push_back(std::move(data));
+            writtenCondition.notify_all();
+        }
+    }
+
+    void rethrowError() const {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+EventWriter::EventWriter(LockExternalConstructionTag, Format format, Sink sink, std::size_t bufferSize)
+    : format_(format), encoder_(std::make_unique<Encoder>()),
+      state_(std::make_shared<State>(std::move(sink), bufferSize)) {
+    state_->buffer = state_->takeBuffer();
+
+    if (format_ == Format::BINARY) {
+        state_->buffer.append(BINARY_MAGIC);
+        state_->buffer.push_back(BINARY_VERSION);
+    }
+
+    ioThread_ = std::thread([state = state_] {
+        state->runIo();
+    });
+}
+
+EventWriter::~EventWriter() noexcept {
+    try {
+        close();
+    } catch (...) {
+        // The errors of the sink are reported by close().
+    }
+}
+
+std::shared_ptr<EventWriter> EventWriter::create(Format format, Sink sink, std::size_t bufferSize) {
+    if (!sink) {
+        throw InvalidArgumentException("The `sink` is empty");
+    }
+
+    if (bufferSize == 0) {
+        throw InvalidArgumentException("The `bufferSize` is zero");
+    }
+
+    return createShared(format, std::move(sink), bufferSize);
+}
+
+std::shared_ptr<EventWriter> EventWriter::create(Format format, const StringLike &path, std::size_t bufferSize) {
+    if (std::string_view(path) == "-") {
+        return create(
+            format,
+            [](const char *data, std::size_t size) {
+                std::cout.write(data, static_cast<std::streamsize>(size));
+                std::cout.flush();
+            },
+            bufferSize);
+    }
+
+    auto out = std::make_shared<std::ofstream>(std::string(path), std::ios::binary | std::ios::trunc);
+
+    if (!*out) {
+        throw InvalidArgumentException(fmt::format("Can't open the file '{}'", std::string_view(path)));
+    }
+
+    return create(
+        format,
+        [out, file = std::string(path)](const char *data, std::size_t size) {
+            if (!out->write(data, static_cast<std::streamsize>(size)).flush()) {
+                throw RuntimeException(fmt::format("Can't write the file '{}'", file));
+            }
+        },
+        bufferSize);
+}
+
+EventWriter::Format EventWriter::parseFormat(std::string_view name) {
+    std::string lower(name);
+
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+
+    if (lower == "text") {
+        return Format::TEXT;
+    }
+
+    if (lower == "csv") {
+        return Format::CSV;
+    }
+
+    if (lower == "json" || lower == "jsonl") {
+        return Format::JSON_LINES;
+    }
+
+    if (lower == "binary" || lower == "bin") {
+        return Format::BINARY;
+    }
+
+    throw InvalidArgumentException(fmt::format("Unknown format '{}' (text, csv, json or binary)", name));
+}
+
+EventWriter::Format EventWriter::getFormat() const noexcept {
+    return format_;
+}
+
+void EventWriter::encode(const EventType &event) {
+    auto &buffer = state_->buffer;
+
+    if (format_ == Format::TEXT) {
+        buffer.append(event.toString());
+        buffer.push_back('\n');
+
+        return;
+    }
+
+    const std::type_index type = typeid(event);
+
+    if (type != encoder_->lastType) {
+        encoder_->lastType = type;
+        encoder_->lastEncoding = &getEncoding(type);
+    }
+
+    const auto &encoding = *encoder_->lastEncoding;
+
+    switch (format_) {
+    case Format::CSV: {
+        if (encoder_->headers.insert(&encoding).second) {
+            HeaderEncoder header{&buffer};
+
+            encoding.header(event, header);
+        }
+
+        CsvEncoder csv{&buffer};
+
+        encoding.csv(event, csv);
+        break;
+    }
+    case Format::JSON_LINES: {
+        JsonEncoder json{&buffer};
+
+        encoding.json(event, json);
+        break;
+    }
+    case Format::BINARY: {
+        BinaryEncoder binary{&buffer, &encoder_->body, &encoder_->symbols};
+
+        encoding.binary(event, binary);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void EventWriter::write(const std::shared_ptr<EventType> &event) {
+    if (!event) {
+        return;
+    }
+
+    std::unique_lock lock(state_->mtx);
+
+    if (state_->closed) {
+        throw RuntimeException("The EventWriter is closed");
+    }
+
+    state_->rethrowError();
+    encode(*event);
+    eventCount_++;
+
+    if (state_->buffer.size() >= state_->bufferSize) {
+        state_->submit(lock);
+    }
+}
+
+void EventWriter::write(const std::vector<std::shared_ptr<EventType>> &events) {
+    std::unique_lock lock(state_->mtx);
+
+    if (state_->closed) {
+        throw RuntimeException("The EventWriter is closed");
+    }
+
+    state_->rethrowError();
+
+    for (const auto &event : events) {
+        if (!event) {
+            continue;
+        }
+
+        encode(*event);
+        eventCount_++;
+
+        if (state_->buffer.size() >= state_->bufferSize) {
+            state_->submit(lock);
+        }
+    }
+}
+
+void EventWriter::flush() {
+    std::unique_lock lock(state_->mtx);
+
+    if (!state_->closed) {
+        state_->submit(lock);
+    }
+
+    const auto submitted = state_->submittedBuffers;
+
+    state_->writtenCondition.wait(lock, [this, submitted] {
+        return state_->writtenBuffers >= submitted;
+    });
+    state_->rethrowError();
+}
+
+void EventWriter::close() {
+    // The writer can be released by the sink itself, so the I/O thread can't be joined from the sink.
+    const bool isIoThread = ioThread_.get_id() == std::this_thread::get_id();
+
+    {
+        std::unique_lock lock(state_->mtx);
+
+        if (!state_->closed) {
+            state_->submit(lock, !isIoThread);
+            state_->closed = true;
+            state_->ioCondition.notify_all();
+        }
+    }
+
+    if (ioThread_.joinable()) {
+        if (isIoThread) {
+            // The thread keeps its reference to the state and finishes writing the queued buffers.
+            ioThread_.detach();
+
+            return;
+        }
+
+        ioThread_.join();
+    }
+
+    std::lock_guard lock(state_->mtx);
+
+    state_->rethrowError();
+}
+
+std::uint64_t EventWriter::getEventCount() const noexcept {
+    return eventCount_;
+}
+
+std::uint64_t EventWriter::getByteCount() const noexcept {
+    return state_->byteCount;
+}
+
+DXFCPP_END_NAMESPACE
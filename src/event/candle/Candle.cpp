@@ -2,9 +2,10 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include "../../../include/dxfeed_graal_cpp_api/event/candle/Candle.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/event/candle/CandleSymbolCache.hpp"
 #include "../../../include/dxfeed_graal_cpp_api/event/EventTypeEnum.hpp"
 #include "../../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
-#include "../../../include/dxfeed_graal_cpp_api/internal/TimeFormat.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/internal/NativeTimeFormat.hpp"
 #include "../../../include/dxfeed_graal_cpp_api/internal/resources/Strings.hpp"
 #include "../../../include/dxfeed_graal_cpp_api/internal/utils/debug/Debug.hpp"
 #include "../../../include/dxfeed_graal_cpp_api/isolated/IsolatedCommon.hpp"
@@ -24,7 +25,10 @@ void Candle::fillData(void *graalNative) {
 
     const auto graalCandle = static_cast<dxfg_candle_t *>(graalNative);
 
-    setEventSymbol(CandleSymbol::valueOf(dxfcpp::toString(graalCandle->event_symbol)));
+    // The candles of a subscription carry the same few symbols, so the parsed symbols are reused.
+    setEventSymbol(*CandleSymbolCache::valueOf(graalCandle->event_symbol == nullptr
+                                                   ? std::string_view{String::NUL}
+                                                   : std::string_view{graalCandle->event_symbol}));
 
     data_ = {
         .eventTime = graalCandle->event_time,
@@ -428,9 +432,9 @@ std::string Candle::toString() const {
     return fmt::format(
         "Candle{{{}, eventTime={}, eventFlags={:#x}, time={}, sequence={}, count={}, open={}, high={}, low={}, "
         "close={}, volume={}, vwap={}, bidVolume={}, askVolume={}, impVolatility={}, openInterest={}}}",
-        getEventSymbol().toString(), TimeFormat::DEFAULT_WITH_MILLIS.format(getEventTime()),
-        getEventFlagsMask().getMask(), TimeFormat::DEFAULT_WITH_MILLIS.format(getTime()), getSequence(), getCount(),
-        dxfcpp::toString(getOpen()), dxfcpp::toString(getHigh()), dxfcpp::toString(getLow()),
+        getEventSymbol().toString(), NativeTimeFormat::DEFAULT_WITH_MILLIS.format(getEventTime()),
+        getEventFlagsMask().getMask(), NativeTimeFormat::DEFAULT_WITH_MILLIS.format(getTime()), getSequence(),
+        getCount(), dxfcpp::toString(getOpen()), dxfcpp::toString(getHigh()), dxfcpp::toString(getLow()),
         dxfcpp::toString(getClose()), dxfcpp::toString(getVolume()), dxfcpp::toString(getVWAP()),
         dxfcpp::toString(getBidVolume()), dxfcpp::toString(getAskVolume()), dxfcpp::toString(getImpVolatility()),
         dxfcpp::toString(getOpenInterest()));
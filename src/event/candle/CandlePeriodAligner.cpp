@@ -0,0 +1,140 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../../include/dxfeed_graal_cpp_api/event/candle/CandlePeriodAligner.hpp"
+
+#include "../../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/schedule/Schedule.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/schedule/Session.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/schedule/SessionType.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+constexpr std::int64_t DAY_MILLIS = 24LL * 60 * 60 * 1000;
+
+// 1970-01-05 is the first Monday after the epoch.
+constexpr std::int64_t FIRST_MONDAY_MILLIS = 4 * DAY_MILLIS;
+
+std::int64_t floorDiv(std::int64_t a, std::int64_t b) noexcept {
+    auto q = a / b;
+
+    if ((a % b != 0) && ((a < 0) != (b < 0))) {
+        q--;
+    }
+
+    return q;
+}
+
+std::int64_t monthsSinceEpoch(std::int64_t time) noexcept {
+    using namespace std::chrono;
+
+    const year_month_day ymd{floor<days>(sys_time<milliseconds>{milliseconds{time}})};
+
+    return (static_cast<int>(ymd.year()) - 1970) * 12LL + static_cast<unsigned>(ymd.month()) - 1;
+}
+
+std::int64_t timeOfMonth(std::int64_t months) noexcept {
+    using namespace std::chrono;
+
+    const auto y = floorDiv(months, 12);
+    const auto m = months - y * 12;
+    const sys_days date = year{static_cast<int>(1970 + y)} / month{static_cast<unsigned>(m + 1)} / day{1};
+
+    return duration_cast<milliseconds>(date.time_since_epoch()).count();
+}
+
+} // namespace
+
+CandlePeriodAligner::CandlePeriodAligner(const CandlePeriod &period, const CandleAlignment &alignment,
+                                         std::shared_ptr<Schedule> schedule)
+    : schedule_(std::move(schedule)) {
+    const auto &type = period.getType();
+
+    if (!(period.getValue() > 0)) {
+        throw InvalidArgumentException("Invalid candle period: " + period.toString());
+    }
+
+    if (type == CandleType::TICK || type == CandleType::VOLUME || type == CandleType::PRICE ||
+        type == CandleType::PRICE_MOMENTUM || type == CandleType::PRICE_RENKO) {
+        kind_ = Kind::NOT_TIME;
+    } else if (type == CandleType::MONTH || type == CandleType::YEAR) {
+        kind_ = Kind::MONTHS;
+        periodMonths_ =
+            std::max<std::int64_t>(1, std::llround(period.getValue())) * (type == CandleType::YEAR ? 12 : 1);
+    } else if (type == CandleType::OPTEXP) {
+        throw InvalidArgumentException("Unsupported candle period: " + period.toString());
+    } else {
+        kind_ = Kind::MILLIS;
+        periodMillis_ = period.getPeriodIntervalMillis();
+        origin_ = type == CandleType::WEEK ? FIRST_MONDAY_MILLIS : 0;
+
+        if (periodMillis_ <= 0) {
+            throw InvalidArgumentException("Invalid candle period: " + period.toString());
+        }
+    }
+
+    sessionAligned_ = kind_ == Kind::MILLIS && alignment == CandleAlignment::SESSION;
+
+    if (sessionAligned_ && !schedule_) {
+        throw InvalidArgumentException("The session alignment requires a schedule");
+    }
+}
+
+void CandlePeriodAligner::updateSession(std::int64_t time) {
+    if (time >= sessionStart_ && time < sessionEnd_) {
+        return;
+    }
+
+    const auto session = schedule_->getSessionByTime(time);
+
+    sessionStart_ = session->getStartTime();
+    sessionEnd_ = std::max(session->getEndTime(), time + 1);
+    sessionRegular_ = session->getType() == SessionType::REGULAR;
+}
+
+bool CandlePeriodAligner::isTimeBased() const noexcept {
+    return kind_ != Kind::NOT_TIME;
+}
+
+CandlePeriodAligner::Bounds CandlePeriodAligner::getBounds(std::int64_t time) {
+    switch (kind_) {
+    case Kind::MILLIS: {
+        if (!sessionAligned_) {
+            const auto start = origin_ + floorDiv(time - origin_, periodMillis_) * periodMillis_;
+
+            return {start, start + periodMillis_};
+        }
+
+        updateSession(time);
+
+        const auto start = sessionStart_ + floorDiv(time - sessionStart_, periodMillis_) * periodMillis_;
+
+        return {start, std::min(start + periodMillis_, sessionEnd_)};
+    }
+    case Kind::MONTHS: {
+        const auto months = floorDiv(monthsSinceEpoch(time), periodMonths_) * periodMonths_;
+
+        return {timeOfMonth(months), timeOfMonth(months + periodMonths_)};
+    }
+    default:
+        throw InvalidArgumentException("The candles of the period are not time-based");
+    }
+}
+
+bool CandlePeriodAligner::isRegularSession(std::int64_t time) {
+    if (!schedule_) {
+        throw InvalidArgumentException("The session filter requires a schedule");
+    }
+
+    updateSession(time);
+
+    return sessionRegular_;
+}
+
+DXFCPP_END_NAMESPACE
@@ -0,0 +1,301 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../../include/dxfeed_graal_cpp_api/event/candle/CandleResampler.hpp"
+
+#include "../../../include/dxfeed_graal_cpp_api/event/candle/CandlePeriodAligner.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/internal/Common.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+// Reduces the values with four independent accumulators, so the compiler can keep them in the vector registers.
+template <typename Op> double reduce(const double *values, std::size_t size, double initial, Op op) noexcept {
+    double a0 = initial;
+    double a1 = initial;
+    double a2 = initial;
+    double a3 = initial;
+    std::size_t i = 0;
+
+    for (; i + 4 <= size; i += 4) {
+        a0 = op(a0, values[i]);
+        a1 = op(a1, values[i + 1]);
+        a2 = op(a2, values[i + 2]);
+        a3 = op(a3, values[i + 3]);
+    }
+
+    for (; i < size; i++) {
+        a0 = op(a0, values[i]);
+    }
+
+    return op(op(a0, a1), op(a2, a3));
+}
+
+// The NaN values are skipped by the comparisons and by the sums.
+constexpr auto MAX = [](double a, double x) noexcept {
+    return x > a ? x : a;
+};
+
+constexpr auto MIN = [](double a, double x) noexcept {
+    return x < a ? x : a;
+};
+
+constexpr auto SUM = [](double a, double x) noexcept {
+    return a + (x == x ? x : 0.0);
+};
+
+double first(const double *values, std::size_t size) noexcept {
+    for (std::size_t i = 0; i < size; i++) {
+        if (!std::isnan(values[i])) {
+            return values[i];
+        }
+    }
+
+    return math::NaN;
+}
+
+double last(const double *values, std::size_t size) noexcept {
+    for (std::size_t i = size; i > 0; i--) {
+        if (!std::isnan(values[i - 1])) {
+            return values[i - 1];
+        }
+    }
+
+    return math::NaN;
+}
+
+double finiteOrNaN(double value) noexcept {
+    return std::isinf(value) ? math::NaN : value;
+}
+
+void checkSizes(const CandleColumnsView &candles) {
+    const auto size = candles.size();
+
+    for (auto columnSize : {candles.counts.size(), candles.opens.size(), candles.highs.size(), candles.lows.size(),
+                            candles.closes.size(), candles.volumes.size(), candles.vwaps.size(),
+                            candles.bidVolumes.size(), candles.askVolumes.size(), candles.impVolatilities.size(),
+                            candles.openInterests.size()}) {
+        if (columnSize != size) {
+            throw InvalidArgumentException("The candle columns have different sizes");
+        }
+    }
+}
+
+} // namespace
+
+void CandleColumns::reserve(std::size_t capacity) {
+    times.reserve(capacity);
+    counts.reserve(capacity);
+    opens.reserve(capacity);
+    highs.reserve(capacity);
+    lows.reserve(capacity);
+    closes.reserve(capacity);
+    volumes.reserve(capacity);
+    vwaps.reserve(capacity);
+    bidVolumes.reserve(capacity);
+    askVolumes.reserve(capacity);
+    impVolatilities.reserve(capacity);
+    openInterests.reserve(capacity);
+}
+
+void CandleColumns::resize(std::size_t size) {
+    times.resize(size);
+    counts.resize(size);
+    opens.resize(size);
+    highs.resize(size);
+    lows.resize(size);
+    closes.resize(size);
+    volumes.resize(size);
+    vwaps.resize(size);
+    bidVolumes.resize(size);
+    askVolumes.resize(size);
+    impVolatilities.resize(size);
+    openInterests.resize(size);
+}
+
+void CandleColumns::append(const Candle &candle) {
+    times.push_back(candle.getTime());
+    counts.push_back(candle.getCount());
+    opens.push_back(candle.getOpen());
+    highs.push_back(candle.getHigh());
+    lows.push_back(candle.getLow());
+    closes.push_back(candle.getClose());
+    volumes.push_back(candle.getVolume());
+    vwaps.push_back(candle.getVWAP());
+    bidVolumes.push_back(candle.getBidVolume());
+    askVolumes.push_back(candle.getAskVolume());
+    impVolatilities.push_back(candle.getImpVolatility());
+    openInterests.push_back(candle.getOpenInterest());
+}
+
+CandleColumnsView CandleColumns::view() const noexcept {
+    return {times,   counts, opens,      highs,      lows,            closes,
+            volumes, vwaps,  bidVolumes, askVolumes, impVolatilities, openInterests};
+}
+
+CandleColumns CandleColumns::fromCandles(const std::vector<std::shared_ptr<Candle>> &candles) {
+    CandleColumns columns{};
+
+    columns.reserve(candles.size());
+
+    const bool descending = candles.size() > 1 && candles.front()->getTime() > candles.back()->getTime();
+
+    if (descending) {
+        for (auto it = candles.rbegin(); it != candles.rend(); ++it) {
+            columns.append(**it);
+        }
+    } else {
+        for (const auto &candle : candles) {
+            columns.append(*candle);
+        }
+    }
+
+    return columns;
+}
+
+std::vector<std::shared_ptr<Candle>> CandleColumns::toCandles(const CandleSymbol &symbol) const {
+    std::vector<std::shared_ptr<Candle>> candles{};
+
+    candles.reserve(size());
+
+    for (std::size_t i = 0; i < size(); i++) {
+        auto candle = std::make_shared<Candle>(symbol);
+
+        candle->setTime(times[i]);
+        candle->setCount(counts[i]);
+        candle->setOpen(opens[i]);
+        candle->setHigh(highs[i]);
+        candle->setLow(lows[i]);
+        candle->setClose(closes[i]);
+        candle->setVolume(volumes[i]);
+        candle->setVWAP(vwaps[i]);
+        candle->setBidVolume(bidVolumes[i]);
+        candle->setAskVolume(askVolumes[i]);
+        candle->setImpVolatility(impVolatilities[i]);
+        candle->setOpenInterest(openInterests[i]);
+        candles.push_back(std::move(candle));
+    }
+
+    return candles;
+}
+
+CandleColumns CandleResampler::resample(const CandleColumnsView &candles, const CandlePeriod &period,
+                                        const CandleAlignment &alignment, const std::shared_ptr<Schedule> &schedule) {
+    checkSizes(candles);
+
+    CandlePeriodAligner aligner(period, alignment, schedule);
+
+    if (!aligner.isTimeBased()) {
+        throw InvalidArgumentException("The resampling requires a time-based period: " + period.toString());
+    }
+
+    const auto size = candles.size();
+    const auto *times = candles.times.data();
+
+    // The first pass: the bucket boundaries.
+    std::vector<std::size_t> bounds{};
+    CandleColumns result{};
+
+    for (std::size_t i = 0; i < size;) {
+        const auto [start, end] = aligner.getBounds(times[i]);
+        auto j = i + 1;
+
+        while (j < size && times[j] < end) {
+            if (times[j] < times[j - 1]) {
+                throw InvalidArgumentException("The candles are not ordered by time");
+            }
+
+            j++;
+        }
+
+        bounds.push_back(i);
+        result.times.push_back(start);
+        i = j;
+    }
+
+    const auto buckets = result.times.size();
+
+    bounds.push_back(size);
+    result.resize(buckets);
+
+    // The second pass: the column-wise reductions.
+    const auto forEachBucket = [&](auto &&f) {
+        for (std::size_t b = 0; b < buckets; b++) {
+            f(b, bounds[b], bounds[b + 1] - bounds[b]);
+        }
+    };
+
+    forEachBucket([&](std::size_t b, std::size_t from, std::size_t n) {
+        std::int64_t count = 0;
+
+        for (std::size_t i = from; i < from + n; i++) {
+            count += candles.counts[i];
+        }
+
+        result.counts[b] = count;
+    });
+    forEachBucket([&](std::size_t b, std::size_t from, std::size_t n) {
+        result.opens[b] = first(candles.opens.data() + from, n);
+    });
+    forEachBucket([&](std::size_t b, std::size_t from, std::size_t n) {
+        result.highs[b] =
+            finiteOrNaN(reduce(candles.highs.data() + from, n, -std::numeric_limits<double>::infinity(), MAX));
+    });
+    forEachBucket([&](std::size_t b, std::size_t from, std::size_t n) {
+        result.lows[b] =
+            finiteOrNaN(reduce(candles.lows.data() + from, n, std::numeric_limits<double>::infinity(), MIN));
+    });
+    forEachBucket([&](std::size_t b, std::size_t from, std::size_t n) {
+        result.closes[b] = last(candles.closes.data() + from, n);
+    });
+    forEachBucket([&](std::size_t b, std::size_t from, std::size_t n) {
+        result.volumes[b] = reduce(candles.volumes.data() + from, n, 0.0, SUM);
+    });
+    forEachBucket([&](std::size_t b, std::size_t from, std::size_t n) {
+        result.bidVolumes[b] = reduce(candles.bidVolumes.data() + from, n, 0.0, SUM);
+    });
+    forEachBucket([&](std::size_t b, std::size_t from, std::size_t n) {
+        result.askVolumes[b] = reduce(candles.askVolumes.data() + from, n, 0.0, SUM);
+    });
+    forEachBucket([&](std::size_t b, std::size_t from, std::size_t n) {
+        double turnover = 0.0;
+        double volume = 0.0;
+
+        for (std::size_t i = from; i < from + n; i++) {
+            const auto v = candles.volumes[i];
+            const auto t = candles.vwaps[i] * v;
+            const bool valid = t == t;
+
+            turnover += valid ? t : 0.0;
+            volume += valid ? v : 0.0;
+        }
+
+        result.vwaps[b] = volume > 0.0 ? turnover / volume : math::NaN;
+    });
+    forEachBucket([&](std::size_t b, std::size_t from, std::size_t n) {
+        result.impVolatilities[b] = last(candles.impVolatilities.data() + from, n);
+    });
+    forEachBucket([&](std::size_t b, std::size_t from, std::size_t n) {
+        result.openInterests[b] = last(candles.openInterests.data() + from, n);
+    });
+
+    return result;
+}
+
+std::vector<std::shared_ptr<Candle>> CandleResampler::resample(const std::vector<std::shared_ptr<Candle>> &candles,
+                                                               const CandleSymbol &symbol,
+                                                               const std::shared_ptr<Schedule> &schedule) {
+    const auto columns = CandleColumns::fromCandles(candles);
+
+    return resample(columns.view(), symbol.getPeriod().value_or(CandlePeriod::DEFAULT),
+                    symbol.getAlignment().value_or(CandleAlignment::DEFAULT), schedule)
+        .toCandles(symbol);
+}
+
+DXFCPP_END_NAMESPACE
@@ -0,0 +1,123 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../../include/dxfeed_graal_cpp_api/event/candle/CandleSymbolCache.hpp"
+
+#include "../../../include/dxfeed_graal_cpp_api/internal/utils/StringUtils.hpp"
+
+#include <array>
+#include <atomic>
+#include <fmt/format.h>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+struct CandleSymbolCacheImpl {
+    static constexpr std::size_t SHARDS = 16;
+
+    struct Shard {
+        std::shared_mutex mtx{};
+        std::unordered_map<std::string, std::shared_ptr<const CandleSymbol>, StringHash, std::equal_to<>> symbols{};
+    };
+
+    std::array<Shard, SHARDS> shards{};
+    std::atomic<std::uint64_t> hits{};
+    std::atomic<std::uint64_t> misses{};
+    std::atomic<std::size_t> capacity{CandleSymbolCache::DEFAULT_CAPACITY};
+
+    static CandleSymbolCacheImpl &getInstance() {
+        static CandleSymbolCacheImpl instance{};
+
+        return instance;
+    }
+
+    Shard &shardOf(std::string_view symbol) noexcept {
+        return shards[StringHash{}(symbol) % SHARDS];
+    }
+};
+
+} // namespace
+
+std::string CandleSymbolCache::Stats::toString() const {
+    return fmt::format("CandleSymbolCache.Stats{{hits={}, misses={}, size={}, hitRatio={:.4f}}}", hits, misses, size,
+                       getHitRatio());
+}
+
+std::shared_ptr<const CandleSymbol> CandleSymbolCache::valueOf(std::string_view symbol) {
+    auto &impl = CandleSymbolCacheImpl::getInstance();
+    auto &shard = impl.shardOf(symbol);
+
+    {
+        std::shared_lock lock(shard.mtx);
+
+        if (auto found = shard.symbols.find(symbol); found != shard.symbols.end()) {
+            impl.hits.fetch_add(1, std::memory_order_relaxed);
+
+            return found->second;
+        }
+    }
+
+    impl.misses.fetch_add(1, std::memory_order_relaxed);
+
+    // Parse outside the lock.
+    auto candleSymbol = std::make_shared<const CandleSymbol>(CandleSymbol::valueOf(symbol));
+    // Rounded up, so a small non-zero capacity still caches (at most SHARDS - 1 extra symbols in total).
+    const auto capacity = impl.capacity.load(std::memory_order_relaxed);
+    const auto shardCapacity =
+        capacity / CandleSymbolCacheImpl::SHARDS + (capacity % CandleSymbolCacheImpl::SHARDS != 0 ? 1 : 0);
+
+    if (shardCapacity == 0) {
+        return candleSymbol;
+    }
+
+    std::unique_lock lock(shard.mtx);
+
+    if (shard.symbols.size() >= shardCapacity) {
+        shard.symbols.clear();
+    }
+
+    // If another thread has already parsed the same symbol, keep its instance.
+    return shard.symbols.try_emplace(std::string(symbol), std::move(candleSymbol)).first->second;
+}
+
+CandleSymbolCache::Stats CandleSymbolCache::getStats() noexcept {
+    auto &impl = CandleSymbolCacheImpl::getInstance();
+    std::size_t size = 0;
+
+    for (auto &shard : impl.shards) {
+        std::shared_lock lock(shard.mtx);
+
+        size += shard.symbols.size();
+    }
+
+    return {impl.hits.load(), impl.misses.load(), size};
+}
+
+void CandleSymbolCache::resetStats() noexcept {
+    auto &impl = CandleSymbolCacheImpl::getInstance();
+
+    impl.hits = 0;
+    impl.misses = 0;
+}
+
+void CandleSymbolCache::clear() noexcept {
+    for (auto &shard : CandleSymbolCacheImpl::getInstance().shards) {
+        std::unique_lock lock(shard.mtx);
+
+        shard.symbols.clear();
+    }
+}
+
+void CandleSymbolCache::setCapacity(std::size_t capacity) noexcept {
+    CandleSymbolCacheImpl::getInstance().capacity = capacity;
+}
+
+std::size_t CandleSymbolCache::getCapacity() noexcept {
+    return CandleSymbolCacheImpl::getInstance().capacity;
+}
+
+DXFCPP_END_NAMESPACE
@@ -5,7 +5,7 @@
 
 #include "../../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
 #include "../../../include/dxfeed_graal_cpp_api/isolated/IsolatedCommon.hpp"
-#include "../../../include/dxfeed_graal_cpp_api/internal/TimeFormat.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/internal/NativeTimeFormat.hpp"
 
 #include <dxfg_api.h>
 #include <fmt/format.h>
@@ -316,9 +316,9 @@ std::string Profile::toString() const {
         "haltStartTime={}, haltEndTime={}, highLimitPrice={}, lowLimitPrice={}, high52WeekPrice={}, "
         "low52WeekPrice={}, beta={}, earningsPerShare={}, dividendFrequency={}, "
         "exDividendAmount={}, exDividendDay={}, shares={}, freeFloat={}}}",
-        MarketEvent::getEventSymbol(), TimeFormat::DEFAULT_WITH_MILLIS.format(MarketEvent::getEventTime()),
+        MarketEvent::getEventSymbol(), NativeTimeFormat::DEFAULT_WITH_MILLIS.format(MarketEvent::getEventTime()),
         getDescription(), getShortSaleRestriction().toString(), getTradingStatus().toString(), getStatusReason(),
-        TimeFormat::DEFAULT.format(getHaltStartTime()), TimeFormat::DEFAULT.format(getHaltEndTime()),
+        NativeTimeFormat::DEFAULT.format(getHaltStartTime()), NativeTimeFormat::DEFAULT.format(getHaltEndTime()),
         dxfcpp::toString(getHighLimitPrice()), dxfcpp::toString(getLowLimitPrice()),
         dxfcpp::toString(getHigh52WeekPrice()), dxfcpp::toString(getLow52WeekPrice()), dxfcpp::toString(getBeta()),
         dxfcpp::toString(getEarningsPerShare()), dxfcpp::toString(getDividendFrequency()),
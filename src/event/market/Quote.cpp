@@ -4,7 +4,7 @@
 #include "../../../include/dxfeed_graal_cpp_api/event/market/Quote.hpp"
 
 #include "../../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
-#include "../../../include/dxfeed_graal_cpp_api/internal/TimeFormat.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/internal/NativeTimeFormat.hpp"
 
 #include <cstdint>
 #include <dxfg_api.h>
@@ -335,11 +335,11 @@ std::string Quote::toString() const {
     return fmt::format(
         "Quote{{{}, eventTime={}, time={}, timeNanoPart={}, sequence={}, bidTime={}, bidExchange={}, bidPrice={}, "
         "bidSize={}, askTime={}, askExchange={}, askPrice={}, askSize={}}}",
-        MarketEvent::getEventSymbol(), TimeFormat::DEFAULT_WITH_MILLIS.format(MarketEvent::getEventTime()),
-        TimeFormat::DEFAULT_WITH_MILLIS.format(getTime()), getTimeNanoPart(), getSequence(),
-        TimeFormat::DEFAULT.format(getBidTime()), encodeChar(getBidExchangeCode()), dxfcpp::toString(getBidPrice()),
-        dxfcpp::toString(getBidSize()), TimeFormat::DEFAULT.format(getAskTime()), encodeChar(getAskExchangeCode()),
-        dxfcpp::toString(getAskPrice()), dxfcpp::toString(getAskSize()));
+        MarketEvent::getEventSymbol(), NativeTimeFormat::DEFAULT_WITH_MILLIS.format(MarketEvent::getEventTime()),
+        NativeTimeFormat::DEFAULT_WITH_MILLIS.format(getTime()), getTimeNanoPart(), getSequence(),
+        NativeTimeFormat::DEFAULT.format(getBidTime()), encodeChar(getBidExchangeCode()),
+        dxfcpp::toString(getBidPrice()), dxfcpp::toString(getBidSize()), NativeTimeFormat::DEFAULT.format(getAskTime()),
+        encodeChar(getAskExchangeCode()), dxfcpp::toString(getAskPrice()), dxfcpp::toString(getAskSize()));
 }
 
 DXFCPP_END_NAMESPACE
\ No newline at end of file
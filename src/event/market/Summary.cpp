@@ -4,7 +4,7 @@
 #include "../../../include/dxfeed_graal_cpp_api/event/market/Summary.hpp"
 
 #include "../../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
-#include "../../../include/dxfeed_graal_cpp_api/internal/TimeFormat.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/internal/NativeTimeFormat.hpp"
 
 #include <dxfg_api.h>
 #include <fmt/format.h>
@@ -215,7 +215,7 @@ std::string Summary::toString() const {
                        "dayClose={}, dayCloseType={}, prevDay={}, prevDayClose={}, prevDayCloseType={}, "
                        "prevDayVolume={}, openInterest={}}}",
                        MarketEvent::getEventSymbol(),
-                       TimeFormat::DEFAULT_WITH_MILLIS.format(MarketEvent::getEventTime()),
+                       NativeTimeFormat::DEFAULT_WITH_MILLIS.format(MarketEvent::getEventTime()),
                        day_util::getYearMonthDayByDayId(getDayId()), dxfcpp::toString(getDayOpenPrice()),
                        dxfcpp::toString(getDayHighPrice()), dxfcpp::toString(getDayLowPrice()),
                        dxfcpp::toString(getDayClosePrice()), getDayClosePriceType().toString(),
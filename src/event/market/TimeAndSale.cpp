@@ -4,7 +4,7 @@
 #include "../../../include/dxfeed_graal_cpp_api/event/market/TimeAndSale.hpp"
 
 #include "../../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
-#include "../../../include/dxfeed_graal_cpp_api/internal/TimeFormat.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/internal/NativeTimeFormat.hpp"
 
 #include <dxfg_api.h>
 #include <fmt/format.h>
@@ -375,8 +375,8 @@ std::string TimeAndSale::toString() const {
                        "exchange={}, price={}, size={}, bid={}, ask={}, ESC='{}', TTE={}, side={}, spread={}, ETH={}, "
                        "validTick={}, type={}{}{}}}",
                        MarketEvent::getEventSymbol(),
-                       TimeFormat::DEFAULT_WITH_MILLIS.format(MarketEvent::getEventTime()),
-                       getEventFlagsMask().getMask(), TimeFormat::DEFAULT_WITH_MILLIS.format(getTime()),
+                       NativeTimeFormat::DEFAULT_WITH_MILLIS.format(MarketEvent::getEventTime()),
+                       getEventFlagsMask().getMask(), NativeTimeFormat::DEFAULT_WITH_MILLIS.format(getTime()),
                        getTimeNanoPart(), getSequence(), encodeChar(getExchangeCode()), dxfcpp::toString(getPrice()),
                        dxfcpp::toString(getSize()), dxfcpp::toString(getBidPrice()), dxfcpp::toString(getAskPrice()),
                        getExchangeSaleConditions(), encodeChar(getTradeThroughExempt()), getAggressorSide().toString(),
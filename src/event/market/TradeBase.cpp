@@ -5,7 +5,7 @@
 
 #include "../../../include/dxfeed_graal_cpp_api/event/market/Direction.hpp"
 #include "../../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
-#include "../../../include/dxfeed_graal_cpp_api/internal/TimeFormat.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/internal/NativeTimeFormat.hpp"
 
 #include <dxfg_api.h>
 #include <fmt/format.h>
@@ -210,8 +210,8 @@ std::string TradeBase::baseFieldsToString() const {
         "{}, eventTime={}, time={}, timeNanoPart={}, sequence={}, exchange={}, price={}, "
         "change={}, size={}, day={}, dayVolume={}, dayTurnover={}, "
         "direction={}, ETH={}",
-        MarketEvent::getEventSymbol(), TimeFormat::DEFAULT_WITH_MILLIS.format(MarketEvent::getEventTime()),
-        TimeFormat::DEFAULT_WITH_MILLIS.format(getTime()), getTimeNanoPart(), getSequence(),
+        MarketEvent::getEventSymbol(), NativeTimeFormat::DEFAULT_WITH_MILLIS.format(MarketEvent::getEventTime()),
+        NativeTimeFormat::DEFAULT_WITH_MILLIS.format(getTime()), getTimeNanoPart(), getSequence(),
         encodeChar(getExchangeCode()), dxfcpp::toString(getPrice()), dxfcpp::toString(getChange()),
         dxfcpp::toString(getSize()), day_util::getYearMonthDayByDayId(getDayId()), dxfcpp::toString(getDayVolume()),
         dxfcpp::toString(getDayTurnover()), getTickDirection().toString(), isExtendedTradingHours());
@@ -5,7 +5,7 @@
 
 #include "../../../include/dxfeed_graal_cpp_api/event/EventType.hpp"
 #include "../../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
-#include "../../../include/dxfeed_graal_cpp_api/internal/TimeFormat.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/internal/NativeTimeFormat.hpp"
 
 #include <dxfg_api.h>
 #include <fmt/format.h>
@@ -232,8 +232,8 @@ TextMessage &TextMessage::withText(const StringLike &text) noexcept {
 
 std::string TextMessage::toString() const {
     return fmt::format("TextMessage{{{}, eventTime={}, time={}, sequence={}, text={}}}", getEventSymbol(),
-                       TimeFormat::DEFAULT_WITH_MILLIS.format(getEventTime()),
-                       TimeFormat::DEFAULT_WITH_MILLIS.format(getTime()), getSequence(), text_);
+                       NativeTimeFormat::DEFAULT_WITH_MILLIS.format(getEventTime()),
+                       NativeTimeFormat::DEFAULT_WITH_MILLIS.format(getTime()), getSequence(), text_);
 }
 
 DXFCPP_END_NAMESPACE
\ No newline at end of file
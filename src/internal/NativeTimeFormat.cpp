@@ -0,0 +1,497 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/internal/NativeTimeFormat.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/internal/Common.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/TimeFormat.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/utils/StringUtils.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <ctime>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+constexpr std::int64_t SECONDS_IN_DAY = 86400;
+constexpr std::int32_t OFFSET_BIAS = 1 << 18;
+constexpr std::int32_t NO_TRANSITION = static_cast<std::int32_t>(SECONDS_IN_DAY);
+constexpr int PAYLOAD_BITS = 40;
+constexpr std::uint64_t PAYLOAD_MASK = (std::uint64_t{1} << PAYLOAD_BITS) - 1;
+
+// The days of 0001-01-01 and 9999-12-31 (and one day around them to cover the offsets).
+constexpr std::int64_t MIN_DAY = -719162 - 1;
+constexpr std::int64_t MAX_DAY = 2932896 + 1;
+
+// The date of the last formatted day. The day doesn't depend on the timezone, so the cache is shared by the formats.
+struct DatePrefix {
+    std::int64_t day = std::numeric_limits<std::int64_t>::min();
+    std::int32_t year{};
+    std::array<char, 8> chars{};
+};
+
+thread_local DatePrefix datePrefix{};
+
+void write2(char *p, std::int32_t value) noexcept {
+    p[0] = static_cast<char>('0' + value / 10);
+    p[1] = static_cast<char>('0' + value % 10);
+}
+
+const DatePrefix &getDatePrefix(std::int64_t day) noexcept {
+    if (datePrefix.day != day) {
+        const auto yyyymmdd = day_util::getYearMonthDayByDayId(static_cast<std::int32_t>(day));
+        const auto year = yyyymmdd / 10000;
+
+        datePrefix.day = day;
+        datePrefix.year = yyyymmdd < 0 ? -1 : year;
+        write2(datePrefix.chars.data(), (year / 100) % 100);
+        write2(datePrefix.chars.data() + 2, year % 100);
+        write2(datePrefix.chars.data() + 4, (yyyymmdd / 100) % 100);
+        write2(datePrefix.chars.data() + 6, yyyymmdd % 100);
+    }
+
+    return datePrefix;
+}
+
+// Returns the offset of the local time from the OS.
+std::optional<std::int32_t> getOsOffset(std::int64_t seconds) noexcept {
+    const auto timeT = static_cast<std::time_t>(seconds);
+    std::tm tm{};
+
+#if defined(_WIN32)
+    if (localtime_s(&tm, &timeT) != 0) {
+        return std::nullopt;
+    }
+#else
+    if (localtime_r(&timeT, &tm) == nullptr) {
+        return std::nullopt;
+    }
+#endif
+
+    const auto localDay = day_util::getDayIdByYearMonthDay(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday);
+    const auto localSeconds = localDay * SECONDS_IN_DAY + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+
+    return static_cast<std::int32_t>(localSeconds - seconds);
+}
+
+// Returns `true` if the default timezone of the Java is the timezone of the OS. They differ if the `user.timezone`
+// property is set, or if the Java and the OS have different timezone databases (as on Windows). The offsets are
+// compared once: every week of the years around the current one and in the middle of the winter and summer months of
+// some past years.
+bool isOsTimeZoneJavaDefault() noexcept {
+    static const bool result = [] {
+        const auto today = math::floorDiv(now(), static_cast<std::int64_t>(SECONDS_IN_DAY * time_util::SECOND));
+        std::vector<std::int64_t> days{};
+
+        for (auto day = today - 366; day <= today + 366; day += 7) {
+            days.push_back(day);
+        }
+
+        for (const auto year : {1970, 1990, 2000, 2010}) {
+            days.push_back(day_util::getDayIdByYearMonthDay(year, 1, 15));
+            days.push_back(day_util::getDayIdByYearMonthDay(year, 7, 15));
+        }
+
+        try {
+            for (const auto day : days) {
+                const auto seconds = day * SECONDS_IN_DAY + SECONDS_IN_DAY / 2;
+                const auto osOffset = getOsOffset(seconds);
+                // yyyyMMdd-HHmmss.SSS+HHmm
+                const auto java = TimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE.format(seconds * time_util::SECOND);
+
+                if (!osOffset || java.size() < 5) {
+                    return false;
+                }
+
+                const auto zone = std::string_view(java).substr(java.size() - 5);
+                const auto hours = (zone[1] - '0') * 10 + (zone[2] - '0');
+                const auto minutes = (zone[3] - '0') * 10 + (zone[4] - '0');
+
+                if ((zone[0] == '-' ? -1 : 1) * (hours * 60 + minutes) != *osOffset / 60) {
+                    return false;
+                }
+            }
+        } catch (...) {
+            // The Java is not available, so the times can't be formatted by it either.
+            return true;
+        }
+
+        return true;
+    }();
+
+    return result;
+}
+
+bool isDigit(char c) noexcept {
+    return c >= '0' && c <= '9';
+}
+
+// The cursor over the parsed string.
+struct Parser {
+    std::string_view s;
+    std::size_t i = 0;
+
+    bool atEnd() const noexcept {
+        return i >= s.size();
+    }
+
+    bool consume(char c) noexcept {
+        if (!atEnd() && s[i] == c) {
+            i++;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    std::optional<std::int32_t> digits(std::size_t count) noexcept {
+        if (s.size() - i < count) {
+            return std::nullopt;
+        }
+
+        std::int32_t value = 0;
+
+        for (std::size_t j = 0; j < count; j++, i++) {
+            if (!isDigit(s[i])) {
+                return std::nullopt;
+            }
+
+            value = value * 10 + (s[i] - '0');
+        }
+
+        return value;
+    }
+
+    bool nextIsDigit() const noexcept {
+        return !atEnd() && isDigit(s[i]);
+    }
+};
+
+std::int32_t getDaysInMonth(std::int32_t year, std::int32_t month) noexcept {
+    static constexpr std::array<std::int32_t, 12> DAYS{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    const bool leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+
+    return DAYS[month - 1] + (month == 2 && leap ? 1 : 0);
+}
+
+} // namespace
+
+const NativeTimeFormat NativeTimeFormat::DEFAULT(TimeFormat::DEFAULT, true, false, false);
+const NativeTimeFormat NativeTimeFormat::DEFAULT_WITH_MILLIS(TimeFormat::DEFAULT_WITH_MILLIS, true, true, false);
+const NativeTimeFormat
+    NativeTimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE(TimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE, true, true,
+                                                        true);
+const NativeTimeFormat NativeTimeFormat::GMT(TimeFormat::GMT, false, false, false);
+
+NativeTimeFormat::NativeTimeFormat(const TimeFormat &fallback, bool local, bool withMillis, bool withTimeZone) noexcept
+    : fallback_(fallback), local_(local), withMillis_(withMillis), withTimeZone_(withTimeZone) {
+}
+
+NativeTimeFormat::OffsetTable &NativeTimeFormat::getOffsetTable() noexcept {
+    static OffsetTable table{};
+
+    return table;
+}
+
+std::optional<std::int32_t> NativeTimeFormat::getOffset(std::int64_t seconds) const noexcept {
+    if (!local_) {
+        return 0;
+    }
+
+    // The local times are formatted and parsed by the TimeFormat.
+    if (!isOsTimeZoneJavaDefault()) {
+        return std::nullopt;
+    }
+
+    const auto day = math::floorDiv(seconds, SECONDS_IN_DAY);
+
+    if (day < MIN_DAY || day > MAX_DAY) {
+        return std::nullopt;
+    }
+
+    const auto secondOfDay = static_cast<std::int32_t>(seconds - day * SECONDS_IN_DAY);
+    const auto key = static_cast<std::uint64_t>(day - MIN_DAY + 1) << PAYLOAD_BITS;
+    const auto index = static_cast<std::size_t>(day - MIN_DAY) % OFFSET_TABLE_SIZE;
+    auto &table = getOffsetTable();
+    const auto start = table.starts[index].load(std::memory_order_relaxed);
+    const auto transition = table.transitions[index].load(std::memory_order_relaxed);
+
+    if ((start & ~PAYLOAD_MASK) == key && (transition & ~PAYLOAD_MASK) == key) {
+        const auto transitionSecond = static_cast<std::int32_t>((transition & PAYLOAD_MASK) >> 19);
+
+        return secondOfDay < transitionSecond
+                   ? static_cast<std::int32_t>(start & PAYLOAD_MASK) - OFFSET_BIAS
+                   : static_cast<std::int32_t>(transition & ((std::uint64_t{1} << 19) - 1)) - OFFSET_BIAS;
+    }
+
+    // The offsets of the day are read from the OS. The transition within the day is searched by the bisection.
+    const auto dayStart = day * SECONDS_IN_DAY;
+    const auto startOffset = getOsOffset(dayStart);
+    const auto endOffset = getOsOffset(dayStart + SECONDS_IN_DAY - 1);
+
+    if (!startOffset || !endOffset) {
+        return std::nullopt;
+    }
+
+    std::int32_t transitionSecond = NO_TRANSITION;
+
+    if (*startOffset != *endOffset) {
+        std::int32_t low = 0;
+        std::int32_t high = NO_TRANSITION - 1;
+
+        while (low + 1 < high) {
+            const auto middle = low + (high - low) / 2;
+
+            if (getOsOffset(dayStart + middle) == startOffset) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+
+        transitionSecond = high;
+    }
+
+    // Both words contain the day, so a reader that sees the words of different days reads the OS.
+    table.starts[index].store(key | static_cast<std::uint64_t>(*startOffset + OFFSET_BIAS), std::memory_order_relaxed);
+    table.transitions[index].store(key | static_cast<std::uint64_t>(transitionSecond) << 19 |
+                                       static_cast<std::uint64_t>(*endOffset + OFFSET_BIAS),
+                                   std::memory_order_relaxed);
+
+    return secondOfDay < transitionSecond ? startOffset : endOffset;
+}
+
+std::optional<std::int32_t> NativeTimeFormat::getOffsetOfLocal(std::int64_t localSeconds) const noexcept {
+    if (!local_) {
+        return 0;
+    }
+
+    // The offsets around the time. They differ only near a transition (the transitions are days apart).
+    const auto before = getOffset(localSeconds - SECONDS_IN_DAY);
+    const auto after = getOffset(localSeconds + SECONDS_IN_DAY);
+
+    if (!before || !after) {
+        return std::nullopt;
+    }
+
+    if (*before == *after || getOffset(localSeconds - *before) == before) {
+        // The overlapped local times are resolved to the earlier offset.
+        return before;
+    }
+
+    if (getOffset(localSeconds - *after) == after) {
+        return after;
+    }
+
+    // The local times in the gap are shifted forward by the length of the gap.
+    return before;
+}
+
+std::size_t NativeTimeFormat::format(std::int64_t timestamp, char *buffer) const noexcept {
+    if (timestamp == 0) {
+        buffer[0] = '0';
+
+        return 1;
+    }
+
+    const auto seconds = math::floorDiv(timestamp, time_util::SECOND);
+    const auto offset = getOffset(seconds);
+
+    if (!offset) {
+        return 0;
+    }
+
+    const auto localSeconds = seconds + *offset;
+    const auto day = math::floorDiv(localSeconds, SECONDS_IN_DAY);
+    const auto &prefix = getDatePrefix(day);
+
+    if (prefix.year < 1 || prefix.year > 9999) {
+        return 0;
+    }
+
+    const auto secondOfDay = static_cast<std::int32_t>(localSeconds - day * SECONDS_IN_DAY);
+    char *p = buffer;
+
+    std::copy(prefix.chars.begin(), prefix.chars.end(), p);
+    p += prefix.chars.size();
+    *p++ = '-';
+    write2(p, secondOfDay / 3600);
+    write2(p + 2, secondOfDay / 60 % 60);
+    write2(p + 4, secondOfDay % 60);
+    p += 6;
+
+    if (withMillis_) {
+        const auto millis = static_cast<std::int32_t>(timestamp - seconds * time_util::SECOND);
+
+        *p++ = '.';
+        *p++ = static_cast<char>('0' + millis / 100);
+        write2(p, millis % 100);
+        p += 2;
+    }
+
+    if (withTimeZone_) {
+        // The offset is truncated to minutes, as the Java's SimpleDateFormat does.
+        const auto offsetMinutes = *offset / 60;
+        const auto absMinutes = offsetMinutes < 0 ? -offsetMinutes : offsetMinutes;
+
+        *p++ = offsetMinutes < 0 ? '-' : '+';
+        write2(p, absMinutes / 60);
+        write2(p + 2, absMinutes % 60);
+        p += 4;
+    }
+
+    return static_cast<std::size_t>(p - buffer);
+}
+
+std::string NativeTimeFormat::format(std::int64_t timestamp) const {
+    std::array<char, MAX_LENGTH> buffer{};
+
+    if (const auto length = format(timestamp, buffer.data()); length > 0) {
+        return {buffer.data(), length};
+    }
+
+    return fallback_.format(timestamp);
+}
+
+std::optional<std::int64_t> NativeTimeFormat::parseNative(std::string_view value) const noexcept {
+    if (value == "0") {
+        return 0;
+    }
+
+    if (value.size() >= 9 && std::all_of(value.begin(), value.end(), isDigit)) {
+        std::int64_t result{};
+
+        if (auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), result); ec == std::errc{}) {
+            return result;
+        }
+
+        return std::nullopt;
+    }
+
+    Parser parser{value};
+
+    // <date>
+    const auto year = parser.digits(4);
+    const bool dashedDate = parser.consume('-');
+    const auto month = parser.digits(2);
+
+    if (!year || !month || (dashedDate && !parser.consume('-'))) {
+        return std::nullopt;
+    }
+
+    const auto dayOfMonth = parser.digits(2);
+
+    if (!dayOfMonth || *year < 1 || *month < 1 || *month > 12 || *dayOfMonth < 1 ||
+        *dayOfMonth > getDaysInMonth(*year, *month)) {
+        return std::nullopt;
+    }
+
+    // [('T'|'t'|'-'|' ')<time>]
+    std::int32_t hour = 0;
+    std::int32_t minute = 0;
+    std::int32_t second = 0;
+    std::int32_t millis = 0;
+
+    if (parser.consume('T') || parser.consume('t') || parser.consume('-') || parser.consume(' ')) {
+        const auto h = parser.digits(2);
+
+        if (!h) {
+            return std::nullopt;
+        }
+
+        hour = *h;
+
+        const bool colons = parser.consume(':');
+
+        if (colons || parser.nextIsDigit()) {
+            const auto m = parser.digits(2);
+
+            if (!m) {
+                return std::nullopt;
+            }
+
+            minute = *m;
+
+            if (colons ? parser.consume(':') : parser.nextIsDigit()) {
+                const auto s = parser.digits(2);
+
+                if (!s) {
+                    return std::nullopt;
+                }
+
+                second = *s;
+
+                if (parser.consume('.')) {
+                    const auto ms = parser.digits(3);
+
+                    if (!ms || parser.nextIsDigit()) {
+                        return std::nullopt;
+                    }
+
+                    millis = *ms;
+                }
+            }
+        }
+
+        if (hour > 23 || minute > 59 || second > 59) {
+            return std::nullopt;
+        }
+    }
+
+    const auto localSeconds =
+        static_cast<std::int64_t>(day_util::getDayIdByYearMonthDay(*year, *month, *dayOfMonth)) * SECONDS_IN_DAY +
+        hour * 3600 + minute * 60 + second;
+    std::optional<std::int32_t> offset{};
+
+    // [<timezone>]
+    if (parser.atEnd()) {
+        offset = getOffsetOfLocal(localSeconds);
+    } else if (parser.consume('Z')) {
+        offset = 0;
+    } else if (const bool negative = parser.consume('-'); negative || parser.consume('+')) {
+        const auto h = parser.digits(2);
+        std::int32_t m = 0;
+
+        if (!h) {
+            return std::nullopt;
+        }
+
+        if (const bool colon = parser.consume(':'); colon || parser.nextIsDigit()) {
+            const auto mm = parser.digits(2);
+
+            if (!mm) {
+                return std::nullopt;
+            }
+
+            m = *mm;
+        }
+
+        if (*h > 23 || m > 59) {
+            return std::nullopt;
+        }
+
+        offset = (negative ? -1 : 1) * (*h * 3600 + m * 60);
+    }
+
+    if (!offset || !parser.atEnd()) {
+        return std::nullopt;
+    }
+
+    return (localSeconds - *offset) * time_util::SECOND + millis;
+}
+
+std::int64_t NativeTimeFormat::parse(std::string_view value) const {
+    if (const auto result = parseNative(value)) {
+        return *result;
+    }
+
+    return fallback_.parse(value);
+}
+
+DXFCPP_END_NAMESPACE
@@ -0,0 +1,597 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../../include/dxfeed_graal_cpp_api/internal/utils/Inflater.hpp"
+
+#include "../../../include/dxfeed_graal_cpp_api/exceptions/RuntimeException.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+constexpr std::array<std::uint16_t, 29> LENGTH_BASE{3,  4,  5,  6,  7,  8,  9,  10,  11,  13,  15,  17,  19,  23, 27,
+                                                    31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+constexpr std::array<std::uint8_t, 29> LENGTH_EXTRA{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                                    2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+constexpr std::array<std::uint16_t, 30> DISTANCE_BASE{1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+                                                      33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+                                                      1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+constexpr std::array<std::uint8_t, 30> DISTANCE_EXTRA{0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                                      6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+constexpr std::array<std::uint8_t, 19> CODE_LENGTH_ORDER{16, 17, 18, 0, 8, 7, 9, 6, 10, 5,
+                                                         11, 4,  12, 3, 13, 2, 14, 1, 15};
+
+constexpr auto CRC_TABLE = [] {
+    std::array<std::uint32_t, 256> table{};
+
+    for (std::uint32_t i = 0; i < 256; i++) {
+        auto crc = i;
+
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? 0xEDB88320U ^ (crc >> 1) : crc >> 1;
+        }
+
+        table[i] = crc;
+    }
+
+    return table;
+}();
+
+[[noreturn]] void fail(const char *message) {
+    throw RuntimeException(std::string("Invalid compressed data: ") + message);
+}
+
+// Reads the bits starting from the least significant bit of each byte. Past the end of the input it reads zeros, which
+// are counted to detect the truncated data.
+struct BitReader {
+    const std::uint8_t *begin;
+    const std::uint8_t *next;
+    const std::uint8_t *end;
+    std::uint64_t bits = 0;
+    unsigned count = 0;
+    std::size_t padding = 0;
+
+    explicit BitReader(std::string_view input)
+        : begin{reinterpret_cast<const std::uint8_t *>(input.data())}, next{begin}, end{begin + input.size()} {
+    }
+
+    void refill();
+
+    std::uint32_t peek(unsigned n) const noexcept {
+        return static_cast<std::uint32_t>(bits & ((std::uint64_t{1} << n) - 1));
+    }
+
+    void skip(unsigned n) noexcept {
+        bits >>= n;
+        count -= n;
+    }
+
+    std::uint32_t get(unsigned n) {
+        if (count < n) {
+            refill();
+        }
+
+        const auto value = peek(n);
+
+        skip(n);
+
+        return value;
+    }
+
+    void alignToByte() noexcept {
+        skip(count % 8);
+    }
+
+    std::size_t getConsumed() const {
+        const auto consumed = static_cast<std::size_t>(next - begin) + padding - count / 8;
+
+        if (consumed > static_cast<std::size_t>(end - begin)) {
+            fail("unexpected end of data");
+        }
+
+        return consumed;
+    }
+};
+
+void BitReader::refill() {
+    while (count <= 56) {
+        if (next < end) {
+            bits |= static_cast<std::uint64_t>(*next++) << count;
+        } else if (++padding > 8) {
+            // The buffer holds at most 8 bytes, so some of the zeros have already been consumed.
+            fail("unexpected end of data");
+        }
+
+        count += 8;
+    }
+}
+
+// The single-level decoding table of a canonical Huffman code. The index is the next bits of the input (of the maximal
+// code length), and the entry is the symbol and the length of its code.
+struct HuffmanTable {
+    std::vector<std::uint16_t> entries{};
+    unsigned maxLength = 0;
+
+    void build(const std::uint8_t *lengths, std::size_t n) {
+        std::array<std::uint16_t, 16> counts{};
+
+        for (std::size_t i = 0; i < n; i++) {
+            counts[lengths[i]]++;
+        }
+
+        counts[0] = 0;
+        maxLength = 1;
+
+        for (unsigned length = 1; length < 16; length++) {
+            if (counts[length] != 0) {
+                maxLength = length;
+            }
+        }
+
+        int left = 1;
+
+        for (unsigned length = 1; length < 16; length++) {
+            left = (left << 1) - counts[length];
+
+            if (left < 0) {
+                fail("over-subscribed Huffman code");
+            }
+        }
+
+        std::array<std::uint32_t, 16> nextCode{};
+
+        for (unsigned length = 1, code = 0; length < 16; length++) {
+            code = (code + counts[length - 1]) << 1;
+            nextCode[length] = code;
+        }
+
+        entries.assign(std::size_t{1} << maxLength, 0);
+
+        for (std::size_t symbol = 0; symbol < n; symbol++) {
+            const unsigned length = lengths[symbol];
+
+            if (length == 0) {
+                continue;
+            }
+
+            auto code = nextCode[length]++;
+            std::uint32_t reversed = 0;
+
+            for (unsigned i = 0; i < length; i++) {
+                reversed = (reversed << 1) | (code & 1);
+                code >>= 1;
+            }
+
+            for (auto i = reversed; i < entries.size(); i += 1U << length) {
+                entries[i] = static_cast<std::uint16_t>(symbol << 4 | length);
+            }
+        }
+    }
+
+    // The reader must have at least maxLength bits.
+    unsigned decode(BitReader &reader) const {
+        const auto entry = entries[reader.peek(maxLength)];
+        const unsigned length = entry & 15;
+
+        if (length == 0) {
+            fail("invalid Huffman code");
+        }
+
+        reader.skip(length);
+
+        return entry >> 4;
+    }
+};
+
+struct Output {
+    std::string &string;
+    std::size_t size;
+
+    explicit Output(std::string &string) : string{string}, size{string.size()} {
+    }
+
+    char *reserve(std::size_t n) {
+        if (const auto required = size + n; required > string.size()) {
+            auto grown = std::max({string.size() * 2, required, std::size_t{1} << 16});
+
+            // The reserved capacity (the expected size) is not exceeded while it is enough, but it is filled
+            // geometrically as well, so a wrong size hint costs no more than the data itself.
+            if (required <= string.capacity()) {
+                grown = std::min(grown, string.capacity());
+            }
+
+            string.resize(grown);
+        }
+
+        return string.data() + size;
+    }
+};
+
+void readDynamicTables(BitReader &reader, HuffmanTable &literals, HuffmanTable &distances) {
+    const auto literalCount = reader.get(5) + 257;
+    const auto distanceCount = reader.get(5) + 1;
+    const auto codeLengthCount = reader.get(4) + 4;
+
+    if (literalCount > 286 || distanceCount > 30) {
+        fail("too many length or distance codes");
+    }
+
+    std::array<std::uint8_t, 19> codeLengthLengths{};
+
+    for (std::size_t i = 0; i < codeLengthCount; i++) {
+        codeLengthLengths[CODE_LENGTH_ORDER[i]] = static_cast<std::uint8_t>(reader.get(3));
+    }
+
+    HuffmanTable codeLengths{};
+
+    codeLengths.build(codeLengthLengths.data(), codeLengthLengths.size());
+
+    std::array<std::uint8_t, 286 + 30> lengths{};
+
+    for (std::size_t i = 0; i < literalCount + distanceCount;) {
+        reader.refill();
+
+        const auto symbol = codeLengths.decode(reader);
+
+        if (symbol < 16) {
+            lengths[i++] = static_cast<std::uint8_t>(symbol);
+
+            continue;
+        }
+
+        std::uint8_t value = 0;
+        std::uint32_t repeat{};
+
+        if (symbol == 16) {
+            if (i == 0) {
+                fail("repeated length with no first length");
+            }
+
+            value = lengths[i - 1];
+            repeat = 3 + reader.get(2);
+        } else if (symbol == 17) {
+            repeat = 3 + reader.get(3);
+        } else {
+            repeat = 11 + reader.get(7);
+        }
+
+        if (i + repeat > literalCount + distanceCount) {
+            fail("too many code lengths");
+        }
+
+        std::fill_n(lengths.begin() + static_cast<std::ptrdiff_t>(i), repeat, value);
+        i += repeat;
+    }
+
+    if (lengths[256] == 0) {
+        fail("no end-of-block code");
+    }
+
+    literals.build(lengths.data(), literalCount);
+    distances.build(lengths.data() + literalCount, distanceCount);
+}
+
+void inflateBlock(BitReader &reader, Output &output, const HuffmanTable &literals, const HuffmanTable &distances) {
+    for (;;) {
+        // Enough for a literal/length code with the extra bits and a distance code with the extra bits.
+        if (reader.count < 48) {
+            reader.refill();
+        }
+
+        const auto symbol = literals.decode(reader);
+
+        if (symbol < 256) {
+            *output.reserve(1) = static_cast<char>(symbol);
+            output.size++;
+
+            continue;
+        }
+
+        if (symbol == 256) {
+            return;
+        }
+
+        if (symbol > 285) {
+            fail("invalid length code");
+        }
+
+        const auto lengthIndex = symbol - 257;
+        const std::size_t length =
+            LENGTH_BASE[lengthIndex] + reader.get(LENGTH_EXTRA[lengthIndex]);
+        const auto distanceIndex = distances.decode(reader);
+
+        if (distanceIndex > 29) {
+            fail("invalid distance code");
+        }
+
+        const std::size_t distance = DISTANCE_BASE[distanceIndex] + reader.get(DISTANCE_EXTRA[distanceIndex]);
+
+        // The distance can reach the data of the preceding gzip members, which is also a part of the output.
+        if (distance > output.size) {
+            fail("distance is too far back");
+        }
+
+        auto *target = output.reserve(length);
+        const auto *source = target - distance;
+
+        if (distance >= length) {
+            std::memcpy(target, source, length);
+        } else {
+            for (std::size_t i = 0; i < length; i++) {
+                target[i] = source[i];
+            }
+        }
+
+        output.size += length;
+    }
+}
+
+std::uint16_t readLE16(std::string_view data, std::size_t offset) {
+    if (offset + 2 > data.size()) {
+        fail("unexpected end of data");
+    }
+
+    return static_cast<std::uint16_t>(static_cast<std::uint8_t>(data[offset]) |
+                                      static_cast<std::uint8_t>(data[offset + 1]) << 8);
+}
+
+std::uint32_t readLE32(std::string_view data, std::size_t offset) {
+    return readLE16(data, offset) | static_cast<std::uint32_t>(readLE16(data, offset + 2)) << 16;
+}
+
+// The expected size from the container is only a hint: it is limited by the best DEFLATE ratios of the real data, so
+// a corrupted size does not allocate much more memory than the input.
+std::size_t getSizeHint(std::uint32_t size, std::size_t inputSize) noexcept {
+    constexpr std::size_t MAX_RATIO = 32;
+
+    return std::min<std::size_t>(size, inputSize > SIZE_MAX / MAX_RATIO ? SIZE_MAX : inputSize * MAX_RATIO);
+}
+
+struct ZipEntry {
+    std::string_view name{};
+    std::size_t next{};
+};
+
+// Decompresses the "zip" entry at the position to the output and returns its name and the position of the next entry.
+ZipEntry readZipEntry(std::string_view data, std::size_t position, std::string &output) {
+    const auto flags = readLE16(data, position + 6);
+    const auto method = readLE16(data, position + 8);
+    auto crc = readLE32(data, position + 14);
+    const auto compressedSize = readLE32(data, position + 18);
+    const auto size = readLE32(data, position + 22);
+    const auto nameLength = readLE16(data, position + 26);
+    const auto offset = position + 30 + nameLength + readLE16(data, position + 28);
+
+    if (offset > data.size()) {
+        fail("unexpected end of data");
+    }
+
+    const auto name = data.substr(position + 30, nameLength);
+    const bool hasDescriptor = (flags & 8) != 0;
+    std::size_t consumed{};
+
+    output.clear();
+
+    if (method == 0) {
+        if (hasDescriptor || compressedSize == 0xFFFFFFFFU || offset + compressedSize > data.size()) {
+            fail("unsupported or truncated stored zip entry");
+        }
+
+        output.assign(data.substr(offset, compressedSize));
+        consumed = compressedSize;
+    } else if (method == 8) {
+        if (!hasDescriptor && size != 0xFFFFFFFFU) {
+            output.reserve(getSizeHint(size, compressedSize));
+        }
+
+        consumed = Inflater::inflate(data.substr(offset), output);
+    } else {
+        fail("unsupported zip compression method");
+    }
+
+    auto next = offset + consumed;
+
+    if (hasDescriptor) {
+        // The signature of the data descriptor is optional.
+        if (readLE32(data, next) == 0x08074B50U) {
+            next += 4;
+        }
+
+        crc = readLE32(data, next);
+        next += 12;
+    }
+
+    if (Inflater::crc32(output) != crc) {
+        fail("corrupt zip entry");
+    }
+
+    return {name, next};
+}
+
+} // namespace
+
+std::size_t Inflater::inflate(std::string_view input, std::string &output) {
+    BitReader reader{input};
+    Output out{output};
+    HuffmanTable literals{};
+    HuffmanTable distances{};
+    HuffmanTable fixedLiterals{};
+    HuffmanTable fixedDistances{};
+    bool last = false;
+
+    while (!last) {
+        last = reader.get(1) != 0;
+
+        const auto type = reader.get(2);
+
+        if (type == 0) {
+            reader.alignToByte();
+
+            const auto length = reader.get(16);
+
+            if ((reader.get(16) ^ 0xFFFFU) != length) {
+                fail("invalid stored block length");
+            }
+
+            auto *target = out.reserve(length);
+            std::size_t copied = 0;
+
+            // The beginning of the block can already be in the bit buffer.
+            for (; copied < length && reader.count >= 8; copied++) {
+                target[copied] = static_cast<char>(reader.get(8));
+            }
+
+            const auto remaining = length - copied;
+
+            if (remaining > static_cast<std::size_t>(reader.end - reader.next)) {
+                fail("unexpected end of data");
+            }
+
+            std::memcpy(target + copied, reader.next, remaining);
+            reader.next += remaining;
+            out.size += length;
+        } else if (type == 1) {
+            if (fixedLiterals.entries.empty()) {
+                std::array<std::uint8_t, 288 + 30> lengths{};
+
+                std::fill_n(lengths.begin(), 144, 8);
+                std::fill_n(lengths.begin() + 144, 112, 9);
+                std::fill_n(lengths.begin() + 256, 24, 7);
+                std::fill_n(lengths.begin() + 280, 8, 8);
+                std::fill_n(lengths.begin() + 288, 30, 5);
+                fixedLiterals.build(lengths.data(), 288);
+                fixedDistances.build(lengths.data() + 288, 30);
+            }
+
+            inflateBlock(reader, out, fixedLiterals, fixedDistances);
+        } else if (type == 2) {
+            readDynamicTables(reader, literals, distances);
+            inflateBlock(reader, out, literals, distances);
+        } else {
+            fail("invalid block type");
+        }
+
+        reader.getConsumed();
+    }
+
+    output.resize(out.size);
+
+    reader.alignToByte();
+
+    return reader.getConsumed();
+}
+
+bool Inflater::isGzip(std::string_view data) noexcept {
+    return data.size() >= 2 && static_cast<std::uint8_t>(data[0]) == 0x1F && static_cast<std::uint8_t>(data[1]) == 0x8B;
+}
+
+bool Inflater::isZip(std::string_view data) noexcept {
+    return data.size() >= 4 && data.substr(0, 4) == std::string_view("PK\x03\x04", 4);
+}
+
+std::string Inflater::gunzip(std::string_view data) {
+    std::string output{};
+
+    // The size of the last member is usually the size of the whole data.
+    if (data.size() >= 4) {
+        output.reserve(getSizeHint(readLE32(data, data.size() - 4), data.size()));
+    }
+
+    std::size_t position = 0;
+
+    while (position < data.size()) {
+        if (!isGzip(data.substr(position))) {
+            // Trailing garbage after the members is ignored.
+            if (position != 0) {
+                break;
+            }
+
+            fail("not in gzip format");
+        }
+
+        if (position + 10 > data.size() || data[position + 2] != 8) {
+            fail("unsupported gzip compression method");
+        }
+
+        const auto flags = static_cast<std::uint8_t>(data[position + 3]);
+        auto offset = position + 10;
+
+        if (flags & 4) { // FEXTRA
+            offset += 2 + readLE16(data, offset);
+        }
+
+        for (const std::uint8_t flag : {8, 16}) { // FNAME, FCOMMENT
+            if (flags & flag) {
+                const auto end = data.find('\0', offset);
+
+                if (end == std::string_view::npos) {
+                    fail("unexpected end of data");
+                }
+
+                offset = end + 1;
+            }
+        }
+
+        if (flags & 2) { // FHCRC
+            offset += 2;
+        }
+
+        if (offset > data.size()) {
+            fail("unexpected end of data");
+        }
+
+        const auto start = output.size();
+
+        offset += inflate(data.substr(offset), output);
+
+        const auto crc = readLE32(data, offset);
+        const auto size = readLE32(data, offset + 4);
+        const auto member = std::string_view(output).substr(start);
+
+        if (crc32(member) != crc || static_cast<std::uint32_t>(member.size()) != size) {
+            fail("corrupt gzip trailer");
+        }
+
+        position = offset + 8;
+    }
+
+    return output;
+}
+
+std::string Inflater::unzip(std::string_view data) {
+    if (!isZip(data)) {
+        fail("not in zip format");
+    }
+
+    std::string output{};
+
+    // The directory entries (their names end with '/') are skipped.
+    for (std::size_t position = 0; isZip(data.substr(std::min(position, data.size())));) {
+        const auto entry = readZipEntry(data, position, output);
+
+        if (!entry.name.ends_with('/')) {
+            return output;
+        }
+
+        position = entry.next;
+    }
+
+    fail("no file entry in zip");
+}
+
+std::uint32_t Inflater::crc32(std::string_view data, std::uint32_t crc) noexcept {
+    crc = ~crc;
+
+    for (const auto c : data) {
+        crc = CRC_TABLE[(crc ^ static_cast<std::uint8_t>(c)) & 0xFFU] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+DXFCPP_END_NAMESPACE
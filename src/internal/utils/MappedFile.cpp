@@ -0,0 +1,175 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../../include/dxfeed_graal_cpp_api/internal/utils/MappedFile.hpp"
+
+#include "../../../include/dxfeed_graal_cpp_api/exceptions/RuntimeException.hpp"
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+DXFCPP_BEGIN_NAMESPACE
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const StringLike &path) {
+    const std::string pathString = path;
+    const auto file = CreateFileA(pathString.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE) {
+        throw RuntimeException(fmt::format("Unable to open the file \"{}\"", pathString));
+    }
+
+    LARGE_INTEGER size{};
+
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+
+        throw RuntimeException(fmt::format("Unable to get the size of the file \"{}\"", pathString));
+    }
+
+    if (size.QuadPart == 0) {
+        CloseHandle(file);
+
+        return;
+    }
+
+    const auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    CloseHandle(file);
+
+    if (mapping == nullptr) {
+        throw RuntimeException(fmt::format("Unable to map the file \"{}\"", pathString));
+    }
+
+    const auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (data == nullptr) {
+        CloseHandle(mapping);
+
+        throw RuntimeException(fmt::format("Unable to map the file \"{}\"", pathString));
+    }
+
+    data_ = static_cast<const char *>(data);
+    size_ = static_cast<std::size_t>(size.QuadPart);
+    mapping_ = mapping;
+}
+
+void MappedFile::close() noexcept {
+    if (data_ != nullptr) {
+        UnmapViewOfFile(data_);
+    }
+
+    if (mapping_ != nullptr) {
+        CloseHandle(mapping_);
+    }
+
+    data_ = nullptr;
+    size_ = 0;
+    mapping_ = nullptr;
+}
+
+#else
+
+MappedFile::MappedFile(const StringLike &path) {
+    const std::string pathString = path;
+    const auto file = ::open(pathString.c_str(), O_RDONLY);
+
+    if (file < 0) {
+        throw RuntimeException(fmt::format("Unable to open the file \"{}\"", pathString));
+    }
+
+    struct stat status {};
+
+    if (::fstat(file, &status) != 0) {
+        ::close(file);
+
+        throw RuntimeException(fmt::format("Unable to get the size of the file \"{}\"", pathString));
+    }
+
+    if (status.st_size == 0) {
+        ::close(file);
+
+        return;
+    }
+
+    const auto data = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+    ::close(file);
+
+    if (data == MAP_FAILED) {
+        throw RuntimeException(fmt::format("Unable to map the file \"{}\"", pathString));
+    }
+
+    // The files are usually read from the beginning to the end.
+    ::madvise(data, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+
+    data_ = static_cast<const char *>(data);
+    size_ = static_cast<std::size_t>(status.st_size);
+}
+
+void MappedFile::close() noexcept {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<char *>(data_), size_);
+    }
+
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#endif
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)},
+      mapping_{std::exchange(other.mapping_, nullptr)} {
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+        close();
+
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mapping_ = std::exchange(other.mapping_, nullptr);
+    }
+
+    return *this;
+}
+
+MappedFile::~MappedFile() noexcept {
+    close();
+}
+
+std::int64_t MappedFile::getLastModified(const StringLike &path) noexcept {
+    std::error_code error{};
+    const auto lastWriteTime = std::filesystem::last_write_time(std::filesystem::path(std::string(path)), error);
+
+    if (error) {
+        return 0;
+    }
+
+    // std::chrono::clock_cast is not available in all the supported standard libraries.
+    const auto systemTime = std::chrono::time_point_cast<std::chrono::system_clock::duration>(
+        lastWriteTime - std::filesystem::file_time_type::clock::now() + std::chrono::system_clock::now());
+
+    return std::chrono::duration_cast<std::chrono::milliseconds>(systemTime.time_since_epoch()).count();
+}
+
+DXFCPP_END_NAMESPACE
@@ -5,7 +5,7 @@
 
 #include "../../../include/dxfeed_graal_cpp_api/internal/utils/StringUtils.hpp"
 
-#include "../../../include/dxfeed_graal_cpp_api/internal/TimeFormat.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/internal/NativeTimeFormat.hpp"
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -276,7 +276,7 @@ std::int16_t utf8to16(char in) noexcept {
 }
 
 std::string formatTimeStamp(std::int64_t timestamp) {
-    return TimeFormat::DEFAULT.format(timestamp);
+    return NativeTimeFormat::DEFAULT.format(timestamp);
 }
 
 std::string formatTimeStampWithTimeZone(std::int64_t timestamp) {
@@ -307,11 +307,11 @@ std::string formatTimeStampFast(std::int64_t timestamp) {
 }
 
 std::string formatTimeStampWithMillis(std::int64_t timestamp) {
-    return TimeFormat::DEFAULT_WITH_MILLIS.format(timestamp);
+    return NativeTimeFormat::DEFAULT_WITH_MILLIS.format(timestamp);
 }
 
 std::string formatTimeStampWithMillisWithTimeZone(std::int64_t timestamp) {
-    return TimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE.format(timestamp);
+    return NativeTimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE.format(timestamp);
 }
 
 char *createCString(const StringLike &s) {
@@ -0,0 +1,435 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/ipf/InstrumentProfileData.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/ipf/InstrumentProfile.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+using StringMember = std::string_view InstrumentProfileData::*;
+
+StringMember getStringMember(InstrumentProfileFieldEnum field) noexcept {
+    switch (field) {
+    case InstrumentProfileFieldEnum::TYPE:
+        return &InstrumentProfileData::type;
+    case InstrumentProfileFieldEnum::SYMBOL:
+        return &InstrumentProfileData::symbol;
+    case InstrumentProfileFieldEnum::DESCRIPTION:
+        return &InstrumentProfileData::description;
+    case InstrumentProfileFieldEnum::LOCAL_SYMBOL:
+        return &InstrumentProfileData::localSymbol;
+    case InstrumentProfileFieldEnum::LOCAL_DESCRIPTION:
+        return &InstrumentProfileData::localDescription;
+    case InstrumentProfileFieldEnum::COUNTRY:
+        return &InstrumentProfileData::country;
+    case InstrumentProfileFieldEnum::OPOL:
+        return &InstrumentProfileData::opol;
+    case InstrumentProfileFieldEnum::EXCHANGE_DATA:
+        return &InstrumentProfileData::exchangeData;
+    case InstrumentProfileFieldEnum::EXCHANGES:
+        return &InstrumentProfileData::exchanges;
+    case InstrumentProfileFieldEnum::CURRENCY:
+        return &InstrumentProfileData::currency;
+    case InstrumentProfileFieldEnum::BASE_CURRENCY:
+        return &InstrumentProfileData::baseCurrency;
+    case InstrumentProfileFieldEnum::CFI:
+        return &InstrumentProfileData::cfi;
+    case InstrumentProfileFieldEnum::ISIN:
+        return &InstrumentProfileData::isin;
+    case InstrumentProfileFieldEnum::SEDOL:
+        return &InstrumentProfileData::sedol;
+    case InstrumentProfileFieldEnum::CUSIP:
+        return &InstrumentProfileData::cusip;
+    case InstrumentProfileFieldEnum::PRODUCT:
+        return &InstrumentProfileData::product;
+    case InstrumentProfileFieldEnum::UNDERLYING:
+        return &InstrumentProfileData::underlying;
+    case InstrumentProfileFieldEnum::ADDITIONAL_UNDERLYINGS:
+        return &InstrumentProfileData::additionalUnderlyings;
+    case InstrumentProfileFieldEnum::MMY:
+        return &InstrumentProfileData::mmy;
+    case InstrumentProfileFieldEnum::OPTION_TYPE:
+        return &InstrumentProfileData::optionType;
+    case InstrumentProfileFieldEnum::EXPIRATION_STYLE:
+        return &InstrumentProfileData::expirationStyle;
+    case InstrumentProfileFieldEnum::SETTLEMENT_STYLE:
+        return &InstrumentProfileData::settlementStyle;
+    case InstrumentProfileFieldEnum::PRICE_INCREMENTS:
+        return &InstrumentProfileData::priceIncrements;
+    case InstrumentProfileFieldEnum::TRADING_HOURS:
+        return &InstrumentProfileData::tradingHours;
+    default:
+        return nullptr;
+    }
+}
+
+// Converts as Java does: NaN is 0, and the out-of-range values are clamped.
+std::int32_t toInt32(double value) noexcept {
+    if (std::isnan(value)) {
+        return 0;
+    }
+
+    return static_cast<std::int32_t>(std::clamp(value, static_cast<double>(std::numeric_limits<std::int32_t>::min()),
+                                                static_cast<double>(std::numeric_limits<std::int32_t>::max())));
+}
+
+// The number of days since 1970-01-01 (H. Hinnant's days_from_civil).
+std::int32_t getDayId(std::int32_t year, std::int32_t month, std::int32_t day) noexcept {
+    year -= month <= 2 ? 1 : 0;
+
+    const auto era = (year >= 0 ? year : year - 399) / 400;
+    const auto yearOfEra = year - era * 400;
+    const auto dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const auto dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+    return era * 146097 + dayOfEra - 719468;
+}
+
+} // namespace
+
+std::string_view InstrumentProfileStringPool::intern(std::string_view string) {
+    if (string.empty()) {
+        return {};
+    }
+
+    if (const auto found = strings_.find(string); found != strings_.end()) {
+        return *found;
+    }
+
+    bytes_ += string.size();
+
+    return *strings_.emplace(string).first;
+}
+
+std::string_view InstrumentProfileStringPool::store(std::string_view string) {
+    if (string.empty()) {
+        return {};
+    }
+
+    if (string.size() > blockLeft_) {
+        const auto size = std::max(BLOCK_SIZE, string.size());
+
+        blocks_.emplace_back(new char[size]);
+        blockNext_ = blocks_.back().get();
+        blockLeft_ = size;
+    }
+
+    auto *copy = blockNext_;
+
+    std::copy(string.begin(), string.end(), copy);
+    blockNext_ += string.size();
+    blockLeft_ -= string.size();
+    bytes_ += string.size();
+
+    return {copy, string.size()};
+}
+
+std::size_t InstrumentProfileStringPool::size() const noexcept {
+    return strings_.size();
+}
+
+std::size_t InstrumentProfileStringPool::getBytes() const noexcept {
+    return bytes_;
+}
+
+std::string_view InstrumentProfileData::getStringField(const InstrumentProfileField &field) const noexcept {
+    const auto member = getStringMember(field.getFieldEnum());
+
+    return member ? this->*member : std::string_view{};
+}
+
+void InstrumentProfileData::setStringField(const InstrumentProfileField &field, std::string_view value) noexcept {
+    if (const auto member = getStringMember(field.getFieldEnum())) {
+        this->*member = value;
+    }
+}
+
+double InstrumentProfileData::getNumericField(const InstrumentProfileField &field) const noexcept {
+    switch (field.getFieldEnum()) {
+    case InstrumentProfileFieldEnum::ICB:
+        return icb;
+    case InstrumentProfileFieldEnum::SIC:
+        return sic;
+    case InstrumentProfileFieldEnum::MULTIPLIER:
+        return multiplier;
+    case InstrumentProfileFieldEnum::SPC:
+        return spc;
+    case InstrumentProfileFieldEnum::EXPIRATION:
+        return expiration;
+    case InstrumentProfileFieldEnum::LAST_TRADE:
+        return lastTrade;
+    case InstrumentProfileFieldEnum::STRIKE:
+        return strike;
+    default:
+        return 0.0;
+    }
+}
+
+void InstrumentProfileData::setNumericField(const InstrumentProfileField &field, double value) noexcept {
+    switch (field.getFieldEnum()) {
+    case InstrumentProfileFieldEnum::ICB:
+        icb = toInt32(value);
+        break;
+    case InstrumentProfileFieldEnum::SIC:
+        sic = toInt32(value);
+        break;
+    case InstrumentProfileFieldEnum::MULTIPLIER:
+        multiplier = value;
+        break;
+    case InstrumentProfileFieldEnum::SPC:
+        spc = value;
+        break;
+    case InstrumentProfileFieldEnum::EXPIRATION:
+        expiration = toInt32(value);
+        break;
+    case InstrumentProfileFieldEnum::LAST_TRADE:
+        lastTrade = toInt32(value);
+        break;
+    case InstrumentProfileFieldEnum::STRIKE:
+        strike = value;
+        break;
+    default:
+        break;
+    }
+}
+
+std::string_view InstrumentProfileData::getField(std::string_view name) const noexcept {
+    if (const auto field = InstrumentProfileField::find(name)) {
+        return getStringField(field->get());
+    }
+
+    const auto found = std::find_if(customFields.begin(), customFields.end(), [name](const CustomField &customField) {
+        return customField.first == name;
+    });
+
+    return found == customFields.end() ? std::string_view{} : found->second;
+}
+
+void InstrumentProfileData::setField(std::string_view name, std::string_view value,
+                                     InstrumentProfileStringPool &pool) {
+    if (const auto field = InstrumentProfileField::find(name)) {
+        setField(field->get(), value, pool);
+
+        return;
+    }
+
+    const auto found = std::find_if(customFields.begin(), customFields.end(), [name](const CustomField &customField) {
+        return customField.first == name;
+    });
+
+    if (value.empty()) {
+        if (found != customFields.end()) {
+            customFields.erase(found);
+        }
+    } else if (found != customFields.end()) {
+        found->second = pool.intern(value);
+    } else {
+        customFields.emplace_back(pool.intern(name), pool.intern(value));
+    }
+}
+
+void InstrumentProfileData::setField(const InstrumentProfileField &field, std::string_view value,
+                                     InstrumentProfileStringPool &pool) {
+    switch (field.getTypeEnum()) {
+    case InstrumentProfileFieldTypeEnum::DOUBLE:
+        setNumericField(field, parseNumber(value));
+        break;
+    case InstrumentProfileFieldTypeEnum::DATE:
+        setNumericField(field, parseDate(value));
+        break;
+    default:
+        setStringField(field, pool.intern(value));
+        break;
+    }
+}
+
+void InstrumentProfileData::intern(InstrumentProfileStringPool &pool) {
+    for (auto member : {&InstrumentProfileData::type,
+                        &InstrumentProfileData::symbol,
+                        &InstrumentProfileData::description,
+                        &InstrumentProfileData::localSymbol,
+                        &InstrumentProfileData::localDescription,
+                        &InstrumentProfileData::country,
+                        &InstrumentProfileData::opol,
+                        &InstrumentProfileData::exchangeData,
+                        &InstrumentProfileData::exchanges,
+                        &InstrumentProfileData::currency,
+                        &InstrumentProfileData::baseCurrency,
+                        &InstrumentProfileData::cfi,
+                        &InstrumentProfileData::isin,
+                        &InstrumentProfileData::sedol,
+                        &InstrumentProfileData::cusip,
+                        &InstrumentProfileData::product,
+                        &InstrumentProfileData::underlying,
+                        &InstrumentProfileData::additionalUnderlyings,
+                        &InstrumentProfileData::mmy,
+                        &InstrumentProfileData::optionType,
+                        &InstrumentProfileData::expirationStyle,
+                        &InstrumentProfileData::settlementStyle,
+                        &InstrumentProfileData::priceIncrements,
+                        &InstrumentProfileData::tradingHours}) {
+        this->*member = pool.intern(this->*member);
+    }
+
+    for (auto &[name, value] : customFields) {
+        name = pool.intern(name);
+        value = pool.intern(value);
+    }
+}
+
+InstrumentProfileData InstrumentProfileData::fromProfile(const InstrumentProfile &profile,
+                                                         InstrumentProfileStringPool &pool) {
+    InstrumentProfileData data{};
+
+    data.type = pool.intern(profile.getType());
+    data.symbol = pool.intern(profile.getSymbol());
+    data.description = pool.intern(profile.getDescription());
+    data.localSymbol = pool.intern(profile.getLocalSymbol());
+    data.localDescription = pool.intern(profile.getLocalDescription());
+    data.country = pool.intern(profile.getCountry());
+    data.opol = pool.intern(profile.getOPOL());
+    data.exchangeData = pool.intern(profile.getExchangeData());
+    data.exchanges = pool.intern(profile.getExchanges());
+    data.currency = pool.intern(profile.getCurrency());
+    data.baseCurrency = pool.intern(profile.getBaseCurrency());
+    data.cfi = pool.intern(profile.getCFI());
+    data.isin = pool.intern(profile.getISIN());
+    data.sedol = pool.intern(profile.getSEDOL());
+    data.cusip = pool.intern(profile.getCUSIP());
+    data.icb = profile.getICB();
+    data.sic = profile.getSIC();
+    data.multiplier = profile.getMultiplier();
+    data.product = pool.intern(profile.getProduct());
+    data.underlying = pool.intern(profile.getUnderlying());
+    data.spc = profile.getSPC();
+    data.additionalUnderlyings = pool.intern(profile.getAdditionalUnderlyings());
+    data.mmy = pool.intern(profile.getMMY());
+    data.expiration = profile.getExpiration();
+    data.lastTrade = profile.getLastTrade();
+    data.strike = profile.getStrike();
+    data.optionType = pool.intern(profile.getOptionType());
+    data.expirationStyle = pool.intern(profile.getExpirationStyle());
+    data.settlementStyle = pool.intern(profile.getSettlementStyle());
+    data.priceIncrements = pool.intern(profile.getPriceIncrements());
+    data.tradingHours = pool.intern(profile.getTradingHours());
+
+    for (const auto &name : profile.getNonEmptyCustomFieldNames()) {
+        data.customFields.emplace_back(pool.intern(name), pool.intern(profile.getField(name)));
+    }
+
+    return data;
+}
+
+double InstrumentProfileData::parseNumber(std::string_view value) {
+    if (value.empty()) {
+        return 0.0;
+    }
+
+    // Only the decimal notation: [+-]digits[.digits][(e|E)[+-]digits] without inf, nan and hexadecimal numbers.
+    std::size_t position = value[0] == '+' || value[0] == '-' ? 1 : 0;
+    const auto skipDigits = [value, &position] {
+        const auto start = position;
+
+        while (position < value.size() && value[position] >= '0' && value[position] <= '9') {
+            position++;
+        }
+
+        return position - start;
+    };
+
+    auto digits = skipDigits();
+
+    if (position < value.size() && value[position] == '.') {
+        position++;
+        digits += skipDigits();
+    }
+
+    if (digits != 0 && position < value.size() && (value[position] == 'e' || value[position] == 'E')) {
+        position++;
+
+        if (position < value.size() && (value[position] == '+' || value[position] == '-')) {
+            position++;
+        }
+
+        digits = skipDigits();
+    }
+
+    if (digits == 0 || position != value.size()) {
+        throw InvalidArgumentException(fmt::format("Invalid number '{}'", value));
+    }
+
+    // std::from_chars is locale-independent, but it is not available for double in all the supported standard
+    // libraries, so the classic locale is used otherwise.
+    const auto text = value[0] == '+' ? value.substr(1) : value;
+    double result{};
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), result);
+    const bool ok = error == std::errc{} && end == text.data() + text.size();
+#else
+    std::istringstream stream{std::string(text)};
+
+    stream.imbue(std::locale::classic());
+    stream >> result;
+
+    const bool ok = !stream.fail() && stream.peek() == std::char_traits<char>::eof();
+#endif
+
+    if (!ok || !std::isfinite(result)) {
+        throw InvalidArgumentException(fmt::format("Invalid number '{}'", value));
+    }
+
+    return result;
+}
+
+std::int32_t InstrumentProfileData::parseDate(std::string_view value) {
+    if (value.empty()) {
+        return 0;
+    }
+
+    std::int32_t year{};
+    std::int32_t month{};
+    std::int32_t day{};
+
+    if (value.size() != 10 || value[4] != '-' || value[7] != '-' ||
+        std::from_chars(value.data(), value.data() + 4, year).ptr != value.data() + 4 ||
+        std::from_chars(value.data() + 5, value.data() + 7, month).ptr != value.data() + 7 ||
+        std::from_chars(value.data() + 8, value.data() + 10, day).ptr != value.data() + 10 || year < 0 ||
+        month < 1 || month > 12 || day < 1 || day > 31) {
+        throw InvalidArgumentException(fmt::format("Invalid date '{}'", value));
+    }
+
+    return getDayId(year, month, day);
+}
+
+void InstrumentProfileDataList::append(InstrumentProfileDataList &&other) {
+    pools.insert(pools.end(), std::make_move_iterator(other.pools.begin()), std::make_move_iterator(other.pools.end()));
+
+    if (profiles.empty() && profiles.capacity() < other.profiles.size()) {
+        profiles = std::move(other.profiles);
+    } else {
+        profiles.insert(profiles.end(), std::make_move_iterator(other.profiles.begin()),
+                        std::make_move_iterator(other.profiles.end()));
+    }
+
+    other.pools.clear();
+    other.profiles.clear();
+}
+
+DXFCPP_END_NAMESPACE
@@ -124,4 +124,19 @@ bool InstrumentProfileField::isNumericField() const {
     return numericField_;
 }
 
+bool InstrumentProfileField::isUniqueField() const noexcept {
+    switch (fieldEnum_) {
+    case InstrumentProfileFieldEnum::SYMBOL:
+    case InstrumentProfileFieldEnum::DESCRIPTION:
+    case InstrumentProfileFieldEnum::LOCAL_SYMBOL:
+    case InstrumentProfileFieldEnum::LOCAL_DESCRIPTION:
+    case InstrumentProfileFieldEnum::ISIN:
+    case InstrumentProfileFieldEnum::SEDOL:
+    case InstrumentProfileFieldEnum::CUSIP:
+        return true;
+    default:
+        return false;
+    }
+}
+
 DXFCPP_END_NAMESPACE
\ No newline at end of file
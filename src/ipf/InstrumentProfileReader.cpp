@@ -13,6 +13,26 @@
 
 DXFCPP_BEGIN_NAMESPACE
 
+namespace {
+
+InstrumentProfileDataList toDataList(std::vector<std::shared_ptr<InstrumentProfile>> &&profiles) {
+    InstrumentProfileDataList result{};
+    auto pool = std::make_shared<InstrumentProfileStringPool>();
+
+    result.profiles.reserve(profiles.size());
+
+    for (auto &profile : profiles) {
+        result.profiles.push_back(InstrumentProfileData::fromProfile(*profile, *pool));
+        profile.reset();
+    }
+
+    result.pools.push_back(std::move(pool));
+
+    return result;
+}
+
+} // namespace
+
 InstrumentProfileReader::InstrumentProfileReader() : id_{Id<InstrumentProfileReader>::UNKNOWN} {
     handle_ = isolated::ipf::IsolatedInstrumentProfileReader::create();
 }
@@ -65,4 +85,18 @@ std::vector<std::shared_ptr<InstrumentProfile>> InstrumentProfileReader::readFro
     return result;
 }
 
+InstrumentProfileDataList InstrumentProfileReader::readDataFromFile(const StringLike &address) const {
+    return toDataList(readFromFile(address));
+}
+
+InstrumentProfileDataList InstrumentProfileReader::readDataFromFile(const StringLike &address, const StringLike &user,
+                                                                    const StringLike &password) const {
+    return toDataList(readFromFile(address, user, password));
+}
+
+InstrumentProfileDataList InstrumentProfileReader::readDataFromFile(const StringLike &address,
+                                                                    const AuthToken &token) const {
+    return toDataList(readFromFile(address, token));
+}
+
 DXFCPP_END_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,674 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/ipf/InstrumentProfileSnapshot.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/exceptions/RuntimeException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/ipf/NativeInstrumentProfileReader.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+// The standard fields in the order of InstrumentProfileFieldEnum.
+const InstrumentProfileField *const FIELDS[] = {
+    &InstrumentProfileField::TYPE,
+    &InstrumentProfileField::SYMBOL,
+    &InstrumentProfileField::DESCRIPTION,
+    &InstrumentProfileField::LOCAL_SYMBOL,
+    &InstrumentProfileField::LOCAL_DESCRIPTION,
+    &InstrumentProfileField::COUNTRY,
+    &InstrumentProfileField::OPOL,
+    &InstrumentProfileField::EXCHANGE_DATA,
+    &InstrumentProfileField::EXCHANGES,
+    &InstrumentProfileField::CURRENCY,
+    &InstrumentProfileField::BASE_CURRENCY,
+    &InstrumentProfileField::CFI,
+    &InstrumentProfileField::ISIN,
+    &InstrumentProfileField::SEDOL,
+    &InstrumentProfileField::CUSIP,
+    &InstrumentProfileField::ICB,
+    &InstrumentProfileField::SIC,
+    &InstrumentProfileField::MULTIPLIER,
+    &InstrumentProfileField::PRODUCT,
+    &InstrumentProfileField::UNDERLYING,
+    &InstrumentProfileField::SPC,
+    &InstrumentProfileField::ADDITIONAL_UNDERLYINGS,
+    &InstrumentProfileField::MMY,
+    &InstrumentProfileField::EXPIRATION,
+    &InstrumentProfileField::LAST_TRADE,
+    &InstrumentProfileField::STRIKE,
+    &InstrumentProfileField::OPTION_TYPE,
+    &InstrumentProfileField::EXPIRATION_STYLE,
+    &InstrumentProfileField::SETTLEMENT_STYLE,
+    &InstrumentProfileField::PRICE_INCREMENTS,
+    &InstrumentProfileField::TRADING_HOURS,
+};
+
+constexpr std::size_t FIELD_COUNT = std::size(FIELDS);
+constexpr char MAGIC[8] = {'D', 'X', 'F', 'I', 'P', 'F', 'S', '\0'};
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr std::uint32_t COMPLETE_FLAG = 1;
+constexpr std::uint64_t MAX_SIZE = std::numeric_limits<std::uint32_t>::max();
+constexpr std::size_t BLOCK_SIZE = 64 * 1024; // The number of the profiles that are written at once.
+
+// The layout of the file:
+//   Header
+//   The columns of the standard fields in the order of FIELDS (8 bytes per profile: StringRef or double). The columns
+//   with only the empty values are omitted (their offsets are 0).
+//   The offsets of the custom fields of the profiles (std::uint32_t[profileCount + 1]).
+//   The custom fields (a pair of StringRef, the name and the value).
+//   The indexes of the profiles with the non-empty symbol and underlying sorted by them (std::uint32_t).
+//   The strings.
+// All the sections except the strings are aligned by 8 bytes.
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+    std::uint32_t flags;
+    std::uint32_t fieldCount;
+    std::int64_t lastModified;
+    std::uint64_t profileCount;
+    std::uint64_t fileSize;
+    std::uint64_t columnOffsets[FIELD_COUNT];
+    std::uint64_t customOffsetsOffset;
+    std::uint64_t customFieldsOffset;
+    std::uint64_t customFieldCount;
+    std::uint64_t symbolIndexOffset;
+    std::uint64_t symbolIndexSize;
+    std::uint64_t underlyingIndexOffset;
+    std::uint64_t underlyingIndexSize;
+    std::uint64_t stringsOffset;
+    std::uint64_t stringsSize;
+};
+
+struct StringRef {
+    std::uint32_t offset;
+    std::uint32_t length;
+};
+
+static_assert(sizeof(Header) % 8 == 0);
+static_assert(sizeof(StringRef) == 8 && sizeof(double) == 8);
+
+std::size_t getColumn(const InstrumentProfileField &field) noexcept {
+    return static_cast<std::size_t>(field.getFieldEnum());
+}
+
+// The strings of the snapshot. The shared strings are deduplicated.
+struct StringTable {
+    private:
+    std::string data_{};
+    std::unordered_map<std::string_view, StringRef> shared_{};
+
+    public:
+    StringRef add(std::string_view string, bool unique) {
+        if (string.empty()) {
+            return {};
+        }
+
+        if (!unique) {
+            if (const auto found = shared_.find(string); found != shared_.end()) {
+                return found->second;
+            }
+        }
+
+        if (data_.size() + string.size() > MAX_SIZE) {
+            throw RuntimeException("The strings of the instrument profiles are too large for the snapshot");
+        }
+
+        const StringRef ref{static_cast<std::uint32_t>(data_.size()), static_cast<std::uint32_t>(string.size())};
+
+        data_.append(string);
+
+        if (!unique) {
+            // The key refers to the source profiles, which outlive the table.
+            shared_.emplace(string, ref);
+        }
+
+        return ref;
+    }
+
+    const std::string &getData() const noexcept {
+        return data_;
+    }
+};
+
+struct FileWriter {
+    private:
+    std::ofstream out_;
+    std::string path_;
+    std::uint64_t position_ = 0;
+
+    public:
+    explicit FileWriter(const std::string &path) : out_(path, std::ios::binary | std::ios::trunc), path_(path) {
+        if (!out_) {
+            throw RuntimeException(fmt::format("Unable to create the file \"{}\"", path_));
+        }
+    }
+
+    std::uint64_t getPosition() const noexcept {
+        return position_;
+    }
+
+    void seek(std::uint64_t position) {
+        out_.seekp(static_cast<std::streamoff>(position));
+        position_ = position;
+    }
+
+    void write(const void *data, std::size_t size) {
+        out_.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+        position_ += size;
+
+        if (!out_) {
+            throw RuntimeException(fmt::format("Unable to write the file \"{}\"", path_));
+        }
+    }
+
+    template <typename T> void write(const std::vector<T> &values) {
+        write(values.data(), values.size() * sizeof(T));
+    }
+
+    void align() {
+        constexpr char ZEROS[8]{};
+
+        write(ZEROS, (8 - position_ % 8) % 8);
+    }
+
+    void writeHeader(const Header &header) {
+        out_.seekp(0);
+        out_.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+        out_.close();
+
+        if (!out_) {
+            throw RuntimeException(fmt::format("Unable to write the file \"{}\"", path_));
+        }
+    }
+};
+
+bool isEmpty(const InstrumentProfileData &profile, const InstrumentProfileField &field) noexcept {
+    if (field.isNumericField()) {
+        const auto value = profile.getNumericField(field);
+        std::uint64_t bits{};
+
+        std::memcpy(&bits, &value, sizeof(value));
+
+        return bits == 0;
+    }
+
+    return profile.getStringField(field).empty();
+}
+
+// Returns the indexes of the profiles with the non-empty values of the field sorted by the values and the indexes.
+std::vector<std::uint32_t> createIndex(const std::vector<InstrumentProfileData> &list,
+                                       std::string_view InstrumentProfileData::*field) {
+    // The values are copied, so the sorting doesn't access the profiles.
+    std::vector<std::pair<std::string_view, std::uint32_t>> entries{};
+
+    entries.reserve(list.size());
+
+    for (std::size_t i = 0; i < list.size(); i++) {
+        if (const auto value = list[i].*field; !value.empty()) {
+            entries.emplace_back(value, static_cast<std::uint32_t>(i));
+        }
+    }
+
+    std::sort(entries.begin(), entries.end());
+
+    std::vector<std::uint32_t> result(entries.size());
+
+    std::transform(entries.begin(), entries.end(), result.begin(), [](const auto &entry) {
+        return entry.second;
+    });
+
+    return result;
+}
+
+template <typename T> T load(const char *data, std::size_t index) noexcept {
+    T result;
+
+    std::memcpy(&result, data + index * sizeof(T), sizeof(T));
+
+    return result;
+}
+
+} // namespace
+
+InstrumentProfileSnapshot::InstrumentProfileSnapshot(LockExternalConstructionTag, MappedFile &&file,
+                                                     std::string_view path)
+    : file_{std::move(file)} {
+    static_assert(std::size(FIELDS) == FIELD_COUNT);
+
+    const auto fail = [path](std::string_view reason) {
+        return RuntimeException(fmt::format("Invalid instrument profile snapshot \"{}\": {}", path, reason));
+    };
+
+    const auto data = file_.data();
+    const std::uint64_t fileSize = file_.size();
+
+    if (fileSize < sizeof(Header)) {
+        throw fail("the file is too small");
+    }
+
+    const auto header = load<Header>(data, 0);
+
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw fail("not a snapshot");
+    }
+
+    if (header.version != VERSION) {
+        throw fail(fmt::format("unsupported version {}", header.version));
+    }
+
+    if (header.byteOrderMark != BYTE_ORDER_MARK) {
+        throw fail("the byte order of the platform is different");
+    }
+
+    if (header.fieldCount != FIELD_COUNT || header.fileSize != fileSize || header.profileCount > MAX_SIZE ||
+        header.customFieldCount > MAX_SIZE || header.symbolIndexSize > header.profileCount ||
+        header.underlyingIndexSize > header.profileCount ||
+        header.stringsOffset > fileSize || header.stringsSize > fileSize - header.stringsOffset) {
+        throw fail("the header is corrupted");
+    }
+
+    const auto count = header.profileCount;
+
+    const auto section = [&](std::uint64_t offset, std::uint64_t size) {
+        if (offset % 8 != 0 || offset > fileSize || size > fileSize - offset) {
+            throw fail("the section is out of the file");
+        }
+
+        return data + offset;
+    };
+
+    const auto toIndexes = [](const char *section, std::uint64_t size) {
+        return std::span<const std::uint32_t>(reinterpret_cast<const std::uint32_t *>(section), size);
+    };
+
+    lastModified_ = header.lastModified;
+    complete_ = (header.flags & COMPLETE_FLAG) != 0;
+    size_ = static_cast<std::size_t>(count);
+    strings_ = std::string_view(data + header.stringsOffset, header.stringsSize);
+
+    for (std::size_t i = 0; i < FIELD_COUNT; i++) {
+        if (header.columnOffsets[i] != 0) {
+            columns_[i] = section(header.columnOffsets[i], count * 8);
+        }
+    }
+
+    customOffsets_ = toIndexes(section(header.customOffsetsOffset, (count + 1) * 4), count + 1);
+    customEntries_ = section(header.customFieldsOffset, header.customFieldCount * 16);
+    symbolIndex_ =
+        toIndexes(section(header.symbolIndexOffset, header.symbolIndexSize * 4), header.symbolIndexSize);
+    underlyingIndex_ =
+        toIndexes(section(header.underlyingIndexOffset, header.underlyingIndexSize * 4), header.underlyingIndexSize);
+
+    // The references are checked once, so the accessors don't check them.
+    const auto checkStrings = [&](const char *column, std::uint64_t refCount) {
+        for (std::size_t i = 0; column != nullptr && i < refCount; i++) {
+            const auto ref = load<StringRef>(column, i);
+
+            if (static_cast<std::uint64_t>(ref.offset) + ref.length > header.stringsSize) {
+                throw fail("the string is out of the file");
+            }
+        }
+    };
+
+    for (const auto field : FIELDS) {
+        if (!field->isNumericField()) {
+            checkStrings(columns_[getColumn(*field)], count);
+        }
+    }
+
+    checkStrings(customEntries_, header.customFieldCount * 2);
+
+    if (customOffsets_.front() != 0 || customOffsets_.back() != header.customFieldCount ||
+        !std::is_sorted(customOffsets_.begin(), customOffsets_.end())) {
+        throw fail("the custom fields are corrupted");
+    }
+
+    const auto isValidIndex = [count](std::uint32_t index) {
+        return index < count;
+    };
+
+    if (!std::all_of(symbolIndex_.begin(), symbolIndex_.end(), isValidIndex) ||
+        !std::all_of(underlyingIndex_.begin(), underlyingIndex_.end(), isValidIndex)) {
+        throw fail("the indexes are corrupted");
+    }
+}
+
+void InstrumentProfileSnapshot::write(const StringLike &path, const InstrumentProfileDataList &profiles,
+                                      std::int64_t lastModified, bool complete) {
+    const auto &list = profiles.profiles;
+    const auto count = list.size();
+
+    if (count > MAX_SIZE) {
+        throw RuntimeException(fmt::format("Too many instrument profiles for the snapshot: {}", count));
+    }
+
+    const std::string pathString = path;
+    const auto temporaryPath = pathString + ".tmp";
+    Header header{};
+
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    header.flags = complete ? COMPLETE_FLAG : 0;
+    header.fieldCount = static_cast<std::uint32_t>(FIELD_COUNT);
+    header.lastModified = lastModified;
+    header.profileCount = count;
+
+    try {
+        FileWriter writer(temporaryPath);
+        StringTable strings{};
+
+        // The columns with only the empty values are omitted, so they are found first.
+        bool present[FIELD_COUNT]{};
+
+        for (const auto &profile : list) {
+            for (std::size_t c = 0; c < FIELD_COUNT; c++) {
+                present[c] = present[c] || !isEmpty(profile, *FIELDS[c]);
+            }
+        }
+
+        std::uint64_t position = sizeof(Header);
+
+        for (std::size_t c = 0; c < FIELD_COUNT; c++) {
+            if (present[c]) {
+                header.columnOffsets[c] = position;
+                position += count * 8;
+            }
+        }
+
+        // The profiles are converted by blocks in their order, and each block is written to all the columns.
+        std::vector<std::uint64_t> block(FIELD_COUNT * BLOCK_SIZE);
+        std::string_view lastValues[FIELD_COUNT]{};
+        StringRef lastRefs[FIELD_COUNT]{};
+
+        for (std::size_t blockBegin = 0; blockBegin < count; blockBegin += BLOCK_SIZE) {
+            const auto blockSize = std::min(BLOCK_SIZE, count - blockBegin);
+
+            for (std::size_t i = 0; i < blockSize; i++) {
+                const auto &profile = list[blockBegin + i];
+
+                for (std::size_t c = 0; c < FIELD_COUNT; c++) {
+                    const auto &field = *FIELDS[c];
+
+                    if (!present[c]) {
+                        continue;
+                    }
+
+                    if (field.isNumericField()) {
+                        const auto value = profile.getNumericField(field);
+
+                        std::memcpy(&block[c * BLOCK_SIZE + i], &value, sizeof(value));
+
+                        continue;
+                    }
+
+                    const auto value = profile.getStringField(field);
+
+                    // The neighbouring profiles usually have the same values of the shared fields.
+                    if (const auto unique = field.isUniqueField(); unique || value != lastValues[c]) {
+                        lastValues[c] = value;
+                        lastRefs[c] = strings.add(value, unique);
+                    }
+
+                    std::memcpy(&block[c * BLOCK_SIZE + i], &lastRefs[c], sizeof(StringRef));
+                }
+            }
+
+            for (std::size_t c = 0; c < FIELD_COUNT; c++) {
+                if (present[c]) {
+                    writer.seek(header.columnOffsets[c] + blockBegin * 8);
+                    writer.write(&block[c * BLOCK_SIZE], blockSize * 8);
+                }
+            }
+        }
+
+        writer.seek(position);
+
+        std::vector<std::uint32_t> customOffsets{};
+        std::vector<StringRef> customFields{};
+
+        customOffsets.reserve(count + 1);
+        customOffsets.push_back(0);
+
+        for (const auto &profile : list) {
+            for (const auto &[name, value] : profile.customFields) {
+                customFields.push_back(strings.add(name, false));
+                customFields.push_back(strings.add(value, false));
+            }
+
+            if (customFields.size() / 2 > MAX_SIZE) {
+                throw RuntimeException("Too many custom fields of the instrument profiles for the snapshot");
+            }
+
+            customOffsets.push_back(static_cast<std::uint32_t>(customFields.size() / 2));
+        }
+
+        header.customOffsetsOffset = writer.getPosition();
+        writer.write(customOffsets);
+        writer.align();
+        header.customFieldsOffset = writer.getPosition();
+        header.customFieldCount = customFields.size() / 2;
+        writer.write(customFields);
+
+        const auto symbolIndex = createIndex(list, &InstrumentProfileData::symbol);
+
+        header.symbolIndexOffset = writer.getPosition();
+        header.symbolIndexSize = symbolIndex.size();
+        writer.write(symbolIndex);
+        writer.align();
+
+        const auto underlyingIndex = createIndex(list, &InstrumentProfileData::underlying);
+
+        header.underlyingIndexOffset = writer.getPosition();
+        header.underlyingIndexSize = underlyingIndex.size();
+        writer.write(underlyingIndex);
+        writer.align();
+
+        header.stringsOffset = writer.getPosition();
+        header.stringsSize = strings.getData().size();
+        writer.write(strings.getData().data(), strings.getData().size());
+
+        header.fileSize = writer.getPosition();
+        writer.writeHeader(header);
+    } catch (...) {
+        std::error_code ignored{};
+
+        std::filesystem::remove(temporaryPath, ignored);
+
+        throw;
+    }
+
+    std::error_code error{};
+
+    std::filesystem::rename(temporaryPath, pathString, error);
+
+    if (error) {
+        std::filesystem::remove(temporaryPath, error);
+
+        throw RuntimeException(fmt::format("Unable to rename the file \"{}\" to \"{}\"", temporaryPath, pathString));
+    }
+}
+
+InstrumentProfileSnapshot::Ptr InstrumentProfileSnapshot::open(const StringLike &path) {
+    const std::string pathString = path;
+
+    return createShared(MappedFile(pathString), pathString);
+}
+
+InstrumentProfileSnapshot::Ptr InstrumentProfileSnapshot::loadOrRead(const StringLike &snapshotPath,
+                                                                     const StringLike &sourcePath) {
+    std::string_view sourcePathView = sourcePath;
+
+    if (sourcePathView.starts_with("file:")) {
+        sourcePathView.remove_prefix(5);
+    }
+
+    const std::string sourcePathString(sourcePathView);
+    const std::string snapshotPathString = snapshotPath;
+
+    if (std::error_code error{}; std::filesystem::exists(snapshotPathString, error)) {
+        try {
+            if (auto snapshot = open(snapshotPathString);
+                snapshot->isValidFor(MappedFile::getLastModified(sourcePathString))) {
+                return snapshot;
+            }
+        } catch (const RuntimeException &) {
+            // The snapshot of another version or a corrupted one is replaced.
+        }
+    }
+
+    auto reader = NativeInstrumentProfileReader::create();
+    const auto profiles = reader->readFromFile(sourcePathString);
+
+    write(snapshotPathString, profiles, reader->getLastModified(), reader->wasComplete());
+
+    return open(snapshotPathString);
+}
+
+std::int64_t InstrumentProfileSnapshot::getLastModified() const noexcept {
+    return lastModified_;
+}
+
+bool InstrumentProfileSnapshot::wasComplete() const noexcept {
+    return complete_;
+}
+
+bool InstrumentProfileSnapshot::isValidFor(std::int64_t lastModified) const noexcept {
+    return complete_ && lastModified != 0 && lastModified_ == lastModified;
+}
+
+std::size_t InstrumentProfileSnapshot::size() const noexcept {
+    return size_;
+}
+
+bool InstrumentProfileSnapshot::empty() const noexcept {
+    return size_ == 0;
+}
+
+std::string_view InstrumentProfileSnapshot::getString(const char *column, std::size_t index) const noexcept {
+    if (column == nullptr) {
+        return {};
+    }
+
+    const auto ref = load<StringRef>(column, index);
+
+    return {strings_.data() + ref.offset, ref.length};
+}
+
+std::string_view InstrumentProfileSnapshot::getStringField(std::size_t index,
+                                                           const InstrumentProfileField &field) const noexcept {
+    if (field.isNumericField()) {
+        return {};
+    }
+
+    return getString(columns_[getColumn(field)], index);
+}
+
+double InstrumentProfileSnapshot::getNumericField(std::size_t index,
+                                                  const InstrumentProfileField &field) const noexcept {
+    const auto column = columns_[getColumn(field)];
+
+    if (!field.isNumericField() || column == nullptr) {
+        return 0;
+    }
+
+    return load<double>(column, index);
+}
+
+InstrumentProfileData InstrumentProfileSnapshot::getProfile(std::size_t index) const {
+    InstrumentProfileData profile{};
+
+    for (const auto field : FIELDS) {
+        if (field->isNumericField()) {
+            profile.setNumericField(*field, getNumericField(index, *field));
+        } else {
+            profile.setStringField(*field, getStringField(index, *field));
+        }
+    }
+
+    const auto customBegin = customOffsets_[index];
+    const auto customEnd = customOffsets_[index + 1];
+
+    profile.customFields.reserve(customEnd - customBegin);
+
+    for (auto i = customBegin; i < customEnd; i++) {
+        profile.customFields.emplace_back(getString(customEntries_, i * 2), getString(customEntries_, i * 2 + 1));
+    }
+
+    return profile;
+}
+
+std::optional<std::size_t> InstrumentProfileSnapshot::findBySymbol(std::string_view symbol) const noexcept {
+    const auto column = columns_[getColumn(InstrumentProfileField::SYMBOL)];
+    const auto found =
+        std::lower_bound(symbolIndex_.begin(), symbolIndex_.end(), symbol, [&](std::uint32_t index, auto value) {
+            return getString(column, index) < value;
+        });
+
+    if (found == symbolIndex_.end() || getString(column, *found) != symbol) {
+        return std::nullopt;
+    }
+
+    return *found;
+}
+
+std::span<const std::uint32_t>
+InstrumentProfileSnapshot::findByUnderlying(std::string_view underlying) const noexcept {
+    const auto column = columns_[getColumn(InstrumentProfileField::UNDERLYING)];
+    const auto begin = std::lower_bound(underlyingIndex_.begin(), underlyingIndex_.end(), underlying,
+                                        [&](std::uint32_t index, auto value) {
+                                            return getString(column, index) < value;
+                                        });
+    const auto end =
+        std::upper_bound(begin, underlyingIndex_.end(), underlying, [&](auto value, std::uint32_t index) {
+            return value < getString(column, index);
+        });
+
+    return {begin, end};
+}
+
+InstrumentProfileDataList InstrumentProfileSnapshot::toDataList() const {
+    InstrumentProfileDataList result{};
+    auto pool = std::make_shared<InstrumentProfileStringPool>();
+
+    result.profiles.reserve(size_);
+
+    for (std::size_t i = 0; i < size_; i++) {
+        auto profile = getProfile(i);
+
+        for (const auto field : FIELDS) {
+            if (const auto value = profile.getStringField(*field); !value.empty()) {
+                profile.setStringField(*field, field->isUniqueField() ? pool->store(value) : pool->intern(value));
+            }
+        }
+
+        for (auto &[name, value] : profile.customFields) {
+            name = pool->intern(name);
+            value = pool->intern(value);
+        }
+
+        result.profiles.push_back(std::move(profile));
+    }
+
+    result.pools.push_back(std::move(pool));
+
+    return result;
+}
+
+DXFCPP_END_NAMESPACE
@@ -0,0 +1,530 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/ipf/NativeInstrumentProfileReader.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/exceptions/RuntimeException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/Platform.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/utils/Inflater.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/utils/MappedFile.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/utils/ParallelUtils.hpp"
+#include "../../include/dxfeed_graal_cpp_api/ipf/InstrumentProfileField.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+// The names of the fields of a type, starting with "TYPE".
+using Format = std::vector<std::string>;
+using Formats = std::unordered_map<std::string, std::shared_ptr<const Format>, StringHash, std::equal_to<>>;
+
+// Reads the CSV records of the text: the fields are separated by commas, and the quoted fields can contain commas,
+// line breaks and doubled quotes.
+struct CsvReader {
+    struct Span {
+        std::size_t offset;
+        std::size_t length;
+        bool unescaped;
+    };
+
+    std::string_view text;
+    std::size_t baseOffset;
+    std::size_t position = 0;
+    std::size_t recordOffset = 0;
+    std::vector<std::string_view> fields{};
+
+    private:
+    std::vector<Span> spans_{};
+    std::string unescaped_{};
+
+    public:
+    CsvReader(std::string_view text, std::size_t baseOffset) : text{text}, baseOffset{baseOffset} {
+    }
+
+    // Reads the next record into the fields. Returns `false` at the end of the text.
+    bool next() {
+        fields.clear();
+
+        if (position >= text.size()) {
+            return false;
+        }
+
+        spans_.clear();
+        unescaped_.clear();
+        recordOffset = position;
+
+        const auto *data = text.data();
+        const auto size = text.size();
+
+        for (;;) {
+            if (position < size && data[position] == '"') {
+                const auto start = unescaped_.size();
+
+                position++;
+
+                for (;;) {
+                    const auto quote = text.find('"', position);
+
+                    if (quote == std::string_view::npos) {
+                        throw RuntimeException(
+                            fmt::format("Unterminated quoted field at offset {}", baseOffset + recordOffset));
+                    }
+
+                    unescaped_.append(data + position, quote - position);
+                    position = quote + 1;
+
+                    if (position < size && data[position] == '"') {
+                        unescaped_.push_back('"');
+                        position++;
+                    } else {
+                        break;
+                    }
+                }
+
+                spans_.push_back({start, unescaped_.size() - start, true});
+            } else {
+                const auto start = position;
+
+                while (position < size && data[position] != ',' && data[position] != '\n') {
+                    position++;
+                }
+
+                auto end = position;
+
+                if (end > start && data[end - 1] == '\r' && (position >= size || data[position] == '\n')) {
+                    end--;
+                }
+
+                spans_.push_back({start, end - start, false});
+            }
+
+            if (position >= size) {
+                break;
+            }
+
+            const auto c = data[position++];
+
+            if (c == ',') {
+                continue;
+            }
+
+            if (c == '\r' && position < size && data[position] == '\n') {
+                position++;
+            } else if (c != '\n') {
+                throw RuntimeException(
+                    fmt::format("Unexpected character after quoted field at offset {}", baseOffset + position - 1));
+            }
+
+            break;
+        }
+
+        const std::string_view unescaped = unescaped_;
+
+        for (const auto &span : spans_) {
+            fields.push_back(span.unescaped ? unescaped.substr(span.offset, span.length)
+                                            : text.substr(span.offset, span.length));
+        }
+
+        return true;
+    }
+};
+
+// The odd number of quotes before a position means that the position is within a quoted field.
+bool hasOddQuotes(std::string_view text, std::size_t begin, std::size_t end) {
+    return std::count(text.data() + begin, text.data() + end, '"') % 2 != 0;
+}
+
+// Returns the position after the line break that ends the record starting at the specified position (the quoted line
+// breaks are skipped).
+std::size_t findRecordEnd(std::string_view text, std::size_t position) {
+    bool quoted = false;
+
+    for (;;) {
+        const auto lineEnd = text.find('\n', position);
+        const auto end = lineEnd == std::string_view::npos ? text.size() : lineEnd;
+
+        quoted ^= hasOddQuotes(text, position, end);
+
+        if (!quoted || end == text.size()) {
+            return std::min(end + 1, text.size());
+        }
+
+        position = end + 1;
+    }
+}
+
+// Splits the text into the chunks of approximately the specified size at the record boundaries.
+std::vector<std::size_t> split(std::string_view text, std::size_t chunkSize) {
+    std::vector<std::size_t> boundaries{0};
+
+    while (boundaries.back() + chunkSize < text.size()) {
+        const auto start = boundaries.back();
+        const auto target = start + chunkSize;
+        bool quoted = hasOddQuotes(text, start, target);
+        auto position = target;
+
+        for (;;) {
+            const auto lineEnd = text.find('\n', position);
+
+            if (lineEnd == std::string_view::npos) {
+                position = text.size();
+
+                break;
+            }
+
+            quoted ^= hasOddQuotes(text, position, lineEnd);
+            position = lineEnd + 1;
+
+            if (!quoted) {
+                break;
+            }
+        }
+
+        if (position >= text.size()) {
+            break;
+        }
+
+        boundaries.push_back(position);
+    }
+
+    boundaries.push_back(text.size());
+
+    return boundaries;
+}
+
+// Parses the format record ("#TYPE::=TYPE,SYMBOL,..."). Returns `std::nullopt` for the comments and the "##COMPLETE"
+// tag.
+std::optional<std::pair<std::string, std::shared_ptr<const Format>>>
+parseFormat(const std::vector<std::string_view> &fields, std::size_t offset, bool &complete) {
+    const auto first = fields.front();
+
+    if (first == "##COMPLETE") {
+        complete = true;
+
+        return std::nullopt;
+    }
+
+    if (first.starts_with("##")) {
+        return std::nullopt;
+    }
+
+    const auto separator = first.find("::=");
+
+    if (separator == std::string_view::npos) {
+        throw RuntimeException(fmt::format("'::=' expected in the format at offset {}", offset));
+    }
+
+    if (first.substr(separator + 3) != "TYPE") {
+        throw RuntimeException(fmt::format("TYPE field expected in the format at offset {}", offset));
+    }
+
+    auto format = std::make_shared<Format>();
+
+    format->reserve(fields.size());
+    format->emplace_back("TYPE");
+
+    for (std::size_t i = 1; i < fields.size(); i++) {
+        format->emplace_back(fields[i]);
+    }
+
+    return std::make_pair(std::string(first.substr(1, separator - 1)), std::move(format));
+}
+
+// The formats that are defined in a chunk, in order, and the number of the profiles in it.
+struct ChunkSummary {
+    std::vector<std::pair<std::string, std::shared_ptr<const Format>>> definitions{};
+    std::size_t profileCount = 0;
+    bool complete = false;
+};
+
+// Returns `true` if the record is empty (contains a single empty field).
+bool isEmptyRecord(const std::vector<std::string_view> &fields) noexcept {
+    return fields.size() == 1 && fields.front().empty();
+}
+
+ChunkSummary scanChunk(std::string_view text, std::size_t begin, std::size_t end) {
+    ChunkSummary result{};
+
+    for (auto position = begin; position < end;) {
+        const auto recordEnd = findRecordEnd(text, position);
+
+        if (text[position] == '#' || text[position] == '"') {
+            CsvReader reader{text.substr(position, recordEnd - position), position};
+
+            reader.next();
+
+            if (!reader.fields.front().starts_with('#')) {
+                result.profileCount += isEmptyRecord(reader.fields) ? 0 : 1;
+            } else if (auto definition = parseFormat(reader.fields, position, result.complete)) {
+                result.definitions.push_back(std::move(*definition));
+            }
+        } else {
+            // The same as the empty record of CsvReader: no characters except the line break.
+            auto line = text.substr(position, recordEnd - position);
+
+            if (line.ends_with('\n')) {
+                line.remove_suffix(1);
+            }
+
+            if (line.ends_with('\r')) {
+                line.remove_suffix(1);
+            }
+
+            result.profileCount += line.empty() ? 0 : 1;
+        }
+
+        position = recordEnd;
+    }
+
+    return result;
+}
+
+struct Column {
+    enum class Kind { NUMERIC, UNIQUE, SHARED, CUSTOM };
+
+    Kind kind;
+    const InstrumentProfileField *field;
+    std::string_view customName;
+
+    // The last interned value. The values of most columns are repeated in the consecutive records, so they are
+    // compared with it before the interning.
+    std::string_view lastValue{};
+};
+
+// Parses the profiles of the chunk into the specified place of the result.
+void parseChunk(std::string_view text, std::size_t begin, std::size_t end, Formats formats,
+                InstrumentProfileData *profiles, std::size_t profileCount, InstrumentProfileStringPool &pool) {
+    std::unordered_map<std::string, std::vector<Column>, StringHash, std::equal_to<>> layouts{};
+    std::string_view lastType{};
+    std::vector<Column> *lastColumns = nullptr;
+    CsvReader reader{text.substr(begin, end - begin), begin};
+    std::size_t count = 0;
+    bool complete = false;
+
+    while (reader.next()) {
+        const auto &fields = reader.fields;
+        const auto type = fields.front();
+
+        if (type.starts_with('#')) {
+            if (auto definition = parseFormat(fields, begin + reader.recordOffset, complete)) {
+                layouts.erase(definition->first);
+                formats.insert_or_assign(std::move(definition->first), std::move(definition->second));
+                lastColumns = nullptr;
+            }
+
+            continue;
+        }
+
+        if (isEmptyRecord(fields)) {
+            continue;
+        }
+
+        if (lastColumns == nullptr || type != lastType) {
+            auto found = layouts.find(type);
+
+            if (found == layouts.end()) {
+                const auto format = formats.find(type);
+
+                if (format == formats.end()) {
+                    throw RuntimeException(
+                        fmt::format("Undefined format for type {} at offset {}", type, begin + reader.recordOffset));
+                }
+
+                std::vector<Column> columns{};
+
+                columns.reserve(format->second->size());
+
+                for (const auto &name : *format->second) {
+                    if (const auto field = InstrumentProfileField::find(name)) {
+                        const auto &f = field->get();
+
+                        columns.push_back({f.isNumericField()  ? Column::Kind::NUMERIC
+                                           : f.isUniqueField() ? Column::Kind::UNIQUE
+                                                               : Column::Kind::SHARED,
+                                           &f,
+                                           {}});
+                    } else {
+                        columns.push_back({Column::Kind::CUSTOM, nullptr, pool.intern(name)});
+                    }
+                }
+
+                found = layouts.emplace(std::string(type), std::move(columns)).first;
+            }
+
+            lastType = found->first;
+            lastColumns = &found->second;
+        }
+
+        if (fields.size() != lastColumns->size()) {
+            throw RuntimeException(fmt::format("Wrong number of fields ({} instead of {}) at offset {}", fields.size(),
+                                               lastColumns->size(), begin + reader.recordOffset));
+        }
+
+        if (count == profileCount) {
+            throw RuntimeException(fmt::format("Unexpected record at offset {}", begin + reader.recordOffset));
+        }
+
+        auto &data = profiles[count++];
+
+        for (std::size_t i = 0; i < fields.size(); i++) {
+            const auto value = fields[i];
+            auto &column = (*lastColumns)[i];
+
+            switch (column.kind) {
+            case Column::Kind::NUMERIC:
+                try {
+                    data.setField(*column.field, value, pool);
+                } catch (const InvalidArgumentException &) {
+                    throw RuntimeException(fmt::format("Invalid value '{}' of the field {} at offset {}", value,
+                                                       column.field->getName(), begin + reader.recordOffset));
+                }
+
+                break;
+            case Column::Kind::UNIQUE:
+                data.setStringField(*column.field, pool.store(value));
+                break;
+            case Column::Kind::SHARED:
+            case Column::Kind::CUSTOM:
+                if (value.empty()) {
+                    break;
+                }
+
+                if (value != column.lastValue) {
+                    column.lastValue = pool.intern(value);
+                }
+
+                if (column.kind == Column::Kind::SHARED) {
+                    data.setStringField(*column.field, column.lastValue);
+                } else {
+                    data.customFields.emplace_back(column.customName, column.lastValue);
+                }
+
+                break;
+            }
+        }
+    }
+
+    if (count != profileCount) {
+        throw RuntimeException(fmt::format("Unexpected number of records at offset {}", begin));
+    }
+}
+
+} // namespace
+
+NativeInstrumentProfileReader::NativeInstrumentProfileReader(LockExternalConstructionTag, const Options &options)
+    : parallelism_{options.parallelism == 0 ? std::max<std::size_t>(Platform::getLogicalCoresCount(), 1)
+                                            : options.parallelism},
+      chunkSize_{std::max<std::size_t>(options.chunkSize, 1)} {
+}
+
+NativeInstrumentProfileReader::Ptr NativeInstrumentProfileReader::create(const Options &options) {
+    return createShared(options);
+}
+
+NativeInstrumentProfileReader::Ptr NativeInstrumentProfileReader::create() {
+    return create(Options{});
+}
+
+std::int64_t NativeInstrumentProfileReader::getLastModified() const noexcept {
+    return lastModified_;
+}
+
+bool NativeInstrumentProfileReader::wasComplete() const noexcept {
+    return wasComplete_;
+}
+
+InstrumentProfileDataList NativeInstrumentProfileReader::readFromFile(const StringLike &path) {
+    std::string_view pathView = path;
+
+    if (pathView.starts_with("file:")) {
+        pathView.remove_prefix(5);
+    }
+
+    const std::string pathString(pathView);
+    const MappedFile file(pathString);
+    const auto lastModified = MappedFile::getLastModified(pathString);
+    auto result = readData(file.view());
+
+    lastModified_ = lastModified;
+
+    return result;
+}
+
+InstrumentProfileDataList NativeInstrumentProfileReader::read(std::string_view data) {
+    auto result = readData(data);
+
+    lastModified_ = 0;
+
+    return result;
+}
+
+InstrumentProfileDataList NativeInstrumentProfileReader::readData(std::string_view data) {
+    if (Inflater::isGzip(data)) {
+        return parse(Inflater::gunzip(data));
+    }
+
+    if (Inflater::isZip(data)) {
+        return parse(Inflater::unzip(data));
+    }
+
+    return parse(data);
+}
+
+InstrumentProfileDataList NativeInstrumentProfileReader::parse(std::string_view text) {
+    const auto boundaries = split(text, chunkSize_);
+    const auto chunkCount = boundaries.size() - 1;
+
+    // The formats are defined by the records of the preceding chunks, so they are collected first, together with the
+    // numbers of the profiles, which define the places of the profiles of each chunk in the result.
+    std::vector<ChunkSummary> summaries(chunkCount);
+
+    parallel_utils::runInParallel(chunkCount, parallelism_, [&](std::size_t i) {
+        summaries[i] = scanChunk(text, boundaries[i], boundaries[i + 1]);
+    });
+
+    std::vector<Formats> initialFormats(chunkCount);
+    std::vector<std::size_t> offsets(chunkCount + 1);
+    bool complete = false;
+
+    for (std::size_t i = 0; i < chunkCount; i++) {
+        if (i > 0) {
+            initialFormats[i] = initialFormats[i - 1];
+
+            for (const auto &[type, format] : summaries[i - 1].definitions) {
+                initialFormats[i].insert_or_assign(type, format);
+            }
+        }
+
+        offsets[i + 1] = offsets[i] + summaries[i].profileCount;
+        complete = complete || summaries[i].complete;
+    }
+
+    InstrumentProfileDataList result{};
+
+    result.profiles.resize(offsets.back());
+
+    for (std::size_t i = 0; i < chunkCount; i++) {
+        result.pools.push_back(std::make_shared<InstrumentProfileStringPool>());
+    }
+
+    parallel_utils::runInParallel(chunkCount, parallelism_, [&](std::size_t i) {
+        parseChunk(text, boundaries[i], boundaries[i + 1], std::move(initialFormats[i]),
+                   result.profiles.data() + offsets[i], summaries[i].profileCount, *result.pools[i]);
+    });
+
+    wasComplete_ = complete;
+
+    return result;
+}
+
+DXFCPP_END_NAMESPACE
@@ -0,0 +1,409 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../../include/dxfeed_graal_cpp_api/ipf/live/InstrumentProfileIndex.hpp"
+
+#include "../../../include/dxfeed_graal_cpp_api/ipf/InstrumentProfileType.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+// Calls the function for each of the exchanges in the semicolon-separated list.
+template <typename F> void forEachExchange(std::string_view exchanges, F &&f) {
+    while (!exchanges.empty()) {
+        const auto end = std::min(exchanges.find(';'), exchanges.size());
+
+        if (end > 0) {
+            f(exchanges.substr(0, end));
+        }
+
+        exchanges.remove_prefix(std::min(end + 1, exchanges.size()));
+    }
+}
+
+template <typename Key, typename Value, typename Set>
+void insert(std::unordered_map<Key, Set> &index, const Key &key, const Value &value) {
+    if (!key.empty()) {
+        index[key].insert(value);
+    }
+}
+
+template <typename Key, typename Value, typename Set>
+void erase(std::unordered_map<Key, Set> &index, const Key &key, const Value &value) {
+    if (const auto found = index.find(key); found != index.end()) {
+        found->second.erase(value);
+
+        if (found->second.empty()) {
+            index.erase(found);
+        }
+    }
+}
+
+} // namespace
+
+struct InstrumentProfileIndex::State {
+    using ExpirationEntry = std::pair<std::int32_t, ProfileId>;
+
+    // The pool is not compacted while it is smaller.
+    static constexpr std::size_t MIN_COMPACTION_BYTES = 1024 * 1024;
+
+    mutable std::shared_mutex mutex{};
+
+    // The pool is append-only, so the strings of the updated and removed profiles are released by the compaction. The
+    // lists returned by getProfiles() share the pool, so they stay valid after it.
+    std::shared_ptr<InstrumentProfileStringPool> pool = std::make_shared<InstrumentProfileStringPool>();
+    std::size_t compactedBytes{};
+    std::vector<std::optional<InstrumentProfileData>> profiles{};
+    std::vector<ProfileId> freeIds{};
+    std::size_t size{};
+
+    std::unordered_map<std::string_view, ProfileId> bySymbol{};
+    std::unordered_map<std::string_view, std::set<ExpirationEntry>> byUnderlying{};
+    std::unordered_map<std::string_view, std::set<ProfileId>> byProduct{};
+    std::unordered_map<std::string_view, std::set<ProfileId>> byExchange{};
+    std::set<ExpirationEntry> byExpiration{};
+    std::set<std::pair<std::string_view, ProfileId>> byCfi{};
+
+    void addToIndexes(ProfileId id, const InstrumentProfileData &profile) {
+        insert(byUnderlying, profile.underlying, ExpirationEntry{profile.expiration, id});
+        insert(byProduct, profile.product, id);
+        forEachExchange(profile.exchanges, [&](auto exchange) {
+            insert(byExchange, exchange, id);
+        });
+
+        if (profile.expiration != 0) {
+            byExpiration.emplace(profile.expiration, id);
+        }
+
+        if (!profile.cfi.empty()) {
+            byCfi.emplace(profile.cfi, id);
+        }
+    }
+
+    void removeFromIndexes(ProfileId id, const InstrumentProfileData &profile) {
+        erase(byUnderlying, profile.underlying, ExpirationEntry{profile.expiration, id});
+        erase(byProduct, profile.product, id);
+        forEachExchange(profile.exchanges, [&](auto exchange) {
+            erase(byExchange, exchange, id);
+        });
+        byExpiration.erase({profile.expiration, id});
+        byCfi.erase({profile.cfi, id});
+    }
+
+    // Must be called under the exclusive lock.
+    std::optional<ProfileId> update(const InstrumentProfileData &source) {
+        if (source.type == InstrumentProfileType::REMOVED.getName()) {
+            remove(source.symbol);
+
+            return std::nullopt;
+        }
+
+        if (source.symbol.empty()) {
+            return std::nullopt;
+        }
+
+        auto profile = source;
+
+        profile.intern(*pool);
+
+        if (const auto found = bySymbol.find(profile.symbol); found != bySymbol.end()) {
+            const auto id = found->second;
+
+            removeFromIndexes(id, *profiles[id]);
+            profiles[id] = std::move(profile);
+            addToIndexes(id, *profiles[id]);
+
+            return id;
+        }
+
+        ProfileId id{};
+
+        if (freeIds.empty()) {
+            id = static_cast<ProfileId>(profiles.size());
+            profiles.emplace_back(std::move(profile));
+        } else {
+            id = freeIds.back();
+            freeIds.pop_back();
+            profiles[id] = std::move(profile);
+        }
+
+        bySymbol.emplace(profiles[id]->symbol, id);
+        addToIndexes(id, *profiles[id]);
+        size++;
+
+        return id;
+    }
+
+    // Must be called under the exclusive lock.
+    bool remove(std::string_view symbol) {
+        const auto found = bySymbol.find(symbol);
+
+        if (found == bySymbol.end()) {
+            return false;
+        }
+
+        const auto id = found->second;
+
+        bySymbol.erase(found);
+        removeFromIndexes(id, *profiles[id]);
+        profiles[id].reset();
+        freeIds.push_back(id);
+        size--;
+
+        return true;
+    }
+
+    // Must be called under the exclusive lock. Moves the strings of the current profiles to the new pool when the pool
+    // has doubled since the last compaction, so the amortized cost of an update stays constant.
+    void compactIfNeeded() {
+        if (pool->getBytes() <= std::max(2 * compactedBytes, MIN_COMPACTION_BYTES)) {
+            return;
+        }
+
+        auto compacted = std::make_shared<InstrumentProfileStringPool>();
+
+        // The keys of the indexes are the views of the strings of the old pool.
+        bySymbol.clear();
+        byUnderlying.clear();
+        byProduct.clear();
+        byExchange.clear();
+        byExpiration.clear();
+        byCfi.clear();
+
+        for (std::size_t id = 0; id < profiles.size(); id++) {
+            if (auto &profile = profiles[id]) {
+                profile->intern(*compacted);
+                bySymbol.emplace(profile->symbol, static_cast<ProfileId>(id));
+                addToIndexes(static_cast<ProfileId>(id), *profile);
+            }
+        }
+
+        pool = std::move(compacted);
+        compactedBytes = pool->getBytes();
+    }
+
+    template <typename Set> static std::vector<ProfileId> toIds(const Set &set) {
+        std::vector<ProfileId> result{};
+
+        result.reserve(set.size());
+
+        for (const auto &entry : set) {
+            if constexpr (std::is_same_v<typename Set::value_type, ProfileId>) {
+                result.push_back(entry);
+            } else {
+                result.push_back(entry.second);
+            }
+        }
+
+        return result;
+    }
+
+    static std::vector<ProfileId> findExpirations(const std::set<ExpirationEntry> &set, std::int32_t from,
+                                                  std::int32_t to) {
+        std::vector<ProfileId> result{};
+
+        for (auto it = set.lower_bound({from, 0}); it != set.end() && it->first <= to; ++it) {
+            result.push_back(it->second);
+        }
+
+        return result;
+    }
+
+    template <typename Index>
+    static std::vector<ProfileId> findIn(const Index &index, std::string_view key) {
+        if (const auto found = index.find(key); found != index.end()) {
+            return toIds(found->second);
+        }
+
+        return {};
+    }
+};
+
+InstrumentProfileIndex::InstrumentProfileIndex(LockExternalConstructionTag) : state_{std::make_shared<State>()} {
+}
+
+InstrumentProfileIndex::~InstrumentProfileIndex() noexcept {
+    if (collector_) {
+        collector_->removeUpdateListener(listenerId_);
+    }
+}
+
+InstrumentProfileIndex::Ptr InstrumentProfileIndex::create() {
+    return createShared();
+}
+
+InstrumentProfileIndex::Ptr InstrumentProfileIndex::create(const InstrumentProfileCollector::Ptr &collector) {
+    auto index = createShared();
+
+    index->collector_ = collector;
+    index->listenerId_ = collector->addUpdateListener(
+        [state = index->state_](const std::vector<std::shared_ptr<InstrumentProfile>> &profiles) {
+            InstrumentProfileStringPool pool{};
+            std::vector<InstrumentProfileData> data{};
+
+            // The profiles are converted without the lock, since it requires the calls to the Graal side.
+            data.reserve(profiles.size());
+
+            for (const auto &profile : profiles) {
+                data.push_back(InstrumentProfileData::fromProfile(*profile, pool));
+            }
+
+            std::unique_lock lock{state->mutex};
+
+            for (const auto &profile : data) {
+                state->update(profile);
+            }
+
+            state->compactIfNeeded();
+        });
+
+    return index;
+}
+
+void InstrumentProfileIndex::update(const std::vector<std::shared_ptr<InstrumentProfile>> &profiles) {
+    InstrumentProfileDataList list{};
+    auto pool = std::make_shared<InstrumentProfileStringPool>();
+
+    list.profiles.reserve(profiles.size());
+
+    for (const auto &profile : profiles) {
+        list.profiles.push_back(InstrumentProfileData::fromProfile(*profile, *pool));
+    }
+
+    list.pools.push_back(std::move(pool));
+    update(list);
+}
+
+void InstrumentProfileIndex::update(const InstrumentProfileDataList &profiles) {
+    std::unique_lock lock{state_->mutex};
+
+    for (const auto &profile : profiles.profiles) {
+        state_->update(profile);
+    }
+
+    state_->compactIfNeeded();
+}
+
+std::optional<InstrumentProfileIndex::ProfileId> InstrumentProfileIndex::update(const InstrumentProfileData &profile) {
+    std::unique_lock lock{state_->mutex};
+    const auto id = state_->update(profile);
+
+    state_->compactIfNeeded();
+
+    return id;
+}
+
+bool InstrumentProfileIndex::remove(std::string_view symbol) {
+    std::unique_lock lock{state_->mutex};
+
+    return state_->remove(symbol);
+}
+
+std::size_t InstrumentProfileIndex::size() const {
+    std::shared_lock lock{state_->mutex};
+
+    return state_->size;
+}
+
+std::optional<InstrumentProfileData> InstrumentProfileIndex::getProfile(ProfileId id,
+                                                                       InstrumentProfileStringPool &pool) const {
+    std::shared_lock lock{state_->mutex};
+
+    if (id >= state_->profiles.size() || !state_->profiles[id]) {
+        return std::nullopt;
+    }
+
+    auto profile = *state_->profiles[id];
+
+    profile.intern(pool);
+
+    return profile;
+}
+
+InstrumentProfileDataList InstrumentProfileIndex::getProfiles(const std::vector<ProfileId> &ids) const {
+    InstrumentProfileDataList result{};
+    std::shared_lock lock{state_->mutex};
+
+    result.pools.push_back(state_->pool);
+    result.profiles.reserve(ids.size());
+
+    for (const auto id : ids) {
+        if (id < state_->profiles.size() && state_->profiles[id]) {
+            result.profiles.push_back(*state_->profiles[id]);
+        }
+    }
+
+    return result;
+}
+
+std::optional<InstrumentProfileIndex::ProfileId> InstrumentProfileIndex::findBySymbol(std::string_view symbol) const {
+    std::shared_lock lock{state_->mutex};
+
+    if (const auto found = state_->bySymbol.find(symbol); found != state_->bySymbol.end()) {
+        return found->second;
+    }
+
+    return std::nullopt;
+}
+
+std::vector<InstrumentProfileIndex::ProfileId>
+InstrumentProfileIndex::findByUnderlying(std::string_view underlying) const {
+    std::shared_lock lock{state_->mutex};
+
+    return State::findIn(state_->byUnderlying, underlying);
+}
+
+std::vector<InstrumentProfileIndex::ProfileId>
+InstrumentProfileIndex::findByUnderlying(std::string_view underlying, std::int32_t fromExpiration,
+                                         std::int32_t toExpiration) const {
+    std::shared_lock lock{state_->mutex};
+
+    if (const auto found = state_->byUnderlying.find(underlying); found != state_->byUnderlying.end()) {
+        return State::findExpirations(found->second, fromExpiration, toExpiration);
+    }
+
+    return {};
+}
+
+std::vector<InstrumentProfileIndex::ProfileId> InstrumentProfileIndex::findByProduct(std::string_view product) const {
+    std::shared_lock lock{state_->mutex};
+
+    return State::findIn(state_->byProduct, product);
+}
+
+std::vector<InstrumentProfileIndex::ProfileId>
+InstrumentProfileIndex::findByExchange(std::string_view exchange) const {
+    std::shared_lock lock{state_->mutex};
+
+    return State::findIn(state_->byExchange, exchange);
+}
+
+std::vector<InstrumentProfileIndex::ProfileId>
+InstrumentProfileIndex::findByExpiration(std::int32_t fromExpiration, std::int32_t toExpiration) const {
+    std::shared_lock lock{state_->mutex};
+
+    return State::findExpirations(state_->byExpiration, fromExpiration, toExpiration);
+}
+
+std::vector<InstrumentProfileIndex::ProfileId> InstrumentProfileIndex::findByCfiPrefix(std::string_view prefix) const {
+    std::vector<ProfileId> result{};
+    std::shared_lock lock{state_->mutex};
+
+    for (auto it = state_->byCfi.lower_bound({prefix, 0}); it != state_->byCfi.end() && it->first.starts_with(prefix);
+         ++it) {
+        result.push_back(it->second);
+    }
+
+    return result;
+}
+
+DXFCPP_END_NAMESPACE
@@ -0,0 +1,199 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../../include/dxfeed_graal_cpp_api/ipf/option/CompactOptionChainsBuilder.hpp"
+
+#include "../../../include/dxfeed_graal_cpp_api/internal/Platform.hpp"
+#include "../../../include/dxfeed_graal_cpp_api/internal/utils/ParallelUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <compare>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+struct Record {
+    const InstrumentProfileData *profile{};
+    bool isCall{};
+    // The CFI of the series: the CFI of the option without the call/put attribute (as OptionChainsBuilder::setCFI
+    // does).
+    std::string seriesCfi{};
+
+    // The order of OptionSeries::operator<.
+    std::weak_ordering compareSeries(const Record &other) const {
+        const auto &a = *profile;
+        const auto &b = *other.profile;
+
+        if (a.expiration != b.expiration) {
+            return a.expiration <=> b.expiration;
+        }
+
+        if (a.lastTrade != b.lastTrade) {
+            return a.lastTrade <=> b.lastTrade;
+        }
+
+        if (a.multiplier != b.multiplier) {
+            return a.multiplier < b.multiplier ? std::weak_ordering::less : std::weak_ordering::greater;
+        }
+
+        if (a.spc != b.spc) {
+            return a.spc < b.spc ? std::weak_ordering::less : std::weak_ordering::greater;
+        }
+
+        for (const auto field : {&InstrumentProfileData::additionalUnderlyings, &InstrumentProfileData::mmy,
+                                 &InstrumentProfileData::optionType, &InstrumentProfileData::expirationStyle,
+                                 &InstrumentProfileData::settlementStyle}) {
+            if (const auto result = a.*field <=> b.*field; result != 0) {
+                return result;
+            }
+        }
+
+        return seriesCfi <=> other.seriesCfi;
+    }
+};
+
+struct ChainRecords {
+    std::string_view symbol{};
+    std::vector<const Record *> records{};
+};
+
+} // namespace
+
+CompactOptionChainsBuilder::Chains
+CompactOptionChainsBuilder::build(const std::shared_ptr<const InstrumentProfileDataList> &profiles) {
+    return build(profiles, 0);
+}
+
+CompactOptionChainsBuilder::Chains
+CompactOptionChainsBuilder::build(const std::shared_ptr<const InstrumentProfileDataList> &profiles,
+                                  std::size_t parallelism) {
+    if (!profiles) {
+        return {};
+    }
+
+    if (parallelism == 0) {
+        parallelism = std::max<std::size_t>(Platform::getLogicalCoresCount(), 1);
+    }
+
+    std::vector<Record> records{};
+
+    for (const auto &profile : profiles->profiles) {
+        if (profile.type != "OPTION") {
+            continue;
+        }
+
+        const bool isCall = profile.cfi.starts_with("OC");
+
+        if (!isCall && !profile.cfi.starts_with("OP") /*is not put*/) {
+            continue;
+        }
+
+        if (profile.expiration == 0 || std::isnan(profile.strike) || std::isinf(profile.strike)) {
+            continue;
+        }
+
+        records.push_back(
+            {&profile, isCall, profile.cfi[0] + std::string("X") + std::string(profile.cfi.substr(2))});
+    }
+
+    std::vector<ChainRecords> chains{};
+    std::unordered_map<std::string_view, std::size_t> chainIndexes{};
+    const auto addToChain = [&](std::string_view symbol, const Record &record) {
+        const auto [found, inserted] = chainIndexes.try_emplace(symbol, chains.size());
+
+        if (inserted) {
+            chains.push_back({symbol, {}});
+        }
+
+        chains[found->second].records.push_back(&record);
+    };
+
+    for (const auto &record : records) {
+        if (!record.profile->product.empty()) {
+            addToChain(record.profile->product, record);
+        }
+
+        // The option is added to its chain once, if the product and the underlying are the same.
+        if (!record.profile->underlying.empty() && record.profile->underlying != record.profile->product) {
+            addToChain(record.profile->underlying, record);
+        }
+    }
+
+    // The largest chains are built first to balance the load of the threads.
+    std::stable_sort(chains.begin(), chains.end(), [](const auto &a, const auto &b) {
+        return a.records.size() > b.records.size();
+    });
+
+    std::vector<CompactOptionChain<const InstrumentProfileData>> results(chains.size());
+
+    parallel_utils::runInParallel(chains.size(), parallelism, [&](std::size_t chainIndex) {
+        auto &chainRecords = chains[chainIndex].records;
+        auto &result = results[chainIndex];
+
+        // The stable sort keeps the order of the profiles, so the first option with the strike wins, as in
+        // OptionChainsBuilder.
+        std::stable_sort(chainRecords.begin(), chainRecords.end(), [](const Record *a, const Record *b) {
+            if (const auto order = a->compareSeries(*b); order != 0) {
+                return order < 0;
+            }
+
+            return a->profile->strike < b->profile->strike;
+        });
+
+        result.symbol_ = chains[chainIndex].symbol;
+
+        for (std::size_t i = 0; i < chainRecords.size(); i++) {
+            const auto &record = *chainRecords[i];
+
+            if (i == 0 || chainRecords[i - 1]->compareSeries(record) != 0) {
+                auto &attributes = result.series_.emplace_back().attributes_;
+                const auto &profile = *record.profile;
+
+                attributes.expiration_ = profile.expiration;
+                attributes.lastTrade_ = profile.lastTrade;
+                attributes.multiplier_ = profile.multiplier;
+                attributes.spc_ = profile.spc;
+                attributes.additionalUnderlyings_ = profile.additionalUnderlyings;
+                attributes.mmy_ = profile.mmy;
+                attributes.optionType_ = profile.optionType;
+                attributes.expirationStyle_ = profile.expirationStyle;
+                attributes.settlementStyle_ = profile.settlementStyle;
+                attributes.cfi_ = record.seriesCfi;
+            }
+
+            auto &series = result.series_.back();
+            const auto strike = record.profile->strike;
+
+            if (series.strikes_.empty() || series.strikes_.back() != strike) {
+                series.strikes_.push_back(strike);
+                series.calls_.emplace_back();
+                series.puts_.emplace_back();
+            }
+
+            if (auto &slot = record.isCall ? series.calls_.back() : series.puts_.back(); !slot) {
+                slot = std::shared_ptr<const InstrumentProfileData>(profiles, record.profile);
+            }
+        }
+    });
+
+    Chains result{};
+
+    result.reserve(results.size());
+
+    for (auto &chain : results) {
+        auto symbol = chain.symbol_;
+
+        result.try_emplace(std::move(symbol), std::move(chain));
+    }
+
+    return result;
+}
+
+DXFCPP_END_NAMESPACE
@@ -0,0 +1,508 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/model/CandleAggregator.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/api/DXFeed.hpp"
+#include "../../include/dxfeed_graal_cpp_api/api/DXFeedSubscription.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/EventFlag.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/candle/CandlePeriodAligner.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/MarketEventSymbols.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/TimeAndSale.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/option/Greeks.hpp"
+#include "../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/utils/StringUtils.hpp"
+#include "../../include/dxfeed_graal_cpp_api/schedule/Schedule.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fmt/format.h>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+enum class BarKind : std::uint8_t { TIME, TICK, VOLUME, PRICE };
+
+BarKind getBarKind(const CandleSymbol &symbol) {
+    const auto &type = symbol.getPeriod().value_or(CandlePeriod::DEFAULT).getType();
+
+    if (type == CandleType::TICK) {
+        return BarKind::TICK;
+    }
+
+    if (type == CandleType::VOLUME) {
+        return BarKind::VOLUME;
+    }
+
+    if (type == CandleType::PRICE) {
+        return BarKind::PRICE;
+    }
+
+    if (type == CandleType::PRICE_MOMENTUM || type == CandleType::PRICE_RENKO || type == CandleType::OPTEXP) {
+        throw InvalidArgumentException("Unsupported candle period for the aggregation: " + symbol.toString());
+    }
+
+    return BarKind::TIME;
+}
+
+void checkSymbol(const CandleSymbol &symbol) {
+    getBarKind(symbol);
+
+    if (!(symbol.getPeriod().value_or(CandlePeriod::DEFAULT).getValue() > 0)) {
+        throw InvalidArgumentException("Invalid candle period for the aggregation: " + symbol.toString());
+    }
+
+    if (symbol.getPrice().value_or(CandlePrice::DEFAULT) != CandlePrice::LAST) {
+        throw InvalidArgumentException("Unsupported candle price for the aggregation: " + symbol.toString());
+    }
+}
+
+bool requiresSchedule(const CandleSymbol &symbol) {
+    return symbol.getAlignment().value_or(CandleAlignment::DEFAULT) == CandleAlignment::SESSION ||
+           symbol.getSession().value_or(CandleSession::DEFAULT) == CandleSession::REGULAR;
+}
+
+// The symbol of the trades: the base symbol with the exchange code of the candle symbol.
+std::string getTradeSymbol(const CandleSymbol &symbol) {
+    const auto exchangeCode = symbol.getExchange().value_or(CandleExchange::DEFAULT).getExchangeCode();
+
+    return exchangeCode == '\0' ? symbol.getBaseSymbol()
+                                : MarketEventSymbols::changeExchangeCode(symbol.getBaseSymbol(), exchangeCode);
+}
+
+} // namespace
+
+struct CandleAggregator::Impl {
+    struct Spec {
+        CandleSymbol symbol;
+        BarKind kind{};
+        double value{};
+        CandlePeriodAligner aligner;
+        bool regularOnly{};
+
+        bool open{};
+        bool updated{};
+        std::int64_t barTime{};
+        std::int64_t barEnd{};
+        std::int64_t lastBarTime = std::numeric_limits<std::int64_t>::min();
+        std::int32_t sequence{};
+        std::int64_t count{};
+        double openPrice{};
+        double high{};
+        double low{};
+        double close{};
+        double volume{};
+        double turnover{};
+        double bidVolume{};
+        double askVolume{};
+        double impVolatility = math::NaN;
+
+        Spec(const CandleSymbol &candleSymbol, const std::shared_ptr<Schedule> &schedule)
+            : symbol(candleSymbol), kind(getBarKind(candleSymbol)),
+              value(candleSymbol.getPeriod().value_or(CandlePeriod::DEFAULT).getValue()),
+              aligner(candleSymbol.getPeriod().value_or(CandlePeriod::DEFAULT),
+                      candleSymbol.getAlignment().value_or(CandleAlignment::DEFAULT), schedule),
+              regularOnly(candleSymbol.getSession().value_or(CandleSession::DEFAULT) == CandleSession::REGULAR) {
+        }
+    };
+
+    std::vector<Spec> specs{};
+    std::unordered_map<std::string, std::vector<std::size_t>, StringHash, std::equal_to<>> specsBySymbol{};
+    std::shared_ptr<Schedule> schedule{};
+    bool partialCandles{};
+    Listener listener{};
+    bool closed{};
+
+    std::vector<std::size_t> updatedSpecs{};
+    std::vector<std::shared_ptr<Candle>> finalCandles{};
+
+    explicit Impl(const Builder &builder)
+        : schedule(builder.schedule_), partialCandles(builder.partialCandles_), listener(builder.listener_) {
+        specs.reserve(builder.symbols_.size());
+
+        for (const auto &symbol : builder.symbols_) {
+            specsBySymbol[getTradeSymbol(symbol)].push_back(specs.size());
+            specs.emplace_back(symbol, schedule);
+        }
+    }
+
+    void markUpdated(Spec &spec, std::size_t specIndex) {
+        if (!spec.updated) {
+            spec.updated = true;
+            updatedSpecs.push_back(specIndex);
+        }
+    }
+
+    void openBar(Spec &spec, std::int64_t time) {
+        const auto [start, end] = spec.kind == BarKind::TIME
+                                      ? spec.aligner.getBounds(time)
+                                      : CandlePeriodAligner::Bounds{time, std::numeric_limits<std::int64_t>::max()};
+
+        spec.open = true;
+        spec.barTime = start;
+        spec.barEnd = end;
+        // The tick, volume and price candles can start at the same millisecond.
+        spec.sequence = start == spec.lastBarTime && spec.sequence < static_cast<std::int32_t>(Candle::MAX_SEQUENCE)
+                            ? spec.sequence + 1
+                            : 0;
+        spec.lastBarTime = start;
+        spec.count = 0;
+        spec.openPrice = spec.high = spec.low = spec.close = math::NaN;
+        spec.volume = spec.turnover = spec.bidVolume = spec.askVolume = 0;
+    }
+
+    static std::shared_ptr<Candle> createCandle(const Spec &spec) {
+        auto candle = std::make_shared<Candle>(spec.symbol);
+
+        candle->setTime(spec.barTime);
+        candle->setSequence(spec.sequence);
+        candle->setCount(spec.count);
+        candle->setOpen(spec.openPrice);
+        candle->setHigh(spec.high);
+        candle->setLow(spec.low);
+        candle->setClose(spec.close);
+        candle->setVolume(spec.volume);
+        candle->setVWAP(spec.volume > 0 ? spec.turnover / spec.volume : math::NaN);
+        candle->setBidVolume(spec.bidVolume);
+        candle->setAskVolume(spec.askVolume);
+        candle->setImpVolatility(spec.impVolatility);
+
+        return candle;
+    }
+
+    // The updated flag is kept until the delivery: the spec stays in the updatedSpecs once per batch, and the closed
+    // candle isn't delivered as a partial one unless the next candle is opened.
+    void closeBar(Spec &spec) {
+        finalCandles.push_back(createCandle(spec));
+        spec.open = false;
+    }
+
+    void onTrade(std::size_t specIndex, std::int64_t time, double price, double size, const Side *side) {
+        auto &spec = specs[specIndex];
+
+        if (spec.regularOnly && !spec.aligner.isRegularSession(time)) {
+            return;
+        }
+
+        if (spec.open && time >= spec.barEnd) {
+            closeBar(spec);
+        }
+
+        // The late trades are applied to the current candle.
+        if (!spec.open) {
+            openBar(spec, time);
+        }
+
+        if (spec.count == 0) {
+            spec.openPrice = spec.high = spec.low = price;
+        } else {
+            spec.high = std::max(spec.high, price);
+            spec.low = std::min(spec.low, price);
+        }
+
+        spec.close = price;
+        spec.count++;
+        spec.volume += size;
+        spec.turnover += price * size;
+
+        if (side == nullptr) {
+            // The trades without the aggressor side are not counted in the bid and ask volumes.
+        } else if (*side == Side::BUY) {
+            spec.askVolume += size;
+        } else if (*side == Side::SELL) {
+            spec.bidVolume += size;
+        }
+
+        markUpdated(spec, specIndex);
+
+        switch (spec.kind) {
+        case BarKind::TICK:
+            if (static_cast<double>(spec.count) >= spec.value) {
+                closeBar(spec);
+            }
+
+            break;
+        case BarKind::VOLUME:
+            if (spec.volume >= spec.value) {
+                closeBar(spec);
+            }
+
+            break;
+        case BarKind::PRICE:
+            if (spec.high - spec.low >= spec.value) {
+                closeBar(spec);
+            }
+
+            break;
+        default:
+            break;
+        }
+    }
+
+    void onTrade(const std::string &symbol, std::int64_t time, double price, double size, const Side *side) {
+        if (std::isnan(price)) {
+            return;
+        }
+
+        if (auto found = specsBySymbol.find(symbol); found != specsBySymbol.end()) {
+            for (auto specIndex : found->second) {
+                onTrade(specIndex, time, price, std::isnan(size) ? 0.0 : size, side);
+            }
+        }
+    }
+
+    void onImpVolatility(const std::string &symbol, double impVolatility) {
+        if (auto found = specsBySymbol.find(symbol); found != specsBySymbol.end()) {
+            for (auto specIndex : found->second) {
+                auto &spec = specs[specIndex];
+
+                spec.impVolatility = impVolatility;
+
+                if (spec.open) {
+                    markUpdated(spec, specIndex);
+                }
+            }
+        }
+    }
+
+    void process(const std::vector<std::shared_ptr<EventType>> &events) {
+        for (const auto &event : events) {
+            if (const auto *timeAndSale = dynamic_cast<const TimeAndSale *>(event.get())) {
+                if (timeAndSale->isValidTick() && timeAndSale->getType() == TimeAndSaleType::NEW &&
+                    !EventFlag::REMOVE_EVENT.in(static_cast<std::uint32_t>(timeAndSale->getEventFlags()))) {
+                    onTrade(timeAndSale->getEventSymbol(), timeAndSale->getTime(), timeAndSale->getPrice(),
+                            timeAndSale->getSize(), &timeAndSale->getAggressorSide());
+                }
+            } else if (const auto *greeks = dynamic_cast<const Greeks *>(event.get())) {
+                onImpVolatility(greeks->getEventSymbol(), greeks->getVolatility());
+            }
+        }
+    }
+
+    void advanceTime(std::int64_t time) {
+        for (auto &spec : specs) {
+            if (spec.open && spec.kind == BarKind::TIME && time >= spec.barEnd) {
+                closeBar(spec);
+            }
+        }
+    }
+
+    void flush() {
+        for (auto &spec : specs) {
+            if (spec.open) {
+                closeBar(spec);
+            }
+        }
+    }
+
+    void deliver() {
+        std::vector<std::shared_ptr<Candle>> partial{};
+
+        if (partialCandles) {
+            for (auto specIndex : updatedSpecs) {
+                if (auto &spec = specs[specIndex]; spec.updated && spec.open) {
+                    partial.push_back(createCandle(spec));
+                }
+            }
+        }
+
+        for (auto specIndex : updatedSpecs) {
+            specs[specIndex].updated = false;
+        }
+
+        updatedSpecs.clear();
+
+        auto completed = std::move(finalCandles);
+
+        finalCandles = {};
+
+        if (!listener) {
+            return;
+        }
+
+        if (!completed.empty()) {
+            listener(completed, true);
+        }
+
+        if (!partial.empty()) {
+            listener(partial, false);
+        }
+    }
+};
+
+CandleAggregator::Builder::Builder(LockExternalConstructionTag) {
+}
+
+CandleAggregator::Builder::~Builder() noexcept = default;
+
+std::shared_ptr<CandleAggregator::Builder> CandleAggregator::Builder::withFeed(std::shared_ptr<DXFeed> feed) {
+    feed_ = std::move(feed);
+
+    return sharedAs<Builder>();
+}
+
+std::shared_ptr<CandleAggregator::Builder> CandleAggregator::Builder::withSymbol(const CandleSymbol &symbol) {
+    checkSymbol(symbol);
+    symbols_.push_back(symbol);
+
+    return sharedAs<Builder>();
+}
+
+std::shared_ptr<CandleAggregator::Builder>
+CandleAggregator::Builder::withSymbols(std::initializer_list<CandleSymbol> symbols) {
+    for (const auto &symbol : symbols) {
+        withSymbol(symbol);
+    }
+
+    return sharedAs<Builder>();
+}
+
+std::shared_ptr<CandleAggregator::Builder> CandleAggregator::Builder::withSchedule(std::shared_ptr<Schedule> schedule) {
+    schedule_ = std::move(schedule);
+
+    return sharedAs<Builder>();
+}
+
+std::shared_ptr<CandleAggregator::Builder> CandleAggregator::Builder::withPartialCandles(bool partialCandles) {
+    partialCandles_ = partialCandles;
+
+    return sharedAs<Builder>();
+}
+
+std::shared_ptr<CandleAggregator::Builder> CandleAggregator::Builder::withImpVolatility(bool impVolatility) {
+    impVolatility_ = impVolatility;
+
+    return sharedAs<Builder>();
+}
+
+std::shared_ptr<CandleAggregator::Builder> CandleAggregator::Builder::withListener(Listener listener) {
+    listener_ = std::move(listener);
+
+    return sharedAs<Builder>();
+}
+
+std::shared_ptr<CandleAggregator> CandleAggregator::Builder::build() {
+    if (symbols_.empty()) {
+        throw InvalidArgumentException("The candle aggregator requires at least one symbol");
+    }
+
+    if (!schedule_) {
+        for (const auto &symbol : symbols_) {
+            if (requiresSchedule(symbol)) {
+                throw InvalidArgumentException("The candle aggregation requires a schedule: " + symbol.toString());
+            }
+        }
+    }
+
+    return CandleAggregator::create(sharedAs<Builder>());
+}
+
+std::shared_ptr<CandleAggregator> CandleAggregator::create(const std::shared_ptr<Builder> &builder) {
+    auto aggregator = CandleAggregator::createShared(builder);
+
+    if (!builder->feed_) {
+        return aggregator;
+    }
+
+    std::vector<EventTypeEnum> eventTypes{EventTypeEnum::TIME_AND_SALE};
+
+    if (builder->impVolatility_) {
+        eventTypes.push_back(EventTypeEnum::GREEKS);
+    }
+
+    std::vector<std::string> symbols{};
+
+    symbols.reserve(aggregator->impl_->specsBySymbol.size());
+
+    for (const auto &[symbol, _] : aggregator->impl_->specsBySymbol) {
+        symbols.push_back(symbol);
+    }
+
+    aggregator->subscription_ = DXFeedSubscription::create(eventTypes);
+    aggregator->subscription_->addEventListener(
+        [a = aggregator->weak_from_this()](const std::vector<std::shared_ptr<EventType>> &events) {
+            if (const auto locked = a.lock()) {
+                locked->sharedAs<CandleAggregator>()->process(events);
+            }
+        });
+    aggregator->subscription_->addSymbols(symbols);
+    aggregator->subscription_->attach(builder->feed_);
+
+    return aggregator;
+}
+
+CandleAggregator::CandleAggregator(LockExternalConstructionTag, const std::shared_ptr<Builder> &builder)
+    : impl_(std::make_unique<Impl>(*builder)) {
+}
+
+CandleAggregator::~CandleAggregator() noexcept {
+    if (subscription_) {
+        subscription_->close();
+    }
+}
+
+std::shared_ptr<CandleAggregator::Builder> CandleAggregator::newBuilder() {
+    return Builder::createShared();
+}
+
+void CandleAggregator::process(const std::vector<std::shared_ptr<EventType>> &events) {
+    std::lock_guard guard(mtx_);
+
+    if (impl_->closed) {
+        return;
+    }
+
+    impl_->process(events);
+    impl_->deliver();
+}
+
+void CandleAggregator::advanceTime(std::int64_t time) {
+    std::lock_guard guard(mtx_);
+
+    if (impl_->closed) {
+        return;
+    }
+
+    impl_->advanceTime(time);
+    impl_->deliver();
+}
+
+void CandleAggregator::flush() {
+    std::lock_guard guard(mtx_);
+
+    if (impl_->closed) {
+        return;
+    }
+
+    impl_->flush();
+    impl_->deliver();
+}
+
+std::vector<std::shared_ptr<Candle>> CandleAggregator::getCurrentCandles() const {
+    std::lock_guard guard(mtx_);
+    std::vector<std::shared_ptr<Candle>> result{};
+
+    for (const auto &spec : impl_->specs) {
+        if (spec.open) {
+            result.push_back(Impl::createCandle(spec));
+        }
+    }
+
+    return result;
+}
+
+void CandleAggregator::close() {
+    std::lock_guard guard(mtx_);
+
+    impl_->closed = true;
+
+    if (subscription_) {
+        subscription_->close();
+    }
+}
+
+DXFCPP_END_NAMESPACE
@@ -0,0 +1,251 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/model/MarketDepthAnalytics.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/internal/Common.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fmt/format.h>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+template <typename Levels> void addLevel(Levels &levels, double price, double size) {
+    auto &level = levels[price];
+
+    level.size += size;
+    level.count++;
+}
+
+template <typename Levels> bool removeLevel(Levels &levels, double price, double size) {
+    auto found = levels.find(price);
+
+    if (found == levels.end()) {
+        return false;
+    }
+
+    if (--found->second.count == 0) {
+        levels.erase(found); // drop the level without the rounding residue
+    } else {
+        found->second.size -= size;
+    }
+
+    return true;
+}
+
+template <typename Levels> std::vector<MarketDepthLevel> topLevels(const Levels &levels, std::size_t maxLevels) {
+    std::vector<MarketDepthLevel> result{};
+
+    result.reserve(std::min(maxLevels, levels.size()));
+
+    for (auto it = levels.begin(); it != levels.end() && result.size() < maxLevels; ++it) {
+        result.push_back({it->first, it->second.size, it->second.count});
+    }
+
+    return result;
+}
+
+double sizeOf(const std::vector<MarketDepthLevel> &levels, std::size_t n) noexcept {
+    double size = 0.0;
+
+    for (std::size_t i = 0; i < std::min(n, levels.size()); i++) {
+        size += levels[i].size;
+    }
+
+    return size;
+}
+
+} // namespace
+
+void MarketDepthLevels::add(const Side &side, double price, double size) {
+    if (std::isnan(price) || std::isnan(size)) {
+        return;
+    }
+
+    if (side == Side::BUY) {
+        addLevel(buyLevels_, price, size);
+        totalBuySize_ += size;
+    } else {
+        addLevel(sellLevels_, price, size);
+        totalSellSize_ += size;
+    }
+}
+
+void MarketDepthLevels::remove(const Side &side, double price, double size) {
+    if (std::isnan(price) || std::isnan(size)) {
+        return;
+    }
+
+    if (side == Side::BUY) {
+        if (removeLevel(buyLevels_, price, size)) {
+            totalBuySize_ = buyLevels_.empty() ? 0.0 : totalBuySize_ - size;
+        }
+    } else {
+        if (removeLevel(sellLevels_, price, size)) {
+            totalSellSize_ = sellLevels_.empty() ? 0.0 : totalSellSize_ - size;
+        }
+    }
+}
+
+void MarketDepthLevels::clear() noexcept {
+    buyLevels_.clear();
+    sellLevels_.clear();
+    totalBuySize_ = 0.0;
+    totalSellSize_ = 0.0;
+}
+
+std::size_t MarketDepthLevels::getLevelCount(const Side &side) const noexcept {
+    return side == Side::BUY ? buyLevels_.size() : sellLevels_.size();
+}
+
+double MarketDepthLevels::getTotalSize(const Side &side) const noexcept {
+    return side == Side::BUY ? totalBuySize_ : totalSellSize_;
+}
+
+std::vector<MarketDepthLevel> MarketDepthLevels::getLevels(const Side &side, std::size_t maxLevels) const {
+    return side == Side::BUY ? topLevels(buyLevels_, maxLevels) : topLevels(sellLevels_, maxLevels);
+}
+
+std::shared_ptr<const MarketDepthAnalytics> MarketDepthLevels::getAnalytics(std::size_t maxLevels) const {
+    return std::make_shared<const MarketDepthAnalytics>(topLevels(buyLevels_, maxLevels),
+                                                        topLevels(sellLevels_, maxLevels), totalBuySize_,
+                                                        totalSellSize_);
+}
+
+MarketDepthAnalytics::MarketDepthAnalytics(std::vector<MarketDepthLevel> buyLevels,
+                                           std::vector<MarketDepthLevel> sellLevels, double totalBuySize,
+                                           double totalSellSize) noexcept
+    : buyLevels_(std::move(buyLevels)), sellLevels_(std::move(sellLevels)), totalBuySize_(totalBuySize),
+      totalSellSize_(totalSellSize) {
+}
+
+const std::shared_ptr<const MarketDepthAnalytics> &MarketDepthAnalytics::empty() {
+    static const auto EMPTY = std::make_shared<const MarketDepthAnalytics>(std::vector<MarketDepthLevel>{},
+                                                                           std::vector<MarketDepthLevel>{}, 0.0, 0.0);
+
+    return EMPTY;
+}
+
+const std::vector<MarketDepthLevel> &MarketDepthAnalytics::levels(const Side &side) const noexcept {
+    return side == Side::BUY ? buyLevels_ : sellLevels_;
+}
+
+const std::vector<MarketDepthLevel> &MarketDepthAnalytics::getLevels(const Side &side) const noexcept {
+    return levels(side);
+}
+
+double MarketDepthAnalytics::getTotalSize(const Side &side) const noexcept {
+    return side == Side::BUY ? totalBuySize_ : totalSellSize_;
+}
+
+double MarketDepthAnalytics::getBestPrice(const Side &side) const noexcept {
+    const auto &l = levels(side);
+
+    return l.empty() ? math::NaN : l.front().price;
+}
+
+double MarketDepthAnalytics::getSpread() const noexcept {
+    return getBestPrice(Side::SELL) - getBestPrice(Side::BUY);
+}
+
+double MarketDepthAnalytics::getMidPrice() const noexcept {
+    return (getBestPrice(Side::BUY) + getBestPrice(Side::SELL)) / 2.0;
+}
+
+double MarketDepthAnalytics::getImbalance(std::size_t levels) const noexcept {
+    const auto buySize = sizeOf(buyLevels_, levels);
+    const auto sellSize = sizeOf(sellLevels_, levels);
+    const auto total = buySize + sellSize;
+
+    return total > 0.0 ? (buySize - sellSize) / total : math::NaN;
+}
+
+double MarketDepthAnalytics::getMicroprice() const noexcept {
+    if (buyLevels_.empty() || sellLevels_.empty()) {
+        return math::NaN;
+    }
+
+    const auto &bid = buyLevels_.front();
+    const auto &ask = sellLevels_.front();
+    const auto total = bid.size + ask.size;
+
+    if (!(total > 0.0)) {
+        return math::NaN;
+    }
+
+    return (bid.price * ask.size + ask.price * bid.size) / total;
+}
+
+double MarketDepthAnalytics::getVwap(const Side &side, std::size_t levels) const noexcept {
+    const auto &l = this->levels(side);
+    double notional = 0.0;
+    double size = 0.0;
+
+    for (std::size_t i = 0; i < std::min(levels, l.size()); i++) {
+        notional += l[i].price * l[i].size;
+        size += l[i].size;
+    }
+
+    return size > 0.0 ? notional / size : math::NaN;
+}
+
+double MarketDepthAnalytics::getDepthWeightedMid(std::size_t levels) const noexcept {
+    return (getVwap(Side::BUY, levels) + getVwap(Side::SELL, levels)) / 2.0;
+}
+
+double MarketDepthAnalytics::getCumulativeSize(const Side &side, std::size_t ticks, double tickSize) const noexcept {
+    const auto &l = levels(side);
+
+    if (l.empty()) {
+        return 0.0;
+    }
+
+    // Half a tick of tolerance for the rounding errors of the prices.
+    const auto distance = (static_cast<double>(ticks) + 0.5) * tickSize;
+    const auto best = l.front().price;
+    double size = 0.0;
+
+    for (const auto &level : l) {
+        if (std::abs(level.price - best) > distance) {
+            break;
+        }
+
+        size += level.size;
+    }
+
+    return size;
+}
+
+double MarketDepthAnalytics::getSweepPrice(const Side &side, double quantity) const noexcept {
+    if (!(quantity > 0.0)) {
+        return math::NaN;
+    }
+
+    double remaining = quantity;
+    double notional = 0.0;
+
+    for (const auto &level : levels(side)) {
+        const auto filled = std::min(remaining, level.size);
+
+        notional += filled * level.price;
+        remaining -= filled;
+
+        if (remaining <= 0.0) {
+            return notional / quantity;
+        }
+    }
+
+    return math::NaN;
+}
+
+std::string MarketDepthAnalytics::toString() const {
+    return fmt::format("MarketDepthAnalytics{{bid={}, ask={}, imbalance={}, microprice={}, buyLevels={}, "
+                       "sellLevels={}}}",
+                       getBestPrice(Side::BUY), getBestPrice(Side::SELL), getImbalance(), getMicroprice(),
+                       buyLevels_.size(), sellLevels_.size());
+}
+
+DXFCPP_END_NAMESPACE
@@ -0,0 +1,499 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/model/OptionChainAnalytics.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/api/DXFeed.hpp"
+#include "../../include/dxfeed_graal_cpp_api/api/DXFeedSubscription.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/EventFlag.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/market/Summary.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/option/Greeks.hpp"
+#include "../../include/dxfeed_graal_cpp_api/event/option/Series.hpp"
+#include "../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/Timer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+double orZero(double value) {
+    return std::isnan(value) ? 0.0 : value;
+}
+
+double ratio(double numerator, double denominator) {
+    return denominator > 0 ? numerator / denominator : NaN;
+}
+
+} // namespace
+
+struct OptionChainAnalytics::Impl {
+    struct Option {
+        double volatility = NaN;
+        double delta = NaN;
+        double gamma = NaN;
+        double openInterest = NaN;
+    };
+
+    // The position of the option in the series.
+    struct OptionRef {
+        std::size_t series{};
+        std::size_t strike{};
+        bool isCall{};
+    };
+
+    struct Series {
+        Builder::SeriesDefinition definition{};
+        std::vector<Option> calls{};
+        std::vector<Option> puts{};
+        double forwardPrice = NaN;
+        double callVolume = NaN;
+        double putVolume = NaN;
+
+        // The sums that are updated incrementally by each event.
+        double callOpenInterest{};
+        double putOpenInterest{};
+        double weightedVolatilitySum{};
+        double volatilityWeightSum{};
+        double gammaExposure{};
+        std::vector<double> gammaExposureByStrike{};
+    };
+
+    std::vector<Series> series{};
+    std::unordered_map<std::string, std::vector<OptionRef>> optionsBySymbol{};
+    // The series by the underlying symbol and the expiration (for the Series events).
+    std::unordered_map<std::string, std::vector<std::size_t>> seriesByUnderlying{};
+    std::unordered_map<std::string, std::size_t> seriesByName{};
+    std::int64_t aggregationPeriodMillis{};
+    Listener listener{};
+    std::vector<std::uint8_t> changed{};
+    std::vector<std::size_t> changedSeries{};
+    bool taskScheduled{};
+    std::shared_ptr<Timer> taskTimer{};
+    bool closed{};
+
+    explicit Impl(const Builder &builder)
+        : aggregationPeriodMillis{builder.aggregationPeriodMillis_}, listener{builder.listener_} {
+        series.reserve(builder.series_.size());
+
+        for (const auto &definition : builder.series_) {
+            const auto index = series.size();
+            auto &s = series.emplace_back();
+
+            s.definition = definition;
+            s.calls.resize(definition.strikes.size());
+            s.puts.resize(definition.strikes.size());
+            s.gammaExposureByStrike.resize(definition.strikes.size());
+            seriesByName.try_emplace(definition.series, index);
+
+            if (!definition.underlying.empty()) {
+                seriesByUnderlying[definition.underlying].push_back(index);
+            }
+
+            for (std::size_t i = 0; i < definition.strikes.size(); i++) {
+                if (!definition.calls[i].empty()) {
+                    optionsBySymbol[definition.calls[i]].push_back({index, i, true});
+                }
+
+                if (!definition.puts[i].empty()) {
+                    optionsBySymbol[definition.puts[i]].push_back({index, i, false});
+                }
+            }
+        }
+
+        changed.resize(series.size());
+    }
+
+    double getSpc(const Series &s) const {
+        return s.definition.spc > 0 ? s.definition.spc : 1.0;
+    }
+
+    // Adds (sign = 1) or removes (sign = -1) the contributions of the option to the sums of the series.
+    void apply(Series &s, const OptionRef &ref, const Option &option, double sign) {
+        const double openInterest = orZero(option.openInterest);
+        const double gammaExposure =
+            (ref.isCall ? 1.0 : -1.0) * orZero(option.gamma) * openInterest * getSpc(s) * sign;
+
+        (ref.isCall ? s.callOpenInterest : s.putOpenInterest) += openInterest * sign;
+
+        if (!std::isnan(option.volatility) && openInterest > 0) {
+            s.weightedVolatilitySum += option.volatility * openInterest * sign;
+            s.volatilityWeightSum += openInterest * sign;
+        }
+
+        s.gammaExposure += gammaExposure;
+        s.gammaExposureByStrike[ref.strike] += gammaExposure;
+    }
+
+    template <typename Update> void updateOption(const std::string &symbol, Update &&update) {
+        const auto found = optionsBySymbol.find(symbol);
+
+        if (found == optionsBySymbol.end()) {
+            return;
+        }
+
+        for (const auto &ref : found->second) {
+            auto &s = series[ref.series];
+            auto &option = (ref.isCall ? s.calls : s.puts)[ref.strike];
+
+            apply(s, ref, option, -1.0);
+            update(option);
+            apply(s, ref, option, 1.0);
+            markChanged(ref.series);
+        }
+    }
+
+    void markChanged(std::size_t index) {
+        if (!changed[index]) {
+            changed[index] = 1;
+            changedSeries.push_back(index);
+        }
+    }
+
+    void process(const std::vector<std::shared_ptr<EventType>> &events) {
+        for (const auto &event : events) {
+            if (const auto *greeks = dynamic_cast<const Greeks *>(event.get())) {
+                const bool removed = EventFlag::REMOVE_EVENT.in(static_cast<std::uint32_t>(greeks->getEventFlags()));
+
+                updateOption(greeks->getEventSymbol(), [&](Option &option) {
+                    option.volatility = removed ? NaN : greeks->getVolatility();
+                    option.delta = removed ? NaN : greeks->getDelta();
+                    option.gamma = removed ? NaN : greeks->getGamma();
+                });
+            } else if (const auto *summary = dynamic_cast<const Summary *>(event.get())) {
+                updateOption(summary->getEventSymbol(), [&](Option &option) {
+                    option.openInterest = static_cast<double>(summary->getOpenInterest());
+                });
+            } else if (const auto *seriesEvent = dynamic_cast<const dxfcpp::Series *>(event.get())) {
+                onSeries(*seriesEvent);
+            }
+        }
+    }
+
+    void onSeries(const dxfcpp::Series &event) {
+        const auto found = seriesByUnderlying.find(event.getEventSymbol());
+
+        if (found == seriesByUnderlying.end()) {
+            return;
+        }
+
+        const bool removed = EventFlag::REMOVE_EVENT.in(static_cast<std::uint32_t>(event.getEventFlags()));
+
+        for (const auto index : found->second) {
+            auto &s = series[index];
+
+            if (s.definition.expiration != event.getExpiration()) {
+                continue;
+            }
+
+            s.forwardPrice = removed ? NaN : event.getForwardPrice();
+            s.callVolume = removed ? NaN : event.getCallVolume();
+            s.putVolume = removed ? NaN : event.getPutVolume();
+            markChanged(index);
+        }
+    }
+
+    // The volatility at the strike: the one of the OTM option, or the one of the other option if it is unknown.
+    static double getStrikeVolatility(const Series &s, std::size_t i) {
+        const bool isCallOtm = s.definition.strikes[i] >= s.forwardPrice;
+        const double otm = isCallOtm ? s.calls[i].volatility : s.puts[i].volatility;
+
+        return std::isnan(otm) ? (isCallOtm ? s.puts[i].volatility : s.calls[i].volatility) : otm;
+    }
+
+    static double getAtmVolatility(const Series &s) {
+        const auto &strikes = s.definition.strikes;
+
+        if (std::isnan(s.forwardPrice) || strikes.empty()) {
+            return NaN;
+        }
+
+        // The nearest strikes with the known volatility around the forward price.
+        const auto upper = static_cast<std::size_t>(std::lower_bound(strikes.begin(), strikes.end(), s.forwardPrice) -
+                                                    strikes.begin());
+        std::size_t below = upper;
+        std::size_t above = upper;
+
+        while (below > 0 && std::isnan(getStrikeVolatility(s, below - 1))) {
+            below--;
+        }
+
+        while (above < strikes.size() && std::isnan(getStrikeVolatility(s, above))) {
+            above++;
+        }
+
+        if (below == 0 && above == strikes.size()) {
+            return NaN;
+        }
+
+        if (below == 0) {
+            return getStrikeVolatility(s, above);
+        }
+
+        if (above == strikes.size()) {
+            return getStrikeVolatility(s, below - 1);
+        }
+
+        const double lowStrike = strikes[below - 1];
+        const double highStrike = strikes[above];
+        const double lowVolatility = getStrikeVolatility(s, below - 1);
+        const double highVolatility = getStrikeVolatility(s, above);
+
+        return highStrike == lowStrike ? lowVolatility
+                                       : lowVolatility + (highVolatility - lowVolatility) *
+                                                             (s.forwardPrice - lowStrike) / (highStrike - lowStrike);
+    }
+
+    static double getVolatilityByDelta(const std::vector<Option> &options, double delta) {
+        double result = NaN;
+        double bestDistance = std::numeric_limits<double>::infinity();
+
+        for (const auto &option : options) {
+            if (const double distance = std::abs(option.delta - delta);
+                !std::isnan(option.volatility) && distance < bestDistance) {
+                bestDistance = distance;
+                result = option.volatility;
+            }
+        }
+
+        return result;
+    }
+
+    OptionSeriesAnalytics getAnalytics(const Series &s) const {
+        OptionSeriesAnalytics result{};
+
+        result.series = s.definition.series;
+        result.expiration = s.definition.expiration;
+        result.underlying = s.definition.underlying;
+        result.forwardPrice = s.forwardPrice;
+        result.atmVolatility = getAtmVolatility(s);
+        result.skew25Delta = getVolatilityByDelta(s.puts, -0.25) - getVolatilityByDelta(s.calls, 0.25);
+        result.callVolume = s.callVolume;
+        result.putVolume = s.putVolume;
+        result.putCallVolumeRatio = ratio(s.putVolume, s.callVolume);
+        result.callOpenInterest = s.callOpenInterest;
+        result.putOpenInterest = s.putOpenInterest;
+        result.putCallOpenInterestRatio = ratio(s.putOpenInterest, s.callOpenInterest);
+        result.weightedVolatility = ratio(s.weightedVolatilitySum, s.volatilityWeightSum);
+        result.gammaExposure = s.gammaExposure;
+        result.strikes = s.definition.strikes;
+        result.gammaExposureByStrike = s.gammaExposureByStrike;
+
+        return result;
+    }
+
+    std::vector<OptionSeriesAnalytics> takeChanged() {
+        std::vector<OptionSeriesAnalytics> result{};
+
+        result.reserve(changedSeries.size());
+        std::sort(changedSeries.begin(), changedSeries.end());
+
+        for (const auto index : changedSeries) {
+            result.push_back(getAnalytics(series[index]));
+            changed[index] = 0;
+        }
+
+        changedSeries.clear();
+
+        return result;
+    }
+
+    // The task that has already started is not waited for: it does nothing after the model is closed.
+    void cancelTask() {
+        if (taskTimer) {
+            taskTimer->stop();
+            taskTimer.reset();
+        }
+
+        taskScheduled = false;
+    }
+};
+
+OptionChainAnalytics::Builder::Builder(LockExternalConstructionTag) {
+}
+
+OptionChainAnalytics::Builder::~Builder() noexcept = default;
+
+std::string OptionChainAnalytics::Builder::getSymbol(const InstrumentProfile &profile) {
+    return profile.getSymbol();
+}
+
+std::string OptionChainAnalytics::Builder::getUnderlying(const InstrumentProfile &profile) {
+    return profile.getUnderlying();
+}
+
+std::shared_ptr<OptionChainAnalytics::Builder> OptionChainAnalytics::Builder::withFeed(std::shared_ptr<DXFeed> feed) {
+    feed_ = std::move(feed);
+
+    return sharedAs<Builder>();
+}
+
+std::shared_ptr<OptionChainAnalytics::Builder>
+OptionChainAnalytics::Builder::withAggregationPeriod(std::int64_t aggregationPeriodMillis) {
+    aggregationPeriodMillis_ = aggregationPeriodMillis;
+
+    return sharedAs<Builder>();
+}
+
+std::shared_ptr<OptionChainAnalytics::Builder> OptionChainAnalytics::Builder::withListener(Listener listener) {
+    listener_ = std::move(listener);
+
+    return sharedAs<Builder>();
+}
+
+std::shared_ptr<OptionChainAnalytics> OptionChainAnalytics::Builder::build() {
+    if (series_.empty()) {
+        throw InvalidArgumentException("The option chain analytics requires at least one series");
+    }
+
+    if (aggregationPeriodMillis_ < 0) {
+        throw InvalidArgumentException("Invalid aggregation period: " + std::to_string(aggregationPeriodMillis_));
+    }
+
+    return OptionChainAnalytics::create(sharedAs<Builder>());
+}
+
+std::shared_ptr<OptionChainAnalytics> OptionChainAnalytics::create(const std::shared_ptr<Builder> &builder) {
+    auto analytics = OptionChainAnalytics::createShared(builder);
+
+    if (!builder->feed_) {
+        return analytics;
+    }
+
+    std::vector<std::string> optionSymbols{};
+    std::vector<std::string> underlyingSymbols{};
+
+    optionSymbols.reserve(analytics->impl_->optionsBySymbol.size());
+
+    for (const auto &[symbol, _] : analytics->impl_->optionsBySymbol) {
+        optionSymbols.push_back(symbol);
+    }
+
+    for (const auto &[symbol, _] : analytics->impl_->seriesByUnderlying) {
+        underlyingSymbols.push_back(symbol);
+    }
+
+    // The Series events are subscribed separately, since they are needed for the underlyings only.
+    analytics->subscription_ = DXFeedSubscription::create({EventTypeEnum::GREEKS, EventTypeEnum::SUMMARY});
+
+    auto seriesSubscription = DXFeedSubscription::create(EventTypeEnum::SERIES);
+
+    for (const auto &subscription : {analytics->subscription_, seriesSubscription}) {
+        subscription->addEventListener(
+            [a = analytics->weak_from_this()](const std::vector<std::shared_ptr<EventType>> &events) {
+                if (const auto locked = a.lock()) {
+                    locked->sharedAs<OptionChainAnalytics>()->process(events);
+                }
+            });
+    }
+
+    analytics->subscription_->addSymbols(optionSymbols);
+    analytics->seriesSubscription_ = seriesSubscription;
+    seriesSubscription->addSymbols(underlyingSymbols);
+    analytics->subscription_->attach(builder->feed_);
+    seriesSubscription->attach(builder->feed_);
+
+    return analytics;
+}
+
+OptionChainAnalytics::OptionChainAnalytics(LockExternalConstructionTag, const std::shared_ptr<Builder> &builder)
+    : impl_(std::make_unique<Impl>(*builder)) {
+}
+
+OptionChainAnalytics::~OptionChainAnalytics() noexcept {
+    close();
+}
+
+std::shared_ptr<OptionChainAnalytics::Builder> OptionChainAnalytics::newBuilder() {
+    return Builder::createShared();
+}
+
+void OptionChainAnalytics::process(const std::vector<std::shared_ptr<EventType>> &events) {
+    std::lock_guard guard(mtx_);
+
+    if (impl_->closed) {
+        return;
+    }
+
+    impl_->process(events);
+
+    if (impl_->changedSeries.empty()) {
+        return;
+    }
+
+    if (impl_->aggregationPeriodMillis == 0) {
+        notifyListener();
+    } else if (!impl_->taskScheduled) {
+        impl_->taskScheduled = true;
+        impl_->taskTimer = Timer::runOnce(
+            [a = weak_from_this()] {
+                if (const auto locked = a.lock()) {
+                    locked->sharedAs<OptionChainAnalytics>()->notifyListener();
+                }
+            },
+            std::chrono::milliseconds(impl_->aggregationPeriodMillis));
+    }
+}
+
+void OptionChainAnalytics::notifyListener() {
+    std::lock_guard guard(mtx_);
+
+    impl_->taskScheduled = false;
+
+    if (impl_->closed || impl_->changedSeries.empty()) {
+        return;
+    }
+
+    auto changed = impl_->takeChanged();
+
+    if (impl_->listener) {
+        impl_->listener(changed);
+    }
+}
+
+std::vector<OptionSeriesAnalytics> OptionChainAnalytics::getAnalytics() const {
+    std::lock_guard guard(mtx_);
+    std::vector<OptionSeriesAnalytics> result{};
+
+    result.reserve(impl_->series.size());
+
+    for (const auto &s : impl_->series) {
+        result.push_back(impl_->getAnalytics(s));
+    }
+
+    return result;
+}
+
+std::optional<OptionSeriesAnalytics> OptionChainAnalytics::getAnalytics(const std::string &series) const {
+    std::lock_guard guard(mtx_);
+
+    if (const auto found = impl_->seriesByName.find(series); found != impl_->seriesByName.end()) {
+        return impl_->getAnalytics(impl_->series[found->second]);
+    }
+
+    return std::nullopt;
+}
+
+void OptionChainAnalytics::close() {
+    std::lock_guard guard(mtx_);
+
+    impl_->closed = true;
+    impl_->cancelTask();
+
+    if (subscription_) {
+        subscription_->close();
+    }
+
+    if (seriesSubscription_) {
+        seriesSubscription_->close();
+    }
+}
+
+DXFCPP_END_NAMESPACE
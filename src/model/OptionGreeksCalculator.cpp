@@ -0,0 +1,361 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/model/OptionGreeksCalculator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+constexpr double INF = std::numeric_limits<double>::infinity();
+constexpr double DAY_MILLIS = 24.0 * 3600.0 * 1000.0;
+constexpr double DAYS_PER_YEAR = 365.0;
+// ln(2) split into the high part with the zero low bits (k * LN2_HI is exact) and the rest.
+constexpr double LN2_HI = 6.93147180369123816490e-01;
+constexpr double LN2_LO = 1.90821492927058770002e-10;
+
+// The functions below are branch-free, use only the arithmetic and the bit operations, and are inlined, so the loops
+// that call them are vectorized by the compiler (unlike the loops that call libm). All the values are computed before
+// they are selected: the compilers don't turn the conditional floating-point operations into the blends. The accuracy
+// is a few ulps (the normal CDF is accurate to 1e-15 absolute).
+
+// exp(x) = 2^k * exp(r), |r| <= ln(2) / 2, exp(r) by the Taylor polynomial of the 12th degree.
+inline double fastExp(double x) {
+    // Adding the shifter rounds to the integer that is stored in the low bits of the mantissa.
+    constexpr double SHIFTER = 0x1.8p52;
+    const double clamped = std::min(std::max(x, -708.0), 709.0);
+    const double shifted = clamped * std::numbers::log2e + SHIFTER;
+    const double k = shifted - SHIFTER;
+    const double r = (clamped - k * LN2_HI) - k * LN2_LO;
+    const auto scale = std::bit_cast<double>(
+        (std::bit_cast<std::uint64_t>(shifted) - std::bit_cast<std::uint64_t>(SHIFTER) + 1023) << 52);
+    double p = 1.0 / 479001600.0;
+
+    p = p * r + 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    p = p * r + 1.0;
+
+    const double result = p * scale;
+
+    return x < -708.0 ? 0.0 : x > 709.0 ? INF : x != x ? x : result;
+}
+
+// log(x) = e * ln(2) + log(m), m is in [sqrt(1/2), sqrt(2)), log(m) = 2 * atanh(s), s = (m - 1) / (m + 1). The
+// subnormal numbers are not supported.
+inline double fastLog(double x) {
+    constexpr std::uint64_t SQRT_HALF_BITS = 0x3FE6A09E667F3BCDULL;
+    constexpr std::uint64_t ONE_BITS = 0x3FF0000000000000ULL;
+    constexpr std::uint64_t MANTISSA_MASK = 0x000FFFFFFFFFFFFFULL;
+    constexpr double TWO_52 = 0x1p52;
+    const auto bits = std::bit_cast<std::uint64_t>(x) + (ONE_BITS - SQRT_HALF_BITS);
+    const double m = std::bit_cast<double>((bits & MANTISSA_MASK) + SQRT_HALF_BITS);
+    // The exponent is converted to double by the bits (the integer conversion of the 64-bit lanes requires AVX-512).
+    const double e = std::bit_cast<double>((bits >> 52) | std::bit_cast<std::uint64_t>(TWO_52)) - (TWO_52 + 1023.0);
+    const double f = m - 1.0;
+    const double s = f / (2.0 + f);
+    const double z = s * s;
+    double p = 1.0 / 23.0;
+
+    p = p * z + 1.0 / 21.0;
+    p = p * z + 1.0 / 19.0;
+    p = p * z + 1.0 / 17.0;
+    p = p * z + 1.0 / 15.0;
+    p = p * z + 1.0 / 13.0;
+    p = p * z + 1.0 / 11.0;
+    p = p * z + 1.0 / 9.0;
+    p = p * z + 1.0 / 7.0;
+    p = p * z + 1.0 / 5.0;
+    p = p * z + 1.0 / 3.0;
+
+    const double result = e * LN2_HI + ((2.0 * s * z * p + e * LN2_LO) + 2.0 * s);
+
+    return x > 0 && x < INF ? result : x == 0 ? -INF : x == INF ? x : NaN;
+}
+
+// The normal CDF by the algorithm of Hart (1968) as given by West, "Better approximations to cumulative normal
+// functions" (2005).
+inline double normalCdf(double x) {
+    const double a = std::abs(x);
+    const double e = fastExp(-0.5 * a * a);
+    const double numerator =
+        (((((0.0352624965998911 * a + 0.700383064443688) * a + 6.37396220353165) * a + 33.912866078383) * a +
+          112.079291497871) * a + 221.213596169931) * a + 220.206867912376;
+    const double denominator =
+        ((((((0.0883883476483184 * a + 1.75566716318264) * a + 16.064177579207) * a + 86.7807322029461) * a +
+           296.564248779674) * a + 637.333633378831) * a + 793.826512519948) * a + 440.413735824752;
+    const double fraction = a + 1.0 / (a + 2.0 / (a + 3.0 / (a + 4.0 / (a + 0.65))));
+    const double central = e * numerator / denominator;
+    const double far = e / (fraction * 2.506628274631);
+    const double tail = a > 37.0 ? 0.0 : a < 7.07106781186547 ? central : far;
+    const double complement = 1.0 - tail;
+
+    return x > 0 ? complement : tail;
+}
+
+inline double normalPdf(double x) {
+    return fastExp(-0.5 * x * x) * (std::numbers::inv_sqrtpi / std::numbers::sqrt2);
+}
+
+// The dividend yields of the model. The Black-76 model is the Black-Scholes model with the dividend yield equal to the
+// rate. The column is selected once, so the loops don't load the dividend yields conditionally.
+inline const std::vector<double> &getDividends(OptionGreeksCalculator::Model model, const OptionGreeksBatch &batch) {
+    return model == OptionGreeksCalculator::Model::BLACK_76 ? batch.rates : batch.dividends;
+}
+
+// The forward price and the discount factor of the option.
+struct Forward {
+    double forward{};
+    double discount{};
+};
+
+inline Forward getForward(double underlyingPrice, double expiration, double rate, double dividend) {
+    return {underlyingPrice * fastExp((rate - dividend) * expiration), fastExp(-rate * expiration)};
+}
+
+} // namespace
+
+void OptionGreeksBatch::add(double strike, double expiration, double price, double rate, double dividend,
+                            bool isCall) {
+    strikes.push_back(strike);
+    expirations.push_back(expiration);
+    prices.push_back(price);
+    rates.push_back(rate);
+    dividends.push_back(dividend);
+    calls.push_back(isCall ? 1 : 0);
+
+    for (auto *column : {&volatilities, &theoPrices, &deltas, &gammas, &thetas, &rhos, &vegas}) {
+        column->push_back(NaN);
+    }
+}
+
+void OptionGreeksBatch::clear() noexcept {
+    for (auto *column : {&strikes, &expirations, &prices, &rates, &dividends, &volatilities, &theoPrices, &deltas,
+                         &gammas, &thetas, &rhos, &vegas}) {
+        column->clear();
+    }
+
+    calls.clear();
+}
+
+void OptionGreeksCalculator::computeImpliedVolatilities(Model model, double underlyingPrice,
+                                                        OptionGreeksBatch &batch) {
+    const auto size = batch.size();
+
+    batch.volatilities.resize(size);
+
+    // The columns of the solver hold only the active options: the converged ones are removed after each iteration, so
+    // the cost of an iteration is proportional to the number of the options that are still being solved. The target is
+    // the undiscounted price, so the discount is applied once.
+    std::vector<std::size_t> indices{};
+    std::vector<double> forwards{};
+    std::vector<double> strikes{};
+    std::vector<double> logMoneyness{};
+    std::vector<double> sqrtExpirations{};
+    std::vector<double> signs{};
+    std::vector<double> targets{};
+    std::vector<double> lows{};
+    std::vector<double> highs{};
+    std::vector<double> volatilities{};
+    std::vector<double> steps{};
+    const auto &dividends = getDividends(model, batch);
+
+    for (std::size_t i = 0; i < size; i++) {
+        const double expiration = batch.expirations[i];
+        const double strike = batch.strikes[i];
+        const auto [forward, discount] = getForward(underlyingPrice, expiration, batch.rates[i], dividends[i]);
+        const double target = batch.prices[i] / discount;
+        const double intrinsic = batch.calls[i] ? std::max(forward - strike, 0.0) : std::max(strike - forward, 0.0);
+        const double upper = batch.calls[i] ? forward : strike;
+
+        batch.volatilities[i] = NaN;
+
+        // The price must be strictly inside the bounds of the model.
+        if (!(expiration > 0 && strike > 0 && forward > 0 && std::isfinite(forward) && target > intrinsic &&
+              target < upper)) {
+            continue;
+        }
+
+        const double moneyness = std::log(forward / strike);
+        // The initial guess is the larger one of Manaster-Koehler (from which Newton converges monotonically) and
+        // Brenner-Subrahmanyam (the ATM approximation).
+        const double guess = std::max(std::sqrt(2.0 * std::abs(moneyness) / expiration),
+                                      std::sqrt(2.0 * std::numbers::pi / expiration) * target / forward);
+
+        indices.push_back(i);
+        forwards.push_back(forward);
+        strikes.push_back(strike);
+        logMoneyness.push_back(moneyness);
+        sqrtExpirations.push_back(std::sqrt(expiration));
+        signs.push_back(batch.calls[i] ? 1.0 : -1.0);
+        targets.push_back(target);
+        lows.push_back(MIN_VOLATILITY);
+        highs.push_back(MAX_VOLATILITY);
+        volatilities.push_back(std::clamp(guess, MIN_VOLATILITY, MAX_VOLATILITY));
+    }
+
+    steps.resize(indices.size());
+
+    auto activeCount = indices.size();
+
+    for (std::size_t iteration = 0; iteration < MAX_ITERATIONS && activeCount > 0; iteration++) {
+        // The vectorized step of all the active options.
+        for (std::size_t i = 0; i < activeCount; i++) {
+            const double volatility = volatilities[i];
+            const double sign = signs[i];
+            const double deviation = volatility * sqrtExpirations[i];
+            const double d1 = logMoneyness[i] / deviation + 0.5 * deviation;
+            const double d2 = d1 - deviation;
+            // The undiscounted Black price and vega.
+            const double price = sign * (forwards[i] * normalCdf(sign * d1) - strikes[i] * normalCdf(sign * d2));
+            const double vega = forwards[i] * normalPdf(d1) * sqrtExpirations[i];
+            const double difference = price - targets[i];
+            const double low = difference < 0 ? volatility : lows[i];
+            const double high = difference < 0 ? highs[i] : volatility;
+            const double newton = volatility - difference / vega;
+            const double bisection = 0.5 * (low + high);
+            const double next = (newton > low && newton < high) ? newton : bisection;
+
+            lows[i] = low;
+            highs[i] = high;
+            volatilities[i] = next;
+            steps[i] = std::abs(next - volatility);
+        }
+
+        // The converged options are stored and removed, the rest are moved to the front of the columns.
+        std::size_t nextCount = 0;
+
+        for (std::size_t i = 0; i < activeCount; i++) {
+            if (steps[i] > VOLATILITY_PRECISION && iteration + 1 < MAX_ITERATIONS) {
+                indices[nextCount] = indices[i];
+                forwards[nextCount] = forwards[i];
+                strikes[nextCount] = strikes[i];
+                logMoneyness[nextCount] = logMoneyness[i];
+                sqrtExpirations[nextCount] = sqrtExpirations[i];
+                signs[nextCount] = signs[i];
+                targets[nextCount] = targets[i];
+                lows[nextCount] = lows[i];
+                highs[nextCount] = highs[i];
+                volatilities[nextCount] = volatilities[i];
+                nextCount++;
+            } else {
+                batch.volatilities[indices[i]] = volatilities[i];
+            }
+        }
+
+        activeCount = nextCount;
+    }
+}
+
+void OptionGreeksCalculator::computeGreeks(Model model, double underlyingPrice, OptionGreeksBatch &batch) {
+    // The results are computed into the tiles on the stack and copied to the batch: the compilers don't vectorize the
+    // loop that writes six columns of the batch, because they can't prove that the columns don't overlap the inputs.
+    constexpr std::size_t TILE_SIZE = 256;
+    const auto size = batch.size();
+
+    for (auto *column : {&batch.volatilities, &batch.theoPrices, &batch.deltas, &batch.gammas, &batch.thetas,
+                         &batch.rhos, &batch.vegas}) {
+        column->resize(size, NaN);
+    }
+
+    const bool isBlack76 = model == Model::BLACK_76;
+    const auto &dividends = getDividends(model, batch);
+    std::array<double, TILE_SIZE> theoPrices{};
+    std::array<double, TILE_SIZE> deltas{};
+    std::array<double, TILE_SIZE> gammas{};
+    std::array<double, TILE_SIZE> thetas{};
+    std::array<double, TILE_SIZE> rhos{};
+    std::array<double, TILE_SIZE> vegas{};
+
+    for (std::size_t begin = 0; begin < size; begin += TILE_SIZE) {
+        const auto count = std::min(TILE_SIZE, size - begin);
+
+        for (std::size_t j = 0; j < count; j++) {
+            const auto i = begin + j;
+            const double expiration = batch.expirations[i];
+            const double strike = batch.strikes[i];
+            const double rate = batch.rates[i];
+            const double dividend = dividends[i];
+            const double volatility = batch.volatilities[i];
+            const auto [forward, discount] = getForward(underlyingPrice, expiration, rate, dividend);
+            const double sign = batch.calls[i] ? 1.0 : -1.0;
+            const double sqrtExpiration = std::sqrt(expiration);
+            const double deviation = volatility * sqrtExpiration;
+            const double d1 = (fastLog(forward / strike) + 0.5 * deviation * deviation) / deviation;
+            const double d2 = d1 - deviation;
+            const double cdf1 = normalCdf(sign * d1);
+            const double cdf2 = normalCdf(sign * d2);
+            const double pdf1 = normalPdf(d1);
+            // The discounted forward is the underlying price discounted by the dividend yield.
+            const double discountedForward = discount * forward;
+            const double theoPrice = sign * (discountedForward * cdf1 - discount * strike * cdf2);
+            const double theta = -discountedForward * pdf1 * volatility / (2.0 * sqrtExpiration) -
+                                 sign * rate * discount * strike * cdf2 + sign * dividend * discountedForward * cdf1;
+            const double rho = isBlack76 ? -expiration * theoPrice : sign * strike * expiration * discount * cdf2;
+            const double delta = sign * discountedForward / underlyingPrice * cdf1;
+            const double gamma = discountedForward * pdf1 / (underlyingPrice * underlyingPrice * deviation);
+            const double vega = discountedForward * pdf1 * sqrtExpiration / 100.0;
+            const bool valid = expiration > 0 && volatility > 0;
+
+            theoPrices[j] = valid ? theoPrice : NaN;
+            deltas[j] = valid ? delta : NaN;
+            gammas[j] = valid ? gamma : NaN;
+            thetas[j] = valid ? theta / DAYS_PER_YEAR : NaN;
+            rhos[j] = valid ? rho / 100.0 : NaN;
+            vegas[j] = valid ? vega : NaN;
+        }
+
+        std::copy_n(theoPrices.begin(), count, batch.theoPrices.begin() + begin);
+        std::copy_n(deltas.begin(), count, batch.deltas.begin() + begin);
+        std::copy_n(gammas.begin(), count, batch.gammas.begin() + begin);
+        std::copy_n(thetas.begin(), count, batch.thetas.begin() + begin);
+        std::copy_n(rhos.begin(), count, batch.rhos.begin() + begin);
+        std::copy_n(vegas.begin(), count, batch.vegas.begin() + begin);
+    }
+}
+
+void OptionGreeksCalculator::compute(Model model, double underlyingPrice, OptionGreeksBatch &batch) {
+    computeImpliedVolatilities(model, underlyingPrice, batch);
+    computeGreeks(model, underlyingPrice, batch);
+}
+
+double OptionGreeksCalculator::getTimeToExpiration(std::int32_t expiration, std::int64_t time) noexcept {
+    const double millis = (static_cast<double>(expiration) + 1.0) * DAY_MILLIS - static_cast<double>(time);
+
+    return std::max(millis, 0.0) / (DAYS_PER_YEAR * DAY_MILLIS);
+}
+
+std::shared_ptr<Greeks> OptionGreeksCalculator::toGreeks(const OptionGreeksBatch &batch, std::size_t index,
+                                                         const StringLike &eventSymbol, std::int64_t time) {
+    auto greeks = std::make_shared<Greeks>(eventSymbol);
+
+    greeks->setTime(time);
+    // The market price if it is known, or the theoretical one if the volatility was set directly.
+    greeks->setPrice(std::isnan(batch.prices[index]) ? batch.theoPrices[index] : batch.prices[index]);
+    greeks->setVolatility(batch.volatilities[index]);
+    greeks->setDelta(batch.deltas[index]);
+    greeks->setGamma(batch.gammas[index]);
+    greeks->setTheta(batch.thetas[index]);
+    greeks->setRho(batch.rhos[index]);
+    greeks->setVega(batch.vegas[index]);
+
+    return greeks;
+}
+
+DXFCPP_END_NAMESPACE
@@ -10,12 +10,16 @@
 #include "../../include/dxfeed_graal_cpp_api/schedule/Day.hpp"
 #include "../../include/dxfeed_graal_cpp_api/schedule/Session.hpp"
 #include "../../include/dxfeed_graal_cpp_api/schedule/SessionFilter.hpp"
+#include "../../include/dxfeed_graal_cpp_api/schedule/SessionTimeline.hpp"
 
 DXFCPP_BEGIN_NAMESPACE
 
-Schedule::Schedule(JavaObjectHandle<Schedule> &&handle) noexcept : handle_(std::move(handle)) {
+Schedule::Schedule(JavaObjectHandle<Schedule> &&handle)
+    : handle_(std::move(handle)), sessionTimeline_(new SessionTimeline(*this)) {
 }
 
+Schedule::~Schedule() noexcept = default;
+
 Schedule::Ptr Schedule::create(JavaObjectHandle<Schedule> &&handle) {
     if (!handle) {
         throw InvalidArgumentException("Unable to create a Schedule object. The handle is nullptr");
@@ -93,6 +97,10 @@ std::shared_ptr<Session> Schedule::findNearestSessionByTime(std::int64_t time, c
     return Session::create(std::move(sessionHandle));
 }
 
+const SessionTimeline &Schedule::getSessionTimeline() const & {
+    return *sessionTimeline_;
+}
+
 std::string Schedule::getName() const {
     return isolated::schedule::IsolatedSchedule::getName(handle_);
 }
@@ -0,0 +1,186 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/schedule/ScheduleCache.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/utils/StringUtils.hpp"
+#include "../../include/dxfeed_graal_cpp_api/ipf/InstrumentProfile.hpp"
+#include "../../include/dxfeed_graal_cpp_api/ipf/InstrumentProfileData.hpp"
+#include "../../include/dxfeed_graal_cpp_api/schedule/Schedule.hpp"
+
+#include <atomic>
+#include <fmt/format.h>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+struct ScheduleCacheImpl {
+    // The schedules of one definition: the default one and the ones of the venues.
+    struct Entry {
+        std::shared_ptr<Schedule> schedule{};
+        std::unordered_map<std::string, std::shared_ptr<Schedule>, StringHash, std::equal_to<>> venues{};
+    };
+
+    std::shared_mutex mtx{};
+    std::unordered_map<std::string, Entry, StringHash, std::equal_to<>> entries{};
+    std::size_t size{};
+    std::atomic<std::uint64_t> hits{};
+    std::atomic<std::uint64_t> misses{};
+
+    static ScheduleCacheImpl &getInstance() {
+        static ScheduleCacheImpl instance{};
+
+        return instance;
+    }
+
+    static std::shared_ptr<Schedule> *find(Entry &entry, std::optional<std::string_view> venue) {
+        if (!venue) {
+            return entry.schedule ? &entry.schedule : nullptr;
+        }
+
+        auto found = entry.venues.find(*venue);
+
+        return found == entry.venues.end() ? nullptr : &found->second;
+    }
+
+    std::shared_ptr<Schedule> get(std::string_view definition, std::optional<std::string_view> venue) {
+        definition = trim(definition);
+
+        {
+            std::shared_lock lock(mtx);
+
+            if (auto found = entries.find(definition); found != entries.end()) {
+                if (auto *schedule = find(found->second, venue)) {
+                    hits.fetch_add(1, std::memory_order_relaxed);
+
+                    return *schedule;
+                }
+            }
+        }
+
+        misses.fetch_add(1, std::memory_order_relaxed);
+
+        // The schedule is resolved (by the Graal) outside the lock, so the lookups of the other definitions are not
+        // blocked. The entry is added only after the schedule is resolved, so an invalid definition is not cached.
+        std::shared_ptr<Schedule> schedule{};
+
+        if (!venue) {
+            schedule = Schedule::getInstance(definition);
+        } else {
+            // The venues are selected from the trading hours of the profile.
+            const auto profile = InstrumentProfile::create();
+
+            profile->setTradingHours(definition);
+            schedule = Schedule::getInstance(profile, *venue);
+        }
+
+        std::unique_lock lock(mtx);
+        auto found = entries.find(definition);
+
+        if (found == entries.end()) {
+            found = entries.try_emplace(std::string(definition)).first;
+        }
+
+        // The concurrent lookups of a new definition can resolve it more than once: the first resolved schedule is
+        // kept, so all of them return the same instance.
+        if (auto *cached = find(found->second, venue)) {
+            return *cached;
+        }
+
+        if (!venue) {
+            found->second.schedule = schedule;
+        } else {
+            found->second.venues.try_emplace(std::string(*venue), schedule);
+        }
+
+        size++;
+
+        return schedule;
+    }
+
+    static std::string_view trim(std::string_view s) noexcept {
+        const auto isSpace = [](char c) {
+            return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+        };
+
+        while (!s.empty() && isSpace(s.front())) {
+            s.remove_prefix(1);
+        }
+
+        while (!s.empty() && isSpace(s.back())) {
+            s.remove_suffix(1);
+        }
+
+        return s;
+    }
+};
+
+} // namespace
+
+std::string ScheduleCache::Stats::toString() const {
+    return fmt::format("ScheduleCache.Stats{{hits={}, misses={}, size={}, hitRatio={:.4f}}}", hits, misses, size,
+                       getHitRatio());
+}
+
+std::shared_ptr<Schedule> ScheduleCache::getInstance(std::string_view scheduleDefinition) {
+    return ScheduleCacheImpl::getInstance().get(scheduleDefinition, std::nullopt);
+}
+
+std::shared_ptr<Schedule> ScheduleCache::getInstance(std::string_view scheduleDefinition, std::string_view venue) {
+    return ScheduleCacheImpl::getInstance().get(scheduleDefinition, venue);
+}
+
+std::shared_ptr<Schedule> ScheduleCache::getInstance(const std::shared_ptr<InstrumentProfile> &profile) {
+    if (!profile) {
+        throw InvalidArgumentException("The `profile` is nullptr");
+    }
+
+    return ScheduleCacheImpl::getInstance().get(profile->getTradingHours(), std::nullopt);
+}
+
+std::shared_ptr<Schedule> ScheduleCache::getInstance(const std::shared_ptr<InstrumentProfile> &profile,
+                                                     std::string_view venue) {
+    if (!profile) {
+        throw InvalidArgumentException("The `profile` is nullptr");
+    }
+
+    return ScheduleCacheImpl::getInstance().get(profile->getTradingHours(), venue);
+}
+
+std::shared_ptr<Schedule> ScheduleCache::getInstance(const InstrumentProfileData &profile) {
+    return ScheduleCacheImpl::getInstance().get(profile.tradingHours, std::nullopt);
+}
+
+std::shared_ptr<Schedule> ScheduleCache::getInstance(const InstrumentProfileData &profile, std::string_view venue) {
+    return ScheduleCacheImpl::getInstance().get(profile.tradingHours, venue);
+}
+
+ScheduleCache::Stats ScheduleCache::getStats() noexcept {
+    auto &impl = ScheduleCacheImpl::getInstance();
+    std::shared_lock lock(impl.mtx);
+
+    return {impl.hits.load(), impl.misses.load(), impl.size};
+}
+
+void ScheduleCache::resetStats() noexcept {
+    auto &impl = ScheduleCacheImpl::getInstance();
+
+    impl.hits = 0;
+    impl.misses = 0;
+}
+
+void ScheduleCache::clear() noexcept {
+    auto &impl = ScheduleCacheImpl::getInstance();
+    std::unique_lock lock(impl.mtx);
+
+    impl.entries.clear();
+    impl.size = 0;
+}
+
+DXFCPP_END_NAMESPACE
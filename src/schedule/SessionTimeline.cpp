@@ -0,0 +1,290 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "../../include/dxfeed_graal_cpp_api/schedule/SessionTimeline.hpp"
+
+#include "../../include/dxfeed_graal_cpp_api/exceptions/InvalidArgumentException.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/Common.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/Platform.hpp"
+#include "../../include/dxfeed_graal_cpp_api/internal/utils/ParallelUtils.hpp"
+#include "../../include/dxfeed_graal_cpp_api/schedule/Day.hpp"
+#include "../../include/dxfeed_graal_cpp_api/schedule/DayFilter.hpp"
+#include "../../include/dxfeed_graal_cpp_api/schedule/Schedule.hpp"
+#include "../../include/dxfeed_graal_cpp_api/schedule/Session.hpp"
+#include "../../include/dxfeed_graal_cpp_api/schedule/SessionFilter.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include <fmt/format.h>
+
+DXFCPP_BEGIN_NAMESPACE
+
+namespace {
+
+// Returns the last item that starts at or before the time. The items cover the time, so it is the one that contains
+// the time (the empty items at the same start time precede the non-empty one).
+template <typename T> std::size_t findIndexByTime(const std::vector<T> &items, std::int64_t time) {
+    auto it = std::upper_bound(items.begin(), items.end(), time, [](std::int64_t t, const T &item) {
+        return t < item.startTime;
+    });
+
+    return static_cast<std::size_t>(std::distance(items.begin(), it)) - 1;
+}
+
+template <typename T> const T &findByTime(const std::vector<T> &items, std::int64_t time) {
+    return items[findIndexByTime(items, time)];
+}
+
+// Loads the day and its sessions from the schedule.
+void loadDay(const Day &day, std::vector<SessionTimeline::SessionInfo> &sessions,
+             std::vector<SessionTimeline::DayInfo> &days) {
+    const auto dayId = day.getDayId();
+    const auto dayFlags = (day.isTrading() ? SessionTimeline::TRADING_DAY : 0u) |
+                          (day.isHoliday() ? SessionTimeline::HOLIDAY : 0u) |
+                          (day.isShortDay() ? SessionTimeline::SHORT_DAY : 0u);
+
+    days.push_back({day.getStartTime(), day.getEndTime(), day.getResetTime(), dayId, day.getYearMonthDay(), dayFlags});
+
+    for (const auto &session : day.getSessions()) {
+        sessions.push_back({session->getStartTime(), session->getEndTime(), session->getType().getCode(), dayId,
+                            dayFlags | (session->isTrading() ? SessionTimeline::TRADING : 0u)});
+    }
+}
+
+} // namespace
+
+const SessionType &SessionTimeline::SessionInfo::getType() const noexcept {
+    switch (type) {
+    case SessionTypeEnum::NO_TRADING:
+        return SessionType::NO_TRADING;
+    case SessionTypeEnum::PRE_MARKET:
+        return SessionType::PRE_MARKET;
+    case SessionTypeEnum::REGULAR:
+        return SessionType::REGULAR;
+    case SessionTypeEnum::AFTER_MARKET:
+        return SessionType::AFTER_MARKET;
+    }
+
+    return SessionType::NO_TRADING;
+}
+
+SessionTimeline::SessionTimeline(const Schedule &schedule) noexcept : schedule_(&schedule) {
+}
+
+bool SessionTimeline::covers(std::int64_t time) const noexcept {
+    return !days_.empty() && time >= days_.front().startTime && time < days_.back().endTime;
+}
+
+void SessionTimeline::load(std::int64_t time) const {
+    if (covers(time)) {
+        return;
+    }
+
+    const std::int64_t maxGap = MAX_GAP_DAYS * time_util::DAY;
+
+    if (days_.empty() || time < days_.front().startTime - maxGap || time >= days_.back().endTime + maxGap) {
+        sessions_.clear();
+        days_.clear();
+        firstDay_ = lastDay_ = schedule_->getDayByTime(time);
+        append(firstDay_);
+    }
+
+    if (time < days_.front().startTime) {
+        while (time < days_.front().startTime) {
+            firstDay_ = firstDay_->getPrevDay(DayFilter::ANY);
+            prepend(firstDay_);
+        }
+    } else {
+        while (time >= days_.back().endTime) {
+            lastDay_ = lastDay_->getNextDay(DayFilter::ANY);
+            append(lastDay_);
+        }
+
+        // The times usually move forward, so the next days are loaded in advance.
+        for (std::size_t i = 0; i < PREFETCH_DAYS; i++) {
+            lastDay_ = lastDay_->getNextDay(DayFilter::ANY);
+            append(lastDay_);
+        }
+    }
+
+    trim(time);
+}
+
+void SessionTimeline::append(const std::shared_ptr<Day> &day) const {
+    loadDay(*day, sessions_, days_);
+}
+
+void SessionTimeline::prepend(const std::shared_ptr<Day> &day) const {
+    std::vector<SessionInfo> sessions{};
+    std::vector<DayInfo> days{};
+
+    loadDay(*day, sessions, days);
+    days_.insert(days_.begin(), days.begin(), days.end());
+    sessions_.insert(sessions_.begin(), sessions.begin(), sessions.end());
+}
+
+void SessionTimeline::trim(std::int64_t time) const {
+    if (days_.size() <= MAX_DAYS) {
+        return;
+    }
+
+    const auto excess = days_.size() - MAX_DAYS;
+
+    // The days on the side opposite to the time are dropped.
+    if (time - days_.front().startTime > days_.back().endTime - time) {
+        const auto newFirstDayId = days_[excess].dayId;
+
+        days_.erase(days_.begin(), days_.begin() + static_cast<std::ptrdiff_t>(excess));
+        sessions_.erase(sessions_.begin(), std::find_if(sessions_.begin(), sessions_.end(), [&](const auto &s) {
+                            return s.dayId == newFirstDayId;
+                        }));
+        firstDay_ = schedule_->getDayById(newFirstDayId);
+    } else {
+        const auto newLastDayId = days_[days_.size() - excess - 1].dayId;
+
+        days_.resize(MAX_DAYS);
+        sessions_.erase(std::find_if(sessions_.rbegin(), sessions_.rend(),
+                                     [&](const auto &s) {
+                                         return s.dayId == newLastDayId;
+                                     })
+                            .base(),
+                        sessions_.end());
+        lastDay_ = schedule_->getDayById(newLastDayId);
+    }
+}
+
+SessionTimeline::SessionInfo SessionTimeline::getSessionByTime(std::int64_t time) const {
+    return read(time, [&] {
+        return findByTime(sessions_, time);
+    });
+}
+
+SessionTimeline::DayInfo SessionTimeline::getDayByTime(std::int64_t time) const {
+    return read(time, [&] {
+        return findByTime(days_, time);
+    });
+}
+
+bool SessionTimeline::isTrading(std::int64_t time) const {
+    return read(time, [&] {
+        return findByTime(sessions_, time).isTrading();
+    });
+}
+
+std::size_t SessionTimeline::classify(std::span<const std::int64_t> times, const SessionFilter &filter,
+                                      std::span<SessionTypeEnum> types, std::span<std::int32_t> dayIds,
+                                      std::size_t parallelism) const {
+    if (types.size() != times.size() || dayIds.size() != times.size()) {
+        throw InvalidArgumentException(fmt::format("The sizes of the outputs ({}, {}) differ from the times size ({})",
+                                                   types.size(), dayIds.size(), times.size()));
+    }
+
+    if (times.empty()) {
+        return 0;
+    }
+
+    if (parallelism == 0) {
+        parallelism = std::max<std::size_t>(Platform::getLogicalCoresCount(), 1);
+    }
+
+    const bool sorted = std::is_sorted(times.begin(), times.end());
+    const auto [minTime, maxTime] = sorted ? std::pair{times.front(), times.back()}
+                                           : std::pair{*std::min_element(times.begin(), times.end()),
+                                                       *std::max_element(times.begin(), times.end())};
+
+    // The sparse times are classified through the horizon, it keeps only the days around the times.
+    if ((maxTime - minTime) / time_util::DAY > MAX_CLASSIFY_SPAN_DAYS) {
+        std::size_t accepted = 0;
+
+        for (std::size_t i = 0; i < times.size(); i++) {
+            const auto session = getSessionByTime(times[i]);
+            const bool isAccepted = filter.accept(session);
+
+            types[i] = session.type;
+            dayIds[i] = isAccepted ? session.dayId : REJECTED_DAY_ID;
+            accepted += isAccepted ? 1 : 0;
+        }
+
+        return accepted;
+    }
+
+    // The private table of the whole span, so the tasks don't touch the horizon and the Graal.
+    std::vector<SessionInfo> sessions{};
+    std::vector<DayInfo> days{};
+
+    for (auto day = schedule_->getDayByTime(minTime);; day = day->getNextDay(DayFilter::ANY)) {
+        loadDay(*day, sessions, days);
+
+        if (days.back().endTime > maxTime) {
+            break;
+        }
+    }
+
+    std::vector<std::int32_t> acceptedDayIds(sessions.size());
+
+    for (std::size_t i = 0; i < sessions.size(); i++) {
+        acceptedDayIds[i] = filter.accept(sessions[i]) ? sessions[i].dayId : REJECTED_DAY_ID;
+    }
+
+    const auto chunkCount = (times.size() + CLASSIFY_CHUNK_SIZE - 1) / CLASSIFY_CHUNK_SIZE;
+    std::atomic<std::size_t> accepted{};
+
+    parallel_utils::runInParallel(chunkCount, parallelism, [&](std::size_t chunk) {
+        const auto begin = chunk * CLASSIFY_CHUNK_SIZE;
+        const auto end = std::min(begin + CLASSIFY_CHUNK_SIZE, times.size());
+        auto index = findIndexByTime(sessions, times[begin]);
+        std::size_t chunkAccepted = 0;
+
+        for (auto i = begin; i < end; i++) {
+            const auto time = times[i];
+
+            if (sorted) {
+                while (index + 1 < sessions.size() && sessions[index + 1].startTime <= time) {
+                    index++;
+                }
+            } else if (time < sessions[index].startTime ||
+                       (index + 1 < sessions.size() && sessions[index + 1].startTime <= time)) {
+                index = findIndexByTime(sessions, time);
+            }
+
+            types[i] = sessions[index].type;
+            dayIds[i] = acceptedDayIds[index];
+            chunkAccepted += acceptedDayIds[index] != REJECTED_DAY_ID ? 1 : 0;
+        }
+
+        accepted += chunkAccepted;
+    });
+
+    return accepted;
+}
+
+std::int64_t SessionTimeline::getStartTime() const {
+    std::shared_lock lock(mtx_);
+
+    return days_.empty() ? 0 : days_.front().startTime;
+}
+
+std::int64_t SessionTimeline::getEndTime() const {
+    std::shared_lock lock(mtx_);
+
+    return days_.empty() ? 0 : days_.back().endTime;
+}
+
+std::size_t SessionTimeline::getDayCount() const {
+    std::shared_lock lock(mtx_);
+
+    return days_.size();
+}
+
+void SessionTimeline::clear() const {
+    std::unique_lock lock(mtx_);
+
+    sessions_.clear();
+    days_.clear();
+    firstDay_.reset();
+    lastDay_.reset();
+}
+
+DXFCPP_END_NAMESPACE
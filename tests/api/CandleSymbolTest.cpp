@@ -97,4 +97,47 @@ TEST_CASE("Double checks") {
             CandleSymbol::valueOf(
                 "AAPL", std::vector<CandleSymbolAttributeVariant>{CandlePeriod::valueOf(15, CandleType::MINUTE)})
                 .toString());
-}
\ No newline at end of file
+}
+
+TEST_CASE("CandleSymbolCache returns the shared parsed symbols") {
+    CandleSymbolCache::clear();
+    CandleSymbolCache::resetStats();
+
+    auto s1 = CandleSymbolCache::valueOf("IBM{aa=zz,price=b}");
+    auto s2 = CandleSymbolCache::valueOf("IBM{aa=zz,price=b}");
+    auto s3 = CandleSymbolCache::valueOf("AAPL&Q{=15m}");
+
+    REQUIRE(s1 == s2);
+    REQUIRE(s1 != s3);
+    REQUIRE(*s1 == CandleSymbol::valueOf("IBM{aa=zz,price=b}"));
+    REQUIRE("IBM{aa=zz,price=bid}" == s1->toString());
+
+    auto stats = CandleSymbolCache::getStats();
+
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.misses == 2);
+    REQUIRE(stats.size == 2);
+
+    CandleSymbolCache::clear();
+    REQUIRE(CandleSymbolCache::getStats().size == 0);
+    REQUIRE(CandleSymbolCache::valueOf("IBM{aa=zz,price=b}") != s1);
+}
+
+TEST_CASE("CandleSymbolCache caches with a capacity smaller than the number of shards") {
+    const auto capacity = CandleSymbolCache::getCapacity();
+
+    CandleSymbolCache::clear();
+    CandleSymbolCache::setCapacity(1);
+
+    auto s1 = CandleSymbolCache::valueOf("IBM{=15m}");
+    auto s2 = CandleSymbolCache::valueOf("IBM{=15m}");
+
+    REQUIRE(s1 == s2);
+
+    CandleSymbolCache::setCapacity(0);
+
+    REQUIRE(CandleSymbolCache::valueOf("AAPL{=15m}") != CandleSymbolCache::valueOf("AAPL{=15m}"));
+
+    CandleSymbolCache::setCapacity(capacity);
+    CandleSymbolCache::clear();
+}
@@ -0,0 +1,142 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+constexpr std::int64_t MINUTE = 60'000LL;
+
+// Stands in for a promise of the feed: completes with a trade for each minute of the range, or blocks until cancelled.
+struct FakeRequest final : TimeSeriesStream::Request {
+    std::int64_t from;
+    std::int64_t to;
+    bool blocking;
+    std::atomic<int> &pending;
+
+    std::mutex mtx{};
+    std::condition_variable cv{};
+    bool cancelled = false;
+
+    FakeRequest(std::int64_t from, std::int64_t to, bool blocking, std::atomic<int> &pending)
+        : from{from}, to{to}, blocking{blocking}, pending{pending} {
+        ++pending;
+    }
+
+    ~FakeRequest() noexcept override {
+        --pending;
+    }
+
+    std::vector<std::shared_ptr<EventType>> await() override {
+        if (blocking) {
+            std::unique_lock lock(mtx);
+
+            cv.wait(lock, [this] {
+                return cancelled;
+            });
+
+            throw std::runtime_error("CancellationException");
+        }
+
+        std::vector<std::shared_ptr<EventType>> events{};
+
+        for (auto time = (from + MINUTE - 1) / MINUTE * MINUTE; time <= to; time += MINUTE) {
+            auto timeAndSale = std::make_shared<TimeAndSale>("AAPL");
+
+            timeAndSale->setTime(time);
+            events.push_back(timeAndSale);
+        }
+
+        return events;
+    }
+
+    void cancel() override {
+        std::lock_guard guard(mtx);
+
+        cancelled = true;
+        cv.notify_all();
+    }
+};
+
+} // namespace
+
+TEST_CASE("TimeSeriesStream delivers the chunks in time order with a bounded prefetch") {
+    std::atomic<int> pending{};
+    std::vector<std::pair<std::int64_t, std::int64_t>> ranges{};
+
+    const auto stream = TimeSeriesStream::create(
+        0, 100 * MINUTE,
+        [&](std::int64_t from, std::int64_t to) {
+            ranges.emplace_back(from, to);
+
+            return std::make_unique<FakeRequest>(from, to, false, pending);
+        },
+        {.chunkDuration = 30 * MINUTE, .prefetch = 2});
+
+    REQUIRE(ranges.size() == 2);
+
+    std::vector<std::int64_t> times{};
+
+    while (auto chunk = stream->nextAs<TimeAndSale>()) {
+        REQUIRE(pending <= 2);
+
+        for (const auto &timeAndSale : *chunk) {
+            times.push_back(timeAndSale->getTime());
+        }
+    }
+
+    REQUIRE(!stream->hasNext());
+    REQUIRE(ranges == std::vector<std::pair<std::int64_t, std::int64_t>>{
+                          {0, 30 * MINUTE - 1},
+                          {30 * MINUTE, 60 * MINUTE - 1},
+                          {60 * MINUTE, 90 * MINUTE - 1},
+                          {90 * MINUTE, 100 * MINUTE},
+                      });
+    REQUIRE(times.size() == 101);
+
+    for (std::size_t i = 0; i < times.size(); i++) {
+        REQUIRE(times[i] == static_cast<std::int64_t>(i) * MINUTE);
+    }
+}
+
+TEST_CASE("TimeSeriesStream is cancelled by the consumer or from another thread") {
+    std::atomic<int> pending{};
+    const auto requester = [&pending](bool blocking) {
+        return [&pending, blocking](std::int64_t from, std::int64_t to) {
+            return std::make_unique<FakeRequest>(from, to, blocking, pending);
+        };
+    };
+
+    auto stream = TimeSeriesStream::create(0, 100 * MINUTE, requester(false), {.chunkDuration = 10 * MINUTE});
+
+    REQUIRE(stream->forEach([](std::vector<std::shared_ptr<EventType>>) {
+        return false;
+    }) == 1);
+    REQUIRE(stream->isCancelled());
+    REQUIRE(!stream->next());
+    REQUIRE(pending == 0);
+
+    stream = TimeSeriesStream::create(0, 100 * MINUTE, requester(true), {.chunkDuration = 10 * MINUTE});
+
+    std::thread canceller([&stream] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        stream->cancel();
+    });
+
+    REQUIRE(!stream->next());
+
+    canceller.join();
+}
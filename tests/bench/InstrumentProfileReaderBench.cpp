@@ -0,0 +1,100 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace dxfcpp;
+
+namespace {
+
+// Writes the file with the stocks and their options (about 150 bytes per option).
+void writeProfiles(const std::filesystem::path &path, std::size_t count) {
+    std::ofstream out(path, std::ios::binary);
+    const std::size_t stockCount = std::max<std::size_t>(count / 1000, 1);
+
+    out << "#STOCK::=TYPE,SYMBOL,DESCRIPTION,COUNTRY,OPOL,EXCHANGES,CURRENCY,CFI,ICB,TRADING_HOURS\n";
+
+    for (std::size_t i = 0; i < stockCount; i++) {
+        out << "STOCK,S" << i << ",\"Company " << i << ", Inc.\",US,XNAS,ARCX;BATS;XNAS,USD,ESXXXX," << 1000 + i % 9000
+            << ",NewYorkETH()\n";
+    }
+
+    out << "#OPTION::=TYPE,SYMBOL,DESCRIPTION,COUNTRY,OPOL,EXCHANGES,CURRENCY,CFI,MULTIPLIER,UNDERLYING,SPC,MMY,"
+           "EXPIRATION,LAST_TRADE,STRIKE,OPTION_TYPE,EXPIRATION_STYLE,SETTLEMENT_STYLE,PRICE_INCREMENTS,"
+           "TRADING_HOURS\n";
+
+    for (std::size_t i = stockCount; i < count; i++) {
+        const auto underlying = "S" + std::to_string(i % stockCount);
+        const auto day = std::to_string(10 + i % 18);
+        const auto strike = std::to_string(i % 500);
+
+        out << "OPTION,." << underlying << "2412" << day << "C" << strike << "," << underlying
+            << " option,US,XNAS,BATO;XCBO,USD,OCASPS,100," << underlying << ",1,202412,2024-12-" << day << ",2024-12-"
+            << day << "," << strike << ",STD,Weeklys,PM,0.01 3; 0.05,NewYorkETH()\n";
+    }
+
+    out << "##COMPLETE\n";
+}
+
+} // namespace
+
+TEST_CASE("Benchmark InstrumentProfileReader vs NativeInstrumentProfileReader vs InstrumentProfileSnapshot") {
+    // The number of the profiles can be changed with the DXFCXX_IPF_BENCH_PROFILES environment variable.
+    std::size_t count = 2'000'000;
+
+    if (const auto value = std::getenv("DXFCXX_IPF_BENCH_PROFILES")) {
+        count = std::stoull(value);
+    }
+
+    const auto path = std::filesystem::temp_directory_path() / "InstrumentProfileReaderBench.ipf";
+
+    writeProfiles(path, count);
+
+    ankerl::nanobench::Bench bench;
+
+    bench.epochs(3);
+    bench.epochIterations(1);
+    bench.warmup(1);
+    bench.unit("profile");
+    bench.batch(count);
+
+    bench.run("InstrumentProfileReader::readFromFile", [&] {
+        ankerl::nanobench::doNotOptimizeAway(InstrumentProfileReader::create()->readFromFile(path.string()).size());
+    });
+
+    bench.run("InstrumentProfileReader::readDataFromFile", [&] {
+        ankerl::nanobench::doNotOptimizeAway(
+            InstrumentProfileReader::create()->readDataFromFile(path.string()).size());
+    });
+
+    bench.run("NativeInstrumentProfileReader (1 thread)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(
+            NativeInstrumentProfileReader::create({.parallelism = 1})->readFromFile(path.string()).size());
+    });
+
+    bench.run("NativeInstrumentProfileReader (all cores)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(
+            NativeInstrumentProfileReader::create()->readFromFile(path.string()).size());
+    });
+
+    const auto snapshotPath = std::filesystem::temp_directory_path() / "InstrumentProfileReaderBench.ipfs";
+    auto reader = NativeInstrumentProfileReader::create();
+
+    InstrumentProfileSnapshot::write(snapshotPath.string(), reader->readFromFile(path.string()),
+                                     reader->getLastModified(), reader->wasComplete());
+
+    bench.run("InstrumentProfileSnapshot::open", [&] {
+        ankerl::nanobench::doNotOptimizeAway(InstrumentProfileSnapshot::open(snapshotPath.string())->size());
+    });
+
+    std::filesystem::remove(snapshotPath);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,184 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <utility>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+// 2024-01-31 00:00:00 UTC
+constexpr std::int64_t START_TIME = 1706659200000LL;
+constexpr std::int64_t MINUTE = 60'000LL;
+
+// Stands in for the candle web service: a candle for each minute of the requested range.
+struct FakeServer {
+    std::vector<std::pair<std::int64_t, std::int64_t>> requests{};
+    // The times of the candles that are sent with EventFlag::REMOVE_EVENT.
+    std::vector<std::int64_t> removed{};
+
+    HistoryCache::Fetcher fetcher(const CandleSymbol &symbol) {
+        return [this, symbol](std::int64_t from, std::int64_t to) {
+            requests.emplace_back(from, to);
+
+            std::vector<std::shared_ptr<EventType>> events{};
+
+            for (auto time = (from + MINUTE - 1) / MINUTE * MINUTE; time <= to; time += MINUTE) {
+                auto candle = std::make_shared<Candle>(symbol);
+                const auto price = 100.0 + static_cast<double>((time - START_TIME) / MINUTE) * 0.25;
+
+                candle->setTime(time);
+                candle->setCount(3);
+                candle->setOpen(price);
+                candle->setHigh(price + 0.5);
+                candle->setLow(price - 0.5);
+                candle->setClose(price + 0.25);
+                candle->setVolume(1000);
+                candle->setVWAP(price);
+
+                if (std::find(removed.begin(), removed.end(), time) != removed.end()) {
+                    candle->setEventFlags(EventFlag::REMOVE_EVENT.getFlag());
+                }
+
+                events.push_back(candle);
+            }
+
+            return events;
+        };
+    }
+};
+
+struct TempDirectory {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "dxfcpp-file-history-cache-test";
+
+    TempDirectory() {
+        std::filesystem::remove_all(path);
+    }
+
+    ~TempDirectory() {
+        std::error_code ec{};
+
+        std::filesystem::remove_all(path, ec);
+    }
+};
+
+} // namespace
+
+TEST_CASE("FileHistoryCache downloads only the gaps and persists the candles") {
+    TempDirectory directory{};
+    const auto symbol = CandleSymbol::valueOf("AAPL{=m}");
+    FakeServer server{};
+
+    {
+        const auto cache = FileHistoryCache::create(directory.path.string());
+        const auto first =
+            cache->getTimeSeries(Candle::TYPE, symbol, START_TIME, START_TIME + 59 * MINUTE, server.fetcher(symbol));
+
+        REQUIRE(first.size() == 60);
+        REQUIRE(server.requests.size() == 1);
+
+        const auto second = cache->getTimeSeries(Candle::TYPE, symbol, START_TIME + 30 * MINUTE,
+                                                 START_TIME + 89 * MINUTE, server.fetcher(symbol));
+
+        REQUIRE(second.size() == 60);
+        REQUIRE(server.requests.size() == 2);
+        REQUIRE(server.requests[1] == std::pair{START_TIME + 59 * MINUTE + 1, START_TIME + 89 * MINUTE});
+        REQUIRE(cache->getStats().misses == 2);
+    }
+
+    const auto cache = FileHistoryCache::create(directory.path.string());
+    const auto all =
+        cache->getTimeSeries(Candle::TYPE, symbol, START_TIME, START_TIME + 89 * MINUTE, server.fetcher(symbol));
+
+    REQUIRE(server.requests.size() == 2);
+    REQUIRE(cache->getStats().hits == 1);
+    REQUIRE(all.size() == 90);
+
+    for (std::size_t i = 0; i < all.size(); i++) {
+        const auto candle = all[i]->template sharedAs<Candle>();
+        const auto price = 100.0 + static_cast<double>(i) * 0.25;
+
+        REQUIRE(candle->getTime() == START_TIME + static_cast<std::int64_t>(i) * MINUTE);
+        REQUIRE(candle->getEventSymbol() == symbol);
+        REQUIRE(candle->getCount() == 3);
+        REQUIRE(candle->getOpen() == price);
+        REQUIRE(candle->getClose() == price + 0.25);
+        REQUIRE(candle->getVWAP() == price);
+        REQUIRE(std::isnan(candle->getOpenInterest()));
+    }
+
+    cache->clear();
+    cache->getTimeSeries(Candle::TYPE, symbol, START_TIME, START_TIME + MINUTE, server.fetcher(symbol));
+
+    REQUIRE(server.requests.size() == 3);
+}
+
+TEST_CASE("FileHistoryCache downloads the candles of the current period again") {
+    TempDirectory directory{};
+    const auto symbol = CandleSymbol::valueOf("AAPL{=d}");
+    const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    const auto from = now - 3 * 24 * 60 * MINUTE;
+    const auto to = now - MINUTE;
+    FakeServer server{};
+    const auto cache = FileHistoryCache::create(directory.path.string());
+
+    cache->getTimeSeries(Candle::TYPE, symbol, from, to, server.fetcher(symbol));
+    cache->getTimeSeries(Candle::TYPE, symbol, from, to, server.fetcher(symbol));
+
+    // The range before the candle of the current day is cached, the rest is requested again.
+    REQUIRE(server.requests.size() == 2);
+    REQUIRE(server.requests[1].first > from);
+    REQUIRE(server.requests[1].first >= now - 24 * 60 * MINUTE);
+    REQUIRE(server.requests[1].second == to);
+}
+
+TEST_CASE("FileHistoryCache removes the candles that are removed by the service") {
+    TempDirectory directory{};
+    const auto symbol = CandleSymbol::valueOf("AAPL{=t}");
+    const auto last = START_TIME + 9 * MINUTE;
+    FakeServer server{};
+    const auto cache = FileHistoryCache::create(directory.path.string());
+
+    REQUIRE(cache->getTimeSeries(Candle::TYPE, symbol, START_TIME, last, server.fetcher(symbol)).size() == 10);
+
+    // The last tick candle is downloaded again, and the service removes it.
+    server.removed.push_back(last);
+
+    const auto events = cache->getTimeSeries(Candle::TYPE, symbol, START_TIME, last, server.fetcher(symbol));
+
+    REQUIRE(server.requests.size() == 2);
+    REQUIRE(server.requests[1] == std::pair{last, last});
+    REQUIRE(events.size() == 9);
+    REQUIRE(events.back()->template sharedAs<Candle>()->getTime() == last - MINUTE);
+    REQUIRE(FileHistoryCache::create(directory.path.string())
+                ->getTimeSeries(Candle::TYPE, symbol, START_TIME, last, server.fetcher(symbol))
+                .size() == 9);
+}
+
+TEST_CASE("FileHistoryCache keeps the symbols that differ in case apart") {
+    TempDirectory directory{};
+    const auto cache = FileHistoryCache::create(directory.path.string());
+    auto lower = cache->getFilePath(Candle::TYPE, "aapl{=d}");
+    auto upper = cache->getFilePath(Candle::TYPE, "AAPL{=d}");
+
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    std::transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+
+    REQUIRE(lower != upper);
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+constexpr std::int64_t HOUR = 3'600'000LL;
+
+// Stands in for the candle web service: a candle at the start of each hour of the requested range, with random delays.
+std::vector<std::shared_ptr<EventType>> fetchHours(const SymbolWrapper &symbol, std::int64_t from, std::int64_t to) {
+    std::this_thread::sleep_for(std::chrono::microseconds((from / HOUR * 7919) % 500));
+
+    std::vector<std::shared_ptr<EventType>> events{};
+
+    for (auto time = (from + HOUR - 1) / HOUR * HOUR; time <= to; time += HOUR) {
+        auto candle = std::make_shared<Candle>(CandleSymbol::valueOf(symbol.asStringSymbol()));
+
+        candle->setTime(time);
+        events.push_back(candle);
+    }
+
+    return events;
+}
+
+} // namespace
+
+TEST_CASE("HistoryBulkLoader delivers the chunks of each symbol in time order") {
+    const std::vector<SymbolWrapper> symbols{"AAPL{=h}", "IBM{=h}", "MSFT{=h}", "GOOG{=h}", "TSLA{=h}"};
+    constexpr std::int64_t from = 0;
+    constexpr std::int64_t to = 1000 * HOUR;
+
+    std::mutex mtx{};
+    std::map<std::string, std::vector<std::int64_t>> times{};
+    std::map<std::string, int> lastChunks{};
+
+    HistoryBulkLoader::load(
+        symbols, from, to, fetchHours,
+        [&](const SymbolWrapper &symbol, std::vector<std::shared_ptr<EventType>> events, bool isLast) {
+            std::lock_guard guard(mtx);
+            auto &symbolTimes = times[symbol.asStringSymbol()];
+
+            REQUIRE(lastChunks[symbol.asStringSymbol()] == 0);
+
+            for (const auto &event : events) {
+                symbolTimes.push_back(event->template sharedAs<Candle>()->getTime());
+            }
+
+            lastChunks[symbol.asStringSymbol()] += isLast ? 1 : 0;
+        },
+        {.chunkDuration = 24 * HOUR, .parallelism = 8, .window = 6});
+
+    REQUIRE(times.size() == symbols.size());
+
+    for (const auto &[symbol, symbolTimes] : times) {
+        REQUIRE(symbolTimes.size() == 1001);
+        REQUIRE(lastChunks[symbol] == 1);
+
+        for (std::size_t i = 0; i < symbolTimes.size(); i++) {
+            REQUIRE(symbolTimes[i] == static_cast<std::int64_t>(i) * HOUR);
+        }
+    }
+}
+
+TEST_CASE("HistoryBulkLoader rethrows the first failure") {
+    std::atomic<int> fetches{};
+
+    REQUIRE_THROWS_AS(HistoryBulkLoader::load(
+                          {"AAPL{=h}", "IBM{=h}"}, 0, 1000 * HOUR,
+                          [&](const SymbolWrapper &symbol, std::int64_t from, std::int64_t to) {
+                              if (++fetches == 3) {
+                                  throw std::runtime_error("The service is unavailable");
+                              }
+
+                              return fetchHours(symbol, from, to);
+                          },
+                          [](const SymbolWrapper &, std::vector<std::shared_ptr<EventType>>, bool) {
+                          },
+                          {.chunkDuration = 10 * HOUR, .parallelism = 4}),
+                      std::runtime_error);
+
+    REQUIRE(fetches < 20);
+}
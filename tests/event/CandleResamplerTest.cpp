@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <cmath>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+// 2024-01-31 00:00:00 UTC (Wednesday)
+constexpr std::int64_t START_TIME = 1706659200000LL;
+constexpr std::int64_t MINUTE = 60'000LL;
+
+CandleColumns createMinutes(std::size_t count) {
+    CandleColumns columns{};
+
+    for (std::size_t i = 0; i < count; i++) {
+        const auto price = 100.0 + static_cast<double>(i % 10);
+
+        columns.times.push_back(START_TIME + static_cast<std::int64_t>(i) * MINUTE);
+        columns.counts.push_back(2);
+        columns.opens.push_back(price);
+        columns.highs.push_back(price + 1);
+        columns.lows.push_back(price - 1);
+        columns.closes.push_back(price + 0.5);
+        columns.volumes.push_back(i % 7 == 0 ? math::NaN : 10.0);
+        columns.vwaps.push_back(price);
+        columns.bidVolumes.push_back(4);
+        columns.askVolumes.push_back(6);
+        columns.impVolatilities.push_back(static_cast<double>(i));
+        columns.openInterests.push_back(math::NaN);
+    }
+
+    return columns;
+}
+
+} // namespace
+
+TEST_CASE("CandleResampler reduces the columns of each bucket") {
+    const auto minutes = createMinutes(180);
+    const auto hours = CandleResampler::resample(minutes.view(), CandlePeriod::valueOf(1, CandleType::HOUR));
+
+    REQUIRE(hours.size() == 3);
+
+    for (std::size_t b = 0; b < hours.size(); b++) {
+        double high = -1e9;
+        double low = 1e9;
+        double volume = 0;
+        double turnover = 0;
+
+        for (std::size_t i = b * 60; i < (b + 1) * 60; i++) {
+            high = std::max(high, minutes.highs[i]);
+            low = std::min(low, minutes.lows[i]);
+
+            if (!std::isnan(minutes.volumes[i])) {
+                volume += minutes.volumes[i];
+                turnover += minutes.volumes[i] * minutes.vwaps[i];
+            }
+        }
+
+        REQUIRE(hours.times[b] == START_TIME + static_cast<std::int64_t>(b) * 60 * MINUTE);
+        REQUIRE(hours.counts[b] == 120);
+        REQUIRE(hours.opens[b] == minutes.opens[b * 60]);
+        REQUIRE(hours.closes[b] == minutes.closes[b * 60 + 59]);
+        REQUIRE(hours.highs[b] == high);
+        REQUIRE(hours.lows[b] == low);
+        REQUIRE(hours.volumes[b] == volume);
+        REQUIRE(hours.vwaps[b] == doctest::Approx(turnover / volume));
+        REQUIRE(hours.bidVolumes[b] == 240);
+        REQUIRE(hours.impVolatilities[b] == static_cast<double>(b * 60 + 59));
+        REQUIRE(std::isnan(hours.openInterests[b]));
+    }
+}
+
+TEST_CASE("CandleResampler aligns the calendar periods") {
+    const auto minutes = createMinutes(180);
+
+    // 2024-01-29 is Monday.
+    REQUIRE(CandleResampler::resample(minutes.view(), CandlePeriod::valueOf(1, CandleType::WEEK)).times ==
+            std::vector<std::int64_t>{1706486400000LL});
+    REQUIRE(CandleResampler::resample(minutes.view(), CandlePeriod::valueOf(1, CandleType::MONTH)).times ==
+            std::vector<std::int64_t>{1704067200000LL});
+
+    CandlePeriodAligner years(CandlePeriod::valueOf(2, CandleType::YEAR));
+
+    REQUIRE(years.getBounds(START_TIME) == CandlePeriodAligner::Bounds{1704067200000LL, 1767225600000LL});
+    REQUIRE(CandlePeriodAligner(CandlePeriod::valueOf(1, CandleType::HOUR)).getStart(-1) == -60 * MINUTE);
+}
+
+TEST_CASE("CandleResampler rejects the invalid input") {
+    auto minutes = createMinutes(10);
+
+    std::swap(minutes.times[3], minutes.times[4]);
+
+    REQUIRE_THROWS_AS(CandleResampler::resample(minutes.view(), CandlePeriod::valueOf(5, CandleType::MINUTE)),
+                      InvalidArgumentException);
+    REQUIRE_THROWS_AS(CandleResampler::resample(createMinutes(10).view(), CandlePeriod::valueOf(5, CandleType::TICK)),
+                      InvalidArgumentException);
+    REQUIRE_THROWS_AS(CandleResampler::resample(createMinutes(10).view(), CandlePeriod::valueOf(1, CandleType::HOUR),
+                                                CandleAlignment::SESSION),
+                      InvalidArgumentException);
+}
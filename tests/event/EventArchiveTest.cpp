@@ -0,0 +1,309 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+// 2024-01-31 00:00:00 UTC
+constexpr std::int64_t START_TIME = 1706659200000LL;
+
+std::shared_ptr<Trade> createTrade(const std::string &symbol, std::int64_t time, double price) {
+    auto trade = std::make_shared<Trade>(symbol);
+
+    trade->setTime(time);
+    trade->setSequence(static_cast<std::int32_t>(time % 1000));
+    trade->setExchangeCode('Q');
+    trade->setPrice(price);
+    trade->setSize(100);
+    trade->setTickDirection(Direction::UP);
+
+    return trade;
+}
+
+std::string getPath(const std::string &name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// Leaves the archive as it was before the writer is closed (the destructor of the writer closes the archive).
+void crash(EventArchiveWriter::Ptr &writer, const std::string &path) {
+    const auto copy = path + ".crash";
+
+    std::filesystem::copy_file(path, copy, std::filesystem::copy_options::overwrite_existing);
+    writer.reset();
+    std::filesystem::rename(copy, path);
+}
+
+} // namespace
+
+TEST_CASE("EventArchive keeps the events") {
+    const auto path = getPath("EventArchiveTest.dxea");
+    std::vector<std::shared_ptr<EventType>> events{};
+
+    for (std::int64_t i = 0; i < 10000; i++) {
+        events.push_back(createTrade(i % 2 == 0 ? "AAPL" : "IBM", START_TIME + i * 1000, 100.25 + i % 17 * 0.01));
+    }
+
+    auto quote = std::make_shared<Quote>("AAPL");
+
+    quote->setBidTime(START_TIME);
+    quote->setBidPrice(99.5);
+    quote->setAskTime(START_TIME + 5);
+    quote->setAskPrice(math::NaN);
+    events.push_back(quote);
+
+    auto writer = EventArchiveWriter::create(path);
+
+    writer->write(events);
+    writer->close();
+
+    REQUIRE(writer->getEventCount() == events.size());
+    REQUIRE_THROWS_AS(writer->write(quote), RuntimeException);
+
+    auto reader = EventArchiveReader::open(path);
+
+    REQUIRE(reader->getEventCount() == events.size());
+    REQUIRE(reader->getSymbols().size() == 2);
+
+    const auto trades = reader->read(Trade::TYPE, "IBM");
+
+    REQUIRE(trades.size() == 5000);
+
+    for (std::size_t i = 0; i < trades.size(); i++) {
+        const auto expected = std::static_pointer_cast<Trade>(events[i * 2 + 1]);
+        const auto actual = std::static_pointer_cast<Trade>(trades[i]);
+
+        REQUIRE(actual->getEventSymbol() == "IBM");
+        REQUIRE(actual->getTime() == expected->getTime());
+        REQUIRE(actual->getSequence() == expected->getSequence());
+        REQUIRE(actual->getExchangeCode() == expected->getExchangeCode());
+        REQUIRE(actual->getPrice() == expected->getPrice());
+        REQUIRE(actual->getSize() == expected->getSize());
+        REQUIRE(actual->getTickDirection() == Direction::UP);
+    }
+
+    const auto quotes = reader->read(Quote::TYPE);
+
+    REQUIRE(quotes.size() == 1);
+
+    const auto actualQuote = std::static_pointer_cast<Quote>(quotes[0]);
+
+    REQUIRE(actualQuote->getTime() == START_TIME + 5);
+    REQUIRE(actualQuote->getBidPrice() == 99.5);
+    REQUIRE(std::isnan(actualQuote->getAskPrice()));
+
+    reader.reset();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("EventArchive scans only the blocks of the symbol and the time range") {
+    const auto path = getPath("EventArchiveScanTest.dxea");
+    auto writer = EventArchiveWriter::create(path);
+    const auto count = static_cast<std::int64_t>(EventArchiveWriter::BLOCK_SIZE) * 4;
+
+    for (std::int64_t i = 0; i < count; i++) {
+        writer->write(createTrade("AAPL", START_TIME + i, 100 + static_cast<double>(i % 100)));
+        writer->write(createTrade("MSFT", START_TIME + i, 200));
+    }
+
+    writer->close();
+
+    auto reader = EventArchiveReader::open(path);
+    const auto from = START_TIME + count / 2;
+    const auto to = from + 10;
+
+    REQUIRE(reader->getBlocks(Trade::TYPE, "AAPL").size() == 4);
+    REQUIRE(reader->getBlocks(Trade::TYPE, "AAPL", from, to).size() == 1);
+    REQUIRE(reader->getBlocks(Trade::TYPE, std::nullopt, from, to).size() == 2);
+    REQUIRE(reader->getBlocks(Trade::TYPE, std::nullopt, START_TIME + count, START_TIME + count + 10).empty());
+    REQUIRE(reader->getBlocks(Trade::TYPE, "GOOG").empty());
+    REQUIRE(reader->getBlocks(Quote::TYPE).empty());
+
+    std::size_t blocks = 0;
+    std::vector<double> prices{};
+
+    reader->scan(Trade::TYPE, "AAPL", from, to, {"price"}, [&](const EventArchiveBlock &block) {
+        blocks++;
+
+        REQUIRE(block.symbol == "AAPL");
+        REQUIRE(block.getInts("sequence").empty());
+
+        const auto blockPrices = block.getDoubles("price");
+
+        for (std::size_t i = 0; i < block.size(); i++) {
+            if (block.times[i] >= from && block.times[i] < to) {
+                prices.push_back(blockPrices[i]);
+            }
+        }
+    });
+
+    REQUIRE(blocks == 1);
+    REQUIRE(prices.size() == 10);
+    REQUIRE(prices.front() == 100 + static_cast<double>(count / 2 % 100));
+    REQUIRE(reader->read(Trade::TYPE, "AAPL", from, to).size() == 10);
+
+    reader.reset();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("EventArchive finds the blocks whose times overlap the later blocks") {
+    const auto path = getPath("EventArchiveOverlapTest.dxea");
+    auto writer = EventArchiveWriter::create(path);
+    const auto size = static_cast<std::int64_t>(EventArchiveWriter::BLOCK_SIZE);
+    const auto late = START_TIME + size * 10;
+
+    // The last event of the first block is later than all the events of the next blocks.
+    for (std::int64_t i = 0; i < size * 3; i++) {
+        writer->write(createTrade("AAPL", i == size - 1 ? late : START_TIME + i, 100));
+    }
+
+    writer->close();
+
+    auto reader = EventArchiveReader::open(path);
+    const auto blocks = reader->getBlocks(Trade::TYPE, "AAPL", late, late + 1);
+
+    REQUIRE(blocks.size() == 1);
+    REQUIRE(blocks[0].minTime == START_TIME);
+    REQUIRE(blocks[0].maxTime == late);
+    REQUIRE(reader->getBlocks(Trade::TYPE, "AAPL", START_TIME + size * 2, START_TIME + size * 2 + 1).size() == 2);
+    REQUIRE(reader->read(Trade::TYPE, std::nullopt, late, late + 1).size() == 1);
+
+    reader.reset();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("EventArchive keeps the sign of the zero") {
+    const auto path = getPath("EventArchiveZeroTest.dxea");
+    auto writer = EventArchiveWriter::create(path);
+
+    writer->write(createTrade("AAPL", START_TIME, 1.5));
+    writer->write(createTrade("AAPL", START_TIME + 1, -0.0));
+    writer->write(createTrade("AAPL", START_TIME + 2, 0.0));
+    writer->close();
+
+    const auto trades = EventArchiveReader::open(path)->read(Trade::TYPE, "AAPL");
+
+    REQUIRE(trades.size() == 3);
+    REQUIRE(std::static_pointer_cast<Trade>(trades[0])->getPrice() == 1.5);
+    REQUIRE(std::static_pointer_cast<Trade>(trades[1])->getPrice() == 0.0);
+    REQUIRE(std::signbit(std::static_pointer_cast<Trade>(trades[1])->getPrice()));
+    REQUIRE(!std::signbit(std::static_pointer_cast<Trade>(trades[2])->getPrice()));
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("EventArchive rejects the unsupported events") {
+    const auto path = getPath("EventArchiveInvalidTest.dxea");
+    auto writer = EventArchiveWriter::create(path);
+
+    REQUIRE(EventArchiveWriter::isSupported(Quote::TYPE));
+    REQUIRE(!EventArchiveWriter::isSupported(Profile::TYPE));
+    REQUIRE_THROWS_AS(writer->write(std::make_shared<Profile>("AAPL")), InvalidArgumentException);
+
+    writer->write(createTrade("AAPL", START_TIME, 100));
+    writer->close();
+
+    REQUIRE(EventArchiveReader::open(path)->getEventCount() == 1);
+
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+
+        out << "Not an event archive";
+    }
+
+    REQUIRE_THROWS_AS(EventArchiveReader::open(path), RuntimeException);
+    REQUIRE_THROWS_AS(EventArchiveWriter::create(path, true), RuntimeException);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("EventArchive recovers the flushed blocks of the unclosed archive") {
+    const auto path = getPath("EventArchiveRecoveryTest.dxea");
+    auto writer = EventArchiveWriter::create(path);
+
+    for (std::int64_t i = 0; i < 100; i++) {
+        writer->write(createTrade(i % 2 == 0 ? "AAPL" : "IBM", START_TIME + i, 100 + static_cast<double>(i)));
+    }
+
+    writer->flush();
+
+    auto reader = EventArchiveReader::open(path);
+
+    REQUIRE(reader->getEventCount() == 100);
+    REQUIRE(reader->read(Trade::TYPE, "IBM").size() == 50);
+
+    reader.reset();
+    writer->write(createTrade("MSFT", START_TIME, 300));
+    writer->flush();
+    crash(writer, path);
+
+    // The incomplete last block (the crash in the middle of the write) is dropped.
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+    reader = EventArchiveReader::open(path);
+
+    REQUIRE(reader->getEventCount() == 100);
+    REQUIRE(reader->read(Trade::TYPE, "AAPL").size() == 50);
+    REQUIRE(reader->read(Trade::TYPE, "MSFT").empty());
+
+    reader.reset();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("EventArchive appends to the existing archive") {
+    const auto path = getPath("EventArchiveAppendTest.dxea");
+
+    std::filesystem::remove(path);
+
+    auto writer = EventArchiveWriter::create(path, true);
+
+    writer->write(createTrade("AAPL", START_TIME, 100));
+    writer->close();
+
+    // The closed archive.
+    writer = EventArchiveWriter::create(path, true);
+    writer->write(createTrade("AAPL", START_TIME + 1, 101));
+    writer->write(createTrade("IBM", START_TIME + 1, 200));
+    writer->flush();
+    crash(writer, path);
+
+    // The unclosed archive.
+    writer = EventArchiveWriter::create(path, true);
+
+    auto quote = std::make_shared<Quote>("AAPL");
+
+    quote->setBidTime(START_TIME + 2);
+    quote->setBidPrice(99.5);
+    writer->write(quote);
+    writer->close();
+
+    REQUIRE(writer->getEventCount() == 4);
+
+    auto reader = EventArchiveReader::open(path);
+
+    REQUIRE(reader->getEventCount() == 4);
+    REQUIRE(reader->getSymbols().size() == 2);
+
+    const auto trades = reader->read(Trade::TYPE, "AAPL");
+
+    REQUIRE(trades.size() == 2);
+    REQUIRE(std::static_pointer_cast<Trade>(trades[0])->getPrice() == 100);
+    REQUIRE(std::static_pointer_cast<Trade>(trades[1])->getPrice() == 101);
+    REQUIRE(reader->read(Trade::TYPE, "IBM").size() == 1);
+    REQUIRE(reader->read(Quote::TYPE, "AAPL").size() == 1);
+
+    reader.reset();
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+std::shared_ptr<EventType> createQuote(const std::string &symbol) {
+    auto quote = std::make_shared<Quote>(symbol);
+
+    quote->setBidPrice(1.5);
+    quote->setBidSize(100);
+    quote->setAskPrice(2.5);
+    quote->setAskSize(200);
+
+    return quote;
+}
+
+std::string writeAll(EventWriter::Format format, const std::vector<std::shared_ptr<EventType>> &events) {
+    std::string output{};
+    auto writer = EventWriter::create(format, [&output](const char *data, std::size_t size) {
+        output.append(data, size);
+    });
+
+    writer->write(events);
+    writer->close();
+
+    return output;
+}
+
+} // namespace
+
+TEST_CASE("EventWriter writes the CSV header once per event type") {
+    const auto output = writeAll(EventWriter::Format::CSV, {createQuote("AAPL"), createQuote("IBM")});
+
+    REQUIRE(output == "#Quote,eventSymbol,eventTime,time,timeNanoPart,sequence,bidTime,bidExchange,bidPrice,bidSize,"
+                      "askTime,askExchange,askPrice,askSize\n"
+                      "Quote,AAPL,0,0,0,0,0,,1.5,100,0,,2.5,200\n"
+                      "Quote,IBM,0,0,0,0,0,,1.5,100,0,,2.5,200\n");
+}
+
+TEST_CASE("EventWriter writes the JSON lines") {
+    const auto output = writeAll(EventWriter::Format::JSON_LINES, {createQuote("A\"B")});
+
+    REQUIRE(output == R"({"type":"Quote","eventSymbol":"A\"B","eventTime":"0","time":"0","timeNanoPart":0,)"
+                      R"("sequence":0,"bidTime":"0","bidExchange":"","bidPrice":1.5,"bidSize":100,"askTime":"0",)"
+                      R"("askExchange":"","askPrice":2.5,"askSize":200})"
+                      "\n");
+}
+
+TEST_CASE("EventWriter writes the binary records with the symbol references") {
+    const auto one = writeAll(EventWriter::Format::BINARY, {createQuote("AAPL")});
+    const auto two = writeAll(EventWriter::Format::BINARY, {createQuote("AAPL"), createQuote("AAPL")});
+
+    REQUIRE(one.substr(0, 5) == std::string("DXEW\x01", 5));
+    REQUIRE(static_cast<std::uint8_t>(one[5]) == Quote::TYPE.getId());
+
+    // The second record refers to the symbol of the first one instead of repeating it.
+    const auto recordSize = one.size() - 5;
+
+    REQUIRE(two.size() == 5 + recordSize + recordSize - 5);
+}
+
+TEST_CASE("EventWriter flushes the buffered events and counts them") {
+    std::string output{};
+    auto writer = EventWriter::create(
+        EventWriter::Format::TEXT,
+        [&output](const char *data, std::size_t size) {
+            output.append(data, size);
+        },
+        64);
+
+    for (int i = 0; i < 100; i++) {
+        writer->write(createQuote("AAPL"));
+    }
+
+    writer->flush();
+
+    REQUIRE(writer->getEventCount() == 100);
+    REQUIRE(writer->getByteCount() == output.size());
+    REQUIRE(std::count(output.begin(), output.end(), '\n') == 100);
+
+    writer->close();
+
+    REQUIRE_THROWS_AS(writer->write(createQuote("AAPL")), RuntimeException);
+}
+
+TEST_CASE("EventWriter finishes writing after it is released by the sink") {
+    struct Context {
+        std::shared_ptr<EventWriter> writer{};
+        std::promise<void> released{};
+        std::promise<std::size_t> written{};
+        std::size_t calls{};
+        std::size_t lines{};
+    };
+
+    auto context = std::make_shared<Context>();
+    auto writer = EventWriter::create(
+        EventWriter::Format::TEXT,
+        [context, released = context->released.get_future().share()](const char *data, std::size_t size) {
+            if (context->calls++ == 0) {
+                // The last reference to the writer is released by the I/O thread.
+                released.wait();
+                context->writer.reset();
+            }
+
+            context->lines += static_cast<std::size_t>(std::count(data, data + size, '\n'));
+
+            if (context->lines == 3) {
+                context->written.set_value(context->calls);
+            }
+        },
+        1);
+    auto written = context->written.get_future();
+
+    context->writer = writer;
+    writer->write({createQuote("AAPL"), createQuote("IBM"), createQuote("MSFT")});
+    writer.reset();
+    context->released.set_value();
+
+    REQUIRE(written.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    REQUIRE(written.get() == 3);
+}
+
+TEST_CASE("EventWriter parses the format names") {
+    REQUIRE(EventWriter::parseFormat("CSV") == EventWriter::Format::CSV);
+    REQUIRE(EventWriter::parseFormat("jsonl") == EventWriter::Format::JSON_LINES);
+    REQUIRE(EventWriter::parseFormat("bin") == EventWriter::Format::BINARY);
+    REQUIRE_THROWS_AS(EventWriter::parseFormat("xml"), InvalidArgumentException);
+}
@@ -0,0 +1,271 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+// The outputs of the reference tools for the data below.
+
+// `gzip -9 -n` of createText(): a block with the dynamic Huffman codes.
+const std::vector<std::uint8_t> TEXT_GZIP{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7D, 0x95, 0xB1, 0x6E, 0xDB, 0x40,
+    0x0C, 0x86, 0xF7, 0x3C, 0x45, 0x80, 0xAE, 0x1C, 0xEE, 0x48, 0xDE, 0x91, 0x0C, 0xD0, 0x25, 0x8A,
+    0x07, 0xA1, 0x8E, 0x6D, 0x58, 0xF2, 0xE0, 0xB1, 0x05, 0x3A, 0x26, 0x2D, 0x0A, 0x74, 0xE8, 0xDB,
+    0x97, 0x29, 0x60, 0xE9, 0x4E, 0x06, 0x0B, 0x6B, 0xF3, 0xAF, 0x83, 0x3F, 0xFE, 0xDF, 0xD1, 0x9F,
+    0xA6, 0xF9, 0x38, 0x7C, 0x79, 0x7A, 0xFA, 0x3C, 0x5F, 0x4F, 0x3B, 0x98, 0xAE, 0xAF, 0xCF, 0xC7,
+    0x3D, 0xBC, 0xEC, 0xA6, 0xE1, 0x3C, 0x9E, 0xE6, 0xF1, 0x78, 0x80, 0xE1, 0x78, 0x39, 0xCC, 0xE7,
+    0x2B, 0x0C, 0x97, 0xF3, 0x79, 0x77, 0x18, 0xAE, 0x30, 0x0E, 0xCF, 0x30, 0x8D, 0x03, 0xBC, 0x5E,
+    0xF6, 0xF3, 0x78, 0xDA, 0x8F, 0xBB, 0xF3, 0xC3, 0xBF, 0x33, 0x3E, 0x5E, 0x4E, 0x30, 0xFC, 0x78,
+    0xFB, 0xF9, 0xF5, 0xFD, 0xCF, 0xE3, 0xFB, 0xEF, 0xB7, 0x6F, 0xDF, 0x7F, 0x3D, 0x26, 0xB8, 0x4C,
+    0xFE, 0xBC, 0x40, 0xF2, 0x4F, 0x5E, 0x83, 0x79, 0x1B, 0x94, 0x5B, 0x90, 0x04, 0x72, 0x06, 0x5C,
+    0xA3, 0xB8, 0x8D, 0xE6, 0x5B, 0x54, 0x18, 0x10, 0x81, 0xD6, 0x28, 0x6D, 0xA3, 0x7A, 0x8B, 0x66,
+    0x3F, 0x93, 0x08, 0x78, 0xCD, 0xF2, 0x36, 0x8B, 0x4B, 0x96, 0x15, 0x98, 0xA1, 0xAC, 0xD9, 0xB2,
+    0xCD, 0xDA, 0x92, 0xD5, 0x02, 0xA5, 0xB4, 0x64, 0x75, 0x9B, 0xA5, 0x5B, 0x16, 0xFD, 0xC7, 0xD6,
+    0xDA, 0xA2, 0xC9, 0x1D, 0xDA, 0x32, 0x2F, 0x2C, 0x06, 0x22, 0x2D, 0x9C, 0x6E, 0xC3, 0xBC, 0x64,
+    0xAD, 0x82, 0x6A, 0x0B, 0x67, 0x77, 0x07, 0x2F, 0x43, 0x23, 0x1F, 0x03, 0xB6, 0x70, 0xF9, 0xAE,
+    0xB4, 0xB2, 0x76, 0xE1, 0xA5, 0x51, 0xD7, 0xDB, 0x5D, 0x71, 0x79, 0x99, 0x1B, 0x27, 0x01, 0xE4,
+    0x96, 0x2F, 0xDF, 0x75, 0x57, 0x97, 0xB0, 0x4F, 0x98, 0x4A, 0xCB, 0x97, 0x29, 0x94, 0x87, 0x35,
+    0x03, 0xD7, 0x16, 0x30, 0x73, 0x28, 0x50, 0xC9, 0x0A, 0x45, 0x3A, 0xC2, 0x12, 0x2A, 0x54, 0xBC,
+    0xBC, 0xAA, 0x1D, 0x61, 0x0D, 0x25, 0x2A, 0x86, 0x20, 0xD6, 0x01, 0x4A, 0x68, 0x51, 0x45, 0x03,
+    0x4B, 0x1D, 0xA0, 0x86, 0x1A, 0x55, 0xF7, 0x82, 0x3B, 0x3E, 0x0B, 0x35, 0x92, 0xE4, 0x8D, 0x94,
+    0x96, 0x0F, 0x53, 0xEC, 0x91, 0x70, 0x02, 0xAC, 0x2D, 0x20, 0xE6, 0x50, 0x24, 0xF9, 0x30, 0x4E,
+    0xBA, 0xCB, 0x87, 0xB1, 0x49, 0xEA, 0x25, 0xF8, 0x55, 0x69, 0x08, 0x91, 0x42, 0x95, 0xB4, 0x64,
+    0x9F, 0x5F, 0x8B, 0x88, 0x1C, 0xAB, 0xA4, 0xAE, 0xB3, 0xBB, 0xD7, 0x32, 0x96, 0x50, 0x25, 0xF3,
+    0xEF, 0x5C, 0x90, 0x16, 0xB1, 0x86, 0x2A, 0x59, 0x45, 0x7F, 0xA1, 0x43, 0x94, 0x50, 0x25, 0x33,
+    0x83, 0xDA, 0x01, 0x6A, 0x68, 0x12, 0xF9, 0x90, 0xA5, 0xE3, 0xB3, 0x50, 0x24, 0xF1, 0x2B, 0xA8,
+    0x2D, 0x1D, 0xA5, 0x78, 0x1B, 0x79, 0x97, 0x64, 0x2D, 0x1D, 0xE5, 0x78, 0x1D, 0xB1, 0x8B, 0x9F,
+    0x5A, 0x3A, 0xC2, 0x50, 0xA4, 0xAC, 0x0C, 0x35, 0x77, 0xFB, 0x93, 0xFE, 0xB3, 0x90, 0xDC, 0x1B,
+    0xC1, 0x16, 0x90, 0x38, 0xDE, 0x48, 0x45, 0x41, 0xA9, 0x23, 0x2C, 0xB1, 0x48, 0x68, 0x05, 0x8C,
+    0x3B, 0xC4, 0x1A, 0xEF, 0x24, 0x27, 0xD2, 0x8E, 0x50, 0x62, 0x8F, 0xA8, 0xFA, 0xE4, 0xAC, 0x43,
+    0xD4, 0x78, 0x25, 0x25, 0xEF, 0x3A, 0x75, 0x84, 0x16, 0xAF, 0x24, 0xF6, 0x7F, 0x13, 0x57, 0xFA,
+    0xE1, 0x2F, 0x73, 0x5D, 0x4A, 0x1B, 0x41, 0x07, 0x00, 0x00};
+
+// `gzip -9 -n` of createNoise(300): a stored block.
+const std::vector<std::uint8_t> NOISE_GZIP{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x2C, 0x01, 0xD3, 0xFE, 0xDC,
+    0x04, 0x65, 0xAA, 0x1F, 0xAD, 0x1D, 0x5A, 0xDA, 0xE5, 0xAC, 0x1B, 0x1E, 0x5F, 0x13, 0x70, 0x79,
+    0x6C, 0xFD, 0x10, 0xFF, 0x19, 0xAF, 0x60, 0x1D, 0x04, 0xAC, 0xB4, 0x1D, 0x02, 0x2B, 0x46, 0x78,
+    0x73, 0x3A, 0xF2, 0xDF, 0x5F, 0xAE, 0xB7, 0x08, 0x59, 0xD1, 0xEE, 0x39, 0x10, 0xCB, 0x48, 0x95,
+    0xB5, 0xCC, 0x89, 0x29, 0x11, 0xFF, 0x06, 0xB6, 0x62, 0x2E, 0xDF, 0x3C, 0xF9, 0x35, 0xFD, 0x4B,
+    0x94, 0x28, 0xCA, 0x09, 0x7C, 0x44, 0xB3, 0x02, 0x5E, 0x96, 0x5F, 0xB3, 0xEA, 0x6D, 0xAC, 0xD4,
+    0x2D, 0x81, 0x6E, 0x69, 0xAF, 0xE0, 0xE6, 0x87, 0x4C, 0x9C, 0x04, 0xE7, 0xD2, 0x36, 0x5D, 0x2C,
+    0x60, 0xC9, 0xEA, 0xF4, 0x79, 0xF6, 0x86, 0xA0, 0xEB, 0x93, 0x26, 0xE4, 0x62, 0x12, 0xD5, 0x0D,
+    0xCB, 0xB3, 0x77, 0x15, 0x6A, 0x6A, 0x3A, 0x68, 0xBA, 0x8E, 0xDB, 0x74, 0x08, 0x46, 0x9E, 0xF3,
+    0xCE, 0xB3, 0x0A, 0xF8, 0xD0, 0xDD, 0x68, 0xBB, 0xF8, 0x5F, 0xFA, 0x24, 0xF2, 0xD2, 0xFC, 0x18,
+    0x87, 0xFB, 0x5C, 0x87, 0xBA, 0xB4, 0x38, 0x32, 0xA5, 0x9B, 0x1B, 0x3D, 0x10, 0x7C, 0xF7, 0x78,
+    0xD6, 0x7F, 0xE2, 0x6D, 0xF8, 0x11, 0x91, 0x29, 0x7E, 0x93, 0x95, 0xCB, 0x12, 0xC5, 0x57, 0xCE,
+    0x5A, 0xF1, 0xD4, 0x16, 0x18, 0xD7, 0x19, 0xBC, 0x04, 0x5B, 0x7E, 0x99, 0x65, 0xF1, 0xA2, 0x94,
+    0x71, 0xC4, 0x2A, 0xAC, 0x6A, 0xA9, 0x38, 0xC4, 0x75, 0xC7, 0xAD, 0x32, 0x38, 0x02, 0x1F, 0x05,
+    0x3B, 0x2C, 0x99, 0x1A, 0xFC, 0xEB, 0x15, 0xDE, 0xCF, 0x68, 0xBA, 0xE0, 0x7C, 0xBC, 0xD6, 0x1E,
+    0x97, 0x1B, 0x9A, 0x0B, 0x9D, 0xBE, 0x97, 0x63, 0xD3, 0x92, 0xFC, 0xAF, 0xDF, 0xA2, 0x8C, 0x97,
+    0x23, 0x45, 0x62, 0xEB, 0xDD, 0x07, 0x65, 0x70, 0xFF, 0x58, 0x89, 0x6A, 0xCF, 0xF7, 0xCA, 0xEE,
+    0x3F, 0x1C, 0xE9, 0xE4, 0x0A, 0x68, 0xE5, 0xDE, 0x93, 0x8D, 0x38, 0x9C, 0x7D, 0xBD, 0xD7, 0x5B,
+    0x09, 0xD4, 0xE7, 0xE2, 0x33, 0x44, 0x3F, 0x4A, 0x8C, 0xC4, 0xA1, 0x90, 0xD6, 0xB8, 0xB8, 0xDC,
+    0x61, 0x5F, 0xD1, 0x8E, 0x28, 0xBE, 0x59, 0x0E, 0xAA, 0x50, 0x1B, 0x5F, 0x0E, 0x2F, 0x63, 0x2C,
+    0x01, 0x00, 0x00};
+
+// `gzip -9 -n` of HELLO: a block with the fixed Huffman codes.
+const std::vector<std::uint8_t> HELLO_GZIP{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xF3, 0x48, 0xCD, 0xC9, 0xC9, 0xD7,
+    0x51, 0xC8, 0x40, 0xA2, 0x14, 0xB9, 0x00, 0xBB, 0xC7, 0x53, 0xED, 0x15, 0x00, 0x00, 0x00};
+
+// `zip -9 -X -r` of the "d/text.ipf" file with createText(): the directory entry comes first.
+const std::vector<std::uint8_t> DIRECTORY_ZIP{
+    0x50, 0x4B, 0x03, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x5A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x64, 0x2F,
+    0x50, 0x4B, 0x03, 0x04, 0x14, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x5A, 0x73, 0x5D,
+    0x4A, 0x1B, 0xD8, 0x01, 0x00, 0x00, 0x41, 0x07, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x64, 0x2F,
+    0x74, 0x65, 0x78, 0x74, 0x2E, 0x69, 0x70, 0x66, 0x7D, 0x95, 0xB1, 0x6E, 0xDB, 0x40, 0x0C, 0x86,
+    0xF7, 0x3C, 0x45, 0x80, 0xAE, 0x1C, 0xEE, 0x48, 0xDE, 0x91, 0x0C, 0xD0, 0x25, 0x8A, 0x07, 0xA1,
+    0x8E, 0x6D, 0x58, 0xF2, 0xE0, 0xB1, 0x05, 0x3A, 0x26, 0x2D, 0x0A, 0x74, 0xE8, 0xDB, 0x97, 0x29,
+    0x60, 0xE9, 0x4E, 0x06, 0x0B, 0x6B, 0xF3, 0xAF, 0x83, 0x3F, 0xFE, 0xDF, 0xD1, 0x9F, 0xA6, 0xF9,
+    0x38, 0x7C, 0x79, 0x7A, 0xFA, 0x3C, 0x5F, 0x4F, 0x3B, 0x98, 0xAE, 0xAF, 0xCF, 0xC7, 0x3D, 0xBC,
+    0xEC, 0xA6, 0xE1, 0x3C, 0x9E, 0xE6, 0xF1, 0x78, 0x80, 0xE1, 0x78, 0x39, 0xCC, 0xE7, 0x2B, 0x0C,
+    0x97, 0xF3, 0x79, 0x77, 0x18, 0xAE, 0x30, 0x0E, 0xCF, 0x30, 0x8D, 0x03, 0xBC, 0x5E, 0xF6, 0xF3,
+    0x78, 0xDA, 0x8F, 0xBB, 0xF3, 0xC3, 0xBF, 0x33, 0x3E, 0x5E, 0x4E, 0x30, 0xFC, 0x78, 0xFB, 0xF9,
+    0xF5, 0xFD, 0xCF, 0xE3, 0xFB, 0xEF, 0xB7, 0x6F, 0xDF, 0x7F, 0x3D, 0x26, 0xB8, 0x4C, 0xFE, 0xBC,
+    0x40, 0xF2, 0x4F, 0x5E, 0x83, 0x79, 0x1B, 0x94, 0x5B, 0x90, 0x04, 0x72, 0x06, 0x5C, 0xA3, 0xB8,
+    0x8D, 0xE6, 0x5B, 0x54, 0x18, 0x10, 0x81, 0xD6, 0x28, 0x6D, 0xA3, 0x7A, 0x8B, 0x66, 0x3F, 0x93,
+    0x08, 0x78, 0xCD, 0xF2, 0x36, 0x8B, 0x4B, 0x96, 0x15, 0x98, 0xA1, 0xAC, 0xD9, 0xB2, 0xCD, 0xDA,
+    0x92, 0xD5, 0x02, 0xA5, 0xB4, 0x64, 0x75, 0x9B, 0xA5, 0x5B, 0x16, 0xFD, 0xC7, 0xD6, 0xDA, 0xA2,
+    0xC9, 0x1D, 0xDA, 0x32, 0x2F, 0x2C, 0x06, 0x22, 0x2D, 0x9C, 0x6E, 0xC3, 0xBC, 0x64, 0xAD, 0x82,
+    0x6A, 0x0B, 0x67, 0x77, 0x07, 0x2F, 0x43, 0x23, 0x1F, 0x03, 0xB6, 0x70, 0xF9, 0xAE, 0xB4, 0xB2,
+    0x76, 0xE1, 0xA5, 0x51, 0xD7, 0xDB, 0x5D, 0x71, 0x79, 0x99, 0x1B, 0x27, 0x01, 0xE4, 0x96, 0x2F,
+    0xDF, 0x75, 0x57, 0x97, 0xB0, 0x4F, 0x98, 0x4A, 0xCB, 0x97, 0x29, 0x94, 0x87, 0x35, 0x03, 0xD7,
+    0x16, 0x30, 0x73, 0x28, 0x50, 0xC9, 0x0A, 0x45, 0x3A, 0xC2, 0x12, 0x2A, 0x54, 0xBC, 0xBC, 0xAA,
+    0x1D, 0x61, 0x0D, 0x25, 0x2A, 0x86, 0x20, 0xD6, 0x01, 0x4A, 0x68, 0x51, 0x45, 0x03, 0x4B, 0x1D,
+    0xA0, 0x86, 0x1A, 0x55, 0xF7, 0x82, 0x3B, 0x3E, 0x0B, 0x35, 0x92, 0xE4, 0x8D, 0x94, 0x96, 0x0F,
+    0x53, 0xEC, 0x91, 0x70, 0x02, 0xAC, 0x2D, 0x20, 0xE6, 0x50, 0x24, 0xF9, 0x30, 0x4E, 0xBA, 0xCB,
+    0x87, 0xB1, 0x49, 0xEA, 0x25, 0xF8, 0x55, 0x69, 0x08, 0x91, 0x42, 0x95, 0xB4, 0x64, 0x9F, 0x5F,
+    0x8B, 0x88, 0x1C, 0xAB, 0xA4, 0xAE, 0xB3, 0xBB, 0xD7, 0x32, 0x96, 0x50, 0x25, 0xF3, 0xEF, 0x5C,
+    0x90, 0x16, 0xB1, 0x86, 0x2A, 0x59, 0x45, 0x7F, 0xA1, 0x43, 0x94, 0x50, 0x25, 0x33, 0x83, 0xDA,
+    0x01, 0x6A, 0x68, 0x12, 0xF9, 0x90, 0xA5, 0xE3, 0xB3, 0x50, 0x24, 0xF1, 0x2B, 0xA8, 0x2D, 0x1D,
+    0xA5, 0x78, 0x1B, 0x79, 0x97, 0x64, 0x2D, 0x1D, 0xE5, 0x78, 0x1D, 0xB1, 0x8B, 0x9F, 0x5A, 0x3A,
+    0xC2, 0x50, 0xA4, 0xAC, 0x0C, 0x35, 0x77, 0xFB, 0x93, 0xFE, 0xB3, 0x90, 0xDC, 0x1B, 0xC1, 0x16,
+    0x90, 0x38, 0xDE, 0x48, 0x45, 0x41, 0xA9, 0x23, 0x2C, 0xB1, 0x48, 0x68, 0x05, 0x8C, 0x3B, 0xC4,
+    0x1A, 0xEF, 0x24, 0x27, 0xD2, 0x8E, 0x50, 0x62, 0x8F, 0xA8, 0xFA, 0xE4, 0xAC, 0x43, 0xD4, 0x78,
+    0x25, 0x25, 0xEF, 0x3A, 0x75, 0x84, 0x16, 0xAF, 0x24, 0xF6, 0x7F, 0x13, 0x57, 0xFA, 0xE1, 0x2F,
+    0x50, 0x4B, 0x01, 0x02, 0x1E, 0x03, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x5A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xED, 0x41, 0x00, 0x00, 0x00, 0x00, 0x64, 0x2F,
+    0x50, 0x4B, 0x01, 0x02, 0x1E, 0x03, 0x14, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x5A,
+    0x73, 0x5D, 0x4A, 0x1B, 0xD8, 0x01, 0x00, 0x00, 0x41, 0x07, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xA4, 0x81, 0x20, 0x00, 0x00, 0x00, 0x64, 0x2F,
+    0x74, 0x65, 0x78, 0x74, 0x2E, 0x69, 0x70, 0x66, 0x50, 0x4B, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x68, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00};
+
+// `zip -9 -X - -` of createText() written to a pipe: the entry with a data descriptor.
+const std::vector<std::uint8_t> STREAMED_ZIP{
+    0x50, 0x4B, 0x03, 0x04, 0x2D, 0x00, 0x08, 0x00, 0x08, 0x00, 0xF4, 0x9E, 0x52, 0x5D, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x14, 0x00, 0x2D, 0x01,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7D, 0x95, 0xB1, 0x6E, 0xDB, 0x40, 0x0C, 0x86, 0xF7, 0x3C, 0x45, 0x80, 0xAE,
+    0x1C, 0xEE, 0x48, 0xDE, 0x91, 0x0C, 0xD0, 0x25, 0x8A, 0x07, 0xA1, 0x8E, 0x6D, 0x58, 0xF2, 0xE0,
+    0xB1, 0x05, 0x3A, 0x26, 0x2D, 0x0A, 0x74, 0xE8, 0xDB, 0x97, 0x29, 0x60, 0xE9, 0x4E, 0x06, 0x0B,
+    0x6B, 0xF3, 0xAF, 0x83, 0x3F, 0xFE, 0xDF, 0xD1, 0x9F, 0xA6, 0xF9, 0x38, 0x7C, 0x79, 0x7A, 0xFA,
+    0x3C, 0x5F, 0x4F, 0x3B, 0x98, 0xAE, 0xAF, 0xCF, 0xC7, 0x3D, 0xBC, 0xEC, 0xA6, 0xE1, 0x3C, 0x9E,
+    0xE6, 0xF1, 0x78, 0x80, 0xE1, 0x78, 0x39, 0xCC, 0xE7, 0x2B, 0x0C, 0x97, 0xF3, 0x79, 0x77, 0x18,
+    0xAE, 0x30, 0x0E, 0xCF, 0x30, 0x8D, 0x03, 0xBC, 0x5E, 0xF6, 0xF3, 0x78, 0xDA, 0x8F, 0xBB, 0xF3,
+    0xC3, 0xBF, 0x33, 0x3E, 0x5E, 0x4E, 0x30, 0xFC, 0x78, 0xFB, 0xF9, 0xF5, 0xFD, 0xCF, 0xE3, 0xFB,
+    0xEF, 0xB7, 0x6F, 0xDF, 0x7F, 0x3D, 0x26, 0xB8, 0x4C, 0xFE, 0xBC, 0x40, 0xF2, 0x4F, 0x5E, 0x83,
+    0x79, 0x1B, 0x94, 0x5B, 0x90, 0x04, 0x72, 0x06, 0x5C, 0xA3, 0xB8, 0x8D, 0xE6, 0x5B, 0x54, 0x18,
+    0x10, 0x81, 0xD6, 0x28, 0x6D, 0xA3, 0x7A, 0x8B, 0x66, 0x3F, 0x93, 0x08, 0x78, 0xCD, 0xF2, 0x36,
+    0x8B, 0x4B, 0x96, 0x15, 0x98, 0xA1, 0xAC, 0xD9, 0xB2, 0xCD, 0xDA, 0x92, 0xD5, 0x02, 0xA5, 0xB4,
+    0x64, 0x75, 0x9B, 0xA5, 0x5B, 0x16, 0xFD, 0xC7, 0xD6, 0xDA, 0xA2, 0xC9, 0x1D, 0xDA, 0x32, 0x2F,
+    0x2C, 0x06, 0x22, 0x2D, 0x9C, 0x6E, 0xC3, 0xBC, 0x64, 0xAD, 0x82, 0x6A, 0x0B, 0x67, 0x77, 0x07,
+    0x2F, 0x43, 0x23, 0x1F, 0x03, 0xB6, 0x70, 0xF9, 0xAE, 0xB4, 0xB2, 0x76, 0xE1, 0xA5, 0x51, 0xD7,
+    0xDB, 0x5D, 0x71, 0x79, 0x99, 0x1B, 0x27, 0x01, 0xE4, 0x96, 0x2F, 0xDF, 0x75, 0x57, 0x97, 0xB0,
+    0x4F, 0x98, 0x4A, 0xCB, 0x97, 0x29, 0x94, 0x87, 0x35, 0x03, 0xD7, 0x16, 0x30, 0x73, 0x28, 0x50,
+    0xC9, 0x0A, 0x45, 0x3A, 0xC2, 0x12, 0x2A, 0x54, 0xBC, 0xBC, 0xAA, 0x1D, 0x61, 0x0D, 0x25, 0x2A,
+    0x86, 0x20, 0xD6, 0x01, 0x4A, 0x68, 0x51, 0x45, 0x03, 0x4B, 0x1D, 0xA0, 0x86, 0x1A, 0x55, 0xF7,
+    0x82, 0x3B, 0x3E, 0x0B, 0x35, 0x92, 0xE4, 0x8D, 0x94, 0x96, 0x0F, 0x53, 0xEC, 0x91, 0x70, 0x02,
+    0xAC, 0x2D, 0x20, 0xE6, 0x50, 0x24, 0xF9, 0x30, 0x4E, 0xBA, 0xCB, 0x87, 0xB1, 0x49, 0xEA, 0x25,
+    0xF8, 0x55, 0x69, 0x08, 0x91, 0x42, 0x95, 0xB4, 0x64, 0x9F, 0x5F, 0x8B, 0x88, 0x1C, 0xAB, 0xA4,
+    0xAE, 0xB3, 0xBB, 0xD7, 0x32, 0x96, 0x50, 0x25, 0xF3, 0xEF, 0x5C, 0x90, 0x16, 0xB1, 0x86, 0x2A,
+    0x59, 0x45, 0x7F, 0xA1, 0x43, 0x94, 0x50, 0x25, 0x33, 0x83, 0xDA, 0x01, 0x6A, 0x68, 0x12, 0xF9,
+    0x90, 0xA5, 0xE3, 0xB3, 0x50, 0x24, 0xF1, 0x2B, 0xA8, 0x2D, 0x1D, 0xA5, 0x78, 0x1B, 0x79, 0x97,
+    0x64, 0x2D, 0x1D, 0xE5, 0x78, 0x1D, 0xB1, 0x8B, 0x9F, 0x5A, 0x3A, 0xC2, 0x50, 0xA4, 0xAC, 0x0C,
+    0x35, 0x77, 0xFB, 0x93, 0xFE, 0xB3, 0x90, 0xDC, 0x1B, 0xC1, 0x16, 0x90, 0x38, 0xDE, 0x48, 0x45,
+    0x41, 0xA9, 0x23, 0x2C, 0xB1, 0x48, 0x68, 0x05, 0x8C, 0x3B, 0xC4, 0x1A, 0xEF, 0x24, 0x27, 0xD2,
+    0x8E, 0x50, 0x62, 0x8F, 0xA8, 0xFA, 0xE4, 0xAC, 0x43, 0xD4, 0x78, 0x25, 0x25, 0xEF, 0x3A, 0x75,
+    0x84, 0x16, 0xAF, 0x24, 0xF6, 0x7F, 0x13, 0x57, 0xFA, 0xE1, 0x2F, 0x50, 0x4B, 0x07, 0x08, 0x73,
+    0x5D, 0x4A, 0x1B, 0xD8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x4B, 0x01, 0x02, 0x1E, 0x03, 0x2D, 0x00, 0x08, 0x00, 0x08, 0x00, 0xF4,
+    0x9E, 0x52, 0x5D, 0x73, 0x5D, 0x4A, 0x1B, 0xD8, 0x01, 0x00, 0x00, 0x41, 0x07, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x2D, 0x50, 0x4B, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x2F, 0x00,
+    0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x00, 0x00};
+
+const std::string HELLO = "Hello, hello, hello!\n";
+
+std::string createText() {
+    std::string text = "#STOCK::=TYPE,SYMBOL,DESCRIPTION,COUNTRY,CURRENCY,ICB,SIC,MULTIPLIER\n";
+
+    for (int i = 0; i < 40; i++) {
+        text += "STOCK,SYM" + std::to_string(i) + ",Company number " + std::to_string(i * 7 % 13) + ",US,USD," +
+                std::to_string(i * 37 % 1000) + "," + std::to_string(i * 11 % 97) + "," + std::to_string(i % 5 + 1) +
+                "\n";
+    }
+
+    return text;
+}
+
+// The incompressible bytes of a linear congruential generator.
+std::string createNoise(std::size_t size) {
+    std::string noise{};
+    std::uint32_t x = 12345;
+
+    for (std::size_t i = 0; i < size; i++) {
+        x = (x * 1103515245U + 12345U) & 0x7FFFFFFFU;
+        noise.push_back(static_cast<char>((x >> 16) & 0xFFU));
+    }
+
+    return noise;
+}
+
+std::string toString(const std::vector<std::uint8_t> &data) {
+    return {data.begin(), data.end()};
+}
+
+} // namespace
+
+TEST_CASE("Inflater decompresses the gzip blocks of all the types") {
+    REQUIRE(Inflater::gunzip(toString(TEXT_GZIP)) == createText());
+    REQUIRE(Inflater::gunzip(toString(NOISE_GZIP)) == createNoise(300));
+    REQUIRE(Inflater::gunzip(toString(HELLO_GZIP)) == HELLO);
+}
+
+TEST_CASE("Inflater concatenates the gzip members") {
+    REQUIRE(Inflater::gunzip(toString(TEXT_GZIP) + toString(NOISE_GZIP) + toString(HELLO_GZIP)) ==
+            createText() + createNoise(300) + HELLO);
+}
+
+TEST_CASE("Inflater decompresses the first file entry of zip") {
+    REQUIRE(Inflater::isZip(toString(DIRECTORY_ZIP)));
+    REQUIRE(Inflater::unzip(toString(DIRECTORY_ZIP)) == createText());
+    REQUIRE(Inflater::unzip(toString(STREAMED_ZIP)) == createText());
+
+    // Only the directory entry.
+    REQUIRE_THROWS_AS(Inflater::unzip(toString(DIRECTORY_ZIP).substr(0, 32)), RuntimeException);
+}
+
+TEST_CASE("Inflater rejects the truncated data") {
+    for (const auto &gzip : {TEXT_GZIP, NOISE_GZIP, HELLO_GZIP}) {
+        const auto data = toString(gzip);
+
+        // The empty data is the empty output.
+        for (std::size_t size = 1; size < data.size(); size++) {
+            REQUIRE_THROWS_AS(Inflater::gunzip(data.substr(0, size)), RuntimeException);
+        }
+    }
+
+    // The local entries end before the central directory, so it is not truncated.
+    for (const auto &zip : {DIRECTORY_ZIP, STREAMED_ZIP}) {
+        const auto data = toString(zip);
+
+        for (std::size_t size = 0; size < data.size() / 2; size++) {
+            REQUIRE_THROWS_AS(Inflater::unzip(data.substr(0, size)), RuntimeException);
+        }
+    }
+}
+
+TEST_CASE("Inflater rejects the corrupted data") {
+    for (const auto &gzip : {TEXT_GZIP, NOISE_GZIP, HELLO_GZIP}) {
+        const auto data = toString(gzip);
+
+        // Every byte of the compressed data (except the last one that can have the unused bits) and of the trailer.
+        for (std::size_t i = 10; i < data.size(); i++) {
+            if (i == data.size() - 9) {
+                continue;
+            }
+
+            auto corrupted = data;
+
+            corrupted[i] = static_cast<char>(corrupted[i] ^ 0xFF);
+
+            REQUIRE_THROWS_AS(Inflater::gunzip(corrupted), RuntimeException);
+        }
+    }
+
+    auto corrupted = toString(DIRECTORY_ZIP);
+
+    corrupted[200] = static_cast<char>(corrupted[200] ^ 0xFF);
+
+    REQUIRE_THROWS_AS(Inflater::unzip(corrupted), RuntimeException);
+
+    // The size of the member is only a hint for the output buffer.
+    auto wrongSize = toString(HELLO_GZIP);
+
+    wrongSize.replace(wrongSize.size() - 4, 4, "\xFF\xFF\xFF\xFF");
+
+    REQUIRE_THROWS_AS(Inflater::gunzip(wrongSize), RuntimeException);
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+std::vector<std::int64_t> createTimes() {
+    std::vector<std::int64_t> times{0, 1, -1, 999, 1'000, 86'399'999, 86'400'000, 1'195'055'160'123};
+    std::mt19937_64 random(42);
+    // 1900-01-01 .. 2100-01-01
+    std::uniform_int_distribution<std::int64_t> distribution(-2'208'988'800'000LL, 4'102'444'800'000LL);
+
+    for (int i = 0; i < 10'000; i++) {
+        times.push_back(distribution(random));
+    }
+
+    return times;
+}
+
+} // namespace
+
+TEST_CASE("NativeTimeFormat formats the times as TimeFormat") {
+    for (auto time : createTimes()) {
+        REQUIRE(NativeTimeFormat::DEFAULT.format(time) == TimeFormat::DEFAULT.format(time));
+        REQUIRE(NativeTimeFormat::DEFAULT_WITH_MILLIS.format(time) == TimeFormat::DEFAULT_WITH_MILLIS.format(time));
+        REQUIRE(NativeTimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE.format(time) ==
+                TimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE.format(time));
+        REQUIRE(NativeTimeFormat::GMT.format(time) == TimeFormat::GMT.format(time));
+    }
+
+    REQUIRE(NativeTimeFormat::GMT.format(1'195'055'160'123) == "20071114-154600");
+
+    std::array<char, NativeTimeFormat::MAX_LENGTH> buffer{};
+    const auto length = NativeTimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE.format(1'195'055'160'123, buffer.data());
+
+    REQUIRE(std::string(buffer.data(), length) ==
+            TimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE.format(1'195'055'160'123));
+}
+
+TEST_CASE("NativeTimeFormat parses the times as TimeFormat") {
+    for (const auto *value :
+         {"0", "123456789", "20071114", "2007-11-14", "20071114-154600", "20071114-154600.123", "2007-11-14T15:46:00",
+          "2007-11-14t15:46", "2007-11-14 15", "20071114-1546", "20071114-154600Z", "20071114-154600.123+0300",
+          "2007-11-14T15:46:00-03:30", "2007-11-14T15:46:00+03", "20000229-235959.999"}) {
+        CAPTURE(value);
+        REQUIRE(NativeTimeFormat::DEFAULT.parse(value) == TimeFormat::DEFAULT.parse(value));
+        REQUIRE(NativeTimeFormat::GMT.parse(value) == TimeFormat::GMT.parse(value));
+    }
+
+    for (auto time : createTimes()) {
+        const auto gmt = NativeTimeFormat::GMT.format(time);
+
+        REQUIRE(NativeTimeFormat::GMT.parse(gmt) == TimeFormat::GMT.parse(gmt));
+
+        const auto local = NativeTimeFormat::DEFAULT_WITH_MILLIS_WITH_TIMEZONE.format(time);
+
+        REQUIRE(NativeTimeFormat::DEFAULT.parse(local) == TimeFormat::DEFAULT.parse(local));
+    }
+
+    // The formats that aren't parsed natively are parsed by the TimeFormat.
+    REQUIRE(NativeTimeFormat::GMT.parse("2007-11-14 15:46:00 GMT") == TimeFormat::GMT.parse("2007-11-14 15:46:00 GMT"));
+}
@@ -0,0 +1,118 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+const std::string TEXT =
+    "#OPTION::=TYPE,SYMBOL,UNDERLYING,PRODUCT,EXPIRATION,MULTIPLIER,SPC,STRIKE,CFI\n"
+    "OPTION,.SPX241220C5000,SPX,SPX,2024-12-20,100,100,5000,OCEICS\n"
+    "OPTION,.SPX241220P5000,SPX,SPX,2024-12-20,100,100,5000,OPEICS\n"
+    "OPTION,.SPX241220C4900,SPX,SPX,2024-12-20,100,100,4900,OCEICS\n"
+    "OPTION,.SPX241220C5100,SPX,SPX,2024-12-20,100,100,5100,OCEICS\n"
+    "OPTION,.SPX241220C5000DUP,SPX,SPX,2024-12-20,100,100,5000,OCEICS\n"
+    "OPTION,.SPXW241213P4800,SPX,SPXW,2024-12-13,100,100,4800,OPEICS\n"
+    "OPTION,.SPX241213P4800,SPX,SPX,2024-12-13,50,100,4800,OPEICS\n"
+    "OPTION,.SPX241227X5000,SPX,SPX,2024-12-27,100,100,5000,FXXXXX\n"
+    "OPTION,.SPX000000C5000,SPX,SPX,,100,100,5000,OCEICS\n"
+    "#STOCK::=TYPE,SYMBOL,CFI\n"
+    "STOCK,SPY,ESXXXX\n";
+
+std::vector<double> toVector(std::span<const double> strikes) {
+    return {strikes.begin(), strikes.end()};
+}
+
+} // namespace
+
+TEST_CASE("CompactOptionChainsBuilder builds the chains by the products and the underlyings") {
+    auto profiles =
+        std::make_shared<InstrumentProfileDataList>(NativeInstrumentProfileReader::create()->read(TEXT));
+    auto chains = CompactOptionChainsBuilder::build(profiles, 1);
+
+    REQUIRE(chains.size() == 2);
+    REQUIRE(chains.at("SPXW").getSeries().size() == 1);
+
+    const auto &spx = chains.at("SPX");
+    const auto december13 = InstrumentProfileData::parseDate("2024-12-13");
+    const auto december20 = InstrumentProfileData::parseDate("2024-12-20");
+
+    REQUIRE(spx.getSymbol() == "SPX");
+    // The series of 2024-12-13 differ by the multiplier.
+    REQUIRE(spx.getSeries().size() == 3);
+    REQUIRE(spx.getSeriesByExpiration(december13).size() == 2);
+    REQUIRE(spx.getSeriesByExpiration(december13)[0].getAttributes().getMultiplier() == 50);
+    REQUIRE(spx.getSeriesByExpiration(december20 + 1).empty());
+
+    const auto &series = spx.getSeriesByExpiration(december20)[0];
+
+    REQUIRE(series.getAttributes().getCFI() == "OXEICS");
+    REQUIRE(series.getStrikes() == std::vector<double>{4900, 5000, 5100});
+    REQUIRE(series.getCall(5000)->symbol == ".SPX241220C5000");
+    REQUIRE(series.getPut(5000)->symbol == ".SPX241220P5000");
+    REQUIRE(series.getPut(4900) == nullptr);
+    REQUIRE(series.getCall(4950) == nullptr);
+    REQUIRE(toVector(series.getNStrikesAround(2, 5000)) == std::vector<double>{4900, 5000});
+    REQUIRE(toVector(series.getNStrikesAround(10, 5000)) == std::vector<double>{4900, 5000, 5100});
+    REQUIRE(series.getNStrikesAround(0, 5000).empty());
+
+    // The options keep the profiles alive.
+    auto call = series.getCall(4900);
+
+    profiles.reset();
+    chains.clear();
+    REQUIRE(call->symbol == ".SPX241220C4900");
+}
+
+TEST_CASE("CompactOptionChainsBuilder gives the same result with any parallelism") {
+    auto profiles =
+        std::make_shared<InstrumentProfileDataList>(NativeInstrumentProfileReader::create()->read(TEXT));
+    auto serial = CompactOptionChainsBuilder::build(profiles, 1);
+    auto parallel = CompactOptionChainsBuilder::build(profiles, 4);
+
+    REQUIRE(serial.size() == parallel.size());
+
+    for (const auto &[symbol, chain] : serial) {
+        const auto &other = parallel.at(symbol);
+
+        REQUIRE(chain.getSeries().size() == other.getSeries().size());
+
+        for (std::size_t i = 0; i < chain.getSeries().size(); i++) {
+            REQUIRE(chain.getSeries()[i].getStrikes() == other.getSeries()[i].getStrikes());
+            REQUIRE(chain.getSeries()[i].getCalls() == other.getSeries()[i].getCalls());
+            REQUIRE(chain.getSeries()[i].getPuts() == other.getSeries()[i].getPuts());
+        }
+    }
+}
+
+TEST_CASE("CompactOptionChainsBuilder converts the chains of OptionChainsBuilder") {
+    OptionChainsBuilder<int> builder{};
+
+    builder.setProduct("SPX");
+    builder.setExpiration(1);
+    builder.setCFI("OCXXXX");
+    builder.setStrike(20);
+    builder.addOption(std::make_shared<int>(1));
+    builder.setStrike(10);
+    builder.addOption(std::make_shared<int>(2));
+    builder.setCFI("OPXXXX");
+    builder.addOption(std::make_shared<int>(3));
+
+    auto chains = CompactOptionChainsBuilder::from(builder.getChains());
+    const auto &series = chains.at("SPX").getSeries().at(0);
+
+    REQUIRE(series.getStrikes() == std::vector<double>{10, 20});
+    REQUIRE(*series.getCalls()[0] == 2);
+    REQUIRE(*series.getCalls()[1] == 1);
+    REQUIRE(*series.getPuts()[0] == 3);
+    REQUIRE(series.getPuts()[1] == nullptr);
+}
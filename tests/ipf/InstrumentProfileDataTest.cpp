@@ -0,0 +1,65 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <string>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+TEST_CASE("InstrumentProfileData parses the numbers and dates in the IPF format") {
+    REQUIRE(InstrumentProfileData::parseNumber("") == 0.0);
+    REQUIRE(InstrumentProfileData::parseNumber("100") == 100.0);
+    REQUIRE(InstrumentProfileData::parseNumber("-0.25") == -0.25);
+    REQUIRE(InstrumentProfileData::parseNumber("+1.5e3") == 1500.0);
+    REQUIRE(InstrumentProfileData::parseNumber(".5") == 0.5);
+    REQUIRE(InstrumentProfileData::parseNumber("5.") == 5.0);
+
+    for (const auto *value : {"1.5x", "1,5", ".", "-", "e5", "1e", " 1", "1 ", "inf", "-Infinity", "nan", "NaN", "0x10",
+                              "0x1p3", "1e999"}) {
+        REQUIRE_THROWS_AS(InstrumentProfileData::parseNumber(value), InvalidArgumentException);
+    }
+
+    REQUIRE(InstrumentProfileData::parseDate("") == 0);
+    REQUIRE(InstrumentProfileData::parseDate("1970-01-01") == 0);
+    REQUIRE(InstrumentProfileData::parseDate("1970-01-02") == 1);
+    REQUIRE(InstrumentProfileData::parseDate("1969-12-31") == -1);
+    REQUIRE(InstrumentProfileData::parseDate("2000-03-01") == 11017);
+    REQUIRE(InstrumentProfileData::parseDate("2024-12-20") == 20077);
+
+    for (const auto *value : {"2024-13-20", "2024/12/20", "2024-12-2", "2024-12-20T", "2024-1x-20", "x"}) {
+        REQUIRE_THROWS_AS(InstrumentProfileData::parseDate(value), InvalidArgumentException);
+    }
+}
+
+TEST_CASE("InstrumentProfileData sets the standard and custom fields") {
+    InstrumentProfileStringPool pool{};
+    InstrumentProfileData data{};
+
+    data.setField("TYPE", "OPTION", pool);
+    data.setField("SYMBOL", ".AAPL241220C200", pool);
+    data.setField("UNDERLYING", "AAPL", pool);
+    data.setField("STRIKE", "200", pool);
+    data.setField("EXPIRATION", "2024-12-20", pool);
+    data.setField("ICB", "9537", pool);
+    data.setField("CUSTOM", "value", pool);
+
+    REQUIRE(data.type == "OPTION");
+    REQUIRE(data.getField("SYMBOL") == ".AAPL241220C200");
+    REQUIRE(data.getStringField(InstrumentProfileField::UNDERLYING) == "AAPL");
+    REQUIRE(data.strike == 200.0);
+    REQUIRE(data.expiration == 20077);
+    REQUIRE(data.getNumericField(InstrumentProfileField::ICB) == 9537.0);
+    REQUIRE(data.getField("CUSTOM") == "value");
+    REQUIRE(data.getField("MISSING").empty());
+
+    InstrumentProfileData other{};
+
+    other.setField("UNDERLYING", std::string("AAPL"), pool);
+    REQUIRE(other.underlying.data() == data.underlying.data());
+
+    data.setField("CUSTOM", "", pool);
+    REQUIRE(data.customFields.empty());
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+const std::string TEXT = "#STOCK::=TYPE,SYMBOL,EXCHANGES,CFI\n"
+                         "STOCK,AAPL,ARCX;XNAS,ESXXXX\n"
+                         "STOCK,IBM,XNYS,ESXXXX\n"
+                         "#OPTION::=TYPE,SYMBOL,UNDERLYING,PRODUCT,EXPIRATION,EXCHANGES,CFI\n"
+                         "OPTION,.AAPL241227C200,AAPL,AAPL,2024-12-27,XCBO,OCASPS\n"
+                         "OPTION,.AAPL241220C200,AAPL,AAPL,2024-12-20,XCBO,OCASPS\n"
+                         "OPTION,.AAPL250117C200,AAPL,AAPL,2025-01-17,BATO;XCBO,OPASPS\n"
+                         "OPTION,.IBM241220P150,IBM,IBM,2024-12-20,XCBO,OPASPS\n";
+
+using Ids = std::vector<InstrumentProfileIndex::ProfileId>;
+
+} // namespace
+
+TEST_CASE("InstrumentProfileIndex answers the queries by the indexes") {
+    auto index = InstrumentProfileIndex::create();
+
+    index->update(NativeInstrumentProfileReader::create()->read(TEXT));
+
+    REQUIRE(index->size() == 6);
+    REQUIRE(index->findBySymbol("IBM") == 1u);
+    REQUIRE(!index->findBySymbol("MSFT"));
+    REQUIRE(index->findByUnderlying("AAPL") == Ids{3, 2, 4});
+
+    const auto december20 = InstrumentProfileData::parseDate("2024-12-20");
+
+    REQUIRE(index->findByUnderlying("AAPL", december20, december20 + 6) == Ids{3});
+    REQUIRE(index->findByExpiration(december20, december20 + 7) == Ids{3, 5, 2});
+    REQUIRE(index->findByProduct("IBM") == Ids{5});
+    REQUIRE(index->findByExchange("XCBO") == Ids{2, 3, 4, 5});
+    REQUIRE(index->findByExchange("XNAS") == Ids{0});
+    REQUIRE(index->findByCfiPrefix("ES") == Ids{0, 1});
+    REQUIRE(index->findByCfiPrefix("OP") == Ids{4, 5});
+    REQUIRE(index->findByCfiPrefix("O").size() == 4);
+    REQUIRE(index->getProfiles(index->findByUnderlying("IBM")).profiles[0].symbol == ".IBM241220P150");
+}
+
+TEST_CASE("InstrumentProfileIndex updates and removes the profiles") {
+    auto index = InstrumentProfileIndex::create();
+    InstrumentProfileStringPool pool{};
+
+    index->update(NativeInstrumentProfileReader::create()->read(TEXT));
+
+    auto profile = *index->getProfile(2, pool);
+
+    profile.setField("UNDERLYING", "IBM", pool);
+    profile.setField("EXCHANGES", "XNYS", pool);
+    REQUIRE(index->update(profile) == 2u);
+    REQUIRE(index->findByUnderlying("AAPL") == Ids{3, 4});
+    REQUIRE(index->findByUnderlying("IBM") == Ids{5, 2});
+    REQUIRE(index->findByExchange("XNYS") == Ids{1, 2});
+
+    REQUIRE(index->remove("IBM"));
+    REQUIRE(!index->remove("IBM"));
+    REQUIRE(index->size() == 5);
+    REQUIRE(!index->getProfile(1, pool));
+    REQUIRE(index->findByCfiPrefix("ES") == Ids{0});
+
+    profile = *index->getProfile(4, pool);
+    profile.setField("TYPE", "REMOVED", pool);
+    REQUIRE(!index->update(profile));
+    REQUIRE(index->findByExpiration(0, 100000) == Ids{3, 5, 2});
+
+    // The identifiers of the removed profiles are reused.
+    profile.setField("TYPE", "STOCK", pool);
+    profile.setField("SYMBOL", "MSFT", pool);
+    REQUIRE(index->update(profile) == 4u);
+    REQUIRE(index->size() == 5);
+}
+
+TEST_CASE("InstrumentProfileIndex releases the strings of the updated profiles") {
+    auto index = InstrumentProfileIndex::create();
+    InstrumentProfileStringPool pool{};
+    InstrumentProfileData profile{};
+
+    profile.setField("TYPE", "STOCK", pool);
+    profile.setField("SYMBOL", "AAPL", pool);
+    REQUIRE(index->update(profile) == 0u);
+
+    const auto before = index->getProfiles({0});
+
+    // Each update interns the new description, about 40 MB in total.
+    for (int i = 0; i < 20000; i++) {
+        const auto description = std::string(2000, 'a') + std::to_string(i);
+
+        profile.description = description;
+        index->update(profile);
+    }
+
+    const auto after = index->getProfiles({0});
+
+    REQUIRE(after.pools[0]->getBytes() < 4 * 1024 * 1024);
+    REQUIRE(after.profiles[0].description == std::string(2000, 'a') + "19999");
+    REQUIRE(before.profiles[0].symbol == "AAPL");
+    REQUIRE(index->findBySymbol("AAPL") == 0u);
+}
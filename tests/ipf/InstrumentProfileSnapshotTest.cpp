@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+const std::string TEXT = "#STOCK::=TYPE,SYMBOL,DESCRIPTION,CURRENCY,ICB,CUSTOM\n"
+                         "STOCK,IBM,International Business Machines,USD,9537,a\n"
+                         "STOCK,AAPL,\"Apple, Inc.\",USD,9537,b\n"
+                         "#OPTION::=TYPE,SYMBOL,UNDERLYING,STRIKE,EXPIRATION\n"
+                         "OPTION,.IBM241220P150,IBM,150.5,2024-12-20\n"
+                         "OPTION,.AAPL241220C200,AAPL,200,2024-12-20\n"
+                         "OPTION,.AAPL241220P200,AAPL,200,2024-12-20\n"
+                         "##COMPLETE\n";
+
+} // namespace
+
+TEST_CASE("InstrumentProfileSnapshot keeps the profiles and the indexes") {
+    const auto path = (std::filesystem::temp_directory_path() / "InstrumentProfileSnapshotTest.ipfs").string();
+    const auto profiles = NativeInstrumentProfileReader::create()->read(TEXT);
+
+    InstrumentProfileSnapshot::write(path, profiles, 1234, true);
+
+    auto snapshot = InstrumentProfileSnapshot::open(path);
+
+    REQUIRE(snapshot->size() == profiles.size());
+    REQUIRE(snapshot->getLastModified() == 1234);
+    REQUIRE(snapshot->wasComplete());
+    REQUIRE(snapshot->isValidFor(1234));
+    REQUIRE(!snapshot->isValidFor(1235));
+
+    for (std::size_t i = 0; i < profiles.size(); i++) {
+        const auto &expected = profiles.profiles[i];
+        const auto actual = snapshot->getProfile(i);
+
+        REQUIRE(actual.type == expected.type);
+        REQUIRE(actual.symbol == expected.symbol);
+        REQUIRE(actual.description == expected.description);
+        REQUIRE(actual.currency == expected.currency);
+        REQUIRE(actual.underlying == expected.underlying);
+        REQUIRE(actual.icb == expected.icb);
+        REQUIRE(actual.strike == expected.strike);
+        REQUIRE(actual.expiration == expected.expiration);
+        REQUIRE(actual.customFields == expected.customFields);
+    }
+
+    REQUIRE(snapshot->getStringField(1, InstrumentProfileField::DESCRIPTION) == "Apple, Inc.");
+    REQUIRE(snapshot->getNumericField(2, InstrumentProfileField::STRIKE) == 150.5);
+    REQUIRE(snapshot->findBySymbol("AAPL") == 1u);
+    REQUIRE(snapshot->findBySymbol(".IBM241220P150") == 2u);
+    REQUIRE(!snapshot->findBySymbol("MSFT"));
+
+    const auto options = snapshot->findByUnderlying("AAPL");
+
+    REQUIRE(std::vector<std::uint32_t>(options.begin(), options.end()) == std::vector<std::uint32_t>{3, 4});
+    REQUIRE(snapshot->findByUnderlying("MSFT").empty());
+
+    snapshot.reset();
+
+    // Any change of the file is detected as a corruption.
+    std::fstream(path, std::ios::binary | std::ios::in | std::ios::out).write("X", 1);
+    REQUIRE_THROWS_AS(InstrumentProfileSnapshot::open(path), RuntimeException);
+
+    std::filesystem::resize_file(path, 100);
+    REQUIRE_THROWS_AS(InstrumentProfileSnapshot::open(path), RuntimeException);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("InstrumentProfileSnapshot is rewritten when the source is modified") {
+    const auto directory = std::filesystem::temp_directory_path();
+    const auto sourcePath = (directory / "InstrumentProfileSnapshotTest.ipf").string();
+    const auto snapshotPath = (directory / "InstrumentProfileSnapshotTest.ipf.ipfs").string();
+
+    std::ofstream(sourcePath, std::ios::binary) << TEXT;
+
+    auto snapshot = InstrumentProfileSnapshot::loadOrRead(snapshotPath, sourcePath);
+
+    REQUIRE(snapshot->size() == 5);
+    REQUIRE(snapshot->isValidFor(MappedFile::getLastModified(sourcePath)));
+    snapshot.reset();
+
+    std::ofstream(sourcePath, std::ios::binary) << "#STOCK::=TYPE,SYMBOL\nSTOCK,MSFT\n##COMPLETE\n";
+    std::filesystem::last_write_time(sourcePath,
+                                     std::filesystem::last_write_time(sourcePath) + std::chrono::seconds(10));
+    snapshot = InstrumentProfileSnapshot::loadOrRead(snapshotPath, sourcePath);
+
+    REQUIRE(snapshot->size() == 1);
+    REQUIRE(snapshot->toDataList().profiles[0].symbol == "MSFT");
+    snapshot.reset();
+
+    std::filesystem::remove(sourcePath);
+    std::filesystem::remove(snapshotPath);
+}
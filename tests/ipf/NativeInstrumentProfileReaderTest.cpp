@@ -0,0 +1,102 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+namespace {
+
+const std::string TEXT = "#STOCK::=TYPE,SYMBOL,DESCRIPTION,CURRENCY,ICB,CUSTOM\r\n"
+                         "STOCK,AAPL,\"Apple, Inc.\",USD,9537,a\r\n"
+                         "STOCK,IBM,\"International \"\"Big\"\"\nMachines\",USD,,\r\n"
+                         "## a comment\n"
+                         "#OPTION::=TYPE,SYMBOL,UNDERLYING,STRIKE,EXPIRATION\n"
+                         "OPTION,.AAPL241220C200,AAPL,200,2024-12-20\n"
+                         "\n"
+                         "#STOCK::=TYPE,SYMBOL,COUNTRY\n"
+                         "STOCK,MSFT,US\n"
+                         "OPTION,.IBM241220P150,IBM,150.5,2024-12-20\n"
+                         "##COMPLETE\n";
+
+void checkProfiles(const InstrumentProfileDataList &list) {
+    REQUIRE(list.size() == 5);
+
+    const auto &profiles = list.profiles;
+
+    REQUIRE(profiles[0].symbol == "AAPL");
+    REQUIRE(profiles[0].description == "Apple, Inc.");
+    REQUIRE(profiles[0].icb == 9537);
+    REQUIRE(profiles[0].getField("CUSTOM") == "a");
+    REQUIRE(profiles[1].description == "International \"Big\"\nMachines");
+    REQUIRE(profiles[1].customFields.empty());
+    REQUIRE(profiles[2].type == "OPTION");
+    REQUIRE(profiles[2].underlying == "AAPL");
+    REQUIRE(profiles[2].expiration == InstrumentProfileData::parseDate("2024-12-20"));
+    REQUIRE(profiles[3].symbol == "MSFT");
+    REQUIRE(profiles[3].country == "US");
+    REQUIRE(profiles[3].currency.empty());
+    REQUIRE(profiles[4].strike == 150.5);
+}
+
+} // namespace
+
+TEST_CASE("NativeInstrumentProfileReader parses the chunks in parallel as a whole") {
+    for (const std::size_t chunkSize : {1, 7, 64, 1 << 20}) {
+        auto reader = NativeInstrumentProfileReader::create({.parallelism = 4, .chunkSize = chunkSize});
+
+        checkProfiles(reader->read(TEXT));
+        REQUIRE(reader->wasComplete());
+    }
+}
+
+TEST_CASE("NativeInstrumentProfileReader reads the gzip and local files") {
+    const std::vector<std::uint8_t> gzip{
+        0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x53, 0x0E, 0x0E, 0xF1, 0x77, 0xF6,
+        0xB6, 0xB2, 0xB2, 0x0D, 0x89, 0x0C, 0x70, 0xD5, 0x09, 0x8E, 0xF4, 0x75, 0xF2, 0xF7, 0xD1, 0x71,
+        0x0E, 0x0D, 0x0A, 0x72, 0xF5, 0x73, 0x8E, 0xE4, 0x02, 0x4B, 0xEA, 0x38, 0x3A, 0x06, 0xF8, 0xE8,
+        0x84, 0x06, 0xBB, 0x40, 0xB9, 0x9E, 0x4E, 0xBE, 0x60, 0x9E, 0xB2, 0xB2, 0xB3, 0xBF, 0x6F, 0x80,
+        0x8F, 0x6B, 0x88, 0x2B, 0x17, 0x00, 0xA0, 0xB2, 0xF8, 0x85, 0x46, 0x00, 0x00, 0x00};
+    auto reader = NativeInstrumentProfileReader::create();
+    auto list = reader->read(std::string(gzip.begin(), gzip.end()));
+
+    REQUIRE(list.size() == 2);
+    REQUIRE(list.profiles[1].symbol == "IBM");
+    REQUIRE(list.profiles[1].currency == "USD");
+    REQUIRE(reader->wasComplete());
+
+    const auto path = std::filesystem::temp_directory_path() / "NativeInstrumentProfileReaderTest.ipf";
+
+    std::ofstream(path, std::ios::binary) << TEXT;
+    checkProfiles(reader->readFromFile(path.string()));
+    REQUIRE(reader->getLastModified() > 0);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("NativeInstrumentProfileReader rejects the malformed records") {
+    auto reader = NativeInstrumentProfileReader::create();
+
+    REQUIRE_THROWS_AS(reader->read("STOCK,AAPL\n"), RuntimeException);
+    REQUIRE_THROWS_AS(reader->read("#STOCK::=TYPE,SYMBOL\nSTOCK,AAPL,USD\n"), RuntimeException);
+    REQUIRE_THROWS_AS(reader->read("#STOCK::=SYMBOL\n"), RuntimeException);
+    REQUIRE_THROWS_AS(reader->read("#STOCK::=TYPE,SYMBOL\nSTOCK,\"AAPL\n"), RuntimeException);
+    REQUIRE(!reader->read("#STOCK::=TYPE,SYMBOL\nSTOCK,AAPL\n").empty());
+    REQUIRE(!reader->wasComplete());
+}
+
+TEST_CASE("NativeInstrumentProfileReader rejects the malformed numbers and dates with the record offset") {
+    auto reader = NativeInstrumentProfileReader::create();
+
+    REQUIRE_THROWS_WITH_AS(reader->read("#STOCK::=TYPE,SYMBOL,STRIKE\nSTOCK,AAPL,1\nSTOCK,IBM,\"1,5\"\n"),
+                           doctest::Contains("Invalid value '1,5' of the field STRIKE at offset 41"), RuntimeException);
+    REQUIRE_THROWS_AS(reader->read("#STOCK::=TYPE,SYMBOL,STRIKE\nSTOCK,AAPL,nan\n"), RuntimeException);
+    REQUIRE_THROWS_AS(reader->read("#STOCK::=TYPE,SYMBOL,EXPIRATION\nSTOCK,AAPL,2024-12-32\n"), RuntimeException);
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace std::literals;
+using namespace dxfcpp;
+
+namespace {
+
+std::shared_ptr<EventType> createTrade(const char *symbol, std::int64_t time, double price, double size,
+                                       const Side &side = Side::UNDEFINED) {
+    auto timeAndSale = std::make_shared<TimeAndSale>(symbol);
+
+    timeAndSale->setTime(time);
+    timeAndSale->setPrice(price);
+    timeAndSale->setSize(size);
+    timeAndSale->setAggressorSide(side);
+    timeAndSale->setValidTick(true);
+
+    return timeAndSale;
+}
+
+struct Collected {
+    std::vector<std::shared_ptr<Candle>> final{};
+    std::vector<std::shared_ptr<Candle>> partial{};
+};
+
+std::shared_ptr<CandleAggregator> createAggregator(std::initializer_list<CandleSymbol> symbols, Collected &collected) {
+    return CandleAggregator::newBuilder()
+        ->withSymbols(symbols)
+        ->withPartialCandles(true)
+        ->withListener([&collected](const auto &candles, bool isFinal) {
+            auto &target = isFinal ? collected.final : collected.partial;
+
+            target.insert(target.end(), candles.begin(), candles.end());
+        })
+        ->build();
+}
+
+} // namespace
+
+TEST_CASE("CandleAggregator builds the time candles") {
+    Collected collected{};
+    auto aggregator = createAggregator({CandleSymbol::valueOf("AAPL{=0.25s}")}, collected);
+
+    aggregator->process({createTrade("AAPL", 1000, 10, 1, Side::BUY), createTrade("AAPL", 1100, 12, 3, Side::SELL),
+                         createTrade("AAPL", 1249, 11, 1), createTrade("IBM", 1200, 100, 1)});
+
+    REQUIRE(collected.final.empty());
+    REQUIRE(collected.partial.size() == 1);
+    REQUIRE(collected.partial[0]->getCount() == 3);
+
+    aggregator->process({createTrade("AAPL", 1250, 9, 2)});
+
+    REQUIRE(collected.final.size() == 1);
+
+    const auto &candle = collected.final[0];
+
+    REQUIRE(candle->getEventSymbol() == CandleSymbol::valueOf("AAPL{=0.25s}"));
+    REQUIRE(candle->getTime() == 1000);
+    REQUIRE(candle->getOpen() == 10);
+    REQUIRE(candle->getHigh() == 12);
+    REQUIRE(candle->getLow() == 10);
+    REQUIRE(candle->getClose() == 11);
+    REQUIRE(candle->getVolume() == 5);
+    REQUIRE(candle->getVWAP() == doctest::Approx((10.0 + 36.0 + 11.0) / 5.0));
+    REQUIRE(candle->getAskVolume() == 1);
+    REQUIRE(candle->getBidVolume() == 3);
+
+    aggregator->advanceTime(1500);
+
+    REQUIRE(collected.final.size() == 2);
+    REQUIRE(collected.final[1]->getTime() == 1250);
+    REQUIRE(aggregator->getCurrentCandles().empty());
+}
+
+TEST_CASE("CandleAggregator ignores the conflated trades") {
+    Collected collected{};
+    auto aggregator = createAggregator({CandleSymbol::valueOf("AAPL{=1t}")}, collected);
+    auto trade = std::make_shared<Trade>("AAPL");
+
+    trade->setTime(1000);
+    trade->setPrice(10);
+    trade->setSize(1);
+    aggregator->process({trade});
+
+    REQUIRE(collected.final.empty());
+    REQUIRE(collected.partial.empty());
+}
+
+TEST_CASE("CandleAggregator builds the tick and volume candles") {
+    Collected collected{};
+    auto aggregator =
+        createAggregator({CandleSymbol::valueOf("AAPL{=2t}"), CandleSymbol::valueOf("AAPL{=5v}")}, collected);
+
+    aggregator->process({createTrade("AAPL", 1000, 10, 2), createTrade("AAPL", 1000, 11, 2),
+                         createTrade("AAPL", 1000, 12, 2), createTrade("AAPL", 1001, 13, 1)});
+
+    REQUIRE(collected.final.size() == 3);
+
+    // The tick candles that start at the same millisecond are distinguished by the sequence.
+    REQUIRE(collected.final[0]->getEventSymbol() == CandleSymbol::valueOf("AAPL{=2t}"));
+    REQUIRE(collected.final[0]->getSequence() == 0);
+    REQUIRE(collected.final[0]->getClose() == 11);
+    REQUIRE(collected.final[1]->getEventSymbol() == CandleSymbol::valueOf("AAPL{=5v}"));
+    REQUIRE(collected.final[1]->getVolume() == 6);
+    REQUIRE(collected.final[2]->getEventSymbol() == CandleSymbol::valueOf("AAPL{=2t}"));
+    REQUIRE(collected.final[2]->getSequence() == 1);
+    REQUIRE(collected.final[2]->getOpen() == 12);
+
+    // One partial candle per spec and batch: the tick candle is completed, the volume candle rolled over.
+    REQUIRE(collected.partial.size() == 1);
+    REQUIRE(collected.partial[0]->getEventSymbol() == CandleSymbol::valueOf("AAPL{=5v}"));
+    REQUIRE(collected.partial[0]->getVolume() == 1);
+
+    aggregator->process(
+        {createTrade("AAPL", 1002, 14, 1), createTrade("AAPL", 1003, 15, 1), createTrade("AAPL", 1004, 16, 1)});
+
+    REQUIRE(collected.final.size() == 4);
+    REQUIRE(collected.final[3]->getOpen() == 14);
+    REQUIRE(collected.final[3]->getClose() == 15);
+    REQUIRE(collected.partial.size() == 3);
+    REQUIRE(collected.partial[1]->getEventSymbol() == CandleSymbol::valueOf("AAPL{=2t}"));
+    REQUIRE(collected.partial[1]->getCount() == 1);
+    REQUIRE(collected.partial[1]->getOpen() == 16);
+    REQUIRE(collected.partial[2]->getEventSymbol() == CandleSymbol::valueOf("AAPL{=5v}"));
+    REQUIRE(collected.partial[2]->getVolume() == 4);
+
+    aggregator->flush();
+
+    REQUIRE(collected.final.size() == 6);
+    REQUIRE(collected.final[4]->getVolume() == 1);
+    REQUIRE(collected.final[5]->getVolume() == 4);
+    REQUIRE(collected.partial.size() == 3);
+}
+
+TEST_CASE("CandleAggregator rejects the unsupported specifications") {
+    REQUIRE_THROWS_AS(CandleAggregator::newBuilder()->withSymbol(CandleSymbol::valueOf("AAPL{price=bid}")),
+                      InvalidArgumentException);
+    REQUIRE_THROWS_AS(CandleAggregator::newBuilder()->withSymbol(CandleSymbol::valueOf("AAPL{=1o}")),
+                      InvalidArgumentException);
+    REQUIRE_THROWS_AS(CandleAggregator::newBuilder()->withSymbol(CandleSymbol::valueOf("AAPL{=1m,tho=true}"))->build(),
+                      InvalidArgumentException);
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace std::literals;
+using namespace dxfcpp;
+
+class MarketByOrderModelTestFixture {
+    protected:
+    const char *symbol_ = "INDEX-TEST";
+
+    std::shared_ptr<InPlaceExecutor> executor_;
+    std::shared_ptr<DXEndpoint> endpoint_{};
+    std::shared_ptr<DXFeed> feed_{};
+    std::shared_ptr<DXPublisher> publisher_{};
+    std::shared_ptr<MarketByOrderModel<Order>> model_{};
+    std::size_t listenerCalls_{};
+
+    std::shared_ptr<Order> createOrder(std::int64_t index, const Side &side, double price, double size,
+                                       std::int32_t eventFlags = 0) {
+        return std::make_shared<Order>(symbol_)
+            ->withIndex(index)
+            .withOrderSide(side)
+            .withScope(Scope::ORDER)
+            .withPrice(price)
+            .withSize(size)
+            .withEventFlags(eventFlags)
+            .sharedAs<Order>();
+    }
+
+    void publishAndProcess(const std::vector<std::shared_ptr<Order>> &orders) {
+        publisher_->publishEvents(orders);
+        executor_->processAllPendingTasks();
+    }
+
+    void checkPosition(std::int64_t index, std::size_t position, double sizeAhead) {
+        auto queuePosition = model_->getQueuePosition(index);
+
+        REQUIRE(queuePosition.has_value());
+        REQUIRE_EQ(queuePosition->position, position);
+        REQUIRE_EQ(queuePosition->sizeAhead, sizeAhead);
+    }
+
+    public:
+    MarketByOrderModelTestFixture() {
+        executor_ = InPlaceExecutor::create();
+        endpoint_ = DXEndpoint::create(DXEndpoint::Role::LOCAL_HUB);
+        endpoint_->executor(executor_);
+        feed_ = endpoint_->getFeed();
+        publisher_ = endpoint_->getPublisher();
+        model_ = MarketByOrderModel<Order>::newBuilder()
+                     ->withFeed(feed_)
+                     ->withSymbol(symbol_)
+                     ->withSources({OrderSource::DEFAULT})
+                     ->withListener([this](const auto &, const auto &, bool) {
+                         listenerCalls_++;
+                     })
+                     ->build();
+    }
+};
+
+TEST_CASE_FIXTURE(MarketByOrderModelTestFixture, "TestQueuePositions") {
+    publishAndProcess(
+        {createOrder(0, Side::BUY, 10, 1, (EventFlag::SNAPSHOT_BEGIN | EventFlag::SNAPSHOT_END).getMask())});
+    publishAndProcess({createOrder(1, Side::BUY, 10, 2), createOrder(2, Side::BUY, 10, 3),
+                       createOrder(3, Side::SELL, 11, 4)});
+
+    REQUIRE_GT(listenerCalls_, 0);
+    checkPosition(0, 0, 0);
+    checkPosition(1, 1, 1);
+    checkPosition(2, 2, 3);
+    checkPosition(3, 0, 0);
+
+    // The decreased size keeps the position.
+    publishAndProcess({createOrder(1, Side::BUY, 10, 1)});
+    checkPosition(1, 1, 1);
+    checkPosition(2, 2, 2);
+
+    // The increased size moves the order to the back of the queue.
+    publishAndProcess({createOrder(0, Side::BUY, 10, 5)});
+    checkPosition(1, 0, 0);
+    checkPosition(2, 1, 1);
+    checkPosition(0, 2, 4);
+
+    // The cancelled order releases its position.
+    publishAndProcess({createOrder(1, Side::BUY, 10, 1, EventFlag::REMOVE_EVENT.getFlag())});
+    REQUIRE_FALSE(model_->getQueuePosition(1).has_value());
+    checkPosition(2, 0, 0);
+    checkPosition(0, 1, 3);
+
+    // The order that changes the price moves to the back of the queue of the new level.
+    publishAndProcess({createOrder(2, Side::BUY, 9, 3)});
+    checkPosition(0, 0, 0);
+    checkPosition(2, 0, 0);
+
+    model_->withBook([](const auto &book) {
+        REQUIRE_EQ(book.size(), 3);
+        REQUIRE_EQ(book.getBestPrice(Side::BUY), 10);
+        REQUIRE_EQ(book.getBestPrice(Side::SELL), 11);
+        REQUIRE_EQ(book.getLevelCount(Side::BUY), 2);
+        REQUIRE_EQ(book.getLevelSize(Side::BUY, 10), 5);
+        REQUIRE_EQ(book.getLevelOrderCount(Side::BUY, 9), 1);
+    });
+}
+
+TEST_CASE_FIXTURE(MarketByOrderModelTestFixture, "TestQueuePositionsAfterFills") {
+    publishAndProcess({createOrder(0, Side::BUY, 10, 1, EventFlag::SNAPSHOT_BEGIN.getFlag()),
+                       createOrder(1, Side::BUY, 10, 2), createOrder(2, Side::BUY, 10, 3),
+                       createOrder(3, Side::BUY, 10, 4, EventFlag::SNAPSHOT_END.getFlag())});
+    checkPosition(3, 3, 6);
+    checkPosition(2, 2, 3);
+
+    // The partial fill of the head decreases the size ahead of the others.
+    publishAndProcess({createOrder(0, Side::BUY, 10, 0.5)});
+    checkPosition(0, 0, 0);
+    checkPosition(2, 2, 2.5);
+    checkPosition(3, 3, 5.5);
+
+    // The fill of the head moves the others forward.
+    publishAndProcess({createOrder(0, Side::BUY, 10, 0, EventFlag::REMOVE_EVENT.getFlag())});
+    checkPosition(1, 0, 0);
+    checkPosition(2, 1, 2);
+    checkPosition(3, 2, 5);
+
+    // The cancellation in the middle of the queue.
+    publishAndProcess({createOrder(2, Side::BUY, 10, 0, EventFlag::REMOVE_EVENT.getFlag())});
+    checkPosition(3, 1, 2);
+
+    // The order that joins the queue after the fills.
+    publishAndProcess({createOrder(4, Side::BUY, 10, 1)});
+    checkPosition(4, 2, 6);
+
+    publishAndProcess({createOrder(1, Side::BUY, 10, 0, EventFlag::REMOVE_EVENT.getFlag())});
+    checkPosition(3, 0, 0);
+    checkPosition(4, 1, 4);
+}
+
+TEST_CASE_FIXTURE(MarketByOrderModelTestFixture, "TestSnapshotReplacesTheBook") {
+    publishAndProcess({createOrder(1, Side::SELL, 11, 1, EventFlag::SNAPSHOT_BEGIN.getFlag()),
+                       createOrder(0, Side::SELL, 11, 2, EventFlag::SNAPSHOT_END.getFlag())});
+    checkPosition(1, 0, 0);
+    checkPosition(0, 1, 1);
+
+    publishAndProcess(
+        {createOrder(5, Side::BUY, 10, 1, (EventFlag::SNAPSHOT_BEGIN | EventFlag::SNAPSHOT_END).getMask())});
+    REQUIRE_FALSE(model_->getQueuePosition(0).has_value());
+    REQUIRE_FALSE(model_->getQueuePosition(1).has_value());
+    checkPosition(5, 0, 0);
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <doctest.h>
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <cmath>
+
+using namespace std::literals;
+using namespace dxfcpp;
+
+TEST_CASE("MarketDepthLevels aggregates the orders by price") {
+    MarketDepthLevels levels{};
+
+    levels.add(Side::BUY, 10.0, 1);
+    levels.add(Side::BUY, 10.0, 2);
+    levels.add(Side::BUY, 9.5, 4);
+    levels.add(Side::SELL, 10.5, 3);
+    levels.add(Side::UNDEFINED, 11.0, 5); // as in MarketDepthModel, the orders without the buy side are sell orders
+    levels.add(Side::BUY, math::NaN, 100);
+
+    REQUIRE_EQ(levels.getLevelCount(Side::BUY), 2);
+    REQUIRE_EQ(levels.getLevelCount(Side::SELL), 2);
+    REQUIRE_EQ(levels.getTotalSize(Side::BUY), 7);
+    REQUIRE_EQ(levels.getTotalSize(Side::SELL), 8);
+    REQUIRE_EQ(levels.getLevels(Side::BUY, 10),
+               std::vector<MarketDepthLevel>{MarketDepthLevel{10.0, 3, 2}, MarketDepthLevel{9.5, 4, 1}});
+    REQUIRE_EQ(levels.getLevels(Side::SELL, 1), std::vector<MarketDepthLevel>{MarketDepthLevel{10.5, 3, 1}});
+
+    levels.remove(Side::BUY, 10.0, 1);
+    levels.remove(Side::BUY, 9.5, 4);
+    levels.remove(Side::SELL, 12.0, 1); // unknown level
+
+    REQUIRE_EQ(levels.getLevels(Side::BUY, 10), std::vector<MarketDepthLevel>{MarketDepthLevel{10.0, 2, 1}});
+    REQUIRE_EQ(levels.getTotalSize(Side::BUY), 2);
+    REQUIRE_EQ(levels.getTotalSize(Side::SELL), 8);
+
+    levels.clear();
+
+    REQUIRE_EQ(levels.getLevelCount(Side::BUY), 0);
+    REQUIRE_EQ(levels.getTotalSize(Side::SELL), 0);
+}
+
+TEST_CASE("MarketDepthAnalytics metrics") {
+    MarketDepthLevels levels{};
+
+    levels.add(Side::BUY, 100.0, 30);
+    levels.add(Side::BUY, 99.9, 10);
+    levels.add(Side::BUY, 99.8, 60);
+    levels.add(Side::BUY, 99.0, 1000);
+    levels.add(Side::SELL, 100.1, 10);
+    levels.add(Side::SELL, 100.2, 20);
+    levels.add(Side::SELL, 100.4, 40);
+
+    auto analytics = levels.getAnalytics(3);
+
+    REQUIRE_EQ(analytics->getLevels(Side::BUY).size(), 3);
+    REQUIRE_EQ(analytics->getTotalSize(Side::BUY), 1100);
+    REQUIRE_EQ(analytics->getBestPrice(Side::BUY), 100.0);
+    REQUIRE_EQ(analytics->getBestPrice(Side::SELL), 100.1);
+    REQUIRE(math::equals(analytics->getSpread(), 0.1, 1e-9));
+    REQUIRE(math::equals(analytics->getMidPrice(), 100.05, 1e-9));
+
+    // (30 - 10) / (30 + 10)
+    REQUIRE(math::equals(analytics->getImbalance(), 0.5, 1e-12));
+    // (100 - 70) / (100 + 70)
+    REQUIRE(math::equals(analytics->getImbalance(3), 30.0 / 170.0, 1e-12));
+    // (100.0 * 10 + 100.1 * 30) / 40
+    REQUIRE(math::equals(analytics->getMicroprice(), 100.075, 1e-9));
+    // (100.0 * 30 + 99.9 * 10) / 40
+    REQUIRE(math::equals(analytics->getVwap(Side::BUY, 2), 99.975, 1e-9));
+    REQUIRE(math::equals(analytics->getDepthWeightedMid(1), 100.05, 1e-9));
+
+    REQUIRE_EQ(analytics->getCumulativeSize(Side::BUY, 0, 0.1), 30);
+    REQUIRE_EQ(analytics->getCumulativeSize(Side::BUY, 2, 0.1), 100);
+    REQUIRE_EQ(analytics->getCumulativeSize(Side::SELL, 2, 0.1), 30);
+
+    // Buy 20: 10 @ 100.1 + 10 @ 100.2
+    REQUIRE(math::equals(analytics->getSweepPrice(Side::SELL, 20), 100.15, 1e-9));
+    REQUIRE(std::isnan(analytics->getSweepPrice(Side::SELL, 1000)));
+}
+
+TEST_CASE("Empty MarketDepthAnalytics") {
+    const auto &analytics = MarketDepthAnalytics::empty();
+
+    REQUIRE(analytics->getLevels(Side::BUY).empty());
+    REQUIRE(std::isnan(analytics->getBestPrice(Side::SELL)));
+    REQUIRE(std::isnan(analytics->getImbalance()));
+    REQUIRE(std::isnan(analytics->getMicroprice()));
+    REQUIRE(std::isnan(analytics->getVwap(Side::BUY, 5)));
+    REQUIRE_EQ(analytics->getCumulativeSize(Side::BUY, 5, 0.01), 0);
+}
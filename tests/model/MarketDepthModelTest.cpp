@@ -3,6 +3,8 @@
 
 // #include <dxfeed_graal_cpp_api/model/MarketDepthModel.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <random>
 #include <string>
 #include <thread>
@@ -350,6 +352,125 @@ TEST_CASE_FIXTURE(MarketDepthModelTestFixture, "TestEnforceEntryLimit") {
     publishAndProcess(false, createOrder(1, Side::BUY, 2, 1, 0));
 }
 
+TEST_CASE_FIXTURE(MarketDepthModelTestFixture, "TestSnapshot") {
+    auto initial = model_->getSnapshot();
+
+    REQUIRE(initial);
+    REQUIRE(initial->getBuyOrders().empty());
+    REQUIRE(initial->getSellOrders().empty());
+    REQUIRE_FALSE(initial->getBestBuyOrder());
+    REQUIRE_FALSE(initial->getBestSellOrder());
+
+    auto o1 = createOrder(2, Side::BUY, 3, 1, 0);
+    auto o2 = createOrder(1, Side::SELL, 4, 1, 0);
+    auto o3 = createOrder(0, Side::BUY, 1, 1, (EventFlag::SNAPSHOT_BEGIN | EventFlag::SNAPSHOT_END).getMask());
+
+    publishAndProcess(true, {o3, o2, o1});
+
+    auto snapshot = model_->getSnapshot();
+
+    REQUIRE_GT(snapshot->getVersion(), initial->getVersion());
+    REQUIRE(equals(snapshot->getBuyOrders(), buyOrders_));
+    REQUIRE(equals(snapshot->getSellOrders(), sellOrders_));
+    REQUIRE(same(o1, snapshot->getBestBuyOrder()));
+    REQUIRE(same(o2, snapshot->getBestSellOrder()));
+
+    // The snapshot that was taken earlier is immutable.
+    publishAndProcess(true, createOrder(3, Side::BUY, 5, 1, 0));
+
+    REQUIRE_EQ(snapshot->getBuyOrders().size(), 2);
+    REQUIRE_EQ(model_->getSnapshot()->getBuyOrders().size(), 3);
+    REQUIRE_EQ(model_->getSnapshot()->getBestBuyOrder()->getIndex(), 3);
+
+    // The unchanged side is shared between the snapshots.
+    REQUIRE_EQ(&snapshot->getSellOrders(), &model_->getSnapshot()->getSellOrders());
+
+    // The snapshot is not published if the book has not changed.
+    auto version = model_->getSnapshot()->getVersion();
+
+    publishAndProcess(false, createOrder(10, Side::BUY, 1, 1, EventFlag::REMOVE_EVENT.getFlag()));
+    REQUIRE_EQ(model_->getSnapshot()->getVersion(), version);
+}
+
+TEST_CASE_FIXTURE(MarketDepthModelTestFixture, "TestAnalytics") {
+    REQUIRE(model_->getSnapshot()->getAnalytics().getLevels(Side::BUY).empty());
+
+    model_.reset();
+    model_ = createBuilder()->withDepthLimit(1)->withAnalyticsDepth(5)->build();
+
+    publishAndProcess(
+        true, {createOrder(0, Side::BUY, 10, 1, (EventFlag::SNAPSHOT_BEGIN | EventFlag::SNAPSHOT_END).getMask()),
+               createOrder(1, Side::SELL, 11, 3, 0)});
+
+    REQUIRE(math::equals(model_->getSnapshot()->getAnalytics().getMicroprice(), (10.0 * 3 + 11.0 * 1) / 4, 1e-9));
+
+    // The changes beyond the depth limit are not notified, but they are reflected in the analytics.
+    publishAndProcess(false, createOrder(2, Side::BUY, 9, 5, 0));
+
+    auto snapshot = model_->getSnapshot();
+    const auto &analytics = snapshot->getAnalytics();
+
+    REQUIRE_EQ(analytics.getLevels(Side::BUY).size(), 2);
+    REQUIRE_EQ(analytics.getTotalSize(Side::BUY), 6);
+
+    publishAndProcess(false, {createOrder(3, Side::BUY, 8, 1, 0), createOrder(4, Side::BUY, 7, 1, 0),
+                              createOrder(5, Side::BUY, 6, 1, 0)});
+
+    // The changes beyond the analytics depth do not publish a snapshot.
+    const auto version = model_->getSnapshot()->getVersion();
+
+    publishAndProcess(false, createOrder(6, Side::BUY, 5, 1, 0));
+    REQUIRE_EQ(model_->getSnapshot()->getVersion(), version);
+
+    // The change of the last level within the analytics depth.
+    publishAndProcess(false, createOrder(7, Side::BUY, 6, 2, 0));
+    REQUIRE_GT(model_->getSnapshot()->getVersion(), version);
+    REQUIRE_EQ(model_->getSnapshot()->getAnalytics().getTotalSize(Side::BUY), 12);
+
+    publishAndProcess(true, createOrder(0, Side::BUY, 10, 1, EventFlag::REMOVE_EVENT.getFlag()));
+
+    REQUIRE_EQ(model_->getSnapshot()->getAnalytics().getBestPrice(Side::BUY), 9);
+}
+
+TEST_CASE_FIXTURE(MarketDepthModelTestFixture, "TestConcurrentSnapshotReaders") {
+    std::atomic<bool> done{};
+    std::atomic<bool> consistent{true};
+    std::vector<std::thread> readers{};
+
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([&] {
+            std::uint64_t lastVersion = 0;
+
+            while (!done) {
+                auto snapshot = model_->getSnapshot();
+                const auto &buy = snapshot->getBuyOrders();
+
+                if (snapshot->getVersion() < lastVersion ||
+                    !std::is_sorted(buy.begin(), buy.end(), [](const auto &o1, const auto &o2) {
+                        return o1->getPrice() > o2->getPrice();
+                    })) {
+                    consistent = false;
+                }
+
+                lastVersion = snapshot->getVersion();
+            }
+        });
+    }
+
+    for (int i = 0; i < 1000; i++) {
+        publishAndProcess(createOrder(i % 50, Side::BUY, i % 17, 1, 0));
+    }
+
+    done = true;
+
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    REQUIRE(consistent);
+    REQUIRE_EQ(model_->getSnapshot()->getBuyOrders().size(), 50);
+}
+
 TEST_CASE_FIXTURE(MarketDepthModelTestFixture, "TestStressBuySellOrders") {
     publishAndProcess(
         false, createOrder(0, Side::BUY, math::NaN, math::NaN,
@@ -0,0 +1,222 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace std::literals;
+using namespace dxfcpp;
+
+// Checks that NativeIndexedTxModel notifies its listener exactly as IndexedTxModel does for the same stream of events.
+class NativeIndexedTxModelTestFixture {
+    protected:
+    struct Notification {
+        bool isSnapshot{};
+        std::vector<std::string> events{};
+
+        bool operator==(const Notification &) const = default;
+    };
+
+    const char *symbol_ = "INDEX-TEST";
+
+    std::shared_ptr<InPlaceExecutor> executor_;
+    std::shared_ptr<DXEndpoint> endpoint_{};
+    std::shared_ptr<DXFeed> feed_{};
+    std::shared_ptr<DXPublisher> publisher_{};
+    std::shared_ptr<IndexedTxModel<Order>> model_{};
+    std::shared_ptr<NativeIndexedTxModel<Order>> nativeModel_{};
+    std::vector<Notification> notifications_{};
+    std::vector<Notification> nativeNotifications_{};
+
+    static Notification toNotification(const std::vector<std::shared_ptr<Order>> &events, bool isSnapshot) {
+        Notification notification{isSnapshot, {}};
+
+        for (const auto &e : events) {
+            notification.events.push_back(e->toString());
+        }
+
+        return notification;
+    }
+
+    void createModels(bool isBatchProcessing, bool isSnapshotProcessing) {
+        model_.reset();
+        nativeModel_.reset();
+        notifications_.clear();
+        nativeNotifications_.clear();
+
+        model_ = IndexedTxModel<Order>::newBuilder()
+                     ->withFeed(feed_)
+                     ->withBatchProcessing(isBatchProcessing)
+                     ->withSnapshotProcessing(isSnapshotProcessing)
+                     ->withSources({OrderSource::DEFAULT})
+                     ->withListener([this](const auto &, const auto &events, bool isSnapshot) {
+                         notifications_.push_back(toNotification(events, isSnapshot));
+                     })
+                     ->withSymbol(symbol_)
+                     ->build();
+
+        nativeModel_ = NativeIndexedTxModel<Order>::newBuilder()
+                           ->withFeed(feed_)
+                           ->withBatchProcessing(isBatchProcessing)
+                           ->withSnapshotProcessing(isSnapshotProcessing)
+                           ->withSources({OrderSource::DEFAULT})
+                           ->withListener([this](const auto &, const auto &events, bool isSnapshot) {
+                               nativeNotifications_.push_back(toNotification(events, isSnapshot));
+                           })
+                           ->withSymbol(symbol_)
+                           ->build();
+    }
+
+    std::shared_ptr<Order> createOrder(std::int64_t index, const Side &side, double price, double size,
+                                       std::int32_t eventFlags) {
+        return std::make_shared<Order>(symbol_)
+            ->withIndex(index)
+            .withOrderSide(side)
+            .withPrice(price)
+            .withSize(size)
+            .withEventFlags(eventFlags)
+            .sharedAs<Order>();
+    }
+
+    void publishAndProcess(const std::vector<std::shared_ptr<Order>> &orders) {
+        publisher_->publishEvents(orders);
+        executor_->processAllPendingTasks();
+    }
+
+    void checkEquivalence() {
+        REQUIRE_EQ(nativeNotifications_.size(), notifications_.size());
+
+        for (std::size_t i = 0; i < notifications_.size(); i++) {
+            REQUIRE_EQ(nativeNotifications_[i].isSnapshot, notifications_[i].isSnapshot);
+            REQUIRE_EQ(nativeNotifications_[i].events, notifications_[i].events);
+        }
+    }
+
+    public:
+    NativeIndexedTxModelTestFixture() {
+        executor_ = InPlaceExecutor::create();
+        endpoint_ = DXEndpoint::create(DXEndpoint::Role::LOCAL_HUB);
+        endpoint_->executor(executor_);
+        feed_ = endpoint_->getFeed();
+        publisher_ = endpoint_->getPublisher();
+    }
+};
+
+TEST_CASE_FIXTURE(NativeIndexedTxModelTestFixture, "TestSnapshotAndUpdates") {
+    for (auto isSnapshotProcessing : {false, true}) {
+        createModels(true, isSnapshotProcessing);
+
+        publishAndProcess({createOrder(2, Side::BUY, 3, 1, EventFlag::SNAPSHOT_BEGIN.getFlag()),
+                           createOrder(1, Side::BUY, 2, 1, 0), createOrder(1, Side::SELL, 4, 2, 0),
+                           createOrder(0, Side::BUY, 1, 1, EventFlag::SNAPSHOT_END.getFlag())});
+        publishAndProcess({createOrder(3, Side::SELL, 5, 1, 0)});
+        publishAndProcess({createOrder(2, Side::BUY, 3, 1, EventFlag::REMOVE_EVENT.getFlag())});
+
+        checkEquivalence();
+        REQUIRE_FALSE(nativeNotifications_.empty());
+    }
+}
+
+TEST_CASE_FIXTURE(NativeIndexedTxModelTestFixture, "TestRemoveInSnapshot") {
+    createModels(true, true);
+
+    publishAndProcess({createOrder(2, Side::BUY, 3, 1, EventFlag::SNAPSHOT_BEGIN.getFlag()),
+                       createOrder(1, Side::BUY, 2, 1, 0),
+                       createOrder(2, Side::BUY, 3, 1, EventFlag::REMOVE_EVENT.getFlag()),
+                       createOrder(0, Side::BUY, 1, 1, EventFlag::SNAPSHOT_END.getFlag())});
+
+    checkEquivalence();
+    REQUIRE_FALSE(nativeNotifications_.empty());
+
+    publishAndProcess(
+        {createOrder(0, Side::BUY, 1, 1,
+                     (EventFlag::SNAPSHOT_BEGIN | EventFlag::SNAPSHOT_END | EventFlag::REMOVE_EVENT).getMask())});
+
+    checkEquivalence();
+    REQUIRE(nativeNotifications_.back().isSnapshot);
+    REQUIRE(nativeNotifications_.back().events.empty());
+}
+
+TEST_CASE_FIXTURE(NativeIndexedTxModelTestFixture, "TestPendingTransactions") {
+    for (auto isBatchProcessing : {false, true}) {
+        createModels(isBatchProcessing, true);
+
+        publishAndProcess(
+            {createOrder(0, Side::BUY, 1, 1, (EventFlag::SNAPSHOT_BEGIN | EventFlag::SNAPSHOT_END).getMask())});
+        publishAndProcess({createOrder(1, Side::BUY, 2, 1, EventFlag::TX_PENDING.getFlag()),
+                           createOrder(2, Side::SELL, 3, 1, EventFlag::TX_PENDING.getFlag())});
+        // The transaction is still pending.
+        checkEquivalence();
+
+        publishAndProcess({createOrder(3, Side::SELL, 4, 1, 0), createOrder(4, Side::SELL, 5, 1, 0)});
+
+        checkEquivalence();
+        REQUIRE_FALSE(nativeNotifications_.empty());
+    }
+}
+
+TEST_CASE_FIXTURE(NativeIndexedTxModelTestFixture, "TestIncompleteSnapshotIsDelayed") {
+    createModels(true, true);
+
+    publishAndProcess({createOrder(5, Side::BUY, 1, 1, EventFlag::SNAPSHOT_BEGIN.getFlag())});
+    publishAndProcess({createOrder(4, Side::BUY, 2, 1, 0)});
+    checkEquivalence();
+
+    // A new snapshot drops the leftovers of the previous one.
+    publishAndProcess({createOrder(3, Side::SELL, 3, 1, EventFlag::SNAPSHOT_BEGIN.getFlag()),
+                       createOrder(2, Side::SELL, 4, 1, EventFlag::SNAPSHOT_END.getFlag())});
+    checkEquivalence();
+    REQUIRE_FALSE(nativeNotifications_.empty());
+}
+
+TEST_CASE_FIXTURE(NativeIndexedTxModelTestFixture, "TestCloseFromListener") {
+    for (auto isBatchProcessing : {false, true}) {
+        std::size_t notifications = 0;
+        std::shared_ptr<NativeIndexedTxModel<Order>> model{};
+
+        model = NativeIndexedTxModel<Order>::newBuilder()
+                    ->withFeed(feed_)
+                    ->withBatchProcessing(isBatchProcessing)
+                    ->withSources({OrderSource::DEFAULT})
+                    ->withListener([&](const auto &, const auto &, bool) {
+                        notifications++;
+                        model->close();
+                    })
+                    ->withSymbol(symbol_)
+                    ->build();
+
+        publishAndProcess(
+            {createOrder(0, Side::BUY, 1, 1, (EventFlag::SNAPSHOT_BEGIN | EventFlag::SNAPSHOT_END).getMask()),
+             createOrder(1, Side::BUY, 2, 1, 0), createOrder(2, Side::SELL, 3, 1, 0)});
+        publishAndProcess({createOrder(3, Side::SELL, 4, 1, 0)});
+
+        REQUIRE(notifications == 1);
+    }
+}
+
+TEST_CASE_FIXTURE(NativeIndexedTxModelTestFixture, "TestSetSourcesFromListener") {
+    std::size_t notifications = 0;
+    std::shared_ptr<NativeIndexedTxModel<Order>> model{};
+
+    model = NativeIndexedTxModel<Order>::newBuilder()
+                ->withFeed(feed_)
+                ->withBatchProcessing(false)
+                ->withSources({OrderSource::DEFAULT})
+                ->withListener([&](const auto &, const auto &, bool) {
+                    notifications++;
+                    model->setSources({OrderSource::NTV});
+                })
+                ->withSymbol(symbol_)
+                ->build();
+
+    publishAndProcess({createOrder(0, Side::BUY, 1, 1, (EventFlag::SNAPSHOT_BEGIN | EventFlag::SNAPSHOT_END).getMask()),
+                       createOrder(1, Side::BUY, 2, 1, 0)});
+
+    REQUIRE(notifications == 1);
+    REQUIRE(model->getSources() == std::unordered_set<EventSourceWrapper>{OrderSource::NTV});
+    model->close();
+}
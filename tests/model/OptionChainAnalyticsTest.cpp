@@ -0,0 +1,149 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace std::literals;
+using namespace dxfcpp;
+
+namespace {
+
+constexpr std::int32_t EXPIRATION = 20000;
+
+OptionChain<std::string> createChain() {
+    OptionChainsBuilder<std::string> builder{};
+
+    builder.setProduct("SPX");
+    builder.setExpiration(EXPIRATION);
+    builder.setSPC(100);
+
+    for (auto strike : {90, 100, 110}) {
+        builder.setStrike(strike);
+        builder.setCFI("OCXXXX");
+        builder.addOption(std::make_shared<std::string>("C" + std::to_string(strike)));
+        builder.setCFI("OPXXXX");
+        builder.addOption(std::make_shared<std::string>("P" + std::to_string(strike)));
+    }
+
+    return builder.getChains().at("SPX");
+}
+
+std::shared_ptr<EventType> createGreeks(const std::string &symbol, double volatility, double delta, double gamma) {
+    auto greeks = std::make_shared<Greeks>(symbol);
+
+    greeks->setVolatility(volatility);
+    greeks->setDelta(delta);
+    greeks->setGamma(gamma);
+
+    return greeks;
+}
+
+std::shared_ptr<EventType> createSummary(const std::string &symbol, std::int64_t openInterest) {
+    auto summary = std::make_shared<Summary>(symbol);
+
+    summary->setOpenInterest(openInterest);
+
+    return summary;
+}
+
+std::shared_ptr<EventType> createSeries(double forwardPrice, double callVolume, double putVolume) {
+    auto series = std::make_shared<Series>("SPX");
+
+    series->setExpiration(EXPIRATION);
+    series->setForwardPrice(forwardPrice);
+    series->setCallVolume(callVolume);
+    series->setPutVolume(putVolume);
+
+    return series;
+}
+
+} // namespace
+
+TEST_CASE("OptionChainAnalytics calculates the series statistics") {
+    auto chain = createChain();
+    const auto series = *chain.getSeries().begin();
+    auto analytics = OptionChainAnalytics::newBuilder()->withSeries(series, "SPX")->build();
+
+    analytics->process({createGreeks("C90", 0.30, 0.80, 0.01), createGreeks("P90", 0.32, -0.20, 0.01),
+                        createGreeks("C100", 0.20, 0.50, 0.03), createGreeks("P100", 0.22, -0.50, 0.03),
+                        createGreeks("C110", 0.18, 0.24, 0.02), createGreeks("P110", 0.19, -0.76, 0.02),
+                        createSummary("C100", 1000), createSummary("P100", 500), createSummary("P90", 1500),
+                        createSeries(105, 2000, 3000)});
+
+    auto result = analytics->getAnalytics(series);
+
+    REQUIRE(result);
+    REQUIRE(result->expiration == EXPIRATION);
+    REQUIRE(result->underlying == "SPX");
+    // The OTM volatilities: the put at 100 and the call at 110.
+    REQUIRE(result->atmVolatility == doctest::Approx(0.20));
+    REQUIRE(result->skew25Delta == doctest::Approx(0.32 - 0.18));
+    REQUIRE(result->putCallVolumeRatio == doctest::Approx(1.5));
+    REQUIRE(result->callOpenInterest == 1000);
+    REQUIRE(result->putOpenInterest == 2000);
+    REQUIRE(result->putCallOpenInterestRatio == doctest::Approx(2.0));
+    REQUIRE(result->weightedVolatility == doctest::Approx((0.20 * 1000 + 0.22 * 500 + 0.32 * 1500) / 3000));
+    REQUIRE(result->strikes == std::vector<double>{90, 100, 110});
+    REQUIRE(result->gammaExposureByStrike[0] == doctest::Approx(-0.01 * 1500 * 100));
+    REQUIRE(result->gammaExposureByStrike[1] == doctest::Approx(0.03 * 500 * 100));
+    REQUIRE(result->gammaExposure == doctest::Approx(0.03 * 500 * 100 - 0.01 * 1500 * 100));
+
+    // The updates replace the contributions of the options.
+    analytics->process({createSummary("P90", 0), createGreeks("C100", 0.25, 0.5, 0.04)});
+    result = analytics->getAnalytics(series);
+
+    REQUIRE(result->putOpenInterest == 500);
+    REQUIRE(result->weightedVolatility == doctest::Approx((0.25 * 1000 + 0.22 * 500) / 1500));
+    REQUIRE(result->gammaExposure == doctest::Approx((0.04 * 1000 - 0.03 * 500) * 100));
+    REQUIRE(!analytics->getAnalytics("unknown"));
+}
+
+TEST_CASE("OptionChainAnalytics notifies the changed series") {
+    std::vector<OptionSeriesAnalytics> notified{};
+    auto analytics = OptionChainAnalytics::newBuilder()
+                         ->withChain(createChain())
+                         ->withListener([&notified](const auto &series) {
+                             notified.insert(notified.end(), series.begin(), series.end());
+                         })
+                         ->build();
+
+    analytics->process({createGreeks("C100", 0.2, 0.5, 0.03), createGreeks("C110", 0.2, 0.3, 0.03)});
+    REQUIRE(notified.size() == 1);
+    REQUIRE(std::isnan(notified[0].forwardPrice));
+
+    // The events of the other symbols don't change the series.
+    analytics->process({createGreeks("AAPL", 0.2, 0.5, 0.03)});
+    REQUIRE(notified.size() == 1);
+}
+
+TEST_CASE("OptionChainAnalytics aggregates the notifications") {
+    std::atomic<int> notifications{};
+    auto analytics = OptionChainAnalytics::newBuilder()
+                         ->withChain(createChain())
+                         ->withAggregationPeriod(50ms)
+                         ->withListener([&notifications](const auto &) {
+                             ++notifications;
+                         })
+                         ->build();
+
+    analytics->process({createGreeks("C100", 0.2, 0.5, 0.03)});
+    analytics->process({createGreeks("C110", 0.2, 0.3, 0.03)});
+    REQUIRE(notifications == 0);
+
+    for (int i = 0; i < 200 && notifications == 0; i++) {
+        std::this_thread::sleep_for(10ms);
+    }
+
+    REQUIRE(notifications == 1);
+    analytics->close();
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <doctest.h>
+
+using namespace dxfcpp;
+
+using Model = OptionGreeksCalculator::Model;
+
+TEST_CASE("OptionGreeksCalculator calculates the Black-Scholes greeks") {
+    OptionGreeksBatch batch{};
+
+    batch.add(100, 1, NAN, 0.05, 0, true);
+    batch.add(100, 1, NAN, 0.05, 0, false);
+    batch.volatilities = {0.2, 0.2};
+    OptionGreeksCalculator::computeGreeks(Model::BLACK_SCHOLES, 100, batch);
+
+    REQUIRE(batch.theoPrices[0] == doctest::Approx(10.4506).epsilon(1e-5));
+    REQUIRE(batch.theoPrices[1] == doctest::Approx(5.5735).epsilon(1e-5));
+    REQUIRE(batch.deltas[0] == doctest::Approx(0.63683).epsilon(1e-5));
+    REQUIRE(batch.deltas[1] == doctest::Approx(-0.36317).epsilon(1e-5));
+    REQUIRE(batch.gammas[0] == doctest::Approx(0.018762).epsilon(1e-5));
+    REQUIRE(batch.gammas[1] == doctest::Approx(batch.gammas[0]));
+    REQUIRE(batch.vegas[0] == doctest::Approx(0.37524).epsilon(1e-5));
+    REQUIRE(batch.thetas[0] == doctest::Approx(-6.41403 / 365).epsilon(1e-5));
+    REQUIRE(batch.rhos[0] == doctest::Approx(0.53232).epsilon(1e-5));
+    REQUIRE(batch.rhos[1] == doctest::Approx(-0.41890).epsilon(1e-5));
+}
+
+TEST_CASE("OptionGreeksCalculator solves the implied volatilities") {
+    OptionGreeksBatch batch{};
+    const std::vector<double> volatilities = {0.05, 0.2, 0.8, 2.5};
+
+    for (auto model : {Model::BLACK_SCHOLES, Model::BLACK_76}) {
+        batch.clear();
+
+        for (auto volatility : volatilities) {
+            for (auto strike : {50.0, 95.0, 100.0, 130.0}) {
+                for (auto isCall : {true, false}) {
+                    batch.add(strike, 0.25, NAN, 0.03, 0.01, isCall);
+                    batch.volatilities.back() = volatility;
+                }
+            }
+        }
+
+        OptionGreeksCalculator::computeGreeks(model, 100, batch);
+        batch.prices = batch.theoPrices;
+        OptionGreeksCalculator::computeImpliedVolatilities(model, 100, batch);
+
+        for (std::size_t i = 0; i < batch.size(); i++) {
+            const auto expected = volatilities[i / 8];
+
+            // The prices of the far options with the low volatility are too insensitive to restore the volatility.
+            if (batch.vegas[i] > 1e-4) {
+                REQUIRE(batch.volatilities[i] == doctest::Approx(expected).epsilon(1e-6));
+            }
+        }
+    }
+
+    batch.clear();
+    // The price below the intrinsic value, the price above the underlying, the unknown price and the expired option.
+    batch.add(50, 1, 40, 0.0, 0, true);
+    batch.add(50, 1, 150, 0.0, 0, true);
+    batch.add(50, 1, NAN, 0.0, 0, true);
+    batch.add(50, 0, 51, 0.0, 0, true);
+    OptionGreeksCalculator::compute(Model::BLACK_SCHOLES, 100, batch);
+
+    for (std::size_t i = 0; i < batch.size(); i++) {
+        REQUIRE(std::isnan(batch.volatilities[i]));
+        REQUIRE(std::isnan(batch.deltas[i]));
+    }
+}
+
+TEST_CASE("OptionGreeksCalculator calculates the greeks of the option chain") {
+    OptionChainsBuilder<std::string> builder{};
+
+    builder.setProduct("ES");
+    builder.setExpiration(20000);
+    builder.setCFI("OCXXXX");
+
+    for (auto strike : {90.0, 100.0, 110.0}) {
+        builder.setStrike(strike);
+        builder.addOption(std::make_shared<std::string>("C" + std::to_string(static_cast<int>(strike))));
+    }
+
+    builder.setCFI("OPXXXX");
+    builder.setStrike(100);
+    builder.addOption(std::make_shared<std::string>("P100"));
+
+    const std::map<std::string, double> prices = {{"C90", 11.5}, {"C100", 4.0}, {"C110", 0.9}, {"P100", 3.8}};
+    const std::int64_t time = 20000LL * 24 * 3600 * 1000 - 30LL * 24 * 3600 * 1000;
+    const auto chains = CompactOptionChainsBuilder::from(builder.getChains());
+    OptionGreeksBatch batch{};
+    auto options = OptionGreeksCalculator::addChain(batch, chains.at("ES"), time, 0.04, 0.0, [&](const auto &option) {
+        return prices.at(*option);
+    });
+
+    REQUIRE(options.size() == 4);
+    REQUIRE(*options[0] == "C90");
+    REQUIRE(*options[3] == "P100");
+    REQUIRE(batch.expirations[0] == doctest::Approx(31.0 / 365));
+
+    OptionGreeksCalculator::compute(Model::BLACK_76, 100, batch);
+
+    for (std::size_t i = 0; i < batch.size(); i++) {
+        REQUIRE(batch.theoPrices[i] == doctest::Approx(batch.prices[i]).epsilon(1e-8));
+    }
+
+    auto greeks = OptionGreeksCalculator::toGreeks(batch, 1, *options[1], time);
+
+    REQUIRE(greeks->getEventSymbol() == "C100");
+    REQUIRE(greeks->getTime() == time);
+    REQUIRE(greeks->getPrice() == 4.0);
+    REQUIRE(greeks->getVolatility() == batch.volatilities[1]);
+    REQUIRE(greeks->getDelta() == batch.deltas[1]);
+    REQUIRE(greeks->getVega() > 0);
+}
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#include <doctest.h>
+#include <dxfeed_graal_cpp_api/api.hpp>
+
+#include <vector>
+
+using namespace std::literals;
+using namespace dxfcpp;
+
+namespace {
+
+std::shared_ptr<TimeAndSale> createTimeAndSale(std::int64_t time, double price, std::int32_t eventFlags = 0) {
+    auto tns = std::make_shared<TimeAndSale>("AAPL");
+
+    tns->setTime(time);
+    tns->setPrice(price);
+    tns->setSize(1);
+    tns->setEventFlags(eventFlags);
+
+    return tns;
+}
+
+std::vector<std::int64_t> times(const std::vector<TimeAndSaleRecord> &records) {
+    std::vector<std::int64_t> result{};
+
+    for (const auto &r : records) {
+        result.push_back(r.time);
+    }
+
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("TimeSeriesStore keeps the records sorted and evicts the oldest ones") {
+    auto store = TimeSeriesStore<TimeAndSale>::create(4);
+
+    REQUIRE(store->empty());
+    REQUIRE_EQ(store->capacity(), 4);
+
+    // A snapshot is delivered from the newest event to the oldest one.
+    store->update({createTimeAndSale(3000, 3), createTimeAndSale(2000, 2), createTimeAndSale(1000, 1)}, true);
+
+    REQUIRE_EQ(store->size(), 3);
+    REQUIRE_EQ(times(store->getRange(0, 10000)), std::vector<std::int64_t>{1000, 2000, 3000});
+
+    // Updates of the existing records and the insertions in the middle.
+    store->update({createTimeAndSale(2000, 22), createTimeAndSale(1500, 15)}, false);
+
+    REQUIRE_EQ(store->size(), 4);
+    REQUIRE_EQ(times(store->getRange(0, 10000)), std::vector<std::int64_t>{1000, 1500, 2000, 3000});
+    REQUIRE_EQ(store->findByIndex(createTimeAndSale(2000, 0)->getIndex())->price, 22);
+
+    // The store is full: the oldest records are evicted, the records that are older than all the others are dropped.
+    store->update({createTimeAndSale(4000, 4), createTimeAndSale(500, 0.5), createTimeAndSale(5000, 5)}, false);
+
+    REQUIRE_EQ(store->size(), 4);
+    REQUIRE_EQ(times(store->getRange(0, 10000)), std::vector<std::int64_t>{2000, 3000, 4000, 5000});
+    REQUIRE_EQ(store->getFirst()->time, 2000);
+    REQUIRE_EQ(store->getLast()->price, 5);
+}
+
+TEST_CASE("TimeSeriesStore removes the records and replaces the content by a snapshot") {
+    auto store = TimeSeriesStore<TimeAndSale>::create(16);
+
+    std::vector<std::shared_ptr<TimeAndSale>> events{};
+
+    for (std::int64_t t = 10; t >= 1; t--) {
+        events.push_back(createTimeAndSale(t * 1000, static_cast<double>(t)));
+    }
+
+    store->update(events, true);
+    store->update({createTimeAndSale(5000, 0, EventFlag::REMOVE_EVENT.getFlag()),
+                   createTimeAndSale(1000, 0, EventFlag::REMOVE_EVENT.getFlag()),
+                   createTimeAndSale(10000, 0, EventFlag::REMOVE_EVENT.getFlag()),
+                   createTimeAndSale(777, 0, EventFlag::REMOVE_EVENT.getFlag())},
+                  false);
+
+    REQUIRE_EQ(times(store->getRange(0, 100000)),
+               std::vector<std::int64_t>{2000, 3000, 4000, 6000, 7000, 8000, 9000});
+    REQUIRE_EQ(times(store->getRange(3000, 6000)), std::vector<std::int64_t>{3000, 4000, 6000});
+    REQUIRE_EQ(times(store->getRange(3001, 5999)), std::vector<std::int64_t>{4000});
+    REQUIRE(store->getRange(6000, 3000).empty());
+
+    {
+        auto window = store->getLastWindow(2s);
+
+        REQUIRE_EQ(window.size(), 3);
+        REQUIRE_EQ(window[0].time, 7000);
+        REQUIRE_EQ((window.end() - 1)->time, 9000);
+    }
+
+    double sum = 0;
+
+    store->forEach(2000, 4000, [&sum](const auto &r) {
+        sum += r.price;
+    });
+
+    REQUIRE_EQ(sum, 9);
+
+    store->update({createTimeAndSale(20000, 20)}, true);
+
+    REQUIRE_EQ(times(store->getRange(0, 100000)), std::vector<std::int64_t>{20000});
+
+    store->clear();
+
+    REQUIRE(store->empty());
+    REQUIRE_FALSE(store->getLast().has_value());
+}
+
+TEST_CASE("TimeSeriesStore stores the candles") {
+    auto store = TimeSeriesStore<Candle>::create(8);
+    auto listener = store->createListener();
+
+    REQUIRE(listener);
+
+    auto candle = std::make_shared<Candle>(CandleSymbol::valueOf("AAPL{=d}"));
+
+    candle->setTime(1000);
+    candle->setClose(10);
+    store->update({candle}, true);
+
+    REQUIRE_EQ(store->getLast()->close, 10);
+}
@@ -192,4 +192,162 @@ TEST_CASE("Test hd sets and days intersect with wrong syntax") {
     REQUIRE_FALSE_MESSAGE(gmt(def)->getDayByYearMonthDay(20210524)->isHoliday(), "CA Holiday");
     REQUIRE_FALSE_MESSAGE(gmt(def)->getDayByYearMonthDay(20210215)->isHoliday(), "US and CA Holiday");
     REQUIRE_MESSAGE(gmt(def)->getDayByYearMonthDay(20210101)->isHoliday(), "Only one remain holiday");
-}
\ No newline at end of file
+}
+
+TEST_CASE("Test session timeline") {
+    auto schedule = gmt("hd=US;0=p04000930r09301600a16002000;td=12345");
+    const auto &timeline = schedule->getSessionTimeline();
+    const auto start = schedule->getDayByYearMonthDay(20210104)->getStartTime();
+
+    auto checkTime = [&](std::int64_t time) {
+        auto session = schedule->getSessionByTime(time);
+        auto day = schedule->getDayByTime(time);
+        auto sessionInfo = timeline.getSessionByTime(time);
+        auto dayInfo = timeline.getDayByTime(time);
+
+        REQUIRE(sessionInfo.startTime == session->getStartTime());
+        REQUIRE(sessionInfo.endTime == session->getEndTime());
+        REQUIRE(sessionInfo.getType() == session->getType());
+        REQUIRE(sessionInfo.isTrading() == session->isTrading());
+        REQUIRE(timeline.isTrading(time) == session->isTrading());
+        REQUIRE(sessionInfo.dayId == day->getDayId());
+        REQUIRE(dayInfo.dayId == day->getDayId());
+        REQUIRE(dayInfo.yearMonthDay == day->getYearMonthDay());
+        REQUIRE(dayInfo.startTime == day->getStartTime());
+        REQUIRE(dayInfo.endTime == day->getEndTime());
+        REQUIRE(dayInfo.isHoliday() == day->isHoliday());
+        REQUIRE(dayInfo.isTrading() == day->isTrading());
+    };
+
+    // Forward, with the holiday of 2021-01-18 and the weekends.
+    for (std::int64_t time = start; time < start + 40 * time_util::DAY; time += 37 * time_util::MINUTE) {
+        checkTime(time);
+    }
+
+    // Backward, the distant time and the session borders.
+    checkTime(start - 3 * time_util::DAY);
+    checkTime(start + 1000 * time_util::DAY);
+    checkTime(start - 1);
+    checkTime(start);
+
+    REQUIRE(timeline.getDayCount() <= SessionTimeline::MAX_DAYS);
+    REQUIRE(timeline.getSessionByTime(start + 9 * time_util::HOUR + 30 * time_util::MINUTE).getType() ==
+            SessionType::REGULAR);
+}
+
+TEST_CASE("Test session timeline classification") {
+    auto schedule = gmt("hd=US;0=p04000930r09301600a16002000;td=12345");
+    const auto &timeline = schedule->getSessionTimeline();
+    const auto start = schedule->getDayByYearMonthDay(20210104)->getStartTime();
+    std::vector<std::int64_t> times{};
+
+    // More than two chunks over a year.
+    for (std::int64_t time = start; times.size() < 2 * SessionTimeline::CLASSIFY_CHUNK_SIZE + 100;
+         time += 4 * time_util::MINUTE + 7) {
+        times.push_back(time);
+    }
+
+    std::vector<SessionTypeEnum> types(times.size());
+    std::vector<std::int32_t> dayIds(times.size());
+    std::size_t expectedAccepted = 0;
+
+    auto accepted = timeline.classify(times, SessionFilter::TRADING, types, dayIds, 4);
+
+    for (std::size_t i = 0; i < times.size(); i++) {
+        auto session = timeline.getSessionByTime(times[i]);
+
+        REQUIRE(types[i] == session.type);
+        REQUIRE(dayIds[i] == (session.isTrading() ? session.dayId : SessionTimeline::REJECTED_DAY_ID));
+        expectedAccepted += session.isTrading() ? 1 : 0;
+    }
+
+    REQUIRE(accepted == expectedAccepted);
+
+    // The unsorted times.
+    std::vector<std::size_t> permutation(times.size());
+    std::vector<std::int64_t> shuffledTimes(times.size());
+    std::vector<SessionTypeEnum> shuffledTypes(times.size());
+    std::vector<std::int32_t> shuffledDayIds(times.size());
+
+    for (std::size_t i = 0; i < times.size(); i++) {
+        permutation[i] = (i * 7919) % times.size();
+        shuffledTimes[i] = times[permutation[i]];
+    }
+
+    REQUIRE(timeline.classify(shuffledTimes, SessionFilter::TRADING, shuffledTypes, shuffledDayIds, 4) ==
+            expectedAccepted);
+
+    for (std::size_t i = 0; i < times.size(); i++) {
+        REQUIRE(shuffledTypes[i] == types[permutation[i]]);
+        REQUIRE(shuffledDayIds[i] == dayIds[permutation[i]]);
+    }
+
+    REQUIRE_THROWS_AS(timeline.classify(times, SessionFilter::ANY, std::span(types).first(1), dayIds),
+                      InvalidArgumentException);
+}
+
+TEST_CASE("Test schedule cache") {
+    const std::string def = "(tz=GMT;0=08001800;td=1234567)";
+
+    ScheduleCache::clear();
+    ScheduleCache::resetStats();
+
+    auto schedule = ScheduleCache::getInstance(def);
+    auto profile = InstrumentProfile::create();
+    InstrumentProfileData data{};
+
+    profile->setTradingHours(def);
+    data.tradingHours = def;
+
+    REQUIRE(schedule == ScheduleCache::getInstance(" " + def + "\n"));
+    REQUIRE(schedule == ScheduleCache::getInstance(profile));
+    REQUIRE(schedule == ScheduleCache::getInstance(data));
+    REQUIRE(schedule->getName() == Schedule::getInstance(def)->getName());
+    REQUIRE(schedule->getDayById(42)->getStartTime() == Schedule::getInstance(def)->getDayById(42)->getStartTime());
+
+    auto stats = ScheduleCache::getStats();
+
+    REQUIRE(stats.misses == 1);
+    REQUIRE(stats.hits == 3);
+    REQUIRE(stats.size == 1);
+
+    ScheduleCache::clear();
+
+    REQUIRE(ScheduleCache::getStats().size == 0);
+    REQUIRE(schedule != ScheduleCache::getInstance(def));
+}
+
+TEST_CASE("Test schedule cache returns the same instance to the concurrent lookups") {
+    const std::string def = "(tz=GMT;0=09001700;td=12345)";
+    std::vector<std::shared_ptr<Schedule>> schedules(8);
+    std::vector<std::thread> threads{};
+
+    ScheduleCache::clear();
+
+    for (std::size_t i = 0; i < schedules.size(); i++) {
+        threads.emplace_back([&schedules, &def, i] {
+            schedules[i] = ScheduleCache::getInstance(def);
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (const auto &schedule : schedules) {
+        REQUIRE(schedule == ScheduleCache::getInstance(def));
+    }
+
+    REQUIRE(ScheduleCache::getStats().size == 1);
+}
+
+TEST_CASE("Test schedule cache doesn't cache the invalid definitions") {
+    const std::string def = "(tz=GMT;0=abc)";
+
+    ScheduleCache::clear();
+
+    REQUIRE_THROWS(ScheduleCache::getInstance(def));
+    REQUIRE_THROWS(ScheduleCache::getInstance(def));
+    REQUIRE_THROWS(ScheduleCache::getInstance(def, "XNYS"));
+    REQUIRE(ScheduleCache::getStats().size == 0);
+}
@@ -33,6 +33,20 @@ const std::string TapeArg::HELP_TEXT{R"(
 Tape all incoming data into the specified file (see "Help Tape").
 )"};
 
+const std::string FormatArg::NAME{"format"};
+const std::string FormatArg::SHORT_NAME{};
+const std::string FormatArg::LONG_NAME{"format"};
+const std::string FormatArg::HELP_TEXT{R"(
+The format of the printed events: text (the default), csv, json (the JSON lines) or binary.
+)"};
+
+const std::string OutputArg::NAME{"output"};
+const std::string OutputArg::SHORT_NAME{"o"};
+const std::string OutputArg::LONG_NAME{"output"};
+const std::string OutputArg::HELP_TEXT{R"(
+Print the events into the specified file instead of the standard output.
+)"};
+
 const std::string QuiteArg::NAME{"quite"};
 const std::string QuiteArg::SHORT_NAME{"q"};
 const std::string QuiteArg::LONG_NAME{"quite"};
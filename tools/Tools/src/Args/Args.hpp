@@ -484,6 +484,64 @@ struct TapeArg : NamedArg {
     }
 };
 
+struct FormatArg : NamedArg {
+    const static std::string NAME;
+    const static std::string SHORT_NAME;
+    const static std::string LONG_NAME;
+    const static std::string HELP_TEXT;
+
+    [[nodiscard]] static std::string prepareHelp(std::size_t namePadding,
+                                                 std::size_t nameFieldSize /* padding + name + padding */,
+                                                 std::size_t windowSize) noexcept {
+        return Arg::prepareHelp<FormatArg>(namePadding, nameFieldSize, windowSize);
+    }
+
+    [[nodiscard]] static std::string getFullName() noexcept {
+        return NamedArg::getFullName<FormatArg>();
+    }
+
+    [[nodiscard]] static std::string getFullHelpText() noexcept {
+        return trimStr(HELP_TEXT);
+    }
+
+    static bool canParse(const std::vector<std::string> &args, std::size_t index) {
+        return NamedArg::canParse<FormatArg>(args, index);
+    }
+
+    static ParseResult<std::optional<std::string>> parse(const std::vector<std::string> &args, std::size_t index) {
+        return NamedArg::parse<FormatArg>(args, index);
+    }
+};
+
+struct OutputArg : NamedArg {
+    const static std::string NAME;
+    const static std::string SHORT_NAME;
+    const static std::string LONG_NAME;
+    const static std::string HELP_TEXT;
+
+    [[nodiscard]] static std::string prepareHelp(std::size_t namePadding,
+                                                 std::size_t nameFieldSize /* padding + name + padding */,
+                                                 std::size_t windowSize) noexcept {
+        return Arg::prepareHelp<OutputArg>(namePadding, nameFieldSize, windowSize);
+    }
+
+    [[nodiscard]] static std::string getFullName() noexcept {
+        return NamedArg::getFullName<OutputArg>();
+    }
+
+    [[nodiscard]] static std::string getFullHelpText() noexcept {
+        return trimStr(HELP_TEXT);
+    }
+
+    static bool canParse(const std::vector<std::string> &args, std::size_t index) {
+        return NamedArg::canParse<OutputArg>(args, index);
+    }
+
+    static ParseResult<std::optional<std::string>> parse(const std::vector<std::string> &args, std::size_t index) {
+        return NamedArg::parse<OutputArg>(args, index);
+    }
+};
+
 struct QuiteArg : FlagArg {
     const static std::string NAME;
     const static std::string SHORT_NAME;
@@ -701,8 +759,8 @@ Represents the arguments passed to the qds-tools.
 using ArgType =
     std::variant<tools::AddressArg<>, tools::AddressArgRequired<>, tools::TypesArg<>, tools::TypesArgRequired<>,
                  tools::SymbolsArg<>, tools::SymbolsArgRequired<>, tools::SymbolsArgRequired<1>, tools::PropertiesArg,
-                 tools::FromTimeArg, tools::SourceArg, tools::TapeArg, tools::QuiteArg, tools::ForceStreamArg,
-                 tools::CPUUsageByCoreArg, tools::DetachListenerArg, tools::IntervalArg, tools::HelpArg,
-                 tools::ArticleArgRequired<>, QdsArgs<>>;
+                 tools::FromTimeArg, tools::SourceArg, tools::TapeArg, tools::FormatArg, tools::OutputArg,
+                 tools::QuiteArg, tools::ForceStreamArg, tools::CPUUsageByCoreArg, tools::DetachListenerArg,
+                 tools::IntervalArg, tools::HelpArg, tools::ArticleArgRequired<>, QdsArgs<>>;
 
 } // namespace dxfcpp::tools
\ No newline at end of file
@@ -51,6 +51,8 @@ struct DumpTool {
         std::optional<std::string> symbols;
         std::optional<std::string> properties;
         std::optional<std::string> tape;
+        std::optional<std::string> format;
+        std::optional<std::string> output;
         bool isQuite;
 
         static ParseResult<Args> parse(const std::vector<std::string> &args) noexcept {
@@ -95,6 +97,10 @@ struct DumpTool {
             std::optional<std::string> properties{};
             bool tapeIsParsed{};
             std::optional<std::string> tape{};
+            bool formatIsParsed{};
+            std::optional<std::string> format{};
+            bool outputIsParsed{};
+            std::optional<std::string> output{};
             bool isQuite{};
 
             for (; index < args.size();) {
@@ -110,6 +116,18 @@ struct DumpTool {
                     tape = parseResult.result;
                     tapeIsParsed = true;
                     index = parseResult.nextIndex;
+                } else if (!formatIsParsed && FormatArg::canParse(args, index)) {
+                    auto parseResult = FormatArg::parse(args, index);
+
+                    format = parseResult.result;
+                    formatIsParsed = true;
+                    index = parseResult.nextIndex;
+                } else if (!outputIsParsed && OutputArg::canParse(args, index)) {
+                    auto parseResult = OutputArg::parse(args, index);
+
+                    output = parseResult.result;
+                    outputIsParsed = true;
+                    index = parseResult.nextIndex;
                 } else {
                     // ReSharper disable once CppUsingResultOfAssignmentAsCondition
                     if (!isQuite && (isQuite = QuiteArg::parse(args, index).result)) {
@@ -121,7 +139,8 @@ struct DumpTool {
                 }
             }
 
-            return ParseResult<Args>::ok({parsedAddress.result, types, symbols, properties, tape, isQuite});
+            return ParseResult<Args>::ok(
+                {parsedAddress.result, types, symbols, properties, tape, format, output, isQuite});
         }
     };
 
@@ -158,14 +177,15 @@ struct DumpTool {
                     ->build();
 
             auto sub = inputEndpoint->getFeed()->createSubscription(parsedTypes);
+            std::shared_ptr<EventWriter> writer{};
 
             if (!args.isQuite) {
-                sub->addEventListener([](auto &&events) {
-                    for (auto &&e : events) {
-                        std::cout << e << "\n";
-                    }
+                writer = EventWriter::create(args.format ? EventWriter::parseFormat(*args.format)
+                                                         : EventWriter::Format::TEXT,
+                                             args.output.value_or("-"));
 
-                    std::cout.flush();
+                sub->addEventListener([writer](auto &&events) {
+                    writer->write(events);
                 });
             }
 
@@ -194,6 +214,10 @@ struct DumpTool {
             inputEndpoint->awaitNotConnected();
             inputEndpoint->closeAndAwaitTermination();
 
+            if (writer) {
+                writer->close();
+            }
+
             if (outputEndpoint.has_value()) {
                 outputEndpoint.value()->awaitProcessed();
                 outputEndpoint.value()->closeAndAwaitTermination();
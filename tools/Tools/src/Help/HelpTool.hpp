@@ -11,6 +11,7 @@
 #include "../PerfTest/PerfTestTool.hpp"
 #include "../PerfTest2/PerfTest2Tool.hpp"
 #include "../Qds/QdsTool.hpp"
+#include "../ReplayBench/ReplayBenchTool.hpp"
 #include <chrono>
 #include <fmt/format.h>
 #include <set>
@@ -32,7 +33,7 @@ namespace dxfcpp::tools {
 
 struct HelpTool {
     using Tool = std::variant<ConnectTool, DumpTool, HelpTool, LatencyTest,
-                              PerfTestTool, PerfTest2Tool, QdsTool, EventGenTool>;
+                              PerfTestTool, PerfTest2Tool, QdsTool, EventGenTool, ReplayBenchTool>;
 
     static const std::unordered_map<std::string, std::string> EMBEDDED_ARTICLES;
     static const std::string NAME;
@@ -0,0 +1,551 @@
+// Copyright (c) 2025 Devexperts LLC.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../../../../include/dxfeed_graal_cpp_api/event/EventArchive.hpp"
+#include "../../../../include/dxfeed_graal_cpp_api/internal/Platform.hpp"
+#include "../../../../include/dxfeed_graal_cpp_api/model/MarketByOrderBook.hpp"
+#include "../Args/Args.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fmt/format.h>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace dxfcpp::tools {
+
+struct ReplayBenchTool {
+    static inline auto BATCH_SIZE_PROPERTY_NAME = "ReplayBench.batchSize";
+    static inline auto ITERATIONS_PROPERTY_NAME = "ReplayBench.iterations";
+    static inline auto FORMAT_NAME = "ReplayBench.format"; // csv, normal
+    static inline auto ARCHIVE_PREFIX = "archive:";
+    static inline auto ARCHIVE_EXTENSION = ".dxea";
+    static const std::string NAME;
+    static const std::string SHORT_DESCRIPTION;
+    static const std::string DESCRIPTION;
+    static const std::vector<std::string> USAGE;
+    static const std::vector<std::string> ADDITIONAL_INFO;
+    static const std::vector<ArgType> ARGS;
+
+    [[nodiscard]] static std::string getName() noexcept {
+        return NAME;
+    }
+
+    [[nodiscard]] static std::string getFullName() noexcept {
+        return NAME;
+    }
+
+    [[nodiscard]] static std::string prepareHelp(std::size_t namePadding,
+                                                 std::size_t nameFieldSize /* padding + name + padding */,
+                                                 std::size_t) noexcept {
+        return fmt::format("{:{}}{:<{}}{:{}}{}\n", "", namePadding, getFullName(), nameFieldSize - 2 * namePadding, "",
+                           namePadding, SHORT_DESCRIPTION);
+    }
+
+    /**
+     * The results of one replay.
+     *
+     * The archive events are published into a LOCAL_HUB, which conflates the ticker types (Quote, Trade, ...), so the
+     * number of the received events depends on the timing and can be less than the number of the published ones.
+     */
+    struct Result final {
+        std::size_t publishedEvents{};
+        std::size_t events{};
+        std::size_t listenerCalls{};
+        std::chrono::nanoseconds wallTime{};
+        std::chrono::nanoseconds decodeTime{};
+        std::chrono::nanoseconds publishTime{};
+        std::chrono::nanoseconds listenerTime{};
+        std::chrono::nanoseconds modelTime{};
+        // The totals of the library metrics (DXFCXX_ENABLE_METRICS): the C++ part of the Graal callback and its stages.
+        std::optional<std::chrono::nanoseconds> callbackTime{};
+        std::optional<std::chrono::nanoseconds> fromGraalListTime{};
+        std::optional<std::chrono::nanoseconds> handlerTime{};
+        std::map<std::string, std::size_t> eventsByType{};
+        std::size_t orders{};
+    };
+
+    /**
+     * The sink of the replayed events: counts them by type and applies the orders to the per-symbol order books,
+     * timing the listener and the model updates.
+     */
+    struct Pipeline final {
+        private:
+        std::mutex mtx_{};
+        Result result_{};
+        std::unordered_map<std::string, MarketByOrderBook<OrderBase>> books_{};
+
+        public:
+        void onEvents(const std::string &typeName, bool isOrder,
+                      const std::vector<std::shared_ptr<EventType>> &events) {
+            const auto start = std::chrono::steady_clock::now();
+
+            std::lock_guard lock{mtx_};
+
+            result_.events += events.size();
+            result_.listenerCalls++;
+            result_.eventsByType[typeName] += events.size();
+
+            if (isOrder) {
+                const auto modelStart = std::chrono::steady_clock::now();
+
+                for (const auto &e : events) {
+                    const auto order = std::static_pointer_cast<OrderBase>(e);
+
+                    books_[order->getEventSymbol()].upsert(order);
+                }
+
+                result_.modelTime += std::chrono::steady_clock::now() - modelStart;
+            }
+
+            result_.listenerTime += std::chrono::steady_clock::now() - start;
+        }
+
+        Result getResult() {
+            std::lock_guard lock{mtx_};
+            auto result = result_;
+
+            for (const auto &[_, book] : books_) {
+                result.orders += book.size();
+            }
+
+            return result;
+        }
+    };
+
+    struct Args {
+        std::string address{};
+        std::optional<std::string> types{};
+        std::optional<std::string> symbols{};
+        std::optional<std::string> properties{};
+
+        static ParseResult<Args> parse(const std::vector<std::string> &args) noexcept {
+            std::size_t index = 0;
+
+            if (HelpArg::parse(args, index).result) {
+                return ParseResult<Args>::help();
+            }
+
+            auto parsedAddress = AddressArgRequired<>::parse(args);
+
+            if (parsedAddress.isError) {
+                return ParseResult<Args>::error(parsedAddress.errorString);
+            }
+
+            index++;
+
+            std::optional<std::string> types{};
+            std::optional<std::string> symbols{};
+
+            if (args.size() > index && !args[index].starts_with('-')) {
+                auto parsedTypes = TypesArg<>::parse(args);
+
+                if (parsedTypes.result.has_value()) {
+                    index++;
+                }
+
+                auto parsedSymbols = SymbolsArg<>::parse(args);
+
+                if (parsedSymbols.result.has_value()) {
+                    index++;
+                }
+
+                types = parsedTypes.result;
+                symbols = parsedSymbols.result;
+            }
+
+            bool propertiesIsParsed{};
+            std::optional<std::string> properties{};
+
+            while (index < args.size()) {
+                if (!propertiesIsParsed && PropertiesArg::canParse(args, index)) {
+                    auto parseResult = PropertiesArg::parse(args, index);
+
+                    properties = parseResult.result;
+                    propertiesIsParsed = true;
+                    index = parseResult.nextIndex;
+                } else {
+                    index++;
+                }
+            }
+
+            return ParseResult<Args>::ok({parsedAddress.result, types, symbols, properties});
+        }
+    };
+
+    static bool isArchive(const std::string &address) noexcept {
+        return address.starts_with(ARCHIVE_PREFIX) || address.ends_with(ARCHIVE_EXTENSION);
+    }
+
+    static bool isOrder(const EventTypeEnum &type) noexcept {
+        return type == EventTypeEnum::ORDER || type == EventTypeEnum::ANALYTIC_ORDER ||
+               type == EventTypeEnum::OTC_MARKETS_ORDER || type == EventTypeEnum::SPREAD_ORDER;
+    }
+
+    /// Returns the properties of the address (the bracketed groups at its end: `file:path[name=value,name]`).
+    static std::unordered_map<std::string, std::string> getAddressProperties(const std::string &address) {
+        std::unordered_map<std::string, std::string> result{};
+        auto end = address.size();
+
+        while (end > 0 && address[end - 1] == ']') {
+            const auto begin = address.rfind('[', end - 1);
+
+            if (begin == std::string::npos) {
+                break;
+            }
+
+            for (const auto &property : splitStr(address.substr(begin + 1, end - begin - 2))) {
+                const auto separator = property.find('=');
+
+                result[trimStr(property.substr(0, separator))] =
+                    separator == std::string::npos ? "" : trimStr(property.substr(separator + 1));
+            }
+
+            end = begin;
+        }
+
+        return result;
+    }
+
+    /// Returns the address of the tape that is read once at the maximum speed.
+    static std::string getTapeAddress(const std::string &address) {
+        const auto properties = getAddressProperties(address);
+
+        if (const auto cycle = properties.find("cycle"); cycle != properties.end() && cycle->second != "false") {
+            throw InvalidArgumentException(
+                fmt::format("The cyclic replay of the tape can't be measured: {}", address));
+        }
+
+        auto result = address.starts_with("file:") ? address : "file:" + address;
+
+        if (!properties.contains("speed")) {
+            result += "[speed=max]";
+        }
+
+        return result;
+    }
+
+    static std::vector<std::reference_wrapper<const EventTypeEnum>>
+    sortTypes(const std::unordered_set<std::reference_wrapper<const EventTypeEnum>> &types) {
+        std::vector<std::reference_wrapper<const EventTypeEnum>> result(types.begin(), types.end());
+
+        std::sort(result.begin(), result.end(), [](const auto &a, const auto &b) {
+            return a.get().getId() < b.get().getId();
+        });
+
+        return result;
+    }
+
+    /// Decodes the events of the archive once, in the order of the type, the symbol and the time.
+    static std::vector<std::shared_ptr<EventType>>
+    decode(const std::string &path, const std::vector<std::reference_wrapper<const EventTypeEnum>> &types,
+           const std::unordered_set<SymbolWrapper> &symbols) {
+        auto reader = EventArchiveReader::open(path);
+        std::set<std::string> names{};
+        bool isWildcard = false;
+
+        for (const auto &symbol : symbols) {
+            if (symbol.isWildcardSymbol()) {
+                isWildcard = true;
+            } else if (symbol.isStringSymbol()) {
+                names.insert(symbol.asStringSymbol());
+            }
+        }
+
+        std::vector<std::shared_ptr<EventType>> result{};
+
+        for (const auto &type : types) {
+            if (isWildcard) {
+                auto events = reader->read(type.get());
+
+                result.insert(result.end(), events.begin(), events.end());
+
+                continue;
+            }
+
+            for (const auto &name : names) {
+                auto events = reader->read(type.get(), name);
+
+                result.insert(result.end(), events.begin(), events.end());
+            }
+        }
+
+        return result;
+    }
+
+    static std::optional<std::chrono::nanoseconds> getMetricTotal(const std::string &name) {
+#if defined(DXFCXX_ENABLE_METRICS)
+        const auto stats = ApiContext::getInstance()->getManager<MetricsManager>()->getAsI64(name);
+
+        return std::chrono::nanoseconds(static_cast<std::int64_t>(static_cast<double>(stats.avgValue) *
+                                                                  static_cast<double>(stats.count)));
+#else
+        ignoreUnused(name);
+
+        return std::nullopt;
+#endif
+    }
+
+    static std::optional<std::chrono::nanoseconds> diff(const std::optional<std::chrono::nanoseconds> &after,
+                                                        const std::optional<std::chrono::nanoseconds> &before) {
+        if (!after || !before) {
+            return std::nullopt;
+        }
+
+        return *after - *before;
+    }
+
+    static Result replay(const Args &args, const std::unordered_map<std::string, std::string> &properties,
+                         const std::vector<std::reference_wrapper<const EventTypeEnum>> &types,
+                         const std::unordered_set<SymbolWrapper> &symbols,
+                         const std::vector<std::shared_ptr<EventType>> &events, std::size_t batchSize) {
+        const bool fromArchive = isArchive(args.address);
+        const auto callbackBefore = getMetricTotal("DXFCXX.Sub.onEvents.total.Batch(ns)");
+        const auto fromGraalListBefore = getMetricTotal("DXFCXX.Sub.onEvents.fromGraalList.Batch(ns)");
+        const auto handlerBefore = getMetricTotal("DXFCXX.Sub.onEvents.handler.Batch(ns)");
+
+        auto endpoint =
+            DXEndpoint::newBuilder()
+                ->withRole(fromArchive ? DXEndpoint::Role::LOCAL_HUB : DXEndpoint::Role::STREAM_FEED)
+                ->withProperty(DXEndpoint::DXFEED_WILDCARD_ENABLE_PROPERTY, "true") // Enabled by default.
+                ->withProperties(properties)
+                ->withName(NAME + "Tool-Feed")
+                ->build();
+
+        auto pipeline = std::make_shared<Pipeline>();
+        std::vector<std::shared_ptr<DXFeedSubscription>> subscriptions{};
+
+        // One subscription per type, so the listeners know the type of the events without inspecting them.
+        for (const auto &type : types) {
+            auto sub = endpoint->getFeed()->createSubscription(type.get());
+
+            sub->addEventListener([pipeline, name = type.get().getName(), order = isOrder(type.get())](
+                                      const std::vector<std::shared_ptr<EventType>> &e) {
+                pipeline->onEvents(name, order, e);
+            });
+            sub->addSymbols(symbols);
+            subscriptions.push_back(sub);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        std::chrono::nanoseconds publishTime{};
+
+        if (fromArchive) {
+            const auto publisher = endpoint->getPublisher();
+
+            for (std::size_t i = 0; i < events.size(); i += batchSize) {
+                const auto publishStart = std::chrono::steady_clock::now();
+
+                publisher->publishEvents(events.begin() + static_cast<std::ptrdiff_t>(i),
+                                         events.begin() + static_cast<std::ptrdiff_t>(
+                                                              std::min(i + batchSize, events.size())));
+                publishTime += std::chrono::steady_clock::now() - publishStart;
+            }
+
+            endpoint->awaitProcessed();
+        } else {
+            endpoint->connect(getTapeAddress(args.address));
+            endpoint->awaitNotConnected();
+        }
+
+        endpoint->closeAndAwaitTermination();
+
+        auto result = pipeline->getResult();
+
+        result.wallTime = std::chrono::steady_clock::now() - start;
+        result.publishedEvents = fromArchive ? events.size() : 0;
+        result.publishTime = publishTime;
+        result.callbackTime = diff(getMetricTotal("DXFCXX.Sub.onEvents.total.Batch(ns)"), callbackBefore);
+        result.fromGraalListTime =
+            diff(getMetricTotal("DXFCXX.Sub.onEvents.fromGraalList.Batch(ns)"), fromGraalListBefore);
+        result.handlerTime = diff(getMetricTotal("DXFCXX.Sub.onEvents.handler.Batch(ns)"), handlerBefore);
+
+        return result;
+    }
+
+    static std::string formatMillis(const std::optional<std::chrono::nanoseconds> &time) noexcept {
+        return time ? fmt::format("{:.3f}", static_cast<double>(time->count()) / 1'000'000.0) : "";
+    }
+
+    static std::string formatStage(const std::string &name, const std::optional<std::chrono::nanoseconds> &time,
+                                   std::size_t events) noexcept {
+        if (!time) {
+            return fmt::format("  {:<30} : n/a (build with DXFCXX_ENABLE_METRICS)\n", name);
+        }
+
+        return fmt::format("  {:<30} : {:>12} (ms) {:>10.1f} (ns/event)\n", name, formatMillis(time),
+                           events == 0 ? 0.0 : static_cast<double>(time->count()) / static_cast<double>(events));
+    }
+
+    static std::string getCsvHeader() {
+        return "Version,Mode,Iteration,Published events,Events,Conflated events,Listener calls,Wall time [ms],Rate "
+               "[events/s],Decode [ms],Publish [ms],Graal callback [ms],fromGraalList [ms],Handler [ms],Listener "
+               "[ms],Model updates [ms],Orders";
+    }
+
+    /// The number of the published archive events that the hub conflated and did not deliver to the listeners.
+    static std::size_t getConflatedEvents(const Result &result) noexcept {
+        return result.publishedEvents > result.events ? result.publishedEvents - result.events : 0;
+    }
+
+    /**
+     * The rate of the archive replay is the rate of the published events: the delivered ones depend on the
+     * conflation and therefore on the timing. The rate of the tape replay is the rate of the received events.
+     */
+    static double getRate(const Result &result, bool fromArchive) noexcept {
+        const auto events = fromArchive ? result.publishedEvents : result.events;
+
+        return result.wallTime.count() == 0
+                   ? 0.0
+                   : static_cast<double>(events) * 1'000'000'000.0 / static_cast<double>(result.wallTime.count());
+    }
+
+    static void print(const Result &result, bool fromArchive, std::size_t iteration, std::size_t iterations,
+                      bool dumpCsv) {
+        if (dumpCsv) {
+            fmt::println("{},{},{},{},{},{},{},{},{:.2f},{},{},{},{},{},{},{},{}", DXFCXX_VERSION,
+                         fromArchive ? "archive" : "tape", iteration, result.publishedEvents, result.events,
+                         getConflatedEvents(result), result.listenerCalls, formatMillis(result.wallTime),
+                         getRate(result, fromArchive), formatMillis(result.decodeTime),
+                         formatMillis(result.publishTime), formatMillis(result.callbackTime),
+                         formatMillis(result.fromGraalListTime), formatMillis(result.handlerTime),
+                         formatMillis(result.listenerTime), formatMillis(result.modelTime), result.orders);
+
+            return;
+        }
+
+        std::string byType{};
+
+        for (const auto &[name, count] : result.eventsByType) {
+            byType += fmt::format("{}{}={}", byType.empty() ? "" : ", ", name, count);
+        }
+
+        std::cout << "----------------------------------------------------\n";
+        fmt::print("  Iteration                      : {} of {}\n", iteration, iterations);
+
+        if (fromArchive) {
+            fmt::print("  Published events               : {}\n", result.publishedEvents);
+        }
+
+        fmt::print("  Received events                : {} ({})\n", result.events, byType);
+
+        if (fromArchive) {
+            fmt::print("  Conflated events (ticker)      : {}\n", getConflatedEvents(result));
+        }
+
+        fmt::print("  Listener calls                 : {}\n", result.listenerCalls);
+        fmt::print("  Orders in the books            : {}\n", result.orders);
+        fmt::print("  Wall time                      : {} (ms)\n", formatMillis(result.wallTime));
+        fmt::print("  Rate of events                 : {:.2f} (events/s{})\n", getRate(result, fromArchive),
+                   fromArchive ? ", published" : "");
+
+        if (fromArchive) {
+            std::cout << formatStage("Decode (once)", result.decodeTime, result.publishedEvents);
+            std::cout << formatStage("Publish", result.publishTime, result.publishedEvents);
+        }
+
+        std::cout << formatStage("Graal callback (C++ part)", result.callbackTime, result.events);
+        std::cout << formatStage("  fromGraalList", result.fromGraalListTime, result.events);
+        std::cout << formatStage("  Handler", result.handlerTime, result.events);
+        std::cout << formatStage("    Listener", result.listenerTime, result.events);
+        std::cout << formatStage("      Model updates", result.modelTime, result.events);
+        std::cout << "----------------------------------------------------\n";
+    }
+
+    static void run(const Args &args) noexcept {
+        try {
+            using namespace std::literals;
+
+            auto parsedProperties = CmdArgsUtils::parseProperties(args.properties);
+            std::size_t batchSize = 1024; // -p ReplayBench.batchSize
+
+            if (parsedProperties.contains(BATCH_SIZE_PROPERTY_NAME)) {
+                batchSize = std::max<std::size_t>(1, std::stoull(parsedProperties[BATCH_SIZE_PROPERTY_NAME]));
+            }
+
+            std::size_t iterations = 1; // -p ReplayBench.iterations
+
+            if (parsedProperties.contains(ITERATIONS_PROPERTY_NAME)) {
+                iterations = std::max<std::size_t>(1, std::stoull(parsedProperties[ITERATIONS_PROPERTY_NAME]));
+            }
+
+            auto dumpCsv = false;
+
+            if (parsedProperties.contains(FORMAT_NAME)) {
+                dumpCsv = iEquals(parsedProperties[FORMAT_NAME], "csv");
+            }
+
+            System::setProperties(parsedProperties);
+
+            auto [parsedTypes, unknownTypes] = CmdArgsUtils::parseTypes(args.types.value_or("all"));
+
+            if (!unknownTypes.empty()) {
+                auto unknown = elementsToString(unknownTypes.begin(), unknownTypes.end(), "", "");
+
+                throw InvalidArgumentException(
+                    fmt::format("There are unknown event types: {}!\n List of available event types: {}", unknown,
+                                enum_utils::getEventTypeEnumClassNamesList(", ")));
+            }
+
+            const auto fromArchive = isArchive(args.address);
+            auto types = sortTypes(parsedTypes);
+
+            if (fromArchive) {
+                // Only the types that the archive can contain: the others would only add idle subscriptions.
+                std::erase_if(types, [](const auto &type) {
+                    return !EventArchiveWriter::isSupported(type.get());
+                });
+            }
+
+            if (types.empty()) {
+                throw InvalidArgumentException("The resulting list of types is empty!");
+            }
+
+            auto parsedSymbols = CmdArgsUtils::parseSymbols(args.symbols.value_or("all"));
+            std::vector<std::shared_ptr<EventType>> events{};
+            std::chrono::nanoseconds decodeTime{};
+
+            if (fromArchive) {
+                const auto path = args.address.starts_with(ARCHIVE_PREFIX)
+                                      ? args.address.substr(std::char_traits<char>::length(ARCHIVE_PREFIX))
+                                      : args.address;
+                const auto decodeStart = std::chrono::steady_clock::now();
+
+                events = decode(path, types, parsedSymbols);
+                decodeTime = std::chrono::steady_clock::now() - decodeStart;
+            }
+
+            if (dumpCsv) {
+                fmt::println("{}", getCsvHeader());
+            } else {
+                fmt::print("\n{}\n", Platform::getPlatformInfo());
+                fmt::print("  Version                        : {}\n", DXFCXX_VERSION);
+                fmt::print("  Source                         : {}\n",
+                           fromArchive ? args.address : getTapeAddress(args.address));
+            }
+
+            for (std::size_t i = 1; i <= iterations; i++) {
+                auto result = replay(args, parsedProperties, types, parsedSymbols, events, batchSize);
+
+                result.decodeTime = decodeTime;
+                print(result, fromArchive, i, iterations, dumpCsv);
+            }
+        } catch (const RuntimeException &e) {
+            std::cerr << e << '\n';
+        }
+    }
+};
+
+} // namespace dxfcpp::tools
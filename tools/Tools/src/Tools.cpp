@@ -36,8 +36,9 @@ const std::vector<std::string> DumpTool::USAGE{
 };
 const std::vector<std::string> DumpTool::ADDITIONAL_INFO{};
 
-const std::vector<ArgType> DumpTool::ARGS{AddressArgRequired{}, TypesArg{}, SymbolsArg{}, PropertiesArg{}, TapeArg{},
-                                          QuiteArg{},           HelpArg{}};
+const std::vector<ArgType> DumpTool::ARGS{AddressArgRequired{}, TypesArg{},  SymbolsArg{}, PropertiesArg{},
+                                          TapeArg{},            FormatArg{}, OutputArg{},  QuiteArg{},
+                                          HelpArg{}};
 
 const std::string LatencyTest::NAME{"LatencyTest"};
 const std::string LatencyTest::SHORT_DESCRIPTION{"Connects to the specified address(es) and calculates latency."};
@@ -81,6 +82,31 @@ const std::vector<ArgType> PerfTest2Tool::ARGS{
     AddressArgRequired{}, SymbolsArgRequired<1>{}, ForceStreamArg{}, DetachListenerArg{},
     CPUUsageByCoreArg{},  PropertiesArg{},         HelpArg{}};
 
+const std::string ReplayBenchTool::NAME{"ReplayBench"};
+const std::string ReplayBenchTool::SHORT_DESCRIPTION{
+    "Replays a tape or an event archive as fast as possible and measures the pipeline stages."};
+const std::string ReplayBenchTool::DESCRIPTION{R"(
+Replays the recorded tape file or the native event archive (EventArchiveWriter) through a local DXEndpoint as fast as
+possible and measures the end-to-end rate of events and the time of the pipeline stages: decoding and publishing of
+the archive, the C++ part of the Graal callback (fromGraalList and the handler, the library must be built with
+DXFCXX_ENABLE_METRICS), the listener and the order book updates. The inputs are read once and in a fixed order, so
+the results of the different library versions can be compared offline.
+)"};
+const std::vector<std::string> ReplayBenchTool::USAGE{
+    NAME + " <tape-file> [<types> [<symbols>]] [<options>]",
+    NAME + " archive:<archive-file> [<types> [<symbols>]] [<options>]",
+};
+const std::vector<std::string> ReplayBenchTool::ADDITIONAL_INFO{
+    R"(Files with the ".dxea" extension are read as event archives without the "archive:" prefix.)",
+    R"(Use "-p ReplayBench.iterations=<n>" to repeat the replay and "-p ReplayBench.format=csv" to print CSV rows.)",
+    R"(Use "-p ReplayBench.batchSize=<n>" to set the number of the archive events published at once (1024).)",
+    R"(The rate of the archive replay is computed from the published events: the local hub conflates the ticker)"
+    R"( events (Quote, Trade, ...), so fewer of them can be received, which is reported as the conflated events.)",
+};
+
+const std::vector<ArgType> ReplayBenchTool::ARGS{AddressArgRequired{}, TypesArg{}, SymbolsArg{}, PropertiesArg{},
+                                                 HelpArg{}};
+
 const std::string QdsTool::NAME{"Qds"};
 const std::string QdsTool::SHORT_DESCRIPTION{"A collection of tools ported from the Java qds-tools."};
 const std::string QdsTool::DESCRIPTION{R"(
@@ -167,6 +193,13 @@ Connects to the local endpoint, subscribes to TimeAndSale event for ETH/USD:GDAX
 
 Connects to the tape file (on max speed and cyclically), subscribes for all symbols and print performance counters:
   perftest file:tape.csv[speed=max,cycle] all all --force-stream)"},
+    {"ReplayBench", R"(Examples:
+
+Replays the tape file once at maximum speed and prints the rate of events and the time of the stages:
+  replaybench tape.csv
+
+Replays only the Order events of the archive 5 times and prints the results as CSV:
+  replaybench archive:feed.dxea Order all -p ReplayBench.iterations=5,ReplayBench.format=csv)"},
     {"Address",
      R"(To create a connection using any tool one must specify an address. Depending on an address format different message
 connectors are used to establish connection.
@@ -412,6 +445,7 @@ const std::unordered_map<std::string, tools::HelpTool::Tool> tools::HelpTool::AL
     {HelpTool::getName(), HelpTool{}},         {LatencyTest::getName(), LatencyTest{}},
     {PerfTestTool::getName(), PerfTestTool{}}, {PerfTest2Tool::getName(), PerfTest2Tool{}},
     {QdsTool::getName(), QdsTool{}},           {EventGenTool::getName(), EventGenTool{}},
+    {ReplayBenchTool::getName(), ReplayBenchTool{}},
 };
 
 const std::vector<std::string> tools::HelpTool::ALL_TOOL_NAMES =